@@ -68,6 +68,9 @@ enum class SchedulerType
     FrFcfsGrp,
     GrpFrFcfs,
     GrpFrFcfsWm,
+    GrpFrFcfsAdaptiveWm,
+    Bliss,
+    ParBs,
     Invalid = -1
 };
 
@@ -77,7 +80,10 @@ NLOHMANN_JSON_SERIALIZE_ENUM(SchedulerType,
                               {SchedulerType::FrFcfs, "FrFcfs"},
                               {SchedulerType::FrFcfsGrp, "FrFcfsGrp"},
                               {SchedulerType::GrpFrFcfs, "GrpFrFcfs"},
-                              {SchedulerType::GrpFrFcfsWm, "GrpFrFcfsWm"}})
+                              {SchedulerType::GrpFrFcfsWm, "GrpFrFcfsWm"},
+                              {SchedulerType::GrpFrFcfsAdaptiveWm, "GrpFrFcfsAdaptiveWm"},
+                              {SchedulerType::Bliss, "Bliss"},
+                              {SchedulerType::ParBs, "ParBs"}})
 
 enum class SchedulerBufferType
 {
@@ -97,13 +103,15 @@ enum class CmdMuxType
 {
     Oldest,
     Strict,
+    BankGroup,
     Invalid = -1
 };
 
 NLOHMANN_JSON_SERIALIZE_ENUM(CmdMuxType,
                              {{CmdMuxType::Invalid, nullptr},
                               {CmdMuxType::Oldest, "Oldest"},
-                              {CmdMuxType::Strict, "Strict"}})
+                              {CmdMuxType::Strict, "Strict"},
+                              {CmdMuxType::BankGroup, "BankGroup"}})
 
 enum class RespQueueType
 {
@@ -121,6 +129,8 @@ enum class RefreshPolicyType
 {
     NoRefresh,
     AllBank,
+    AllBank2x,
+    AllBank4x,
     PerBank,
     Per2Bank,
     SameBank,
@@ -131,6 +141,8 @@ NLOHMANN_JSON_SERIALIZE_ENUM(RefreshPolicyType,
                              {{RefreshPolicyType::Invalid, nullptr},
                               {RefreshPolicyType::NoRefresh, "NoRefresh"},
                               {RefreshPolicyType::AllBank, "AllBank"},
+                              {RefreshPolicyType::AllBank2x, "AllBank2x"},
+                              {RefreshPolicyType::AllBank4x, "AllBank4x"},
                               {RefreshPolicyType::PerBank, "PerBank"},
                               {RefreshPolicyType::Per2Bank, "Per2Bank"},
                               {RefreshPolicyType::SameBank, "SameBank"},
@@ -141,17 +153,33 @@ NLOHMANN_JSON_SERIALIZE_ENUM(RefreshPolicyType,
                               {RefreshPolicyType::PerBank, "Bankwise"},
                               {RefreshPolicyType::SameBank, "Groupwise"}})
 
+enum class RefreshFlexibilityType
+{
+    Opportunistic,
+    Elastic,
+    Invalid = -1
+};
+
+NLOHMANN_JSON_SERIALIZE_ENUM(RefreshFlexibilityType,
+                             {{RefreshFlexibilityType::Invalid, nullptr},
+                              {RefreshFlexibilityType::Opportunistic, "Opportunistic"},
+                              {RefreshFlexibilityType::Elastic, "Elastic"}})
+
 enum class PowerDownPolicyType
 {
     NoPowerDown,
     Staggered,
+    Timeout,
+    Predictive,
     Invalid = -1
 };
 
 NLOHMANN_JSON_SERIALIZE_ENUM(PowerDownPolicyType,
                              {{PowerDownPolicyType::Invalid, nullptr},
                               {PowerDownPolicyType::NoPowerDown, "NoPowerDown"},
-                              {PowerDownPolicyType::Staggered, "Staggered"}})
+                              {PowerDownPolicyType::Staggered, "Staggered"},
+                              {PowerDownPolicyType::Timeout, "Timeout"},
+                              {PowerDownPolicyType::Predictive, "Predictive"}})
 
 enum class ArbiterType
 {
@@ -175,6 +203,9 @@ struct McConfig
     std::optional<SchedulerType> Scheduler;
     std::optional<unsigned int> HighWatermark;
     std::optional<unsigned int> LowWatermark;
+    std::optional<unsigned int> BlacklistingThreshold;
+    std::optional<unsigned int> BlacklistingClearingInterval;
+    std::optional<unsigned int> BatchMarkingCap;
     std::optional<SchedulerBufferType> SchedulerBuffer;
     std::optional<unsigned int> RequestBufferSize;
     std::optional<unsigned int> RequestBufferSizeRead;
@@ -184,9 +215,15 @@ struct McConfig
     std::optional<RefreshPolicyType> RefreshPolicy;
     std::optional<unsigned int> RefreshMaxPostponed;
     std::optional<unsigned int> RefreshMaxPulledin;
+    std::optional<RefreshFlexibilityType> RefreshFlexibility;
+    std::optional<unsigned int> ElasticRefreshThreshold;
+    std::optional<unsigned int> ElasticRefreshIdleDelay;
     std::optional<PowerDownPolicyType> PowerDownPolicy;
+    std::optional<unsigned int> PowerDownTimeout;
+    std::optional<unsigned int> SelfRefreshTimeout;
     std::optional<ArbiterType> Arbiter;
     std::optional<unsigned int> MaxActiveTransactions;
+    std::optional<unsigned int> ChannelRequestSlots;
     std::optional<bool> RefreshManagement;
     std::optional<unsigned int> ArbitrationDelayFw;
     std::optional<unsigned int> ArbitrationDelayBw;
@@ -203,6 +240,9 @@ NLOHMANN_JSONIFY_ALL_THINGS(McConfig,
                             Scheduler,
                             HighWatermark,
                             LowWatermark,
+                            BlacklistingThreshold,
+                            BlacklistingClearingInterval,
+                            BatchMarkingCap,
                             SchedulerBuffer,
                             RequestBufferSize,
                             RequestBufferSizeRead,
@@ -212,9 +252,15 @@ NLOHMANN_JSONIFY_ALL_THINGS(McConfig,
                             RefreshPolicy,
                             RefreshMaxPostponed,
                             RefreshMaxPulledin,
+                            RefreshFlexibility,
+                            ElasticRefreshThreshold,
+                            ElasticRefreshIdleDelay,
                             PowerDownPolicy,
+                            PowerDownTimeout,
+                            SelfRefreshTimeout,
                             Arbiter,
                             MaxActiveTransactions,
+                            ChannelRequestSlots,
                             RefreshManagement,
                             ArbitrationDelayFw,
                             ArbitrationDelayBw,
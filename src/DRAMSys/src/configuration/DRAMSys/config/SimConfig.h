@@ -40,6 +40,7 @@
 #include <DRAMUtils/config/toggling_rate.h>
 
 #include <optional>
+#include <vector>
 
 namespace DRAMSys::Config
 {
@@ -56,6 +57,77 @@ NLOHMANN_JSON_SERIALIZE_ENUM(StoreModeType,
                               {StoreModeType::NoStorage, "NoStorage"},
                               {StoreModeType::Store, "Store"}})
 
+enum class StorageBackendType
+{
+    Flat,
+    Sparse,
+    SharedMemory,
+    File,
+    Invalid = -1
+};
+
+NLOHMANN_JSON_SERIALIZE_ENUM(StorageBackendType,
+                             {{StorageBackendType::Invalid, nullptr},
+                              {StorageBackendType::Flat, "Flat"},
+                              {StorageBackendType::Sparse, "Sparse"},
+                              {StorageBackendType::SharedMemory, "SharedMemory"},
+                              {StorageBackendType::File, "File"}})
+
+enum class RecordingFormatType
+{
+    SQLite,
+    Columnar,
+    Invalid = -1
+};
+
+NLOHMANN_JSON_SERIALIZE_ENUM(RecordingFormatType,
+                             {{RecordingFormatType::Invalid, nullptr},
+                              {RecordingFormatType::SQLite, "SQLite"},
+                              {RecordingFormatType::Columnar, "Columnar"}})
+
+enum class RecordingModeType
+{
+    Full,
+    CommandsOnly,
+    Invalid = -1
+};
+
+NLOHMANN_JSON_SERIALIZE_ENUM(RecordingModeType,
+                             {{RecordingModeType::Invalid, nullptr},
+                              {RecordingModeType::Full, "Full"},
+                              {RecordingModeType::CommandsOnly, "CommandsOnly"}})
+
+enum class MetricsExportType
+{
+    None,
+    CSV,
+    JSONLines,
+    Invalid = -1
+};
+
+NLOHMANN_JSON_SERIALIZE_ENUM(MetricsExportType,
+                             {{MetricsExportType::Invalid, nullptr},
+                              {MetricsExportType::None, "None"},
+                              {MetricsExportType::CSV, "CSV"},
+                              {MetricsExportType::JSONLines, "JSONLines"}})
+
+struct AddressRange
+{
+    uint64_t Start;
+    uint64_t End;
+};
+
+NLOHMANN_JSONIFY_ALL_THINGS(AddressRange, Start, End)
+
+struct RecordingFilterConfig
+{
+    std::optional<std::vector<unsigned int>> Threads;
+    std::optional<std::vector<unsigned int>> Banks;
+    std::optional<std::vector<AddressRange>> AddressRanges;
+};
+
+NLOHMANN_JSONIFY_ALL_THINGS(RecordingFilterConfig, Threads, Banks, AddressRanges)
+
 struct SimConfig
 {
     static constexpr std::string_view KEY = "simconfig";
@@ -65,10 +137,21 @@ struct SimConfig
     std::optional<bool> DatabaseRecording;
     std::optional<bool> Debug;
     std::optional<bool> EnableWindowing;
+    std::optional<MetricsExportType> MetricsExport;
+    std::optional<std::string> MetricsOutput;
     std::optional<bool> PowerAnalysis;
+    std::optional<RecordingFilterConfig> RecordingFilter;
+    std::optional<RecordingFormatType> RecordingFormat;
+    std::optional<RecordingModeType> RecordingMode;
+    std::optional<unsigned int> RecordingSampling;
+    std::optional<double> RecordingStart;
+    std::optional<double> RecordingStop;
     std::optional<std::string> SimulationName;
     std::optional<bool> SimulationProgressBar;
     std::optional<StoreModeType> StoreMode;
+    std::optional<StorageBackendType> StorageBackend;
+    std::optional<uint64_t> StoragePageSize;
+    std::optional<std::string> StoragePath;
     std::optional<bool> ThermalSimulation;
     std::optional<bool> UseMalloc;
     std::optional<unsigned int> WindowSize;
@@ -82,10 +165,21 @@ NLOHMANN_JSONIFY_ALL_THINGS(SimConfig,
                             DatabaseRecording,
                             Debug,
                             EnableWindowing,
+                            MetricsExport,
+                            MetricsOutput,
                             PowerAnalysis,
+                            RecordingFilter,
+                            RecordingFormat,
+                            RecordingMode,
+                            RecordingSampling,
+                            RecordingStart,
+                            RecordingStop,
                             SimulationName,
                             SimulationProgressBar,
                             StoreMode,
+                            StorageBackend,
+                            StoragePageSize,
+                            StoragePath,
                             ThermalSimulation,
                             UseMalloc,
                             WindowSize,
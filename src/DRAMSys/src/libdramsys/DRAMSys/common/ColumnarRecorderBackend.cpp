@@ -0,0 +1,336 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "ColumnarRecorderBackend.h"
+
+#include <filesystem>
+
+#ifdef DRAMSYS_HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+using namespace sc_core;
+
+namespace DRAMSys
+{
+
+using ColumnarTrace::BlockType;
+using ColumnarTrace::Compression;
+using ColumnarTrace::Encoder;
+
+ColumnarRecorderBackend::ColumnarRecorderBackend(const std::string& fileName,
+                                                 const RecordingInfo& info)
+{
+    std::filesystem::remove(fileName);
+    file.open(fileName, std::ios::binary);
+    if (!file)
+        SC_REPORT_FATAL("ColumnarRecorderBackend", ("Cannot open file " + fileName).c_str());
+
+    file.write(ColumnarTrace::MAGIC, sizeof(ColumnarTrace::MAGIC));
+    Encoder header;
+    header.putFixed32(ColumnarTrace::VERSION);
+    file.write(reinterpret_cast<const char*>(header.data().data()),
+               static_cast<std::streamsize>(header.size()));
+
+    Encoder generalInfo;
+    generalInfo.putVarint(info.numberOfRanks);
+    generalInfo.putVarint(info.numberOfBankGroups);
+    generalInfo.putVarint(info.numberOfBanks);
+    generalInfo.putVarint(info.clk);
+    generalInfo.putString(info.mcConfig);
+    generalInfo.putString(info.memSpec);
+    generalInfo.putString(info.traces);
+    generalInfo.putVarint(info.windowSize);
+    generalInfo.putVarint(info.refreshMaxPostponed);
+    generalInfo.putVarint(info.refreshMaxPulledin);
+    generalInfo.putVarint(info.maxBufferDepth);
+    generalInfo.putVarint(info.per2BankOffset);
+    generalInfo.putByte(static_cast<uint8_t>(info.rowColumnCommandBus));
+    generalInfo.putByte(static_cast<uint8_t>(info.pseudoChannelMode));
+    generalInfo.putVarint(info.commandLengths.size());
+    for (const auto& [commandName, length] : info.commandLengths)
+    {
+        generalInfo.putString(commandName);
+        generalInfo.putDouble(length);
+    }
+    writeBlock(BlockType::GeneralInfo, generalInfo);
+}
+
+ColumnarRecorderBackend::~ColumnarRecorderBackend()
+{
+    close();
+}
+
+void ColumnarRecorderBackend::writeTransactions(RecordedTransactions transactions)
+{
+    if (transactions.empty())
+        return;
+
+    Encoder newNames;
+    uint64_t namesBefore = numberOfPhaseNames;
+    uint64_t numberOfPhases = 0;
+    transactionColumns.clear();
+    phaseColumns.clear();
+
+    transactionColumns.putVarint(transactions.size());
+
+    uint64_t previous = 0;
+    for (const auto& transaction : transactions)
+    {
+        transactionColumns.putSigned(static_cast<int64_t>(transaction.id - previous));
+        previous = transaction.id;
+    }
+    previous = 0;
+    for (const auto& transaction : transactions)
+    {
+        transactionColumns.putSigned(static_cast<int64_t>(transaction.address - previous));
+        previous = transaction.address;
+    }
+    for (const auto& transaction : transactions)
+        transactionColumns.putVarint(transaction.dataLength);
+    for (const auto& transaction : transactions)
+        transactionColumns.putByte(static_cast<uint8_t>(transaction.cmd));
+    previous = 0;
+    for (const auto& transaction : transactions)
+    {
+        transactionColumns.putSigned(
+            static_cast<int64_t>(transaction.timeOfGeneration.value() - previous));
+        previous = transaction.timeOfGeneration.value();
+    }
+    for (const auto& transaction : transactions)
+        transactionColumns.putVarint(static_cast<uint64_t>(transaction.thread));
+    for (const auto& transaction : transactions)
+        transactionColumns.putVarint(static_cast<uint64_t>(transaction.channel));
+    for (const auto& transaction : transactions)
+    {
+        transactionColumns.putVarint(transaction.recordedPhases.size());
+        numberOfPhases += transaction.recordedPhases.size();
+    }
+
+    // Applies encode to every phase of the block, which produces one column
+    auto forEachPhase = [&transactions](auto encode)
+    {
+        for (const auto& transaction : transactions)
+            for (const auto& phase : transaction.recordedPhases)
+                encode(phase);
+    };
+
+    forEachPhase(
+        [&](const RecordedTransaction::Phase& phase)
+        { phaseColumns.putVarint(phaseNameId(phase.phase, newNames)); });
+    previous = 0;
+    forEachPhase(
+        [&](const RecordedTransaction::Phase& phase)
+        {
+            phaseColumns.putSigned(static_cast<int64_t>(phase.interval.start.value() - previous));
+            previous = phase.interval.start.value();
+        });
+    forEachPhase(
+        [&](const RecordedTransaction::Phase& phase)
+        {
+            phaseColumns.putSigned(
+                static_cast<int64_t>(phase.interval.end.value() - phase.interval.start.value()));
+        });
+    // Most phases have no data strobe interval, 0 marks them and saves the length entry
+    auto hasDataStrobe = [](const RecordedTransaction::Phase& phase)
+    {
+        return phase.intervalOnDataStrobe.start != SC_ZERO_TIME ||
+               phase.intervalOnDataStrobe.end != SC_ZERO_TIME;
+    };
+    forEachPhase(
+        [&](const RecordedTransaction::Phase& phase)
+        {
+            if (!hasDataStrobe(phase))
+            {
+                phaseColumns.putVarint(0);
+                return;
+            }
+            int64_t offset = static_cast<int64_t>(phase.intervalOnDataStrobe.start.value() -
+                                                  phase.interval.start.value());
+            phaseColumns.putVarint(((static_cast<uint64_t>(offset) << 1) ^
+                                    static_cast<uint64_t>(offset >> 63)) +
+                                   1);
+        });
+    forEachPhase(
+        [&](const RecordedTransaction::Phase& phase)
+        {
+            if (hasDataStrobe(phase))
+            {
+                phaseColumns.putSigned(
+                    static_cast<int64_t>(phase.intervalOnDataStrobe.end.value() -
+                                         phase.intervalOnDataStrobe.start.value()));
+            }
+        });
+    forEachPhase([&](const RecordedTransaction::Phase& phase)
+                 { phaseColumns.putVarint(static_cast<uint64_t>(phase.rank)); });
+    forEachPhase([&](const RecordedTransaction::Phase& phase)
+                 { phaseColumns.putVarint(static_cast<uint64_t>(phase.bankGroup)); });
+    forEachPhase([&](const RecordedTransaction::Phase& phase)
+                 { phaseColumns.putVarint(static_cast<uint64_t>(phase.bank)); });
+    forEachPhase([&](const RecordedTransaction::Phase& phase)
+                 { phaseColumns.putVarint(static_cast<uint64_t>(phase.row)); });
+    forEachPhase([&](const RecordedTransaction::Phase& phase)
+                 { phaseColumns.putVarint(static_cast<uint64_t>(phase.column)); });
+    forEachPhase([&](const RecordedTransaction::Phase& phase)
+                 { phaseColumns.putVarint(phase.burstLength); });
+
+    transactionColumns.append(phaseColumns);
+
+    if (numberOfPhaseNames != namesBefore)
+    {
+        Encoder names;
+        names.putVarint(numberOfPhaseNames - namesBefore);
+        names.append(newNames);
+        writeBlock(BlockType::PhaseNames, names);
+    }
+    writeBlock(BlockType::Transactions, transactionColumns);
+}
+
+void ColumnarRecorderBackend::writePower(double timeInSeconds, double averagePower)
+{
+    power.encoder.putDouble(timeInSeconds);
+    power.encoder.putDouble(averagePower);
+    append(power);
+}
+
+void ColumnarRecorderBackend::writeBufferDepth(double timeInSeconds,
+                                               const std::vector<double>& averageBufferDepth)
+{
+    bufferDepth.encoder.putDouble(timeInSeconds);
+    bufferDepth.encoder.putVarint(averageBufferDepth.size());
+    for (double depth : averageBufferDepth)
+        bufferDepth.encoder.putDouble(depth);
+    append(bufferDepth);
+}
+
+void ColumnarRecorderBackend::writeBandwidth(double timeInSeconds, double averageBandwidth)
+{
+    bandwidth.encoder.putDouble(timeInSeconds);
+    bandwidth.encoder.putDouble(averageBandwidth);
+    append(bandwidth);
+}
+
+void ColumnarRecorderBackend::writeDebugMessage(const std::string& message, const sc_time& time)
+{
+    debugMessages.encoder.putSigned(static_cast<int64_t>(time.value() - lastDebugMessageTime));
+    debugMessages.encoder.putString(message);
+    lastDebugMessageTime = time.value();
+    append(debugMessages);
+}
+
+void ColumnarRecorderBackend::close()
+{
+    if (!file.is_open())
+        return;
+
+    flush(power);
+    flush(bufferDepth);
+    flush(bandwidth);
+    flush(debugMessages);
+    writeBlock(BlockType::End, Encoder());
+    file.close();
+}
+
+void ColumnarRecorderBackend::append(RecordBuffer& records)
+{
+    records.count++;
+    if (records.encoder.size() >= recordBufferSize)
+        flush(records);
+}
+
+void ColumnarRecorderBackend::flush(RecordBuffer& records)
+{
+    if (records.count == 0)
+        return;
+
+    Encoder payload;
+    payload.putVarint(records.count);
+    payload.append(records.encoder);
+    writeBlock(records.type, payload);
+
+    records.encoder.clear();
+    records.count = 0;
+}
+
+uint64_t ColumnarRecorderBackend::phaseNameId(const tlm::tlm_phase& phase, Encoder& newNames)
+{
+    if (phaseNameIds.size() <= phase)
+        phaseNameIds.resize(phase + 1, UINT64_MAX);
+
+    if (phaseNameIds[phase] == UINT64_MAX)
+    {
+        phaseNameIds[phase] = numberOfPhaseNames++;
+        newNames.putString(getRecordedPhaseName(phase));
+    }
+    return phaseNameIds[phase];
+}
+
+void ColumnarRecorderBackend::writeBlock(BlockType type, const Encoder& payload)
+{
+    const uint8_t* data = payload.data().data();
+    std::size_t storedSize = payload.size();
+    Compression compression = Compression::None;
+
+#ifdef DRAMSYS_HAVE_ZLIB
+    // Compression runs outside of the lock, the storage thread does the bulk of the work
+    std::vector<uint8_t> compressed;
+    if (payload.size() > 64)
+    {
+        uLongf compressedSize = compressBound(static_cast<uLong>(payload.size()));
+        compressed.resize(compressedSize);
+        if (compress2(compressed.data(),
+                      &compressedSize,
+                      data,
+                      static_cast<uLong>(payload.size()),
+                      Z_BEST_SPEED) == Z_OK &&
+            compressedSize < payload.size())
+        {
+            data = compressed.data();
+            storedSize = compressedSize;
+            compression = Compression::Zlib;
+        }
+    }
+#endif
+
+    Encoder header;
+    header.putByte(static_cast<uint8_t>(type));
+    header.putByte(static_cast<uint8_t>(compression));
+    header.putFixed32(static_cast<uint32_t>(payload.size()));
+    header.putFixed32(static_cast<uint32_t>(storedSize));
+
+    std::lock_guard<std::mutex> lock(fileMutex);
+    file.write(reinterpret_cast<const char*>(header.data().data()),
+               static_cast<std::streamsize>(header.size()));
+    file.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(storedSize));
+}
+
+} // namespace DRAMSys
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef COLUMNARRECORDERBACKEND_H
+#define COLUMNARRECORDERBACKEND_H
+
+#include "DRAMSys/common/ColumnarTraceFormat.h"
+#include "DRAMSys/common/RecorderBackendIF.h"
+
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace DRAMSys
+{
+
+// Writes the transactions as compressed column blocks, see ColumnarTraceFormat.h. The
+// TraceConverter tool turns the file into a trace database.
+class ColumnarRecorderBackend final : public RecorderBackendIF
+{
+public:
+    ColumnarRecorderBackend(const std::string& fileName, const RecordingInfo& info);
+    ColumnarRecorderBackend(const ColumnarRecorderBackend&) = delete;
+    ColumnarRecorderBackend(ColumnarRecorderBackend&&) = delete;
+    ColumnarRecorderBackend& operator=(const ColumnarRecorderBackend&) = delete;
+    ColumnarRecorderBackend& operator=(ColumnarRecorderBackend&&) = delete;
+    ~ColumnarRecorderBackend() override;
+
+    void writeTransactions(RecordedTransactions transactions) override;
+    void writePower(double timeInSeconds, double averagePower) override;
+    void writeBufferDepth(double timeInSeconds,
+                          const std::vector<double>& averageBufferDepth) override;
+    void writeBandwidth(double timeInSeconds, double averageBandwidth) override;
+    void writeDebugMessage(const std::string& message, const sc_core::sc_time& time) override;
+    void close() override;
+
+private:
+    // Small records are collected and written as one block when the buffer is full
+    struct RecordBuffer
+    {
+        ColumnarTrace::BlockType type;
+        ColumnarTrace::Encoder encoder;
+        uint64_t count = 0;
+    };
+
+    void append(RecordBuffer& records);
+    void flush(RecordBuffer& records);
+    void writeBlock(ColumnarTrace::BlockType type, const ColumnarTrace::Encoder& payload);
+
+    uint64_t phaseNameId(const tlm::tlm_phase& phase, ColumnarTrace::Encoder& newNames);
+
+    static constexpr std::size_t recordBufferSize = 64 * 1024;
+
+    std::ofstream file;
+    std::mutex fileMutex;
+
+    // Only accessed by the storage thread of the recorder
+    // File ids of the phase names indexed by the phase id
+    std::vector<uint64_t> phaseNameIds;
+    uint64_t numberOfPhaseNames = 0;
+    ColumnarTrace::Encoder transactionColumns;
+    ColumnarTrace::Encoder phaseColumns;
+    ColumnarTrace::Encoder column;
+
+    RecordBuffer power{ColumnarTrace::BlockType::Power, {}};
+    RecordBuffer bufferDepth{ColumnarTrace::BlockType::BufferDepth, {}};
+    RecordBuffer bandwidth{ColumnarTrace::BlockType::Bandwidth, {}};
+    RecordBuffer debugMessages{ColumnarTrace::BlockType::DebugMessages, {}};
+    uint64_t lastDebugMessageTime = 0;
+};
+
+} // namespace DRAMSys
+
+#endif // COLUMNARRECORDERBACKEND_H
@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef COLUMNARTRACEFORMAT_H
+#define COLUMNARTRACEFORMAT_H
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace DRAMSys::ColumnarTrace
+{
+
+// File layout:
+//   "DRAMSYSC" | version (u32)
+//   block*     | type (u8) | compression (u8) | raw size (u32) | stored size (u32) | payload
+//
+// The first block holds the general info, the last block marks the end of the file. A
+// transactions block stores each field as a column of varints, ids and times are delta encoded
+// and phase names refer to the ids of the preceding phase name blocks. Fixed size values are
+// stored little-endian.
+constexpr char MAGIC[8] = {'D', 'R', 'A', 'M', 'S', 'Y', 'S', 'C'};
+constexpr uint32_t VERSION = 1;
+constexpr std::size_t BLOCK_HEADER_SIZE = 10;
+
+enum class BlockType : uint8_t
+{
+    GeneralInfo = 1,
+    PhaseNames = 2,
+    Transactions = 3,
+    Power = 4,
+    BufferDepth = 5,
+    Bandwidth = 6,
+    DebugMessages = 7,
+    End = 8
+};
+
+enum class Compression : uint8_t
+{
+    None = 0,
+    Zlib = 1
+};
+
+class Encoder
+{
+public:
+    void putByte(uint8_t value) { buffer.push_back(value); }
+
+    void putVarint(uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            buffer.push_back(static_cast<uint8_t>(value) | 0x80);
+            value >>= 7;
+        }
+        buffer.push_back(static_cast<uint8_t>(value));
+    }
+
+    // Zigzag encoding keeps small negative deltas short
+    void putSigned(int64_t value)
+    {
+        putVarint((static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+    }
+
+    void putFixed32(uint32_t value)
+    {
+        for (unsigned shift = 0; shift < 32; shift += 8)
+            buffer.push_back(static_cast<uint8_t>(value >> shift));
+    }
+
+    void putDouble(double value)
+    {
+        uint64_t bits = 0;
+        std::memcpy(&bits, &value, sizeof(bits));
+        for (unsigned shift = 0; shift < 64; shift += 8)
+            buffer.push_back(static_cast<uint8_t>(bits >> shift));
+    }
+
+    void putString(const std::string& value)
+    {
+        putVarint(value.size());
+        buffer.insert(buffer.end(), value.begin(), value.end());
+    }
+
+    void append(const Encoder& other)
+    {
+        buffer.insert(buffer.end(), other.buffer.begin(), other.buffer.end());
+    }
+
+    void clear() { buffer.clear(); }
+    [[nodiscard]] std::size_t size() const { return buffer.size(); }
+    [[nodiscard]] const std::vector<uint8_t>& data() const { return buffer; }
+
+private:
+    std::vector<uint8_t> buffer;
+};
+
+class Decoder
+{
+public:
+    Decoder(const uint8_t* data, std::size_t size) : position(data), end(data + size) {}
+
+    uint8_t getByte()
+    {
+        require(1);
+        return *position++;
+    }
+
+    uint64_t getVarint()
+    {
+        uint64_t value = 0;
+        for (unsigned shift = 0; shift < 64; shift += 7)
+        {
+            uint8_t byte = getByte();
+            value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+            if ((byte & 0x80) == 0)
+                return value;
+        }
+        throw std::runtime_error("Malformed varint");
+    }
+
+    int64_t getSigned()
+    {
+        uint64_t value = getVarint();
+        return static_cast<int64_t>((value >> 1) ^ (~(value & 1) + 1));
+    }
+
+    uint32_t getFixed32()
+    {
+        require(4);
+        uint32_t value = 0;
+        for (unsigned shift = 0; shift < 32; shift += 8)
+            value |= static_cast<uint32_t>(*position++) << shift;
+        return value;
+    }
+
+    double getDouble()
+    {
+        require(8);
+        uint64_t bits = 0;
+        for (unsigned shift = 0; shift < 64; shift += 8)
+            bits |= static_cast<uint64_t>(*position++) << shift;
+        double value = 0;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    std::string getString()
+    {
+        uint64_t length = getVarint();
+        require(length);
+        std::string value(reinterpret_cast<const char*>(position), length);
+        position += length;
+        return value;
+    }
+
+    [[nodiscard]] bool atEnd() const { return position == end; }
+
+private:
+    void require(uint64_t bytes) const
+    {
+        if (bytes > static_cast<uint64_t>(end - position))
+            throw std::runtime_error("Unexpected end of block");
+    }
+
+    const uint8_t* position;
+    const uint8_t* end;
+};
+
+} // namespace DRAMSys::ColumnarTrace
+
+#endif // COLUMNARTRACEFORMAT_H
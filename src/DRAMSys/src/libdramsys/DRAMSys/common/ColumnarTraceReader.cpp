@@ -0,0 +1,326 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "ColumnarTraceReader.h"
+
+#include <stdexcept>
+
+#ifdef DRAMSYS_HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+using namespace sc_core;
+
+namespace DRAMSys
+{
+
+using ColumnarTrace::BlockType;
+using ColumnarTrace::Compression;
+using ColumnarTrace::Decoder;
+
+ColumnarTraceReader::ColumnarTraceReader(const std::string& fileName) :
+    file(fileName, std::ios::binary)
+{
+    if (!file)
+        throw std::runtime_error("Cannot open file " + fileName);
+
+    char magic[sizeof(ColumnarTrace::MAGIC)] = {};
+    uint8_t version[4] = {};
+    file.read(magic, sizeof(magic));
+    file.read(reinterpret_cast<char*>(version), sizeof(version));
+    if (!file || std::string(magic, sizeof(magic)) !=
+                     std::string(ColumnarTrace::MAGIC, sizeof(ColumnarTrace::MAGIC)))
+        throw std::runtime_error(fileName + " is not a columnar trace");
+    if (Decoder(version, sizeof(version)).getFixed32() != ColumnarTrace::VERSION)
+        throw std::runtime_error(fileName + " has an unsupported version");
+
+    BlockType type{};
+    std::vector<uint8_t> payload;
+    if (!readBlock(type, payload) || type != BlockType::GeneralInfo)
+        throw std::runtime_error(fileName + " does not start with the general info");
+
+    Decoder decoder(payload.data(), payload.size());
+    info.numberOfRanks = static_cast<unsigned>(decoder.getVarint());
+    info.numberOfBankGroups = static_cast<unsigned>(decoder.getVarint());
+    info.numberOfBanks = static_cast<unsigned>(decoder.getVarint());
+    info.clk = decoder.getVarint();
+    info.mcConfig = decoder.getString();
+    info.memSpec = decoder.getString();
+    info.traces = decoder.getString();
+    info.windowSize = decoder.getVarint();
+    info.refreshMaxPostponed = static_cast<unsigned>(decoder.getVarint());
+    info.refreshMaxPulledin = static_cast<unsigned>(decoder.getVarint());
+    info.maxBufferDepth = static_cast<unsigned>(decoder.getVarint());
+    info.per2BankOffset = static_cast<unsigned>(decoder.getVarint());
+    info.rowColumnCommandBus = decoder.getByte() != 0;
+    info.pseudoChannelMode = decoder.getByte() != 0;
+    uint64_t numberOfCommands = decoder.getVarint();
+    for (uint64_t command = 0; command < numberOfCommands; command++)
+    {
+        std::string commandName = decoder.getString();
+        double length = decoder.getDouble();
+        info.commandLengths.emplace_back(std::move(commandName), length);
+    }
+}
+
+void ColumnarTraceReader::replay(RecorderBackendIF& backend)
+{
+    BlockType type{};
+    std::vector<uint8_t> payload;
+    uint64_t debugMessageTime = 0;
+
+    while (readBlock(type, payload))
+    {
+        Decoder decoder(payload.data(), payload.size());
+        switch (type)
+        {
+        case BlockType::PhaseNames:
+        {
+            uint64_t count = decoder.getVarint();
+            for (uint64_t name = 0; name < count; name++)
+            {
+                std::string phaseName = decoder.getString();
+                tlm::tlm_phase phase = findRecordedPhase(phaseName);
+                if (phase == tlm::UNINITIALIZED_PHASE)
+                    throw std::runtime_error("Unknown phase " + phaseName);
+                phases.push_back(phase);
+            }
+            break;
+        }
+        case BlockType::Transactions:
+        {
+            std::vector<RecordedTransaction> transactions = decodeTransactions(decoder);
+            backend.writeTransactions({transactions.data(), transactions.size()});
+            break;
+        }
+        case BlockType::Power:
+        case BlockType::Bandwidth:
+        {
+            uint64_t count = decoder.getVarint();
+            for (uint64_t record = 0; record < count; record++)
+            {
+                double time = decoder.getDouble();
+                double value = decoder.getDouble();
+                if (type == BlockType::Power)
+                    backend.writePower(time, value);
+                else
+                    backend.writeBandwidth(time, value);
+            }
+            break;
+        }
+        case BlockType::BufferDepth:
+        {
+            uint64_t count = decoder.getVarint();
+            std::vector<double> depths;
+            for (uint64_t record = 0; record < count; record++)
+            {
+                double time = decoder.getDouble();
+                depths.resize(decoder.getVarint());
+                for (double& depth : depths)
+                    depth = decoder.getDouble();
+                backend.writeBufferDepth(time, depths);
+            }
+            break;
+        }
+        case BlockType::DebugMessages:
+        {
+            uint64_t count = decoder.getVarint();
+            for (uint64_t record = 0; record < count; record++)
+            {
+                debugMessageTime += static_cast<uint64_t>(decoder.getSigned());
+                std::string message = decoder.getString();
+                backend.writeDebugMessage(message, sc_time::from_value(debugMessageTime));
+            }
+            break;
+        }
+        case BlockType::End:
+            return;
+        default:
+            throw std::runtime_error("Unknown block type " +
+                                     std::to_string(static_cast<unsigned>(type)));
+        }
+    }
+
+    throw std::runtime_error("Unexpected end of file, the recording was not closed");
+}
+
+bool ColumnarTraceReader::readBlock(BlockType& type, std::vector<uint8_t>& payload)
+{
+    uint8_t header[ColumnarTrace::BLOCK_HEADER_SIZE];
+    if (!file.read(reinterpret_cast<char*>(header), sizeof(header)))
+        return false;
+
+    Decoder decoder(header, sizeof(header));
+    type = static_cast<BlockType>(decoder.getByte());
+    auto compression = static_cast<Compression>(decoder.getByte());
+    uint32_t rawSize = decoder.getFixed32();
+    uint32_t storedSize = decoder.getFixed32();
+
+    std::vector<uint8_t> stored(storedSize);
+    if (!file.read(reinterpret_cast<char*>(stored.data()), storedSize))
+        throw std::runtime_error("Truncated block");
+
+    if (compression == Compression::None)
+    {
+        payload = std::move(stored);
+        return true;
+    }
+
+#ifdef DRAMSYS_HAVE_ZLIB
+    if (compression == Compression::Zlib)
+    {
+        payload.resize(rawSize);
+        uLongf size = rawSize;
+        if (uncompress(payload.data(), &size, stored.data(), storedSize) != Z_OK ||
+            size != rawSize)
+            throw std::runtime_error("Corrupted compressed block");
+        return true;
+    }
+#endif
+
+    throw std::runtime_error("Unsupported block compression " +
+                             std::to_string(static_cast<unsigned>(compression)));
+}
+
+std::vector<RecordedTransaction> ColumnarTraceReader::decodeTransactions(Decoder& decoder) const
+{
+    std::vector<RecordedTransaction> transactions;
+    std::size_t count = decoder.getVarint();
+    transactions.reserve(count);
+
+    std::vector<uint64_t> ids(count), addresses(count), times(count);
+    uint64_t previous = 0;
+    for (auto& id : ids)
+        previous = id = previous + static_cast<uint64_t>(decoder.getSigned());
+    previous = 0;
+    for (auto& address : addresses)
+        previous = address = previous + static_cast<uint64_t>(decoder.getSigned());
+    std::vector<unsigned> dataLengths(count);
+    for (auto& dataLength : dataLengths)
+        dataLength = static_cast<unsigned>(decoder.getVarint());
+    std::vector<char> commands(count);
+    for (auto& command : commands)
+        command = static_cast<char>(decoder.getByte());
+    previous = 0;
+    for (auto& time : times)
+        previous = time = previous + static_cast<uint64_t>(decoder.getSigned());
+    std::vector<uint64_t> threads(count), channels(count), phaseCounts(count);
+    for (auto& thread : threads)
+        thread = decoder.getVarint();
+    for (auto& channel : channels)
+        channel = decoder.getVarint();
+    for (auto& phaseCount : phaseCounts)
+        phaseCount = decoder.getVarint();
+
+    std::size_t numberOfPhases = 0;
+    for (std::size_t index = 0; index < count; index++)
+    {
+        transactions.emplace_back(ids[index],
+                                  addresses[index],
+                                  dataLengths[index],
+                                  commands[index],
+                                  sc_time::from_value(times[index]),
+                                  static_cast<Thread>(threads[index]),
+                                  static_cast<Channel>(channels[index]));
+        transactions.back().recordedPhases.reserve(phaseCounts[index]);
+        numberOfPhases += phaseCounts[index];
+    }
+
+    // Phases are decoded into a flat list first and distributed afterwards
+    std::vector<RecordedTransaction::Phase> decodedPhases;
+    decodedPhases.reserve(numberOfPhases);
+    for (std::size_t index = 0; index < numberOfPhases; index++)
+    {
+        uint64_t nameId = decoder.getVarint();
+        if (nameId >= phases.size())
+            throw std::runtime_error("Unknown phase name id " + std::to_string(nameId));
+        decodedPhases.emplace_back(phases[nameId], SC_ZERO_TIME);
+    }
+    previous = 0;
+    for (auto& phase : decodedPhases)
+    {
+        previous += static_cast<uint64_t>(decoder.getSigned());
+        phase.interval.start = sc_time::from_value(previous);
+    }
+    for (auto& phase : decodedPhases)
+    {
+        phase.interval.end = sc_time::from_value(phase.interval.start.value() +
+                                                 static_cast<uint64_t>(decoder.getSigned()));
+    }
+    std::vector<bool> hasDataStrobe(numberOfPhases);
+    for (std::size_t index = 0; index < numberOfPhases; index++)
+    {
+        uint64_t value = decoder.getVarint();
+        hasDataStrobe[index] = value != 0;
+        if (value == 0)
+            continue;
+        value--;
+        auto offset = static_cast<uint64_t>((value >> 1) ^ (~(value & 1) + 1));
+        decodedPhases[index].intervalOnDataStrobe.start =
+            sc_time::from_value(decodedPhases[index].interval.start.value() + offset);
+    }
+    for (std::size_t index = 0; index < numberOfPhases; index++)
+    {
+        if (hasDataStrobe[index])
+        {
+            decodedPhases[index].intervalOnDataStrobe.end =
+                sc_time::from_value(decodedPhases[index].intervalOnDataStrobe.start.value() +
+                                    static_cast<uint64_t>(decoder.getSigned()));
+        }
+    }
+    for (auto& phase : decodedPhases)
+        phase.rank = static_cast<Rank>(decoder.getVarint());
+    for (auto& phase : decodedPhases)
+        phase.bankGroup = static_cast<BankGroup>(decoder.getVarint());
+    for (auto& phase : decodedPhases)
+        phase.bank = static_cast<Bank>(decoder.getVarint());
+    for (auto& phase : decodedPhases)
+        phase.row = static_cast<Row>(decoder.getVarint());
+    for (auto& phase : decodedPhases)
+        phase.column = static_cast<Column>(decoder.getVarint());
+    for (auto& phase : decodedPhases)
+        phase.burstLength = static_cast<unsigned>(decoder.getVarint());
+
+    auto phase = std::make_move_iterator(decodedPhases.begin());
+    for (std::size_t index = 0; index < count; index++)
+    {
+        for (uint64_t number = 0; number < phaseCounts[index]; number++)
+            transactions[index].recordedPhases.push_back(*phase++);
+    }
+
+    if (!decoder.atEnd())
+        throw std::runtime_error("Trailing data in transactions block");
+
+    return transactions;
+}
+
+} // namespace DRAMSys
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef COLUMNARTRACEREADER_H
+#define COLUMNARTRACEREADER_H
+
+#include "DRAMSys/common/ColumnarTraceFormat.h"
+#include "DRAMSys/common/RecorderBackendIF.h"
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace DRAMSys
+{
+
+// Reads a file of the ColumnarRecorderBackend, throws std::runtime_error on malformed input
+class ColumnarTraceReader
+{
+public:
+    explicit ColumnarTraceReader(const std::string& fileName);
+
+    [[nodiscard]] const RecordingInfo& getInfo() const { return info; }
+
+    // Passes all records of the file to the backend in the order they were written
+    void replay(RecorderBackendIF& backend);
+
+private:
+    bool readBlock(ColumnarTrace::BlockType& type, std::vector<uint8_t>& payload);
+    std::vector<RecordedTransaction> decodeTransactions(ColumnarTrace::Decoder& decoder) const;
+
+    std::ifstream file;
+    RecordingInfo info;
+    // Phases of the file ids of the phase names
+    std::vector<tlm::tlm_phase> phases;
+};
+
+} // namespace DRAMSys
+
+#endif // COLUMNARTRACEREADER_H
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef METRICSSINKIF_H
+#define METRICSSINKIF_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace DRAMSys
+{
+
+// Metrics of one channel over one window, published while the simulation runs
+struct MetricsRecord
+{
+    // Bin i counts request latencies in [2^i, 2^(i+1)) ns, the first bin also counts latencies
+    // below 1 ns and the last bin all latencies above
+    static constexpr std::size_t latencyBins = 16;
+
+    enum class Type : uint8_t
+    {
+        Controller,
+        Power
+    } type = Type::Controller;
+
+    unsigned int channel = 0;
+    double time = 0; // end of the window in seconds
+
+    // Controller
+    double bandwidth = 0;  // bytes per second of the served requests
+    double queueDepth = 0; // average number of requests in the scheduler buffers
+    // Share of the column commands without an activate, NaN without column commands
+    double rowHitRate = std::numeric_limits<double>::quiet_NaN();
+    std::array<uint32_t, latencyBins> latencyHistogram{};
+
+    // Power
+    double power = 0; // average power in W
+};
+
+class MetricsSinkIF
+{
+protected:
+    MetricsSinkIF(const MetricsSinkIF&) = default;
+    MetricsSinkIF(MetricsSinkIF&&) = default;
+    MetricsSinkIF& operator=(const MetricsSinkIF&) = default;
+    MetricsSinkIF& operator=(MetricsSinkIF&&) = default;
+
+public:
+    MetricsSinkIF() = default;
+    virtual ~MetricsSinkIF() = default;
+
+    // Called from the simulation thread, must not block
+    virtual void publish(const MetricsRecord& record) = 0;
+    virtual void close() = 0;
+};
+
+} // namespace DRAMSys
+
+#endif // METRICSSINKIF_H
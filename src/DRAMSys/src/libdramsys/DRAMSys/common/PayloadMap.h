@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PAYLOADMAP_H
+#define PAYLOADMAP_H
+
+#include <cassert>
+#include <cstdint>
+#include <tlm>
+#include <utility>
+#include <vector>
+
+namespace DRAMSys
+{
+
+/*
+ * Map from payloads to values for the bookkeeping of payloads in flight. The keys live in a
+ * small open-addressing table with linear probing, the values in a pool that is indexed by the
+ * table. Erased values stay in the pool and are handed out again by the next emplace, so that
+ * their members (e.g. reserved vectors) are reused. No allocation happens once the table and the
+ * pool have reached the maximum number of payloads in flight.
+ */
+template <typename Value>
+class PayloadMap
+{
+    using Index = std::uint32_t;
+
+    struct Slot
+    {
+        tlm::tlm_generic_payload* payload = nullptr; // nullptr marks an empty slot
+        Index value = 0;
+    };
+
+public:
+    PayloadMap() : slots(64) {}
+
+    // Returns the value of the payload and true if it was newly added. A new value is a reused
+    // value of the pool with the state of its last use or a default constructed value.
+    std::pair<Value&, bool> emplace(tlm::tlm_generic_payload* payload)
+    {
+        if (2 * (numEntries + 1) > slots.size())
+            grow();
+
+        Slot& slot = slots[findSlot(payload)];
+        if (slot.payload != nullptr)
+            return {values[slot.value], false};
+
+        if (freeValues.empty())
+        {
+            slot.value = static_cast<Index>(values.size());
+            values.emplace_back();
+        }
+        else
+        {
+            slot.value = freeValues.back();
+            freeValues.pop_back();
+        }
+        slot.payload = payload;
+        numEntries++;
+        return {values[slot.value], true};
+    }
+
+    [[nodiscard]] Value* find(const tlm::tlm_generic_payload* payload)
+    {
+        const Slot& slot = slots[findSlot(payload)];
+        return slot.payload != nullptr ? &values[slot.value] : nullptr;
+    }
+
+    Value& at(const tlm::tlm_generic_payload* payload)
+    {
+        Value* value = find(payload);
+        assert(value != nullptr);
+        return *value;
+    }
+
+    void erase(const tlm::tlm_generic_payload* payload)
+    {
+        std::size_t slot = findSlot(payload);
+        if (slots[slot].payload == nullptr)
+            return;
+
+        freeValues.push_back(slots[slot].value);
+        numEntries--;
+
+        // Backward shift deletion keeps the probe sequences intact without tombstones
+        std::size_t mask = slots.size() - 1;
+        std::size_t next = slot;
+        while (true)
+        {
+            next = (next + 1) & mask;
+            if (slots[next].payload == nullptr)
+                break;
+
+            std::size_t home = homeSlot(slots[next].payload);
+            bool homeBetween = slot <= next ? (slot < home && home <= next)
+                                            : (slot < home || home <= next);
+            if (homeBetween)
+                continue;
+
+            slots[slot] = slots[next];
+            slot = next;
+        }
+        slots[slot] = Slot();
+    }
+
+    [[nodiscard]] bool empty() const { return numEntries == 0; }
+    [[nodiscard]] std::size_t size() const { return numEntries; }
+
+    // Calls function(payload, value) for all entries in no particular order
+    template <typename Function> void forEach(Function function)
+    {
+        for (const Slot& slot : slots)
+        {
+            if (slot.payload != nullptr)
+                function(slot.payload, values[slot.value]);
+        }
+    }
+
+private:
+    [[nodiscard]] std::size_t homeSlot(const tlm::tlm_generic_payload* payload) const
+    {
+        // Fibonacci hashing, payloads of a memory manager are often allocated consecutively
+        uint64_t hash = reinterpret_cast<std::uintptr_t>(payload) * UINT64_C(0x9E3779B97F4A7C15);
+        return static_cast<std::size_t>(hash >> 32) & (slots.size() - 1);
+    }
+
+    [[nodiscard]] std::size_t findSlot(const tlm::tlm_generic_payload* payload) const
+    {
+        std::size_t mask = slots.size() - 1;
+        std::size_t slot = homeSlot(payload);
+        while (slots[slot].payload != nullptr && slots[slot].payload != payload)
+            slot = (slot + 1) & mask;
+        return slot;
+    }
+
+    void grow()
+    {
+        std::vector<Slot> oldSlots(slots.size() * 2);
+        oldSlots.swap(slots);
+        for (const Slot& oldSlot : oldSlots)
+        {
+            if (oldSlot.payload != nullptr)
+                slots[findSlot(oldSlot.payload)] = oldSlot;
+        }
+    }
+
+    std::vector<Slot> slots;
+    std::vector<Value> values;
+    std::vector<Index> freeValues;
+    std::size_t numEntries = 0;
+};
+
+} // namespace DRAMSys
+
+#endif // PAYLOADMAP_H
@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef RECORDERBACKENDIF_H
+#define RECORDERBACKENDIF_H
+
+#include "DRAMSys/common/dramExtensions.h"
+#include "DRAMSys/common/utils.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <systemc>
+#include <tlm>
+#include <utility>
+#include <vector>
+
+namespace DRAMSys
+{
+
+struct RecordedTransaction
+{
+    RecordedTransaction() = default;
+    RecordedTransaction(uint64_t id,
+                        uint64_t address,
+                        unsigned int dataLength,
+                        char cmd,
+                        const sc_core::sc_time& timeOfGeneration,
+                        Thread thread,
+                        Channel channel) :
+        id(id),
+        address(address),
+        dataLength(dataLength),
+        cmd(cmd),
+        timeOfGeneration(timeOfGeneration),
+        thread(thread),
+        channel(channel)
+    {
+    }
+
+    uint64_t id = 0;
+    uint64_t address = 0;
+    unsigned int dataLength = 0;
+    char cmd = 'X';
+    sc_core::sc_time timeOfGeneration;
+    Thread thread = Thread(0);
+    Channel channel = Channel(0);
+
+    struct Phase
+    {
+        // for BEGIN_REQ and BEGIN_RESP
+        Phase(const tlm::tlm_phase& phase, const sc_core::sc_time& begin) :
+            phase(phase),
+            interval(begin, sc_core::SC_ZERO_TIME)
+        {
+        }
+        Phase(const tlm::tlm_phase& phase,
+              TimeInterval interval,
+              TimeInterval intervalOnDataStrobe,
+              Rank rank,
+              BankGroup bankGroup,
+              Bank bank,
+              Row row,
+              Column column,
+              unsigned int burstLength) :
+            phase(phase),
+            interval(std::move(interval)),
+            intervalOnDataStrobe(std::move(intervalOnDataStrobe)),
+            rank(rank),
+            bankGroup(bankGroup),
+            bank(bank),
+            row(row),
+            column(column),
+            burstLength(burstLength)
+        {
+        }
+        [[nodiscard]] const std::string& getName() const { return getRecordedPhaseName(phase); }
+
+        tlm::tlm_phase phase;
+        TimeInterval interval;
+        TimeInterval intervalOnDataStrobe = {sc_core::SC_ZERO_TIME, sc_core::SC_ZERO_TIME};
+        Rank rank = Rank(0);
+        BankGroup bankGroup = BankGroup(0);
+        Bank bank = Bank(0);
+        Row row = Row(0);
+        Column column = Column(0);
+        unsigned int burstLength = 0;
+    };
+    std::vector<Phase> recordedPhases;
+};
+
+// Transactions handed to a backend, the recorder reuses their storage after the call
+class RecordedTransactions
+{
+public:
+    RecordedTransactions(const RecordedTransaction* first, std::size_t count) :
+        first(first),
+        count(count)
+    {
+    }
+
+    [[nodiscard]] const RecordedTransaction* begin() const { return first; }
+    [[nodiscard]] const RecordedTransaction* end() const { return first + count; }
+    [[nodiscard]] std::size_t size() const { return count; }
+    [[nodiscard]] bool empty() const { return count == 0; }
+
+private:
+    const RecordedTransaction* first;
+    std::size_t count;
+};
+
+// Simulation parameters stored with every trace, times are in units of the SystemC time
+// resolution
+struct RecordingInfo
+{
+    unsigned numberOfRanks = 0;
+    unsigned numberOfBankGroups = 0;
+    unsigned numberOfBanks = 0;
+    uint64_t clk = 0;
+    std::string mcConfig;
+    std::string memSpec;
+    std::string traces;
+    uint64_t windowSize = 0;
+    unsigned refreshMaxPostponed = 0;
+    unsigned refreshMaxPulledin = 0;
+    unsigned maxBufferDepth = 0;
+    unsigned per2BankOffset = 0;
+    bool rowColumnCommandBus = false;
+    bool pseudoChannelMode = false;
+    std::vector<std::pair<std::string, double>> commandLengths;
+};
+
+/**
+ * Storage format of the TlmRecorder. writeTransactions is called from the storage thread of the
+ * recorder and may run concurrently to the other write methods.
+ */
+class RecorderBackendIF
+{
+protected:
+    RecorderBackendIF(const RecorderBackendIF&) = default;
+    RecorderBackendIF(RecorderBackendIF&&) = default;
+    RecorderBackendIF& operator=(const RecorderBackendIF&) = default;
+    RecorderBackendIF& operator=(RecorderBackendIF&&) = default;
+
+public:
+    RecorderBackendIF() = default;
+    virtual ~RecorderBackendIF() = default;
+
+    virtual void writeTransactions(RecordedTransactions transactions) = 0;
+    virtual void writePower(double timeInSeconds, double averagePower) = 0;
+    virtual void writeBufferDepth(double timeInSeconds,
+                                  const std::vector<double>& averageBufferDepth) = 0;
+    virtual void writeBandwidth(double timeInSeconds, double averageBandwidth) = 0;
+    virtual void writeDebugMessage(const std::string& message, const sc_core::sc_time& time) = 0;
+    virtual void close() = 0;
+};
+
+} // namespace DRAMSys
+
+#endif // RECORDERBACKENDIF_H
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SPSCRING_H
+#define SPSCRING_H
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+namespace DRAMSys
+{
+
+/*
+ * Bounded lock-free queue for exactly one producer thread and one consumer thread. The producer
+ * only writes the tail and the consumer only writes the head, each publishes its index with
+ * release semantics after the element was copied. Both indices run freely and are masked with
+ * the power-of-two capacity.
+ */
+template <typename T>
+class SpscRing
+{
+public:
+    explicit SpscRing(std::size_t capacity) : elements(capacity), mask(capacity - 1)
+    {
+        assert(capacity > 0 && (capacity & (capacity - 1)) == 0);
+    }
+
+    // Returns false without blocking if the ring is full
+    bool push(const T& element)
+    {
+        std::size_t currentTail = tail.load(std::memory_order_relaxed);
+        if (currentTail - cachedHead == elements.size())
+        {
+            cachedHead = head.load(std::memory_order_acquire);
+            if (currentTail - cachedHead == elements.size())
+                return false;
+        }
+
+        elements[currentTail & mask] = element;
+        tail.store(currentTail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Returns false if the ring is empty
+    bool pop(T& element)
+    {
+        std::size_t currentHead = head.load(std::memory_order_relaxed);
+        if (currentHead == cachedTail)
+        {
+            cachedTail = tail.load(std::memory_order_acquire);
+            if (currentHead == cachedTail)
+                return false;
+        }
+
+        element = elements[currentHead & mask];
+        head.store(currentHead + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    std::vector<T> elements;
+    const std::size_t mask;
+
+    // The indices and the copy of the other side's index of each thread live on separate cache
+    // lines, so that the threads do not invalidate each other's lines on every access
+    alignas(64) std::atomic<std::size_t> tail{0};
+    std::size_t cachedHead = 0;
+    alignas(64) std::atomic<std::size_t> head{0};
+    std::size_t cachedTail = 0;
+};
+
+} // namespace DRAMSys
+
+#endif // SPSCRING_H
@@ -0,0 +1,330 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "SqliteRecorderBackend.h"
+
+#include <cassert>
+#include <climits>
+#include <filesystem>
+#include <sqlite3.h>
+
+using namespace sc_core;
+
+namespace DRAMSys
+{
+
+SqliteRecorderBackend::SqliteRecorderBackend(const std::string& dbName, const RecordingInfo& info)
+{
+    openDB(dbName);
+    char* sErrMsg = nullptr;
+    sqlite3_exec(db, "PRAGMA main.page_size = 4096", nullptr, nullptr, &sErrMsg);
+    sqlite3_exec(db, "PRAGMA main.cache_size=10000", nullptr, nullptr, &sErrMsg);
+    sqlite3_exec(db, "PRAGMA main.locking_mode=EXCLUSIVE", nullptr, nullptr, &sErrMsg);
+    sqlite3_exec(db, "PRAGMA main.synchronous=OFF", nullptr, nullptr, &sErrMsg);
+    sqlite3_exec(db, "PRAGMA journal_mode = OFF", nullptr, nullptr, &sErrMsg);
+
+    executeInitialSqlCommand();
+    prepareSqlStatements();
+
+    insertGeneralInfo(info);
+    insertCommandLengths(info);
+}
+
+SqliteRecorderBackend::~SqliteRecorderBackend()
+{
+    close();
+}
+
+void SqliteRecorderBackend::close()
+{
+    if (db == nullptr)
+        return;
+
+    sqlite3_finalize(insertTransactionStatement);
+    sqlite3_finalize(insertRangeStatement);
+    sqlite3_finalize(updateRangeStatement);
+    sqlite3_finalize(insertPhaseStatement);
+    sqlite3_finalize(updatePhaseStatement);
+    sqlite3_finalize(insertGeneralInfoStatement);
+    sqlite3_finalize(insertCommandLengthsStatement);
+    sqlite3_finalize(insertDebugMessageStatement);
+    sqlite3_finalize(insertPowerStatement);
+    sqlite3_finalize(insertBufferDepthStatement);
+    sqlite3_finalize(insertBandwidthStatement);
+    sqlite3_close(db);
+    db = nullptr;
+}
+
+void SqliteRecorderBackend::writePower(double timeInSeconds, double averagePower)
+{
+    sqlite3_bind_double(insertPowerStatement, 1, timeInSeconds);
+    sqlite3_bind_double(insertPowerStatement, 2, averagePower);
+    executeSqlStatement(insertPowerStatement);
+}
+
+void SqliteRecorderBackend::writeBufferDepth(double timeInSeconds,
+                                             const std::vector<double>& averageBufferDepth)
+{
+    for (size_t index = 0; index < averageBufferDepth.size(); index++)
+    {
+        sqlite3_bind_double(insertBufferDepthStatement, 1, timeInSeconds);
+        sqlite3_bind_int(insertBufferDepthStatement, 2, static_cast<int>(index));
+        sqlite3_bind_double(insertBufferDepthStatement, 3, averageBufferDepth[index]);
+        executeSqlStatement(insertBufferDepthStatement);
+    }
+}
+
+void SqliteRecorderBackend::writeBandwidth(double timeInSeconds, double averageBandwidth)
+{
+    sqlite3_bind_double(insertBandwidthStatement, 1, timeInSeconds);
+    sqlite3_bind_double(insertBandwidthStatement, 2, averageBandwidth);
+    executeSqlStatement(insertBandwidthStatement);
+}
+
+void SqliteRecorderBackend::writeTransactions(RecordedTransactions transactions)
+{
+    sqlite3_exec(db, "BEGIN;", nullptr, nullptr, nullptr);
+    for (const RecordedTransaction& transaction : transactions)
+    {
+        assert(!transaction.recordedPhases.empty());
+        insertTransactionInDB(transaction);
+        for (const RecordedTransaction::Phase& phase : transaction.recordedPhases)
+        {
+            insertPhaseInDB(phase, transaction.id);
+        }
+
+        sc_time rangeBegin = transaction.recordedPhases.front().interval.start;
+        sc_time rangeEnd = rangeBegin;
+        for (const RecordedTransaction::Phase& phase : transaction.recordedPhases)
+        {
+            rangeEnd = std::max(rangeEnd, phase.interval.end);
+        }
+        insertRangeInDB(transaction.id, rangeBegin, rangeEnd);
+    }
+
+    sqlite3_exec(db, "COMMIT;", nullptr, nullptr, nullptr);
+}
+
+void SqliteRecorderBackend::openDB(const std::string& dbName)
+{
+    std::filesystem::remove(dbName.c_str());
+
+    if (sqlite3_open(dbName.c_str(), &db) != SQLITE_OK)
+    {
+        SC_REPORT_FATAL("Error in TraceRecorder", "Error cannot open database");
+        sqlite3_close(db);
+    }
+}
+
+void SqliteRecorderBackend::prepareSqlStatements()
+{
+    insertTransactionString =
+        "INSERT INTO Transactions VALUES (:id,:rangeID,:address,:dataLength,:thread,:channel,"
+        ":timeOfGeneration,:command)";
+
+    insertRangeString = "INSERT INTO Ranges VALUES (:id,:begin,:end)";
+
+    updateRangeString = "UPDATE Ranges SET  End = :end WHERE ID = :id";
+
+    insertPhaseString =
+        "INSERT INTO Phases "
+        "(PhaseName,PhaseBegin,PhaseEnd,DataStrobeBegin,DataStrobeEnd,Rank,BankGroup,Bank,"
+        "Row,Column,BurstLength,Transact) VALUES "
+        "(:name,:begin,:end,:strobeBegin,:strobeEnd,:rank,:bankGroup,:bank,"
+        ":row,:column,:burstLength,:transaction)";
+
+    updatePhaseString =
+        "UPDATE Phases SET PhaseEnd = :end WHERE Transact = :trans AND PhaseName = :name";
+
+    insertGeneralInfoString =
+        "INSERT INTO GeneralInfo VALUES"
+        "(:numberOfRanks, :numberOfBankGroups, :numberOfBanks, :clk, :unitOfTime, "
+        ":mcconfig, :memspec, :traces, :windowSize, :refreshMaxPostponed, :refreshMaxPulledin, "
+        ":controllerThread, "
+        ":maxBufferDepth, :per2BankOffset, :rowColumnCommandBus, :pseudoChannelMode)";
+
+    insertCommandLengthsString = "INSERT INTO CommandLengths VALUES"
+                                 "(:command, :length)";
+
+    insertDebugMessageString = "INSERT INTO DebugMessages (Time,Message) Values (:time,:message)";
+
+    insertPowerString = "INSERT INTO Power VALUES (:time,:averagePower)";
+    insertBufferDepthString =
+        "INSERT INTO BufferDepth VALUES (:time,:bufferNumber,:averageBufferDepth)";
+    insertBandwidthString = "INSERT INTO Bandwidth VALUES (:time,:averageBandwidth)";
+
+    sqlite3_prepare_v2(
+        db, insertTransactionString.c_str(), -1, &insertTransactionStatement, nullptr);
+    sqlite3_prepare_v2(db, insertRangeString.c_str(), -1, &insertRangeStatement, nullptr);
+    sqlite3_prepare_v2(db, updateRangeString.c_str(), -1, &updateRangeStatement, nullptr);
+    sqlite3_prepare_v2(db, insertPhaseString.c_str(), -1, &insertPhaseStatement, nullptr);
+    sqlite3_prepare_v2(db, updatePhaseString.c_str(), -1, &updatePhaseStatement, nullptr);
+    sqlite3_prepare_v2(
+        db, insertGeneralInfoString.c_str(), -1, &insertGeneralInfoStatement, nullptr);
+    sqlite3_prepare_v2(
+        db, insertCommandLengthsString.c_str(), -1, &insertCommandLengthsStatement, nullptr);
+    sqlite3_prepare_v2(
+        db, insertDebugMessageString.c_str(), -1, &insertDebugMessageStatement, nullptr);
+    sqlite3_prepare_v2(db, insertPowerString.c_str(), -1, &insertPowerStatement, nullptr);
+    sqlite3_prepare_v2(
+        db, insertBufferDepthString.c_str(), -1, &insertBufferDepthStatement, nullptr);
+    sqlite3_prepare_v2(db, insertBandwidthString.c_str(), -1, &insertBandwidthStatement, nullptr);
+}
+
+void SqliteRecorderBackend::writeDebugMessage(const std::string& message, const sc_time& time)
+{
+    sqlite3_bind_int64(insertDebugMessageStatement, 1, static_cast<int64_t>(time.value()));
+    sqlite3_bind_text(insertDebugMessageStatement,
+                      2,
+                      message.c_str(),
+                      static_cast<int>(message.length()),
+                      nullptr);
+    executeSqlStatement(insertDebugMessageStatement);
+}
+
+void SqliteRecorderBackend::insertGeneralInfo(const RecordingInfo& info)
+{
+    sqlite3_bind_int(insertGeneralInfoStatement, 1, static_cast<int>(info.numberOfRanks));
+    sqlite3_bind_int(insertGeneralInfoStatement, 2, static_cast<int>(info.numberOfBankGroups));
+    sqlite3_bind_int(insertGeneralInfoStatement, 3, static_cast<int>(info.numberOfBanks));
+    sqlite3_bind_int64(insertGeneralInfoStatement, 4, static_cast<int64_t>(info.clk));
+    sqlite3_bind_text(insertGeneralInfoStatement, 5, "PS", 2, nullptr);
+
+    sqlite3_bind_text(insertGeneralInfoStatement,
+                      6,
+                      info.mcConfig.c_str(),
+                      static_cast<int>(info.mcConfig.length()),
+                      nullptr);
+    sqlite3_bind_text(insertGeneralInfoStatement,
+                      7,
+                      info.memSpec.c_str(),
+                      static_cast<int>(info.memSpec.length()),
+                      nullptr);
+    sqlite3_bind_text(insertGeneralInfoStatement,
+                      8,
+                      info.traces.c_str(),
+                      static_cast<int>(info.traces.length()),
+                      nullptr);
+    sqlite3_bind_int64(insertGeneralInfoStatement, 9, static_cast<int64_t>(info.windowSize));
+    sqlite3_bind_int(insertGeneralInfoStatement, 10, static_cast<int>(info.refreshMaxPostponed));
+    sqlite3_bind_int(insertGeneralInfoStatement, 11, static_cast<int>(info.refreshMaxPulledin));
+    sqlite3_bind_int(insertGeneralInfoStatement, 12, static_cast<int>(UINT_MAX));
+    sqlite3_bind_int(insertGeneralInfoStatement, 13, static_cast<int>(info.maxBufferDepth));
+    sqlite3_bind_int(insertGeneralInfoStatement, 14, static_cast<int>(info.per2BankOffset));
+    sqlite3_bind_int(insertGeneralInfoStatement, 15, static_cast<int>(info.rowColumnCommandBus));
+    sqlite3_bind_int(insertGeneralInfoStatement, 16, static_cast<int>(info.pseudoChannelMode));
+    executeSqlStatement(insertGeneralInfoStatement);
+}
+
+void SqliteRecorderBackend::insertCommandLengths(const RecordingInfo& info)
+{
+    for (const auto& [commandName, length] : info.commandLengths)
+    {
+        sqlite3_bind_text(insertCommandLengthsStatement,
+                          1,
+                          commandName.c_str(),
+                          static_cast<int>(commandName.length()),
+                          nullptr);
+        sqlite3_bind_double(insertCommandLengthsStatement, 2, length);
+        executeSqlStatement(insertCommandLengthsStatement);
+    }
+}
+
+void SqliteRecorderBackend::insertTransactionInDB(const RecordedTransaction& recordingData)
+{
+    sqlite3_bind_int(insertTransactionStatement, 1, static_cast<int>(recordingData.id));
+    sqlite3_bind_int(insertTransactionStatement, 2, static_cast<int>(recordingData.id));
+    sqlite3_bind_int64(insertTransactionStatement, 3, static_cast<int64_t>(recordingData.address));
+    sqlite3_bind_int(insertTransactionStatement, 4, static_cast<int>(recordingData.dataLength));
+    sqlite3_bind_int(insertTransactionStatement, 5, static_cast<int>(recordingData.thread));
+    sqlite3_bind_int(insertTransactionStatement, 6, static_cast<int>(recordingData.channel));
+    sqlite3_bind_int64(insertTransactionStatement,
+                       7,
+                       static_cast<int64_t>(recordingData.timeOfGeneration.value()));
+    sqlite3_bind_text(insertTransactionStatement, 8, &recordingData.cmd, 1, nullptr);
+
+    executeSqlStatement(insertTransactionStatement);
+}
+
+void SqliteRecorderBackend::insertRangeInDB(uint64_t id, const sc_time& begin, const sc_time& end)
+{
+    sqlite3_bind_int64(insertRangeStatement, 1, static_cast<int64_t>(id));
+    sqlite3_bind_int64(insertRangeStatement, 2, static_cast<int64_t>(begin.value()));
+    sqlite3_bind_int64(insertRangeStatement, 3, static_cast<int64_t>(end.value()));
+    executeSqlStatement(insertRangeStatement);
+}
+
+void SqliteRecorderBackend::insertPhaseInDB(const RecordedTransaction::Phase& phase, uint64_t transactionID)
+{
+    const std::string& name = phase.getName();
+    sqlite3_bind_text(
+        insertPhaseStatement, 1, name.c_str(), static_cast<int>(name.length()), nullptr);
+    sqlite3_bind_int64(insertPhaseStatement, 2, static_cast<int64_t>(phase.interval.start.value()));
+    sqlite3_bind_int64(insertPhaseStatement, 3, static_cast<int64_t>(phase.interval.end.value()));
+    sqlite3_bind_int64(
+        insertPhaseStatement, 4, static_cast<int64_t>(phase.intervalOnDataStrobe.start.value()));
+    sqlite3_bind_int64(
+        insertPhaseStatement, 5, static_cast<int64_t>(phase.intervalOnDataStrobe.end.value()));
+    sqlite3_bind_int(insertPhaseStatement, 6, static_cast<int>(phase.rank));
+    sqlite3_bind_int(insertPhaseStatement, 7, static_cast<int>(phase.bankGroup));
+    sqlite3_bind_int(insertPhaseStatement, 8, static_cast<int>(phase.bank));
+    sqlite3_bind_int(insertPhaseStatement, 9, static_cast<int>(phase.row));
+    sqlite3_bind_int(insertPhaseStatement, 10, static_cast<int>(phase.column));
+    sqlite3_bind_int(insertPhaseStatement, 11, static_cast<int>(phase.burstLength));
+    sqlite3_bind_int64(insertPhaseStatement, 12, static_cast<int64_t>(transactionID));
+    executeSqlStatement(insertPhaseStatement);
+}
+
+void SqliteRecorderBackend::executeSqlStatement(sqlite3_stmt* statement)
+{
+    int errorCode = sqlite3_step(statement);
+    if (errorCode != SQLITE_DONE)
+        SC_REPORT_FATAL(
+            "Error in TraceRecorder",
+            (std::string("Could not execute statement. Error code: ") + std::to_string(errorCode))
+                .c_str());
+
+    sqlite3_reset(statement);
+}
+
+void SqliteRecorderBackend::executeInitialSqlCommand()
+{
+    char* errMsg = nullptr;
+    int rc = sqlite3_exec(db, initialCommand.c_str(), nullptr, nullptr, &errMsg);
+    if (rc != SQLITE_OK)
+    {
+        SC_REPORT_FATAL("SQLITE Error", errMsg);
+        sqlite3_free(errMsg);
+    }
+}
+
+} // namespace DRAMSys
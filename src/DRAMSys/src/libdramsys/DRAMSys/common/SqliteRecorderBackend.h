@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLITERECORDERBACKEND_H
+#define SQLITERECORDERBACKEND_H
+
+#include "DRAMSys/common/RecorderBackendIF.h"
+
+#include <string>
+#include <vector>
+
+class sqlite3;
+class sqlite3_stmt;
+
+namespace DRAMSys
+{
+
+// Writes the trace database (.tdb) read by the Trace Analyzer
+class SqliteRecorderBackend final : public RecorderBackendIF
+{
+public:
+    SqliteRecorderBackend(const std::string& dbName, const RecordingInfo& info);
+    SqliteRecorderBackend(const SqliteRecorderBackend&) = delete;
+    SqliteRecorderBackend(SqliteRecorderBackend&&) = delete;
+    SqliteRecorderBackend& operator=(const SqliteRecorderBackend&) = delete;
+    SqliteRecorderBackend& operator=(SqliteRecorderBackend&&) = delete;
+    ~SqliteRecorderBackend() override;
+
+    void writeTransactions(RecordedTransactions transactions) override;
+    void writePower(double timeInSeconds, double averagePower) override;
+    void writeBufferDepth(double timeInSeconds,
+                          const std::vector<double>& averageBufferDepth) override;
+    void writeBandwidth(double timeInSeconds, double averageBandwidth) override;
+    void writeDebugMessage(const std::string& message, const sc_core::sc_time& time) override;
+    void close() override;
+
+private:
+    void prepareSqlStatements();
+    void executeInitialSqlCommand();
+    static void executeSqlStatement(sqlite3_stmt* statement);
+
+    void openDB(const std::string& dbName);
+
+    void insertGeneralInfo(const RecordingInfo& info);
+    void insertCommandLengths(const RecordingInfo& info);
+    void insertTransactionInDB(const RecordedTransaction& recordingData);
+    void insertRangeInDB(uint64_t id, const sc_core::sc_time& begin, const sc_core::sc_time& end);
+    void insertPhaseInDB(const RecordedTransaction::Phase& phase, uint64_t transactionID);
+
+    sqlite3* db = nullptr;
+    sqlite3_stmt *insertTransactionStatement = nullptr, *insertRangeStatement = nullptr,
+                 *updateRangeStatement = nullptr, *insertPhaseStatement = nullptr,
+                 *updatePhaseStatement = nullptr, *insertGeneralInfoStatement = nullptr,
+                 *insertCommandLengthsStatement = nullptr, *insertDebugMessageStatement = nullptr,
+                 *insertPowerStatement = nullptr, *insertBufferDepthStatement = nullptr,
+                 *insertBandwidthStatement = nullptr;
+    std::string insertTransactionString, insertRangeString, updateRangeString, insertPhaseString,
+        updatePhaseString, insertGeneralInfoString, insertCommandLengthsString,
+        insertDebugMessageString, insertPowerString, insertBufferDepthString, insertBandwidthString;
+
+    std::string initialCommand = R"(
+        DROP TABLE IF EXISTS Phases;
+        DROP TABLE IF EXISTS GeneralInfo;
+        DROP TABLE IF EXISTS CommandLengths;
+        DROP TABLE IF EXISTS Comments;
+        DROP TABLE IF EXISTS ranges;
+        DROP TABLE IF EXISTS Transactions;
+        DROP TABLE IF EXISTS DebugMessages;
+        DROP TABLE IF EXISTS Power;
+        DROP TABLE IF EXISTS BufferDepth;
+        DROP TABLE IF EXISTS Bandwidth;
+
+        CREATE TABLE Phases(
+                ID INTEGER PRIMARY KEY,
+                PhaseName TEXT,
+                PhaseBegin INTEGER,
+                PhaseEnd INTEGER,
+                DataStrobeBegin INTEGER,
+                DataStrobeEnd INTEGER,
+                Rank INTEGER,
+                BankGroup INTEGER,
+                Bank INTEGER,
+                Row INTEGER,
+                Column INTEGER,
+                BurstLength INTEGER,
+                Transact INTEGER
+        );
+
+        CREATE TABLE GeneralInfo(
+                NumberOfRanks INTEGER,
+                NumberOfBankgroups INTEGER,
+                NumberOfBanks INTEGER,
+                clk INTEGER,
+                UnitOfTime TEXT,
+                MCconfig TEXT,
+                Memspec TEXT,
+                Traces TEXT,
+                WindowSize INTEGER,
+                RefreshMaxPostponed INTEGER,
+                RefreshMaxPulledin INTEGER,
+                ControllerThread INTEGER,
+                MaxBufferDepth INTEGER,
+                Per2BankOffset INTEGER,
+                RowColumnCommandBus BOOL,
+                PseudoChannelMode BOOL
+        );
+
+        CREATE TABLE CommandLengths(
+                Command TEXT,
+                Length DOUBLE
+        );
+
+        CREATE TABLE Power(
+                time DOUBLE,
+                AveragePower DOUBLE
+        );
+
+        CREATE TABLE BufferDepth(
+            Time DOUBLE,
+            BufferNumber INTEGER,
+            AverageBufferDepth DOUBLE
+        );
+
+        CREATE TABLE Bandwidth(
+            Time DOUBLE,
+            AverageBandwidth DOUBLE
+        );
+
+        CREATE TABLE Comments(
+                Time INTEGER,
+                Text TEXT
+        );
+
+        CREATE TABLE DebugMessages(
+                Time INTEGER,
+                Message TEXT
+        );
+
+        -- use SQLITE R* TREE Module to make queries on timespans effecient (see http://www.sqlite.org/rtree.html)
+        CREATE VIRTUAL TABLE ranges USING rtree(
+           id,
+           begin, end
+        );
+
+        CREATE TABLE Transactions(
+                ID INTEGER,
+                Range INTEGER,
+                Address INTEGER,
+                DataLength INTEGER,
+                Thread INTEGER,
+                Channel INTEGER,
+                TimeOfGeneration INTEGER,
+                Command TEXT
+        );
+
+        CREATE INDEX ranges_index ON Transactions(Range);
+        CREATE INDEX "phasesTransactions" ON "Phases" ("Transact" ASC);
+        CREATE INDEX "messageTimes" ON "DebugMessages" ("Time" ASC);
+    )";
+};
+
+} // namespace DRAMSys
+
+#endif // SQLITERECORDERBACKEND_H
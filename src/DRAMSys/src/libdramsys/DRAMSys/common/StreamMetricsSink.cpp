@@ -0,0 +1,270 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "StreamMetricsSink.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <systemc>
+
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace DRAMSys
+{
+
+namespace
+{
+
+constexpr std::string_view SOCKET_PREFIX = "unix:";
+constexpr std::chrono::milliseconds POLL_INTERVAL(10);
+
+// NaN is written as an empty CSV field or as JSON null
+void appendNumber(std::string& buffer, double value, std::string_view nan)
+{
+    if (std::isnan(value))
+    {
+        buffer += nan;
+        return;
+    }
+
+    std::array<char, 32> text{};
+    int length = std::snprintf(text.data(), text.size(), "%.9g", value);
+    buffer.append(text.data(), static_cast<std::size_t>(length));
+}
+
+void appendCsvRow(std::string& buffer,
+                  const MetricsRecord& record,
+                  std::string_view metric,
+                  double value)
+{
+    appendNumber(buffer, record.time, "");
+    buffer += ',';
+    buffer += std::to_string(record.channel);
+    buffer += ',';
+    buffer += metric;
+    buffer += ',';
+    appendNumber(buffer, value, "");
+    buffer += '\n';
+}
+
+} // namespace
+
+StreamMetricsSink::StreamMetricsSink(const std::string& output, Config::MetricsExportType format) :
+    metricsFormat(format)
+{
+    if (output.compare(0, SOCKET_PREFIX.size(), SOCKET_PREFIX) == 0)
+    {
+#ifdef _WIN32
+        SC_REPORT_FATAL("StreamMetricsSink", "On Windows Unix sockets are not supported");
+#else
+        std::string path = output.substr(SOCKET_PREFIX.size());
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        if (path.empty() || path.size() >= sizeof(address.sun_path))
+            SC_REPORT_FATAL("StreamMetricsSink", ("Invalid socket path " + path).c_str());
+        path.copy(address.sun_path, path.size());
+
+        socketDescriptor = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (socketDescriptor < 0 ||
+            connect(socketDescriptor, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0)
+        {
+            SC_REPORT_FATAL("StreamMetricsSink",
+                            ("Could not connect to socket " + path).c_str());
+        }
+#endif
+    }
+    else
+    {
+        file.open(output, std::ios::trunc);
+        if (!file.is_open())
+            SC_REPORT_FATAL("StreamMetricsSink", ("Could not open " + output).c_str());
+    }
+
+    if (metricsFormat == Config::MetricsExportType::CSV)
+    {
+        buffer = "time,channel,metric,value\n";
+        write();
+    }
+
+    reader = std::thread(&StreamMetricsSink::readerThread, this);
+}
+
+StreamMetricsSink::~StreamMetricsSink()
+{
+    close();
+}
+
+void StreamMetricsSink::publish(const MetricsRecord& record)
+{
+    if (!ring.push(record))
+        droppedRecords++;
+}
+
+void StreamMetricsSink::close()
+{
+    if (!reader.joinable())
+        return;
+
+    stopRequested.store(true, std::memory_order_release);
+    reader.join();
+
+    if (file.is_open())
+        file.close();
+#ifndef _WIN32
+    if (socketDescriptor >= 0)
+        ::close(socketDescriptor);
+#endif
+    socketDescriptor = -1;
+
+    if (droppedRecords > 0)
+    {
+        SC_REPORT_WARNING("StreamMetricsSink",
+                          (std::to_string(droppedRecords) +
+                           " metrics records were dropped, the output could not keep up")
+                              .c_str());
+    }
+    if (writeFailed)
+        SC_REPORT_WARNING("StreamMetricsSink", "Writing the metrics failed");
+}
+
+void StreamMetricsSink::readerThread()
+{
+    MetricsRecord record;
+    while (true)
+    {
+        // Everything published before the stop request is still written
+        bool stop = stopRequested.load(std::memory_order_acquire);
+
+        while (ring.pop(record))
+            format(record);
+
+        if (!buffer.empty())
+            write();
+
+        if (stop)
+            break;
+
+        std::this_thread::sleep_for(POLL_INTERVAL);
+    }
+}
+
+void StreamMetricsSink::format(const MetricsRecord& record)
+{
+    if (metricsFormat == Config::MetricsExportType::CSV)
+    {
+        if (record.type == MetricsRecord::Type::Power)
+        {
+            appendCsvRow(buffer, record, "power", record.power);
+            return;
+        }
+
+        appendCsvRow(buffer, record, "bandwidth", record.bandwidth);
+        appendCsvRow(buffer, record, "row_hit_rate", record.rowHitRate);
+        appendCsvRow(buffer, record, "queue_depth", record.queueDepth);
+        for (std::size_t bin = 0; bin < MetricsRecord::latencyBins; bin++)
+        {
+            std::string metric =
+                "latency_" + std::to_string(bin == 0 ? 0 : UINT64_C(1) << bin) + "ns";
+            appendCsvRow(buffer, record, metric, record.latencyHistogram[bin]);
+        }
+        return;
+    }
+
+    buffer += "{\"time\":";
+    appendNumber(buffer, record.time, "null");
+    buffer += ",\"channel\":";
+    buffer += std::to_string(record.channel);
+
+    if (record.type == MetricsRecord::Type::Power)
+    {
+        buffer += ",\"power\":";
+        appendNumber(buffer, record.power, "null");
+    }
+    else
+    {
+        buffer += ",\"bandwidth\":";
+        appendNumber(buffer, record.bandwidth, "null");
+        buffer += ",\"rowHitRate\":";
+        appendNumber(buffer, record.rowHitRate, "null");
+        buffer += ",\"queueDepth\":";
+        appendNumber(buffer, record.queueDepth, "null");
+        buffer += ",\"latencyHistogram\":[";
+        for (std::size_t bin = 0; bin < MetricsRecord::latencyBins; bin++)
+        {
+            if (bin != 0)
+                buffer += ',';
+            buffer += std::to_string(record.latencyHistogram[bin]);
+        }
+        buffer += ']';
+    }
+    buffer += "}\n";
+}
+
+void StreamMetricsSink::write()
+{
+    // After the first failure, e.g. a closed socket, the records are discarded
+    if (!writeFailed)
+    {
+        if (file.is_open())
+        {
+            file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            file.flush();
+            writeFailed = !file.good();
+        }
+#ifndef _WIN32
+        else
+        {
+            int flags = 0;
+#ifdef MSG_NOSIGNAL
+            flags = MSG_NOSIGNAL;
+#endif
+            std::size_t written = 0;
+            while (!writeFailed && written < buffer.size())
+            {
+                ssize_t result = send(
+                    socketDescriptor, buffer.data() + written, buffer.size() - written, flags);
+                writeFailed = result < 0;
+                written += result < 0 ? 0 : static_cast<std::size_t>(result);
+            }
+        }
+#endif
+    }
+
+    buffer.clear();
+}
+
+} // namespace DRAMSys
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef STREAMMETRICSSINK_H
+#define STREAMMETRICSSINK_H
+
+#include "DRAMSys/common/MetricsSinkIF.h"
+#include "DRAMSys/common/SpscRing.h"
+
+#include <DRAMSys/config/SimConfig.h>
+
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <thread>
+
+namespace DRAMSys
+{
+
+/*
+ * Hands the records through a lock-free ring to a reader thread, which formats them as CSV or
+ * JSON lines and writes them to a file or, for outputs of the form "unix:<path>", to a listening
+ * Unix domain socket. The simulation never waits for the output: records that do not fit into
+ * the ring are dropped and counted.
+ */
+class StreamMetricsSink final : public MetricsSinkIF
+{
+public:
+    StreamMetricsSink(const std::string& output, Config::MetricsExportType format);
+    StreamMetricsSink(const StreamMetricsSink&) = delete;
+    StreamMetricsSink(StreamMetricsSink&&) = delete;
+    StreamMetricsSink& operator=(const StreamMetricsSink&) = delete;
+    StreamMetricsSink& operator=(StreamMetricsSink&&) = delete;
+    ~StreamMetricsSink() override;
+
+    void publish(const MetricsRecord& record) override;
+    void close() override;
+
+private:
+    void readerThread();
+    void format(const MetricsRecord& record);
+    void write();
+
+    static constexpr std::size_t ringCapacity = 4096;
+
+    const Config::MetricsExportType metricsFormat;
+    std::ofstream file;
+    int socketDescriptor = -1;
+
+    SpscRing<MetricsRecord> ring{ringCapacity};
+    std::thread reader;
+    std::atomic<bool> stopRequested{false};
+
+    // Only accessed by the simulation thread
+    uint64_t droppedRecords = 0;
+
+    // Only accessed by the reader thread until it is joined
+    std::string buffer;
+    bool writeFailed = false;
+};
+
+} // namespace DRAMSys
+
+#endif // STREAMMETRICSSINK_H
@@ -41,11 +41,12 @@
 
 #include "TlmRecorder.h"
 
+#include "DRAMSys/common/ColumnarRecorderBackend.h"
 #include "DRAMSys/common/DebugManager.h"
+#include "DRAMSys/common/SqliteRecorderBackend.h"
 
-#include <filesystem>
-#include <fstream>
-#include <sqlite3.h>
+#include <algorithm>
+#include <cmath>
 
 using namespace sc_core;
 using namespace tlm;
@@ -57,6 +58,7 @@ TlmRecorder::TlmRecorder(const std::string& name,
                          const SimConfig& simConfig,
                          const McConfig& mcConfig,
                          const MemSpec& memSpec,
+                         const AddressDecoder& addressDecoder,
                          const std::string& dbName,
                          const std::string& mcConfigString,
                          const std::string& memSpecString,
@@ -67,69 +69,102 @@ TlmRecorder::TlmRecorder(const std::string& name,
     memSpec(memSpec),
     currentDataBuffer(&recordingDataBuffer.at(0)),
     storageDataBuffer(&recordingDataBuffer.at(1)),
+    addressDecoder(addressDecoder),
+    recordingStart(simConfig.recordingStart, SC_SEC),
+    recordingStop(std::isinf(simConfig.recordingStop) ? sc_max_time()
+                                                      : sc_time(simConfig.recordingStop, SC_SEC)),
+    recordingSampling(simConfig.recordingSampling),
+    commandsOnly(simConfig.recordingMode == Config::RecordingModeType::CommandsOnly),
     simulationTimeCoveredByRecording(SC_ZERO_TIME)
 {
-    currentDataBuffer->reserve(transactionCommitRate);
-    storageDataBuffer->reserve(transactionCommitRate);
-
-    openDB(dbName);
-    char* sErrMsg = nullptr;
-    sqlite3_exec(db, "PRAGMA main.page_size = 4096", nullptr, nullptr, &sErrMsg);
-    sqlite3_exec(db, "PRAGMA main.cache_size=10000", nullptr, nullptr, &sErrMsg);
-    sqlite3_exec(db, "PRAGMA main.locking_mode=EXCLUSIVE", nullptr, nullptr, &sErrMsg);
-    sqlite3_exec(db, "PRAGMA main.synchronous=OFF", nullptr, nullptr, &sErrMsg);
-    sqlite3_exec(db, "PRAGMA journal_mode = OFF", nullptr, nullptr, &sErrMsg);
+    if (simConfig.recordingFilter.has_value())
+    {
+        const Config::RecordingFilterConfig& filter = *simConfig.recordingFilter;
+        for (unsigned thread : filter.Threads.value_or(std::vector<unsigned>{}))
+        {
+            if (recordedThreads.size() <= thread)
+                recordedThreads.resize(thread + 1);
+            recordedThreads[thread] = true;
+        }
+        for (unsigned bank : filter.Banks.value_or(std::vector<unsigned>{}))
+        {
+            if (bank >= memSpec.banksPerChannel)
+                SC_REPORT_FATAL("TlmRecorder", "RecordingFilter: bank out of range");
+            recordedBanks.resize(memSpec.banksPerChannel);
+            recordedBanks[bank] = true;
+        }
+        for (const auto& range : filter.AddressRanges.value_or(std::vector<Config::AddressRange>{}))
+        {
+            if (range.End <= range.Start)
+                SC_REPORT_FATAL("TlmRecorder", "RecordingFilter: empty address range");
+            recordedAddressRanges.emplace_back(range.Start, range.End);
+        }
+    }
 
-    executeInitialSqlCommand();
-    prepareSqlStatements();
+    currentDataBuffer->resize(transactionCommitRate);
+    storageDataBuffer->resize(transactionCommitRate);
+
+    RecordingInfo info;
+    info.numberOfRanks = memSpec.ranksPerChannel;
+    info.numberOfBankGroups = memSpec.bankGroupsPerChannel;
+    info.numberOfBanks = memSpec.banksPerChannel;
+    info.clk = memSpec.tCK.value();
+    info.mcConfig = mcConfigString;
+    info.memSpec = memSpecString;
+    info.traces = traces;
+    info.windowSize = simConfig.enableWindowing ? (memSpec.tCK * simConfig.windowSize).value() : 0;
+    info.refreshMaxPostponed = mcConfig.refreshMaxPostponed;
+    info.refreshMaxPulledin = mcConfig.refreshMaxPulledin;
+    info.maxBufferDepth = mcConfig.requestBufferSize;
+    info.per2BankOffset = memSpec.getPer2BankOffset();
+    info.rowColumnCommandBus = memSpec.hasRasAndCasBus();
+    info.pseudoChannelMode = memSpec.pseudoChannelMode();
+    for (unsigned int command = 0; command < Command::END_ENUM; ++command)
+    {
+        Command commandType(static_cast<Command::Type>(command));
+        info.commandLengths.emplace_back(commandType.toString(),
+                                         memSpec.getCommandLengthInCycles(commandType));
+    }
 
-    insertGeneralInfo(mcConfigString, memSpecString, traces);
-    insertCommandLengths();
+    if (simConfig.recordingFormat == Config::RecordingFormatType::Columnar)
+        backend = std::make_unique<ColumnarRecorderBackend>(dbName, info);
+    else
+        backend = std::make_unique<SqliteRecorderBackend>(dbName, info);
 
     PRINTDEBUGMESSAGE(name, "Starting new database transaction");
 }
 
 void TlmRecorder::finalize()
 {
-    if (db != nullptr)
+    if (backend)
         closeConnection();
-    sqlite3_finalize(insertTransactionStatement);
-    sqlite3_finalize(insertRangeStatement);
-    sqlite3_finalize(updateRangeStatement);
-    sqlite3_finalize(insertPhaseStatement);
-    sqlite3_finalize(updatePhaseStatement);
-    sqlite3_finalize(insertGeneralInfoStatement);
-    sqlite3_finalize(insertCommandLengthsStatement);
-    sqlite3_finalize(insertDebugMessageStatement);
-    sqlite3_finalize(insertPowerStatement);
-    sqlite3_finalize(insertBufferDepthStatement);
-    sqlite3_finalize(insertBandwidthStatement);
+}
+
+void TlmRecorder::startRecording()
+{
+    recordingStart = sc_time_stamp();
+    recordingStop = sc_max_time();
+}
+
+void TlmRecorder::stopRecording()
+{
+    recordingStop = sc_time_stamp();
 }
 
 void TlmRecorder::recordPower(double timeInSeconds, double averagePower)
 {
-    sqlite3_bind_double(insertPowerStatement, 1, timeInSeconds);
-    sqlite3_bind_double(insertPowerStatement, 2, averagePower);
-    executeSqlStatement(insertPowerStatement);
+    backend->writePower(timeInSeconds, averagePower);
 }
 
 void TlmRecorder::recordBufferDepth(double timeInSeconds,
                                     const std::vector<double>& averageBufferDepth)
 {
-    for (size_t index = 0; index < averageBufferDepth.size(); index++)
-    {
-        sqlite3_bind_double(insertBufferDepthStatement, 1, timeInSeconds);
-        sqlite3_bind_int(insertBufferDepthStatement, 2, static_cast<int>(index));
-        sqlite3_bind_double(insertBufferDepthStatement, 3, averageBufferDepth[index]);
-        executeSqlStatement(insertBufferDepthStatement);
-    }
+    backend->writeBufferDepth(timeInSeconds, averageBufferDepth);
 }
 
 void TlmRecorder::recordBandwidth(double timeInSeconds, double averageBandwidth)
 {
-    sqlite3_bind_double(insertBandwidthStatement, 1, timeInSeconds);
-    sqlite3_bind_double(insertBandwidthStatement, 2, averageBandwidth);
-    executeSqlStatement(insertBandwidthStatement);
+    backend->writeBandwidth(timeInSeconds, averageBandwidth);
 }
 
 void TlmRecorder::recordPhase(tlm_generic_payload& trans,
@@ -140,90 +175,98 @@ void TlmRecorder::recordPhase(tlm_generic_payload& trans,
 
     if (phase == BEGIN_REQ)
     {
-        introduceTransactionToSystem(trans);
-        std::string phaseName = getPhaseName(phase).substr(6);
-        currentTransactionsInSystem.at(&trans).recordedPhases.emplace_back(phaseName,
-                                                                           currentTime + delay);
+        Transaction& transaction = introduceTransactionToSystem(trans, phase, currentTime + delay);
+        if (transaction.id != notRecorded && !commandsOnly)
+            transaction.recordedPhases.emplace_back(phase, currentTime + delay);
     }
     if (phase == BEGIN_RESP)
     {
-        std::string phaseName = getPhaseName(phase).substr(6);
-        currentTransactionsInSystem.at(&trans).recordedPhases.emplace_back(phaseName,
-                                                                           currentTime + delay);
+        Transaction& transaction = currentTransactionsInSystem.at(&trans);
+        if (transaction.id != notRecorded && !commandsOnly)
+            transaction.recordedPhases.emplace_back(phase, currentTime + delay);
     }
     else if (phase == END_REQ)
     {
         // BEGIN_REQ is always the first phase of a normal transaction
-        currentTransactionsInSystem.at(&trans).recordedPhases.front().interval.end =
-            currentTime + delay;
+        Transaction& transaction = currentTransactionsInSystem.at(&trans);
+        if (transaction.id != notRecorded && !commandsOnly)
+            transaction.recordedPhases.front().interval.end = currentTime + delay;
     }
     else if (phase == END_RESP)
     {
         // BEGIN_RESP is always the last phase of a normal transaction at this point
-        currentTransactionsInSystem.at(&trans).recordedPhases.back().interval.end =
-            currentTime + delay;
+        Transaction& transaction = currentTransactionsInSystem.at(&trans);
+        if (transaction.id != notRecorded && !commandsOnly)
+            transaction.recordedPhases.back().interval.end = currentTime + delay;
         removeTransactionFromSystem(trans);
     }
     else if (isFixedCommandPhase(phase))
     {
-        tlm_generic_payload* keyTrans = nullptr;
+        Transaction* transaction = nullptr;
         if (ChildExtension::isChildTrans(trans))
         {
-            keyTrans = &ChildExtension::getParentTrans(trans);
+            transaction = &currentTransactionsInSystem.at(&ChildExtension::getParentTrans(trans));
         }
         else
         {
-            if (currentTransactionsInSystem.find(&trans) == currentTransactionsInSystem.end())
-                introduceTransactionToSystem(trans);
-            keyTrans = &trans;
+            transaction = currentTransactionsInSystem.find(&trans);
+            if (transaction == nullptr)
+                transaction = &introduceTransactionToSystem(trans, phase, currentTime + delay);
         }
 
-        std::string phaseName = getPhaseName(phase).substr(6); // remove "BEGIN_"
-        const ControllerExtension& extension = ControllerExtension::getExtension(trans);
-        TimeInterval intervalOnDataStrobe;
-        if (phaseHasDataStrobe(phase))
+        if (transaction->id != notRecorded)
         {
-            intervalOnDataStrobe = memSpec.getIntervalOnDataStrobe(Command(phase), trans);
-            intervalOnDataStrobe.start = currentTime + delay + intervalOnDataStrobe.start;
-            intervalOnDataStrobe.end = currentTime + delay + intervalOnDataStrobe.end;
-        }
+            const ControllerExtension& extension = ControllerExtension::getExtension(trans);
+            TimeInterval intervalOnDataStrobe;
+            if (phaseHasDataStrobe(phase))
+            {
+                intervalOnDataStrobe = memSpec.getIntervalOnDataStrobe(Command(phase), trans);
+                intervalOnDataStrobe.start = currentTime + delay + intervalOnDataStrobe.start;
+                intervalOnDataStrobe.end = currentTime + delay + intervalOnDataStrobe.end;
+            }
 
-        currentTransactionsInSystem.at(keyTrans).recordedPhases.emplace_back(
-            std::move(phaseName),
-            std::move(TimeInterval(currentTime + delay,
-                                   currentTime + delay +
-                                       memSpec.getExecutionTime(Command(phase), trans))),
-            std::move(intervalOnDataStrobe),
-            extension.getRank(),
-            extension.getBankGroup(),
-            extension.getBank(),
-            extension.getRow(),
-            extension.getColumn(),
-            extension.getBurstLength());
+            transaction->recordedPhases.emplace_back(
+                phase,
+                TimeInterval(currentTime + delay,
+                             currentTime + delay +
+                                 memSpec.getExecutionTime(Command(phase), trans)),
+                intervalOnDataStrobe,
+                extension.getRank(),
+                extension.getBankGroup(),
+                extension.getBank(),
+                extension.getRow(),
+                extension.getColumn(),
+                extension.getBurstLength());
+        }
 
         if (isRefreshCommandPhase(phase))
             removeTransactionFromSystem(trans);
     }
     else if (isPowerDownEntryPhase(phase))
     {
-        introduceTransactionToSystem(trans);
-        std::string phaseName = getPhaseName(phase).substr(6); // remove "BEGIN_"
-        const ControllerExtension& extension = ControllerExtension::getExtension(trans);
-        currentTransactionsInSystem.at(&trans).recordedPhases.emplace_back(
-            std::move(phaseName),
-            std::move(TimeInterval(currentTime + delay, SC_ZERO_TIME)),
-            std::move(TimeInterval(SC_ZERO_TIME, SC_ZERO_TIME)),
-            extension.getRank(),
-            extension.getBankGroup(),
-            extension.getBank(),
-            extension.getRow(),
-            extension.getColumn(),
-            extension.getBurstLength());
+        Transaction& transaction = introduceTransactionToSystem(trans, phase, currentTime + delay);
+        if (transaction.id != notRecorded)
+        {
+            const ControllerExtension& extension = ControllerExtension::getExtension(trans);
+            transaction.recordedPhases.emplace_back(phase,
+                                                    TimeInterval(currentTime + delay, SC_ZERO_TIME),
+                                                    TimeInterval(SC_ZERO_TIME, SC_ZERO_TIME),
+                                                    extension.getRank(),
+                                                    extension.getBankGroup(),
+                                                    extension.getBank(),
+                                                    extension.getRow(),
+                                                    extension.getColumn(),
+                                                    extension.getBurstLength());
+        }
     }
     else if (isPowerDownExitPhase(phase))
     {
-        currentTransactionsInSystem.at(&trans).recordedPhases.back().interval.end =
-            currentTime + delay + memSpec.getCommandLength(Command(phase));
+        Transaction& transaction = currentTransactionsInSystem.at(&trans);
+        if (transaction.id != notRecorded)
+        {
+            transaction.recordedPhases.back().interval.end =
+                currentTime + delay + memSpec.getCommandLength(Command(phase));
+        }
         removeTransactionFromSystem(trans);
     }
 
@@ -232,13 +275,25 @@ void TlmRecorder::recordPhase(tlm_generic_payload& trans,
 
 void TlmRecorder::recordDebugMessage(const std::string& message, const sc_time& time)
 {
-    insertDebugMessageInDB(message, time);
+    backend->writeDebugMessage(message, time);
 }
 
 // ------------- internal -----------------------
 
-void TlmRecorder::introduceTransactionToSystem(tlm_generic_payload& trans)
+TlmRecorder::Transaction& TlmRecorder::introduceTransactionToSystem(tlm_generic_payload& trans,
+                                                                    const tlm_phase& phase,
+                                                                    const sc_time& time)
 {
+    auto [transaction, inserted] = currentTransactionsInSystem.emplace(&trans);
+    if (!inserted)
+        return transaction;
+
+    if (!isRecorded(trans, phase, time))
+    {
+        transaction.id = notRecorded;
+        return transaction;
+    }
+
     totalNumTransactions++;
 
     char commandChar = 0;
@@ -252,41 +307,89 @@ void TlmRecorder::introduceTransactionToSystem(tlm_generic_payload& trans)
 
     const ArbiterExtension& extension = ArbiterExtension::getExtension(trans);
 
-    currentTransactionsInSystem.insert({&trans,
-                                        Transaction(totalNumTransactions,
-                                                    trans.get_address(),
-                                                    trans.get_data_length(),
-                                                    commandChar,
-                                                    extension.getTimeOfGeneration(),
-                                                    extension.getThread(),
-                                                    extension.getChannel())});
+    // The pooled transaction keeps the capacity of its phase vector from the previous use
+    transaction.id = totalNumTransactions;
+    transaction.address = trans.get_address();
+    transaction.dataLength = trans.get_data_length();
+    transaction.cmd = commandChar;
+    transaction.timeOfGeneration = extension.getTimeOfGeneration();
+    transaction.thread = extension.getThread();
+    transaction.channel = extension.getChannel();
+    transaction.recordedPhases.clear();
+    if (transaction.recordedPhases.capacity() == 0)
+        transaction.recordedPhases.reserve(phaseReserve);
 
     PRINTDEBUGMESSAGE(name,
                       "New transaction #" + std::to_string(totalNumTransactions) +
-                          " generation time " +
-                          currentTransactionsInSystem.at(&trans).timeOfGeneration.to_string());
+                          " generation time " + transaction.timeOfGeneration.to_string());
+
+    return transaction;
+}
+
+bool TlmRecorder::isRecorded(const tlm_generic_payload& trans,
+                             const tlm_phase& phase,
+                             const sc_time& time)
+{
+    if (time < recordingStart || time >= recordingStop)
+        return false;
+
+    if (phase != BEGIN_REQ)
+    {
+        // Commands of the controller itself, e.g. refreshes and power-downs, are only filtered by
+        // their bank
+        if (!recordedBanks.empty() && isFixedCommandPhase(phase) && Command(phase).isBankCommand())
+            return recordedBanks[static_cast<std::size_t>(ControllerExtension::getBank(trans))];
+        return true;
+    }
+
+    if (!recordedThreads.empty())
+    {
+        auto thread = static_cast<std::size_t>(ArbiterExtension::getThread(trans));
+        if (thread >= recordedThreads.size() || !recordedThreads[thread])
+            return false;
+    }
+
+    uint64_t address = trans.get_address();
+    if (!recordedAddressRanges.empty() &&
+        std::none_of(recordedAddressRanges.begin(),
+                     recordedAddressRanges.end(),
+                     [address](const std::pair<uint64_t, uint64_t>& range)
+                     { return range.first <= address && address < range.second; }))
+        return false;
+
+    // The controller assigns the bank later, the request is decoded here
+    if (!recordedBanks.empty() && !recordedBanks[addressDecoder.decodeAddress(address).bank])
+        return false;
+
+    return numberOfSampledRequests++ % recordingSampling == 0;
 }
 
 void TlmRecorder::removeTransactionFromSystem(tlm_generic_payload& trans)
 {
-    assert(currentTransactionsInSystem.count(&trans) != 0);
+    Transaction& transaction = currentTransactionsInSystem.at(&trans);
 
-    PRINTDEBUGMESSAGE(
-        name, "Removing transaction #" + std::to_string(currentTransactionsInSystem.at(&trans).id));
+    if (transaction.id == notRecorded)
+    {
+        currentTransactionsInSystem.erase(&trans);
+        return;
+    }
 
-    Transaction& recordingData = currentTransactionsInSystem.at(&trans);
-    currentDataBuffer->push_back(recordingData);
+    PRINTDEBUGMESSAGE(name, "Removing transaction #" + std::to_string(transaction.id));
+
+    // Swapping hands the stale buffer entry with its phase vector back to the pool
+    std::swap((*currentDataBuffer)[currentDataBufferSize++], transaction);
     currentTransactionsInSystem.erase(&trans);
 
-    if (currentDataBuffer->size() == transactionCommitRate)
+    if (currentDataBufferSize == transactionCommitRate)
     {
         if (storageThread.joinable())
             storageThread.join();
 
         std::swap(currentDataBuffer, storageDataBuffer);
+        storageDataBufferSize = currentDataBufferSize;
 
         storageThread = std::thread(&TlmRecorder::commitRecordedDataToDB, this);
-        currentDataBuffer->clear();
+        currentDataBufferSize = 0;
     }
 }
 
@@ -294,34 +397,48 @@ void TlmRecorder::terminateRemainingTransactions()
 {
     while (!currentTransactionsInSystem.empty())
     {
-        auto transaction =
-            std::min_element(currentTransactionsInSystem.begin(),
-                             currentTransactionsInSystem.end(),
-                             [](decltype(currentTransactionsInSystem)::value_type& l,
-                                decltype(currentTransactionsInSystem)::value_type& r) -> bool
-                             { return l.second.id < r.second.id; });
-        if (transaction->second.cmd == 'X')
+        tlm_generic_payload* oldestTrans = nullptr;
+        Transaction* oldest = nullptr;
+        currentTransactionsInSystem.forEach(
+            [&oldestTrans, &oldest](tlm_generic_payload* trans, Transaction& transaction)
+            {
+                if (oldest == nullptr || transaction.id < oldest->id)
+                {
+                    oldestTrans = trans;
+                    oldest = &transaction;
+                }
+            });
+
+        if (oldest->id == notRecorded)
+        {
+            currentTransactionsInSystem.erase(oldestTrans);
+        }
+        else if (oldest->cmd == 'X')
         {
-            std::string beginPhase = transaction->second.recordedPhases.front().name;
-            if (beginPhase == "PDNA")
-                recordPhase(*(transaction->first), END_PDNA, SC_ZERO_TIME);
-            else if (beginPhase == "PDNP")
-                recordPhase(*(transaction->first), END_PDNP, SC_ZERO_TIME);
-            else if (beginPhase == "SREF")
-                recordPhase(*(transaction->first), END_SREF, SC_ZERO_TIME);
+            tlm_phase beginPhase = oldest->recordedPhases.front().phase;
+            if (beginPhase == BEGIN_PDNA)
+                recordPhase(*oldestTrans, END_PDNA, SC_ZERO_TIME);
+            else if (beginPhase == BEGIN_PDNP)
+                recordPhase(*oldestTrans, END_PDNP, SC_ZERO_TIME);
+            else if (beginPhase == BEGIN_SREF)
+                recordPhase(*oldestTrans, END_SREF, SC_ZERO_TIME);
             else
-                removeTransactionFromSystem(*transaction->first);
+                removeTransactionFromSystem(*oldestTrans);
+        }
+        else if (commandsOnly && !oldest->recordedPhases.empty())
+        {
+            // The commands of the request were issued, the response is not recorded anyway
+            removeTransactionFromSystem(*oldestTrans);
         }
         else
         {
-            std::string beginPhase = transaction->second.recordedPhases.back().name;
-
-            if (beginPhase == "RESP")
-                recordPhase(*(transaction->first), END_RESP, SC_ZERO_TIME);
+            if (!oldest->recordedPhases.empty() &&
+                oldest->recordedPhases.back().phase == BEGIN_RESP)
+                recordPhase(*oldestTrans, END_RESP, SC_ZERO_TIME);
             else
             {
                 // Do not terminate transaction as it is not ready to be completed.
-                currentTransactionsInSystem.erase(transaction);
+                currentTransactionsInSystem.erase(oldestTrans);
 
                 // Decrement totalNumTransactions as this transaction will not be recorded in the
                 // database.
@@ -333,242 +450,7 @@ void TlmRecorder::terminateRemainingTransactions()
 
 void TlmRecorder::commitRecordedDataToDB()
 {
-    sqlite3_exec(db, "BEGIN;", nullptr, nullptr, nullptr);
-    for (const Transaction& transaction : *storageDataBuffer)
-    {
-        assert(!transaction.recordedPhases.empty());
-        insertTransactionInDB(transaction);
-        for (const Transaction::Phase& phase : transaction.recordedPhases)
-        {
-            insertPhaseInDB(phase, transaction.id);
-        }
-
-        sc_time rangeBegin = transaction.recordedPhases.front().interval.start;
-        sc_time rangeEnd = rangeBegin;
-        for (const Transaction::Phase& phase : transaction.recordedPhases)
-        {
-            rangeEnd = std::max(rangeEnd, phase.interval.end);
-        }
-        insertRangeInDB(transaction.id, rangeBegin, rangeEnd);
-    }
-
-    sqlite3_exec(db, "COMMIT;", nullptr, nullptr, nullptr);
-}
-
-void TlmRecorder::openDB(const std::string& dbName)
-{
-    std::filesystem::remove(dbName.c_str());
-
-    if (sqlite3_open(dbName.c_str(), &db) != SQLITE_OK)
-    {
-        SC_REPORT_FATAL("Error in TraceRecorder", "Error cannot open database");
-        sqlite3_close(db);
-    }
-}
-
-void TlmRecorder::prepareSqlStatements()
-{
-    insertTransactionString =
-        "INSERT INTO Transactions VALUES (:id,:rangeID,:address,:dataLength,:thread,:channel,"
-        ":timeOfGeneration,:command)";
-
-    insertRangeString = "INSERT INTO Ranges VALUES (:id,:begin,:end)";
-
-    updateRangeString = "UPDATE Ranges SET  End = :end WHERE ID = :id";
-
-    insertPhaseString =
-        "INSERT INTO Phases "
-        "(PhaseName,PhaseBegin,PhaseEnd,DataStrobeBegin,DataStrobeEnd,Rank,BankGroup,Bank,"
-        "Row,Column,BurstLength,Transact) VALUES "
-        "(:name,:begin,:end,:strobeBegin,:strobeEnd,:rank,:bankGroup,:bank,"
-        ":row,:column,:burstLength,:transaction)";
-
-    updatePhaseString =
-        "UPDATE Phases SET PhaseEnd = :end WHERE Transact = :trans AND PhaseName = :name";
-
-    insertGeneralInfoString =
-        "INSERT INTO GeneralInfo VALUES"
-        "(:numberOfRanks, :numberOfBankGroups, :numberOfBanks, :clk, :unitOfTime, "
-        ":mcconfig, :memspec, :traces, :windowSize, :refreshMaxPostponed, :refreshMaxPulledin, "
-        ":controllerThread, "
-        ":maxBufferDepth, :per2BankOffset, :rowColumnCommandBus, :pseudoChannelMode)";
-
-    insertCommandLengthsString = "INSERT INTO CommandLengths VALUES"
-                                 "(:command, :length)";
-
-    insertDebugMessageString = "INSERT INTO DebugMessages (Time,Message) Values (:time,:message)";
-
-    insertPowerString = "INSERT INTO Power VALUES (:time,:averagePower)";
-    insertBufferDepthString =
-        "INSERT INTO BufferDepth VALUES (:time,:bufferNumber,:averageBufferDepth)";
-    insertBandwidthString = "INSERT INTO Bandwidth VALUES (:time,:averageBandwidth)";
-
-    sqlite3_prepare_v2(
-        db, insertTransactionString.c_str(), -1, &insertTransactionStatement, nullptr);
-    sqlite3_prepare_v2(db, insertRangeString.c_str(), -1, &insertRangeStatement, nullptr);
-    sqlite3_prepare_v2(db, updateRangeString.c_str(), -1, &updateRangeStatement, nullptr);
-    sqlite3_prepare_v2(db, insertPhaseString.c_str(), -1, &insertPhaseStatement, nullptr);
-    sqlite3_prepare_v2(db, updatePhaseString.c_str(), -1, &updatePhaseStatement, nullptr);
-    sqlite3_prepare_v2(
-        db, insertGeneralInfoString.c_str(), -1, &insertGeneralInfoStatement, nullptr);
-    sqlite3_prepare_v2(
-        db, insertCommandLengthsString.c_str(), -1, &insertCommandLengthsStatement, nullptr);
-    sqlite3_prepare_v2(
-        db, insertDebugMessageString.c_str(), -1, &insertDebugMessageStatement, nullptr);
-    sqlite3_prepare_v2(db, insertPowerString.c_str(), -1, &insertPowerStatement, nullptr);
-    sqlite3_prepare_v2(
-        db, insertBufferDepthString.c_str(), -1, &insertBufferDepthStatement, nullptr);
-    sqlite3_prepare_v2(db, insertBandwidthString.c_str(), -1, &insertBandwidthStatement, nullptr);
-}
-
-void TlmRecorder::insertDebugMessageInDB(const std::string& message, const sc_time& time)
-{
-    sqlite3_bind_int64(insertDebugMessageStatement, 1, static_cast<int64_t>(time.value()));
-    sqlite3_bind_text(insertDebugMessageStatement,
-                      2,
-                      message.c_str(),
-                      static_cast<int>(message.length()),
-                      nullptr);
-    executeSqlStatement(insertDebugMessageStatement);
-}
-
-void TlmRecorder::insertGeneralInfo(const std::string& mcConfigString,
-                                    const std::string& memSpecString,
-                                    const std::string& traces)
-{
-    sqlite3_bind_int(insertGeneralInfoStatement, 1, static_cast<int>(memSpec.ranksPerChannel));
-    sqlite3_bind_int(insertGeneralInfoStatement, 2, static_cast<int>(memSpec.bankGroupsPerChannel));
-    sqlite3_bind_int(insertGeneralInfoStatement, 3, static_cast<int>(memSpec.banksPerChannel));
-    sqlite3_bind_int64(insertGeneralInfoStatement, 4, static_cast<int64_t>(memSpec.tCK.value()));
-    sqlite3_bind_text(insertGeneralInfoStatement, 5, "PS", 2, nullptr);
-
-    sqlite3_bind_text(insertGeneralInfoStatement,
-                      6,
-                      mcConfigString.c_str(),
-                      static_cast<int>(mcConfigString.length()),
-                      nullptr);
-    sqlite3_bind_text(insertGeneralInfoStatement,
-                      7,
-                      memSpecString.c_str(),
-                      static_cast<int>(memSpecString.length()),
-                      nullptr);
-    sqlite3_bind_text(
-        insertGeneralInfoStatement, 8, traces.c_str(), static_cast<int>(traces.length()), nullptr);
-
-    if (simConfig.enableWindowing)
-    {
-        sqlite3_bind_int64(insertGeneralInfoStatement,
-                           9,
-                           static_cast<int64_t>((memSpec.tCK * simConfig.windowSize).value()));
-    }
-    else
-    {
-        sqlite3_bind_int64(insertGeneralInfoStatement, 9, 0);
-    }
-    sqlite3_bind_int(
-        insertGeneralInfoStatement, 10, static_cast<int>(mcConfig.refreshMaxPostponed));
-    sqlite3_bind_int(insertGeneralInfoStatement, 11, static_cast<int>(mcConfig.refreshMaxPulledin));
-    sqlite3_bind_int(insertGeneralInfoStatement, 12, static_cast<int>(UINT_MAX));
-    sqlite3_bind_int(insertGeneralInfoStatement, 13, static_cast<int>(mcConfig.requestBufferSize));
-    sqlite3_bind_int(insertGeneralInfoStatement, 14, static_cast<int>(memSpec.getPer2BankOffset()));
-
-    bool rowColumnCommandBus = memSpec.hasRasAndCasBus();
-    bool pseudoChannelMode = memSpec.pseudoChannelMode();
-
-    sqlite3_bind_int(insertGeneralInfoStatement, 15, static_cast<int>(rowColumnCommandBus));
-    sqlite3_bind_int(insertGeneralInfoStatement, 16, static_cast<int>(pseudoChannelMode));
-    executeSqlStatement(insertGeneralInfoStatement);
-}
-
-void TlmRecorder::insertCommandLengths()
-{
-    auto insertCommandLength = [this](Command command)
-    {
-        auto commandName = command.toString();
-
-        sqlite3_bind_text(
-            insertCommandLengthsStatement, 1, commandName.c_str(), commandName.length(), nullptr);
-        sqlite3_bind_double(
-            insertCommandLengthsStatement, 2, memSpec.getCommandLengthInCycles(command));
-        executeSqlStatement(insertCommandLengthsStatement);
-    };
-
-    for (unsigned int command = 0; command < Command::END_ENUM; ++command)
-        insertCommandLength(static_cast<Command::Type>(command));
-}
-
-void TlmRecorder::insertTransactionInDB(const Transaction& recordingData)
-{
-    sqlite3_bind_int(insertTransactionStatement, 1, static_cast<int>(recordingData.id));
-    sqlite3_bind_int(insertTransactionStatement, 2, static_cast<int>(recordingData.id));
-    sqlite3_bind_int64(insertTransactionStatement, 3, static_cast<int64_t>(recordingData.address));
-    sqlite3_bind_int(insertTransactionStatement, 4, static_cast<int>(recordingData.dataLength));
-    sqlite3_bind_int(insertTransactionStatement, 5, static_cast<int>(recordingData.thread));
-    sqlite3_bind_int(insertTransactionStatement, 6, static_cast<int>(recordingData.channel));
-    sqlite3_bind_int64(insertTransactionStatement,
-                       7,
-                       static_cast<int64_t>(recordingData.timeOfGeneration.value()));
-    sqlite3_bind_text(insertTransactionStatement, 8, &recordingData.cmd, 1, nullptr);
-
-    executeSqlStatement(insertTransactionStatement);
-}
-
-void TlmRecorder::insertRangeInDB(uint64_t id, const sc_time& begin, const sc_time& end)
-{
-    sqlite3_bind_int64(insertRangeStatement, 1, static_cast<int64_t>(id));
-    sqlite3_bind_int64(insertRangeStatement, 2, static_cast<int64_t>(begin.value()));
-    sqlite3_bind_int64(insertRangeStatement, 3, static_cast<int64_t>(end.value()));
-    executeSqlStatement(insertRangeStatement);
-}
-
-void TlmRecorder::insertPhaseInDB(const Transaction::Phase& phase, uint64_t transactionID)
-{
-    sqlite3_bind_text(insertPhaseStatement,
-                      1,
-                      phase.name.c_str(),
-                      static_cast<int>(phase.name.length()),
-                      nullptr);
-    sqlite3_bind_int64(insertPhaseStatement, 2, static_cast<int64_t>(phase.interval.start.value()));
-    sqlite3_bind_int64(insertPhaseStatement, 3, static_cast<int64_t>(phase.interval.end.value()));
-    sqlite3_bind_int64(
-        insertPhaseStatement, 4, static_cast<int64_t>(phase.intervalOnDataStrobe.start.value()));
-    sqlite3_bind_int64(
-        insertPhaseStatement, 5, static_cast<int64_t>(phase.intervalOnDataStrobe.end.value()));
-    sqlite3_bind_int(insertPhaseStatement, 6, static_cast<int>(phase.rank));
-    sqlite3_bind_int(insertPhaseStatement, 7, static_cast<int>(phase.bankGroup));
-    sqlite3_bind_int(insertPhaseStatement, 8, static_cast<int>(phase.bank));
-    sqlite3_bind_int(insertPhaseStatement, 9, static_cast<int>(phase.row));
-    sqlite3_bind_int(insertPhaseStatement, 10, static_cast<int>(phase.column));
-    sqlite3_bind_int(insertPhaseStatement, 11, static_cast<int>(phase.burstLength));
-    sqlite3_bind_int64(insertPhaseStatement, 12, static_cast<int64_t>(transactionID));
-    executeSqlStatement(insertPhaseStatement);
-}
-
-void TlmRecorder::executeSqlStatement(sqlite3_stmt* statement)
-{
-    int errorCode = sqlite3_step(statement);
-    if (errorCode != SQLITE_DONE)
-        SC_REPORT_FATAL(
-            "Error in TraceRecorder",
-            (std::string("Could not execute statement. Error code: ") + std::to_string(errorCode))
-                .c_str());
-
-    sqlite3_reset(statement);
-}
-
-void TlmRecorder::executeInitialSqlCommand()
-{
-    PRINTDEBUGMESSAGE(name, "Creating database by running provided sql script");
-
-    char* errMsg = nullptr;
-    int rc = sqlite3_exec(db, initialCommand.c_str(), nullptr, nullptr, &errMsg);
-    if (rc != SQLITE_OK)
-    {
-        SC_REPORT_FATAL("SQLITE Error", errMsg);
-        sqlite3_free(errMsg);
-    }
-
-    PRINTDEBUGMESSAGE(name, "Database created successfully");
+    backend->writeTransactions({storageDataBuffer->data(), storageDataBufferSize});
 }
 
 void TlmRecorder::closeConnection()
@@ -577,12 +459,13 @@ void TlmRecorder::closeConnection()
     if (storageThread.joinable())
         storageThread.join();
     std::swap(currentDataBuffer, storageDataBuffer);
+    storageDataBufferSize = currentDataBufferSize;
     commitRecordedDataToDB();
     PRINTDEBUGMESSAGE(
         name, "Number of transactions written to DB: " + std::to_string(totalNumTransactions));
     PRINTDEBUGMESSAGE(name, "tlmPhaseRecorder:\tEnd Recording");
-    sqlite3_close(db);
-    db = nullptr;
+    backend->close();
+    backend.reset();
 }
 
 } // namespace DRAMSys
@@ -41,23 +41,23 @@
 #ifndef TLMRECORDER_H
 #define TLMRECORDER_H
 
+#include "DRAMSys/common/PayloadMap.h"
+#include "DRAMSys/common/RecorderBackendIF.h"
 #include "DRAMSys/common/dramExtensions.h"
 #include "DRAMSys/common/utils.h"
 #include "DRAMSys/configuration/memspec/MemSpec.h"
 #include "DRAMSys/controller/McConfig.h"
+#include "DRAMSys/simulation/AddressDecoder.h"
 #include "DRAMSys/simulation/SimConfig.h"
 
+#include <memory>
 #include <string>
 #include <systemc>
 #include <thread>
 #include <tlm>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
-class sqlite3;
-class sqlite3_stmt;
-
 namespace DRAMSys
 {
 
@@ -68,6 +68,7 @@ public:
                 const SimConfig& simConfig,
                 const McConfig& mcConfig,
                 const MemSpec& memSpec,
+                const AddressDecoder& addressDecoder,
                 const std::string& dbName,
                 const std::string& mcconfig,
                 const std::string& memspec,
@@ -87,222 +88,63 @@ public:
     void recordDebugMessage(const std::string& message, const sc_core::sc_time& time);
     void finalize();
 
+    // Transactions that begin from now on are recorded until stopRecording() is called, this
+    // overrides RecordingStart and RecordingStop
+    void startRecording();
+    // Transactions that already began are still recorded completely
+    void stopRecording();
+
 private:
     std::string name;
     const SimConfig& simConfig;
     const McConfig& mcConfig;
     const MemSpec& memSpec;
 
-    struct Transaction
-    {
-        Transaction(uint64_t id,
-                    uint64_t address,
-                    unsigned int dataLength,
-                    char cmd,
-                    const sc_core::sc_time& timeOfGeneration,
-                    Thread thread,
-                    Channel channel) :
-            id(id),
-            address(address),
-            dataLength(dataLength),
-            cmd(cmd),
-            timeOfGeneration(timeOfGeneration),
-            thread(thread),
-            channel(channel)
-        {
-        }
-
-        uint64_t id = 0;
-        uint64_t address = 0;
-        unsigned int dataLength = 0;
-        char cmd = 'X';
-        sc_core::sc_time timeOfGeneration;
-        Thread thread;
-        Channel channel;
-
-        struct Phase
-        {
-            // for BEGIN_REQ and BEGIN_RESP
-            Phase(std::string name, const sc_core::sc_time& begin) :
-                name(std::move(name)),
-                interval(begin, sc_core::SC_ZERO_TIME)
-            {
-            }
-            Phase(std::string name,
-                  TimeInterval interval,
-                  TimeInterval intervalOnDataStrobe,
-                  Rank rank,
-                  BankGroup bankGroup,
-                  Bank bank,
-                  Row row,
-                  Column column,
-                  unsigned int burstLength) :
-                name(std::move(name)),
-                interval(std::move(interval)),
-                intervalOnDataStrobe(std::move(intervalOnDataStrobe)),
-                rank(rank),
-                bankGroup(bankGroup),
-                bank(bank),
-                row(row),
-                column(column),
-                burstLength(burstLength)
-            {
-            }
-            std::string name;
-            TimeInterval interval;
-            TimeInterval intervalOnDataStrobe = {sc_core::SC_ZERO_TIME, sc_core::SC_ZERO_TIME};
-            Rank rank = Rank(0);
-            BankGroup bankGroup = BankGroup(0);
-            Bank bank = Bank(0);
-            Row row = Row(0);
-            Column column = Column(0);
-            unsigned int burstLength = 0;
-        };
-        std::vector<Phase> recordedPhases;
-    };
-
-    void prepareSqlStatements();
-    void executeInitialSqlCommand();
-    static void executeSqlStatement(sqlite3_stmt* statement);
+    using Transaction = RecordedTransaction;
 
-    void openDB(const std::string& dbName);
     void closeConnection();
 
-    void introduceTransactionToSystem(tlm::tlm_generic_payload& trans);
+    Transaction& introduceTransactionToSystem(tlm::tlm_generic_payload& trans,
+                                              const tlm::tlm_phase& phase,
+                                              const sc_core::sc_time& time);
+    // Applies the recording window, the filters and the sampling to a new transaction
+    bool isRecorded(const tlm::tlm_generic_payload& trans,
+                    const tlm::tlm_phase& phase,
+                    const sc_core::sc_time& time);
     void removeTransactionFromSystem(tlm::tlm_generic_payload& trans);
 
     void terminateRemainingTransactions();
     void commitRecordedDataToDB();
-    void insertGeneralInfo(const std::string& mcConfigString,
-                           const std::string& memSpecString,
-                           const std::string& traces);
-    void insertCommandLengths();
-    void insertTransactionInDB(const Transaction& recordingData);
-    void insertRangeInDB(uint64_t id, const sc_core::sc_time& begin, const sc_core::sc_time& end);
-    void insertPhaseInDB(const Transaction::Phase& phase, uint64_t transactionID);
-    void insertDebugMessageInDB(const std::string& message, const sc_core::sc_time& time);
 
+    // The entries of the buffers are reused, their phase vectors keep the allocated capacity
     static constexpr unsigned transactionCommitRate = 8192;
     std::array<std::vector<Transaction>, 2> recordingDataBuffer;
     std::vector<Transaction>* currentDataBuffer;
     std::vector<Transaction>* storageDataBuffer;
+    std::size_t currentDataBufferSize = 0;
+    std::size_t storageDataBufferSize = 0;
     std::thread storageThread;
 
-    std::unordered_map<tlm::tlm_generic_payload*, Transaction> currentTransactionsInSystem;
+    static constexpr std::size_t phaseReserve = 8;
+    // Transactions that are not recorded stay in the map with this id until they are finished
+    static constexpr uint64_t notRecorded = 0;
+    PayloadMap<Transaction> currentTransactionsInSystem;
+
+    // Recording policy, empty filters record everything
+    const AddressDecoder& addressDecoder;
+    sc_core::sc_time recordingStart;
+    sc_core::sc_time recordingStop;
+    const unsigned recordingSampling;
+    uint64_t numberOfSampledRequests = 0;
+    const bool commandsOnly;
+    std::vector<bool> recordedThreads;
+    std::vector<bool> recordedBanks;
+    std::vector<std::pair<uint64_t, uint64_t>> recordedAddressRanges;
 
     uint64_t totalNumTransactions = 0;
     sc_core::sc_time simulationTimeCoveredByRecording;
 
-    sqlite3* db = nullptr;
-    sqlite3_stmt *insertTransactionStatement = nullptr, *insertRangeStatement = nullptr,
-                 *updateRangeStatement = nullptr, *insertPhaseStatement = nullptr,
-                 *updatePhaseStatement = nullptr, *insertGeneralInfoStatement = nullptr,
-                 *insertCommandLengthsStatement = nullptr, *insertDebugMessageStatement = nullptr,
-                 *insertPowerStatement = nullptr, *insertBufferDepthStatement = nullptr,
-                 *insertBandwidthStatement = nullptr;
-    std::string insertTransactionString, insertRangeString, updateRangeString, insertPhaseString,
-        updatePhaseString, insertGeneralInfoString, insertCommandLengthsString,
-        insertDebugMessageString, insertPowerString, insertBufferDepthString, insertBandwidthString;
-
-    std::string initialCommand = R"(
-        DROP TABLE IF EXISTS Phases;
-        DROP TABLE IF EXISTS GeneralInfo;
-        DROP TABLE IF EXISTS CommandLengths;
-        DROP TABLE IF EXISTS Comments;
-        DROP TABLE IF EXISTS ranges;
-        DROP TABLE IF EXISTS Transactions;
-        DROP TABLE IF EXISTS DebugMessages;
-        DROP TABLE IF EXISTS Power;
-        DROP TABLE IF EXISTS BufferDepth;
-        DROP TABLE IF EXISTS Bandwidth;
-
-        CREATE TABLE Phases(
-                ID INTEGER PRIMARY KEY,
-                PhaseName TEXT,
-                PhaseBegin INTEGER,
-                PhaseEnd INTEGER,
-                DataStrobeBegin INTEGER,
-                DataStrobeEnd INTEGER,
-                Rank INTEGER,
-                BankGroup INTEGER,
-                Bank INTEGER,
-                Row INTEGER,
-                Column INTEGER,
-                BurstLength INTEGER,
-                Transact INTEGER
-        );
-
-        CREATE TABLE GeneralInfo(
-                NumberOfRanks INTEGER,
-                NumberOfBankgroups INTEGER,
-                NumberOfBanks INTEGER,
-                clk INTEGER,
-                UnitOfTime TEXT,
-                MCconfig TEXT,
-                Memspec TEXT,
-                Traces TEXT,
-                WindowSize INTEGER,
-                RefreshMaxPostponed INTEGER,
-                RefreshMaxPulledin INTEGER,
-                ControllerThread INTEGER,
-                MaxBufferDepth INTEGER,
-                Per2BankOffset INTEGER,
-                RowColumnCommandBus BOOL,
-                PseudoChannelMode BOOL
-        );
-
-        CREATE TABLE CommandLengths(
-                Command TEXT,
-                Length DOUBLE
-        );
-
-        CREATE TABLE Power(
-                time DOUBLE,
-                AveragePower DOUBLE
-        );
-
-        CREATE TABLE BufferDepth(
-            Time DOUBLE,
-            BufferNumber INTEGER,
-            AverageBufferDepth DOUBLE
-        );
-
-        CREATE TABLE Bandwidth(
-            Time DOUBLE,
-            AverageBandwidth DOUBLE
-        );
-
-        CREATE TABLE Comments(
-                Time INTEGER,
-                Text TEXT
-        );
-
-        CREATE TABLE DebugMessages(
-                Time INTEGER,
-                Message TEXT
-        );
-
-        -- use SQLITE R* TREE Module to make queries on timespans effecient (see http://www.sqlite.org/rtree.html)
-        CREATE VIRTUAL TABLE ranges USING rtree(
-           id,
-           begin, end
-        );
-
-        CREATE TABLE Transactions(
-                ID INTEGER,
-                Range INTEGER,
-                Address INTEGER,
-                DataLength INTEGER,
-                Thread INTEGER,
-                Channel INTEGER,
-                TimeOfGeneration INTEGER,
-                Command TEXT
-        );
-
-        CREATE INDEX ranges_index ON Transactions(Range);
-        CREATE INDEX "phasesTransactions" ON "Phases" ("Transact" ASC);
-        CREATE INDEX "messageTimes" ON "DebugMessages" ("Time" ASC);
-    )";
+    std::unique_ptr<RecorderBackendIF> backend;
 };
 
 } // namespace DRAMSys
@@ -39,7 +39,18 @@
 
 #include "utils.h"
 
+#include "DRAMSys/controller/Command.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstring>
 #include <sstream>
+#include <vector>
+
+#if defined(__AVX2__) || defined(__AVX512BW__)
+#include <immintrin.h>
+#endif
 
 using namespace sc_core;
 using namespace tlm;
@@ -72,6 +83,52 @@ std::string getPhaseName(const tlm_phase& phase)
     return oss.str();
 }
 
+namespace
+{
+
+// Indexed by the phase id, the ids of the extended phases depend on their registration order
+const std::vector<std::string>& recordedPhaseNames()
+{
+    static const std::vector<std::string> names = []
+    {
+        std::vector<tlm_phase> phases = {BEGIN_REQ, BEGIN_RESP};
+        for (unsigned command = 0; command < Command::END_ENUM; command++)
+            phases.push_back(Command(static_cast<Command::Type>(command)).toPhase());
+
+        std::vector<std::string> table;
+        for (const tlm_phase& phase : phases)
+        {
+            if (table.size() <= phase)
+                table.resize(phase + 1);
+
+            std::string name = getPhaseName(phase);
+            if (name.rfind("BEGIN_", 0) == 0)
+                name.erase(0, 6);
+            table[phase] = std::move(name);
+        }
+        return table;
+    }();
+    return names;
+}
+
+} // namespace
+
+const std::string& getRecordedPhaseName(const tlm_phase& phase)
+{
+    const std::vector<std::string>& names = recordedPhaseNames();
+    assert(phase < names.size() && !names[phase].empty());
+    return names[phase];
+}
+
+tlm_phase findRecordedPhase(const std::string& name)
+{
+    const std::vector<std::string>& names = recordedPhaseNames();
+    auto it = std::find(names.begin(), names.end(), name);
+    if (name.empty() || it == names.end())
+        return UNINITIALIZED_PHASE;
+    return {static_cast<unsigned>(it - names.begin())};
+}
+
 void setUpDummy(tlm_generic_payload& payload,
                 uint64_t channelPayloadID,
                 Rank rank,
@@ -100,4 +157,98 @@ sc_time alignAtNext(sc_time time, sc_time alignment)
     return std::ceil(time / alignment) * alignment;
 }
 
+// Copies with a byte enable for each byte, the AVX2 path reads the disabled destination bytes
+// and writes them back unchanged
+static void maskedCopyContiguous(unsigned char* destination,
+                                 const unsigned char* source,
+                                 std::size_t length,
+                                 const unsigned char* byteEnable)
+{
+    std::size_t i = 0;
+
+#if defined(__AVX512BW__)
+    const __m512i enabled512 = _mm512_set1_epi8(static_cast<char>(TLM_BYTE_ENABLED));
+    for (; i + 64 <= length; i += 64)
+    {
+        __mmask64 mask = _mm512_cmpeq_epi8_mask(_mm512_loadu_si512(byteEnable + i), enabled512);
+        _mm512_mask_storeu_epi8(destination + i, mask, _mm512_loadu_si512(source + i));
+    }
+
+    if (i < length)
+    {
+        __mmask64 tail = (uint64_t{1} << (length - i)) - 1;
+        __mmask64 mask = _mm512_mask_cmpeq_epi8_mask(
+            tail, _mm512_maskz_loadu_epi8(tail, byteEnable + i), enabled512);
+        _mm512_mask_storeu_epi8(
+            destination + i, mask, _mm512_maskz_loadu_epi8(tail, source + i));
+        return;
+    }
+#elif defined(__AVX2__)
+    const __m256i enabled256 = _mm256_set1_epi8(static_cast<char>(TLM_BYTE_ENABLED));
+    for (; i + 32 <= length; i += 32)
+    {
+        const auto* enable = reinterpret_cast<const __m256i*>(byteEnable + i);
+        auto* target = reinterpret_cast<__m256i*>(destination + i);
+        __m256i mask = _mm256_cmpeq_epi8(_mm256_loadu_si256(enable), enabled256);
+        __m256i data = _mm256_blendv_epi8(
+            _mm256_loadu_si256(target),
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + i)),
+            mask);
+        _mm256_storeu_si256(target, data);
+    }
+#endif
+
+    for (; i < length; i++)
+    {
+        destination[i] = (byteEnable[i] == TLM_BYTE_ENABLED) ? source[i] : destination[i];
+    }
+}
+
+void maskedCopy(unsigned char* destination,
+                const unsigned char* source,
+                std::size_t length,
+                const unsigned char* byteEnable,
+                std::size_t byteEnableLength,
+                std::size_t byteEnableOffset)
+{
+    // Short byte enable patterns are repeated into a buffer of at least 32 bytes, so that the
+    // contiguous copies below are long enough for the vector paths
+    constexpr std::size_t patternBufferSize = 64;
+    std::array<unsigned char, patternBufferSize> pattern{};
+    if (byteEnableLength < patternBufferSize / 2 && length > byteEnableLength)
+    {
+        std::size_t patternLength = (patternBufferSize / byteEnableLength) * byteEnableLength;
+        if (8 % byteEnableLength == 0)
+        {
+            // Byte enables of 1, 2, 4 or 8 bytes are replicated as one 64 bit word
+            uint64_t word = 0;
+            for (std::size_t i = 0; i < 8; i++)
+                word |= static_cast<uint64_t>(byteEnable[i % byteEnableLength]) << (8 * i);
+            for (std::size_t i = 0; i < patternLength; i += 8)
+                std::memcpy(pattern.data() + i, &word, sizeof(word));
+        }
+        else
+        {
+            for (std::size_t i = 0, index = 0; i < patternLength; i++)
+            {
+                pattern[i] = byteEnable[index];
+                index = (index + 1 == byteEnableLength) ? 0 : index + 1;
+            }
+        }
+
+        byteEnable = pattern.data();
+        byteEnableLength = patternLength;
+    }
+
+    std::size_t byteEnableIndex = byteEnableOffset % byteEnableLength;
+    for (std::size_t i = 0; i < length;)
+    {
+        std::size_t segment = std::min(length - i, byteEnableLength - byteEnableIndex);
+        maskedCopyContiguous(
+            destination + i, source + i, segment, byteEnable + byteEnableIndex);
+        i += segment;
+        byteEnableIndex = 0;
+    }
+}
+
 } // namespace DRAMSys
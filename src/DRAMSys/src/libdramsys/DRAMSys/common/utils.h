@@ -70,6 +70,12 @@ constexpr const std::string_view headline =
 
 std::string getPhaseName(const tlm::tlm_phase& phase);
 
+// Name of a recorded phase without the "BEGIN_" prefix, e.g. "ACT" or "REQ". The names of all
+// request, response and command phases are interned once, no string is built per call.
+const std::string& getRecordedPhaseName(const tlm::tlm_phase& phase);
+// Inverse of getRecordedPhaseName, returns UNINITIALIZED_PHASE for unknown names
+tlm::tlm_phase findRecordedPhase(const std::string& name);
+
 void setUpDummy(tlm::tlm_generic_payload& payload,
                 uint64_t channelPayloadID,
                 Rank rank = Rank(0),
@@ -79,6 +85,16 @@ void setUpDummy(tlm::tlm_generic_payload& payload,
 bool isFullCycle(sc_core::sc_time time, sc_core::sc_time cycleTime);
 sc_core::sc_time alignAtNext(sc_core::sc_time time, sc_core::sc_time alignment);
 
+// Copies the bytes of source whose byte enable is TLM_BYTE_ENABLED to destination. The byte
+// enables repeat every byteEnableLength bytes, byteEnableOffset is the byte enable index of the
+// first byte.
+void maskedCopy(unsigned char* destination,
+                const unsigned char* source,
+                std::size_t length,
+                const unsigned char* byteEnable,
+                std::size_t byteEnableLength,
+                std::size_t byteEnableOffset = 0);
+
 } // namespace DRAMSys
 
 #endif // UTILS_H
@@ -37,6 +37,8 @@
 
 #include "MemSpec.h"
 
+#include <algorithm>
+
 using namespace sc_core;
 using namespace tlm;
 
@@ -115,6 +117,44 @@ bool MemSpec::pseudoChannelMode() const
     return false;
 }
 
+sc_time MemSpec::getCasToCasSameBankGroup() const
+{
+    return SC_ZERO_TIME;
+}
+
+sc_time MemSpec::getBreakEvenActivePowerDown() const
+{
+    SC_REPORT_FATAL("MemSpec", "Break-even times of the low-power states not supported");
+    return SC_ZERO_TIME;
+}
+
+sc_time MemSpec::getBreakEvenPrechargePowerDown() const
+{
+    SC_REPORT_FATAL("MemSpec", "Break-even times of the low-power states not supported");
+    return SC_ZERO_TIME;
+}
+
+sc_time MemSpec::getBreakEvenSelfRefresh() const
+{
+    SC_REPORT_FATAL("MemSpec", "Break-even times of the low-power states not supported");
+    return SC_ZERO_TIME;
+}
+
+sc_time MemSpec::getBreakEven(const sc_time& minimumDuration,
+                              const sc_time& exitLatency,
+                              double standbyPower,
+                              double lowPower)
+{
+    // The state never saves energy
+    if (lowPower >= standbyPower)
+        return sc_max_time();
+
+    // The state saves standbyPower - lowPower while it lasts and costs the standby power during
+    // the exit, which follows the idle period
+    sc_time energyBreakEven = exitLatency * (standbyPower / (standbyPower - lowPower));
+    return std::max(minimumDuration, energyBreakEven);
+}
+
 bool MemSpec::requiresMaskedWrite(const tlm::tlm_generic_payload& payload) const
 {
     if (allBytesEnabled(payload))
@@ -102,6 +102,17 @@ public:
     [[nodiscard]] virtual bool hasRasAndCasBus() const;
     [[nodiscard]] virtual bool pseudoChannelMode() const;
 
+    // Minimum distance of two CAS commands to the same bank group (tCCD_L), zero if the distance
+    // does not depend on the bank group
+    [[nodiscard]] virtual sc_core::sc_time getCasToCasSameBankGroup() const;
+
+    // Shortest idle time for which entering the low-power state saves energy compared to
+    // standby, based on the DRAMPower currents, the exit latency and the minimum duration.
+    // sc_max_time() if the state draws at least the standby power.
+    [[nodiscard]] virtual sc_core::sc_time getBreakEvenActivePowerDown() const;
+    [[nodiscard]] virtual sc_core::sc_time getBreakEvenPrechargePowerDown() const;
+    [[nodiscard]] virtual sc_core::sc_time getBreakEvenSelfRefresh() const;
+
     [[nodiscard]] virtual sc_core::sc_time
     getExecutionTime(Command command, const tlm::tlm_generic_payload& payload) const = 0;
     [[nodiscard]] virtual TimeInterval
@@ -127,6 +138,11 @@ public:
     }
 
 protected:
+    [[nodiscard]] static sc_core::sc_time getBreakEven(const sc_core::sc_time& minimumDuration,
+                                                       const sc_core::sc_time& exitLatency,
+                                                       double standbyPower,
+                                                       double lowPower);
+
     [[nodiscard]] static bool allBytesEnabled(const tlm::tlm_generic_payload& trans)
     {
         if (trans.get_byte_enable_ptr() == nullptr)
@@ -51,6 +51,22 @@ namespace DRAMSys
 
 using DRAMUtils::MemSpec::RefModeTypeDDR4;
 
+namespace
+{
+
+using PowerSpec = DRAMPower::MemSpecDDR4::MemPowerSpec;
+
+// Background power of one device, summed over the voltage domains
+double getBackgroundPower(const DRAMPower::MemSpecDDR4& memSpec, double PowerSpec::*current)
+{
+    double power = 0.0;
+    for (const auto& domain : memSpec.memPowerSpec)
+        power += domain.*current * domain.vXX;
+    return power;
+}
+
+} // namespace
+
 MemSpecDDR4::MemSpecDDR4(const DRAMUtils::MemSpec::MemSpecDDR4& memSpec) :
     MemSpec(memSpec,
             memSpec.memarchitecturespec.nbrOfChannels,
@@ -141,6 +157,11 @@ sc_time MemSpecDDR4::getRefreshIntervalAB() const
     return tREFI;
 }
 
+sc_time MemSpecDDR4::getCasToCasSameBankGroup() const
+{
+    return tCCD_L;
+}
+
 // Returns the execution time for commands that have a fixed execution time
 sc_time MemSpecDDR4::getExecutionTime(Command command,
                                       [[maybe_unused]] const tlm_generic_payload& payload) const
@@ -191,6 +212,33 @@ bool MemSpecDDR4::requiresMaskedWrite(const tlm::tlm_generic_payload& payload) c
     return !allBytesEnabled(payload);
 }
 
+sc_time MemSpecDDR4::getBreakEvenActivePowerDown() const
+{
+    DRAMPower::MemSpecDDR4 powerSpec(memSpec);
+    return getBreakEven(tCKE,
+                        tXP,
+                        getBackgroundPower(powerSpec, &PowerSpec::iXX3N),
+                        getBackgroundPower(powerSpec, &PowerSpec::iXX3P));
+}
+
+sc_time MemSpecDDR4::getBreakEvenPrechargePowerDown() const
+{
+    DRAMPower::MemSpecDDR4 powerSpec(memSpec);
+    return getBreakEven(tCKE,
+                        tXP,
+                        getBackgroundPower(powerSpec, &PowerSpec::iXX2N),
+                        getBackgroundPower(powerSpec, &PowerSpec::iXX2P));
+}
+
+sc_time MemSpecDDR4::getBreakEvenSelfRefresh() const
+{
+    DRAMPower::MemSpecDDR4 powerSpec(memSpec);
+    return getBreakEven(tCKESR,
+                        tXS,
+                        getBackgroundPower(powerSpec, &PowerSpec::iXX2N),
+                        getBackgroundPower(powerSpec, &PowerSpec::iXX6N));
+}
+
 std::unique_ptr<DRAMPower::dram_base<DRAMPower::CmdType>> MemSpecDDR4::toDramPowerObject() const
 {
     return std::make_unique<DRAMPower::DDR4>(DRAMPower::MemSpecDDR4(memSpec));
@@ -89,6 +89,12 @@ public:
 
     [[nodiscard]] sc_core::sc_time getRefreshIntervalAB() const override;
 
+    [[nodiscard]] sc_core::sc_time getCasToCasSameBankGroup() const override;
+
+    [[nodiscard]] sc_core::sc_time getBreakEvenActivePowerDown() const override;
+    [[nodiscard]] sc_core::sc_time getBreakEvenPrechargePowerDown() const override;
+    [[nodiscard]] sc_core::sc_time getBreakEvenSelfRefresh() const override;
+
     [[nodiscard]] sc_core::sc_time
     getExecutionTime(Command command, const tlm::tlm_generic_payload& payload) const override;
     [[nodiscard]] TimeInterval
@@ -0,0 +1,299 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "MemSpecDDR5.h"
+
+#include "DRAMSys/common/utils.h"
+
+#include <DRAMPower/standards/ddr5/DDR5.h>
+
+#include <algorithm>
+#include <iostream>
+
+using namespace sc_core;
+using namespace tlm;
+
+namespace DRAMSys
+{
+
+using DRAMUtils::MemSpec::RefModeTypeDDR5;
+
+namespace
+{
+
+using PowerSpec = DRAMPower::MemSpecDDR5::MemPowerSpec;
+
+// Background power of one device, summed over the voltage domains
+double getBackgroundPower(const DRAMPower::MemSpecDDR5& memSpec, double PowerSpec::*current)
+{
+    double power = 0.0;
+    for (const auto& domain : memSpec.memPowerSpec)
+        power += domain.*current * domain.vXX;
+    return power;
+}
+
+} // namespace
+
+MemSpecDDR5::MemSpecDDR5(const DRAMUtils::MemSpec::MemSpecDDR5& memSpec) :
+    MemSpec(memSpec,
+            memSpec.memarchitecturespec.nbrOfChannels,
+            memSpec.memarchitecturespec.nbrOfRanks,
+            memSpec.memarchitecturespec.nbrOfBanks,
+            memSpec.memarchitecturespec.nbrOfBankGroups,
+            memSpec.memarchitecturespec.nbrOfBanks /
+                memSpec.memarchitecturespec.nbrOfBankGroups,
+            memSpec.memarchitecturespec.nbrOfBanks *
+                memSpec.memarchitecturespec.nbrOfRanks,
+            memSpec.memarchitecturespec.nbrOfBankGroups *
+                memSpec.memarchitecturespec.nbrOfRanks,
+            memSpec.memarchitecturespec.nbrOfDevices),
+    memSpec(memSpec),
+    RAAIMT(memSpec.memarchitecturespec.RAAIMT),
+    RAAMMT(memSpec.memarchitecturespec.RAAMMT),
+    RAADEC(memSpec.memarchitecturespec.RAADEC),
+    tRCD(tCK * memSpec.memtimingspec.RCD),
+    tPPD(tCK * memSpec.memtimingspec.PPD),
+    tRP(tCK * memSpec.memtimingspec.RP),
+    tRAS(tCK * memSpec.memtimingspec.RAS),
+    tRC(tRAS + tRP),
+    tRL(tCK * memSpec.memtimingspec.RL),
+    tRTP(tCK * memSpec.memtimingspec.RTP),
+    tRPRE(tCK * memSpec.memtimingspec.RPRE),
+    tRPST(tCK * memSpec.memtimingspec.RPST),
+    tWL(tCK * memSpec.memtimingspec.WL),
+    tWPRE(tCK * memSpec.memtimingspec.WPRE),
+    tWR(tCK * memSpec.memtimingspec.WR),
+    tCCD_L(tCK * memSpec.memtimingspec.CCD_L_slr),
+    tCCD_L_WR(tCK * memSpec.memtimingspec.CCD_L_WR_slr),
+    tCCD_L_WR2(tCK * memSpec.memtimingspec.CCD_L_WR2_slr),
+    tCCD_S(tCK * memSpec.memtimingspec.CCD_S_slr),
+    tCCD_S_WR(tCK * memSpec.memtimingspec.CCD_S_WR_slr),
+    tRRD_L(tCK * memSpec.memtimingspec.RRD_L_slr),
+    tRRD_S(tCK * memSpec.memtimingspec.RRD_S_slr),
+    tFAW(tCK * memSpec.memtimingspec.FAW_slr),
+    tWTR_L(tCK * memSpec.memtimingspec.WTR_L),
+    tWTR_S(tCK * memSpec.memtimingspec.WTR_S),
+    tREFI((memSpec.memarchitecturespec.RefMode == RefModeTypeDDR5::REF_MODE_2) ?
+        (tCK * memSpec.memtimingspec.REFI2)
+            // RefModeTypeDDR5::REF_MODE_1 || RefModeTypeDDR5::INVALID
+            : (tCK * memSpec.memtimingspec.REFI1)),
+    tREFISB(tCK * memSpec.memtimingspec.REFISB),
+    tRFC((memSpec.memarchitecturespec.RefMode == RefModeTypeDDR5::REF_MODE_2) ?
+        (tCK * memSpec.memtimingspec.RFC2_slr)
+            // RefModeTypeDDR5::REF_MODE_1 || RefModeTypeDDR5::INVALID
+            : (tCK * memSpec.memtimingspec.RFC1_slr)),
+    tRFCsb(tCK * memSpec.memtimingspec.RFCsb_slr),
+    tREFSBRD(tCK * memSpec.memtimingspec.REFSBRD_slr),
+    tXS(tRFC),
+    tRTRS(tCK * memSpec.memtimingspec.RTRS),
+    tCPDED(tCK * memSpec.memtimingspec.CPDED),
+    tPD(tCK * memSpec.memtimingspec.PD),
+    tXP(tCK * memSpec.memtimingspec.XP),
+    tACTPDEN(tCK * memSpec.memtimingspec.ACTPDEN),
+    tPRPDEN(tCK * memSpec.memtimingspec.PRPDEN),
+    tREFPDEN(tCK * memSpec.memtimingspec.REFPDEN)
+{
+    if (RefModeTypeDDR5::INVALID == memSpec.memarchitecturespec.RefMode)
+        SC_REPORT_FATAL("MemSpecDDR5",
+                        "Invalid refresh mode! "
+                        "Set 1 for normal (fixed 1x) or 2 for fine granularity (fixed 2x) "
+                        "refresh mode.");
+
+    if (memSpec.memarchitecturespec.nbrOfRanks !=
+        memSpec.memarchitecturespec.nbrOfDIMMRanks *
+            memSpec.memarchitecturespec.nbrOfPhysicalRanks *
+            memSpec.memarchitecturespec.nbrOfLogicalRanks)
+        SC_REPORT_FATAL("MemSpecDDR5",
+                        "Number of ranks does not match DIMM ranks x physical ranks x logical "
+                        "ranks!");
+
+    // Logical ranks of a 3DS stack share the data bus without rank-to-rank turnaround and use the
+    // dlr timings, which the checker does not model
+    if (memSpec.memarchitecturespec.nbrOfLogicalRanks != 1)
+        SC_REPORT_FATAL("MemSpecDDR5", "3DS devices with logical ranks are not supported!");
+
+    if (maxBurstLength != defaultBurstLength)
+        SC_REPORT_FATAL("MemSpecDDR5", "Burst length 32 is not supported!");
+
+    // ACT, RD and WR use two cycles on the CA bus, all commands are stretched in 2N mode
+    const double cmdMode =
+        std::max<double>(1, static_cast<double>(memSpec.memarchitecturespec.cmdMode));
+    for (double& commandLength : commandLengthInCycles)
+        commandLength = cmdMode;
+    for (Command command : {Command::ACT,
+                            Command::RD,
+                            Command::RDA,
+                            Command::WR,
+                            Command::WRA,
+                            Command::MWR,
+                            Command::MWRA})
+        commandLengthInCycles[command] = 2 * cmdMode;
+
+    uint64_t deviceSizeBits =
+        static_cast<uint64_t>(banksPerRank) * rowsPerBank * columnsPerRow * bitWidth;
+    uint64_t deviceSizeBytes = deviceSizeBits / 8;
+    memorySizeBytes = deviceSizeBytes * devicesPerRank * ranksPerChannel * numberOfChannels;
+
+    std::cout << headline << std::endl;
+    std::cout << "Memory Configuration:" << std::endl << std::endl;
+    std::cout << " Memory type:           "
+              << "DDR5" << std::endl;
+    std::cout << " Memory size in bytes:  " << memorySizeBytes << std::endl;
+    std::cout << " Sub-channels:          " << numberOfChannels << std::endl;
+    std::cout << " Ranks per sub-channel: " << ranksPerChannel << std::endl;
+    std::cout << " Bank groups per rank:  " << groupsPerRank << std::endl;
+    std::cout << " Banks per rank:        " << banksPerRank << std::endl;
+    std::cout << " Rows per bank:         " << rowsPerBank << std::endl;
+    std::cout << " Columns per row:       " << columnsPerRow << std::endl;
+    std::cout << " Device width in bits:  " << bitWidth << std::endl;
+    std::cout << " Device size in bits:   " << deviceSizeBits << std::endl;
+    std::cout << " Device size in bytes:  " << deviceSizeBytes << std::endl;
+    std::cout << " Devices per rank:      " << devicesPerRank << std::endl;
+    std::cout << std::endl;
+}
+
+sc_time MemSpecDDR5::getRefreshIntervalAB() const
+{
+    return tREFI;
+}
+
+sc_time MemSpecDDR5::getRefreshIntervalSB() const
+{
+    return tREFISB;
+}
+
+unsigned MemSpecDDR5::getRAAIMT() const
+{
+    return RAAIMT;
+}
+
+unsigned MemSpecDDR5::getRAAMMT() const
+{
+    return RAAMMT;
+}
+
+unsigned MemSpecDDR5::getRAADEC() const
+{
+    return RAADEC;
+}
+
+sc_time MemSpecDDR5::getCasToCasSameBankGroup() const
+{
+    return tCCD_L;
+}
+
+// Returns the execution time for commands that have a fixed execution time
+sc_time MemSpecDDR5::getExecutionTime(Command command,
+                                      [[maybe_unused]] const tlm_generic_payload& payload) const
+{
+    if (command == Command::PREPB || command == Command::PRESB || command == Command::PREAB)
+        return tRP;
+
+    if (command == Command::ACT)
+        return tRCD;
+
+    if (command == Command::RD)
+        return tRL + burstDuration;
+
+    if (command == Command::RDA)
+        return tRTP + tRP;
+
+    if (command == Command::WR || command == Command::MWR)
+        return tWL + burstDuration;
+
+    if (command == Command::WRA || command == Command::MWRA)
+        return tWL + burstDuration + tWR + tRP;
+
+    if (command == Command::REFAB || command == Command::RFMAB)
+        return tRFC;
+
+    if (command == Command::REFSB || command == Command::RFMSB)
+        return tRFCsb;
+
+    SC_REPORT_FATAL("getExecutionTime",
+                    "command not known or command doesn't have a fixed execution time");
+    throw;
+}
+
+TimeInterval
+MemSpecDDR5::getIntervalOnDataStrobe(Command command,
+                                     [[maybe_unused]] const tlm::tlm_generic_payload& payload) const
+{
+    if (command == Command::RD || command == Command::RDA)
+        return {tRL, tRL + burstDuration};
+
+    if (command == Command::WR || command == Command::WRA || command == Command::MWR ||
+        command == Command::MWRA)
+        return {tWL, tWL + burstDuration};
+
+    SC_REPORT_FATAL("MemSpec", "Method was called with invalid argument");
+    throw;
+}
+
+bool MemSpecDDR5::requiresMaskedWrite(const tlm::tlm_generic_payload& payload) const
+{
+    return !allBytesEnabled(payload);
+}
+
+sc_time MemSpecDDR5::getBreakEvenActivePowerDown() const
+{
+    DRAMPower::MemSpecDDR5 powerSpec(memSpec);
+    return getBreakEven(tPD,
+                        tXP,
+                        getBackgroundPower(powerSpec, &PowerSpec::iXX3N),
+                        getBackgroundPower(powerSpec, &PowerSpec::iXX3P));
+}
+
+sc_time MemSpecDDR5::getBreakEvenPrechargePowerDown() const
+{
+    DRAMPower::MemSpecDDR5 powerSpec(memSpec);
+    return getBreakEven(tPD,
+                        tXP,
+                        getBackgroundPower(powerSpec, &PowerSpec::iXX2N),
+                        getBackgroundPower(powerSpec, &PowerSpec::iXX2P));
+}
+
+sc_time MemSpecDDR5::getBreakEvenSelfRefresh() const
+{
+    DRAMPower::MemSpecDDR5 powerSpec(memSpec);
+    return getBreakEven(tPD,
+                        tXS,
+                        getBackgroundPower(powerSpec, &PowerSpec::iXX2N),
+                        getBackgroundPower(powerSpec, &PowerSpec::iXX6N));
+}
+
+std::unique_ptr<DRAMPower::dram_base<DRAMPower::CmdType>> MemSpecDDR5::toDramPowerObject() const
+{
+    return std::make_unique<DRAMPower::DDR5>(DRAMPower::MemSpecDDR5(memSpec));
+}
+
+} // namespace DRAMSys
@@ -128,6 +128,11 @@ sc_time MemSpecGDDR5::getRefreshIntervalPB() const
     return tREFIPB;
 }
 
+sc_time MemSpecGDDR5::getCasToCasSameBankGroup() const
+{
+    return tCCDL;
+}
+
 sc_time MemSpecGDDR5::getExecutionTime(Command command, const tlm_generic_payload& payload) const
 {
     if (command == Command::PREPB || command == Command::PREAB)
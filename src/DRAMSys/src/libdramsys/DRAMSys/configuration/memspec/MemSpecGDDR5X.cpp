@@ -128,6 +128,11 @@ sc_time MemSpecGDDR5X::getRefreshIntervalPB() const
     return tREFIPB;
 }
 
+sc_time MemSpecGDDR5X::getCasToCasSameBankGroup() const
+{
+    return tCCDL;
+}
+
 sc_time MemSpecGDDR5X::getExecutionTime(Command command, const tlm_generic_payload& payload) const
 {
     if (command == Command::PREPB || command == Command::PREAB)
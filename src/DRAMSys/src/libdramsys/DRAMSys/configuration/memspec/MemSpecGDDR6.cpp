@@ -141,6 +141,11 @@ unsigned MemSpecGDDR6::getPer2BankOffset() const
     return per2BankOffset;
 }
 
+sc_time MemSpecGDDR6::getCasToCasSameBankGroup() const
+{
+    return tCCDL;
+}
+
 sc_time MemSpecGDDR6::getExecutionTime(Command command, const tlm_generic_payload& payload) const
 {
     if (command == Command::PREPB || command == Command::PREAB)
@@ -100,6 +100,8 @@ public:
     [[nodiscard]] sc_core::sc_time getRefreshIntervalP2B() const override;
     [[nodiscard]] unsigned getPer2BankOffset() const override;
 
+    [[nodiscard]] sc_core::sc_time getCasToCasSameBankGroup() const override;
+
     [[nodiscard]] sc_core::sc_time
     getExecutionTime(Command command, const tlm::tlm_generic_payload& payload) const override;
     [[nodiscard]] TimeInterval
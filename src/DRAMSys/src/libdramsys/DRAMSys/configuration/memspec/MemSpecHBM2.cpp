@@ -136,6 +136,11 @@ bool MemSpecHBM2::pseudoChannelMode() const
     return ranksPerChannel != 1;
 }
 
+sc_time MemSpecHBM2::getCasToCasSameBankGroup() const
+{
+    return tCCDL;
+}
+
 sc_time MemSpecHBM2::getExecutionTime(Command command, const tlm_generic_payload& payload) const
 {
     if (command == Command::PREPB || command == Command::PREAB)
@@ -96,6 +96,8 @@ public:
     [[nodiscard]] bool hasRasAndCasBus() const override;
     [[nodiscard]] bool pseudoChannelMode() const override;
 
+    [[nodiscard]] sc_core::sc_time getCasToCasSameBankGroup() const override;
+
     [[nodiscard]] sc_core::sc_time
     getExecutionTime(Command command, const tlm::tlm_generic_payload& payload) const override;
     [[nodiscard]] TimeInterval
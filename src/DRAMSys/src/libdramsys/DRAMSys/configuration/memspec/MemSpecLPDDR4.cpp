@@ -49,6 +49,22 @@ using namespace tlm;
 namespace DRAMSys
 {
 
+namespace
+{
+
+using PowerSpec = DRAMPower::MemSpecLPDDR4::MemPowerSpec;
+
+// Background power of one device, summed over the voltage domains
+double getBackgroundPower(const DRAMPower::MemSpecLPDDR4& memSpec, double PowerSpec::*current)
+{
+    double power = 0.0;
+    for (const auto& domain : memSpec.memPowerSpec)
+        power += domain.*current * domain.vDDX;
+    return power;
+}
+
+} // namespace
+
 MemSpecLPDDR4::MemSpecLPDDR4(const DRAMUtils::MemSpec::MemSpecLPDDR4& memSpec) :
     MemSpec(memSpec,
             memSpec.memarchitecturespec.nbrOfChannels,
@@ -190,6 +206,33 @@ MemSpecLPDDR4::getIntervalOnDataStrobe(Command command,
     throw;
 }
 
+sc_time MemSpecLPDDR4::getBreakEvenActivePowerDown() const
+{
+    DRAMPower::MemSpecLPDDR4 powerSpec(memSpec);
+    return getBreakEven(tCKE,
+                        tXP,
+                        getBackgroundPower(powerSpec, &PowerSpec::iDD3NX),
+                        getBackgroundPower(powerSpec, &PowerSpec::iDD3PX));
+}
+
+sc_time MemSpecLPDDR4::getBreakEvenPrechargePowerDown() const
+{
+    DRAMPower::MemSpecLPDDR4 powerSpec(memSpec);
+    return getBreakEven(tCKE,
+                        tXP,
+                        getBackgroundPower(powerSpec, &PowerSpec::iDD2NX),
+                        getBackgroundPower(powerSpec, &PowerSpec::iDD2PX));
+}
+
+sc_time MemSpecLPDDR4::getBreakEvenSelfRefresh() const
+{
+    DRAMPower::MemSpecLPDDR4 powerSpec(memSpec);
+    return getBreakEven(tSR,
+                        tXSR,
+                        getBackgroundPower(powerSpec, &PowerSpec::iDD2NX),
+                        getBackgroundPower(powerSpec, &PowerSpec::iDD6X));
+}
+
 std::unique_ptr<DRAMPower::dram_base<DRAMPower::CmdType>> MemSpecLPDDR4::toDramPowerObject() const
 {
     return std::make_unique<DRAMPower::LPDDR4>(DRAMPower::MemSpecLPDDR4(memSpec));
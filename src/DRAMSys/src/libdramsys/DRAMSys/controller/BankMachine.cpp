@@ -182,6 +182,21 @@ bool BankMachine::isPrecharged() const
     return state == State::Precharged;
 }
 
+bool BankMachine::hasFurtherRowHit() const
+{
+    return state == State::Activated && currentPayload != nullptr &&
+           scheduler.hasFurtherRowHit(bank, openRow, currentPayload->get_command());
+}
+
+unsigned BankMachine::getRefreshCost() const
+{
+    // 0: idle and precharged, 1: idle and activated, 2: busy, 3: busy with pending row hits
+    if (isIdle())
+        return isActivated() ? 1 : 0;
+
+    return hasFurtherRowHit() ? 3 : 2;
+}
+
 BankMachineOpen::BankMachineOpen(const McConfig& config,
                                  const MemSpec& memSpec,
                                  const SchedulerIF& scheduler,
@@ -63,6 +63,8 @@ public:
     [[nodiscard]] bool isIdle() const;
     [[nodiscard]] bool isActivated() const;
     [[nodiscard]] bool isPrecharged() const;
+    [[nodiscard]] bool hasFurtherRowHit() const;
+    [[nodiscard]] unsigned getRefreshCost() const;
     [[nodiscard]] uint64_t getRefreshManagementCounter() const;
 
 protected:
@@ -41,18 +41,24 @@
 #include "DRAMSys/config/McConfig.h"
 #include "DRAMSys/controller/checker/CheckerDDR3.h"
 #include "DRAMSys/controller/checker/CheckerDDR4.h"
+#include "DRAMSys/controller/checker/CheckerDDR5.h"
 #include "DRAMSys/controller/checker/CheckerGDDR5.h"
 #include "DRAMSys/controller/checker/CheckerGDDR5X.h"
 #include "DRAMSys/controller/checker/CheckerGDDR6.h"
 #include "DRAMSys/controller/checker/CheckerHBM2.h"
+#include "DRAMSys/controller/checker/CheckerHBM3.h"
 #include "DRAMSys/controller/checker/CheckerLPDDR4.h"
+#include "DRAMSys/controller/checker/CheckerLPDDR5.h"
 #include "DRAMSys/controller/checker/CheckerSTTMRAM.h"
 #include "DRAMSys/controller/checker/CheckerWideIO.h"
 #include "DRAMSys/controller/checker/CheckerWideIO2.h"
+#include "DRAMSys/controller/cmdmux/CmdMuxBankGroup.h"
 #include "DRAMSys/controller/cmdmux/CmdMuxOldest.h"
 #include "DRAMSys/controller/cmdmux/CmdMuxStrict.h"
 #include "DRAMSys/controller/powerdown/PowerDownManagerDummy.h"
+#include "DRAMSys/controller/powerdown/PowerDownManagerPredictive.h"
 #include "DRAMSys/controller/powerdown/PowerDownManagerStaggered.h"
+#include "DRAMSys/controller/powerdown/PowerDownManagerTimeout.h"
 #include "DRAMSys/controller/refresh/RefreshManagerAllBank.h"
 #include "DRAMSys/controller/refresh/RefreshManagerDummy.h"
 #include "DRAMSys/controller/refresh/RefreshManagerPer2Bank.h"
@@ -60,24 +66,22 @@
 #include "DRAMSys/controller/refresh/RefreshManagerSameBank.h"
 #include "DRAMSys/controller/respqueue/RespQueueFifo.h"
 #include "DRAMSys/controller/respqueue/RespQueueReorder.h"
+#include "DRAMSys/controller/scheduler/SchedulerBliss.h"
 #include "DRAMSys/controller/scheduler/SchedulerFifo.h"
 #include "DRAMSys/controller/scheduler/SchedulerFrFcfs.h"
 #include "DRAMSys/controller/scheduler/SchedulerFrFcfsGrp.h"
+#include "DRAMSys/controller/scheduler/SchedulerGrpFrFcfsAdaptiveWm.h"
 #include "DRAMSys/controller/scheduler/SchedulerGrpFrFcfs.h"
 #include "DRAMSys/controller/scheduler/SchedulerGrpFrFcfsWm.h"
+#include "DRAMSys/controller/scheduler/SchedulerParBs.h"
 
+#include <algorithm>
+#include <cmath>
 #include <cstdint>
+#include <limits>
 #include <numeric>
 #include <string>
 
-#ifdef DDR5_SIM
-#include "DRAMSys/controller/checker/CheckerDDR5.h"
-#endif
-#include "DRAMSys/controller/checker/CheckerLPDDR5.h"
-#ifdef HBM3_SIM
-#include "DRAMSys/controller/checker/CheckerHBM3.h"
-#endif
-
 using namespace sc_core;
 using namespace tlm;
 
@@ -89,16 +93,24 @@ Controller::Controller(const sc_module_name& name,
                        const MemSpec& memSpec,
                        const SimConfig& simConfig,
                        const AddressDecoder& addressDecoder,
-                       TlmRecorder* tlmRecorder) :
+                       TlmRecorder* tlmRecorder,
+                       MetricsSinkIF* metricsSink,
+                       unsigned int channel) :
     sc_module(name),
     config(config),
     memSpec(memSpec),
     simConfig(simConfig),
     addressDecoder(addressDecoder),
     tlmRecorder(tlmRecorder),
+    metricsSink(metricsSink),
     windowSizeTime(simConfig.windowSize * memSpec.tCK),
     nextWindowEventTime(windowSizeTime),
     numberOfBeatsServed(memSpec.ranksPerChannel, 0),
+    refreshStallCycles(memSpec.ranksPerChannel, 0),
+    powerDownCycles(memSpec.ranksPerChannel, 0),
+    powerDownExitDelayCycles(memSpec.ranksPerChannel, 0),
+    powerDownEntryTimes(memSpec.ranksPerChannel, sc_max_time()),
+    rankWakeupTimes(memSpec.ranksPerChannel, SC_ZERO_TIME),
     minBytesPerBurst(memSpec.defaultBytesPerBurst),
     maxBytesPerBurst(memSpec.maxBytesPerBurst)
 {
@@ -110,6 +122,15 @@ Controller::Controller(const sc_module_name& name,
         windowEvent.notify(windowSizeTime);
     }
 
+    if (metricsSink != nullptr)
+    {
+        metrics.channel = channel;
+        SC_METHOD(publishMetrics);
+        dont_initialize();
+        sensitive << metricsEvent;
+        metricsEvent.notify(windowSizeTime);
+    }
+
     SC_METHOD(controllerMethod);
     sensitive << beginReqEvent << endRespEvent << controllerEvent << dataResponseEvent;
 
@@ -124,6 +145,8 @@ Controller::Controller(const sc_module_name& name,
 
     // reserve buffer for command tuples
     readyCommands.reserve(memSpec.banksPerChannel);
+    commandQueries.reserve(memSpec.banksPerChannel + 2 * memSpec.ranksPerChannel);
+    earliestTimes.reserve(memSpec.banksPerChannel + 2 * memSpec.ranksPerChannel);
 
     // instantiate timing checker
     try
@@ -170,22 +193,18 @@ Controller::Controller(const sc_module_name& name,
             checker =
                 std::make_unique<CheckerSTTMRAM>(dynamic_cast<const MemSpecSTTMRAM&>(memSpec));
         }
-#ifdef DDR5_SIM
         else if (memSpec.memoryType == DRAMUtils::MemSpec::MemSpecDDR5::id)
         {
             checker = std::make_unique<CheckerDDR5>(dynamic_cast<const MemSpecDDR5&>(memSpec));
         }
-#endif
         else if (memSpec.memoryType == DRAMUtils::MemSpec::MemSpecLPDDR5::id)
         {
             checker = std::make_unique<CheckerLPDDR5>(dynamic_cast<const MemSpecLPDDR5&>(memSpec));
         }
-#ifdef HBM3_SIM
         else if (memSpec.memoryType == DRAMUtils::MemSpec::MemSpecHBM3::id)
         {
             checker = std::make_unique<CheckerHBM3>(dynamic_cast<const MemSpecHBM3&>(memSpec));
         }
-#endif
     }
     catch (const std::bad_cast& e)
     {
@@ -203,6 +222,12 @@ Controller::Controller(const sc_module_name& name,
         scheduler = std::make_unique<SchedulerGrpFrFcfs>(config, memSpec);
     else if (config.scheduler == Config::SchedulerType::GrpFrFcfsWm)
         scheduler = std::make_unique<SchedulerGrpFrFcfsWm>(config, memSpec);
+    else if (config.scheduler == Config::SchedulerType::GrpFrFcfsAdaptiveWm)
+        scheduler = std::make_unique<SchedulerGrpFrFcfsAdaptiveWm>(config, memSpec);
+    else if (config.scheduler == Config::SchedulerType::Bliss)
+        scheduler = std::make_unique<SchedulerBliss>(config, memSpec);
+    else if (config.scheduler == Config::SchedulerType::ParBs)
+        scheduler = std::make_unique<SchedulerParBs>(config, memSpec);
 
     if (config.cmdMux == Config::CmdMuxType::Oldest)
     {
@@ -218,6 +243,13 @@ Controller::Controller(const sc_module_name& name,
         else
             cmdMux = std::make_unique<CmdMuxStrict>(memSpec);
     }
+    else if (config.cmdMux == Config::CmdMuxType::BankGroup)
+    {
+        if (memSpec.hasRasAndCasBus())
+            cmdMux = std::make_unique<CmdMuxBankGroupRasCas>(memSpec);
+        else
+            cmdMux = std::make_unique<CmdMuxBankGroup>(memSpec);
+    }
 
     if (config.respQueue == Config::RespQueueType::Fifo)
         respQueue = std::make_unique<RespQueueFifo>();
@@ -273,6 +305,22 @@ Controller::Controller(const sc_module_name& name,
                 bankMachinesOnRank[Rank(rankID)], Rank(rankID)));
         }
     }
+    else if (config.powerDownPolicy == Config::PowerDownPolicyType::Timeout)
+    {
+        for (unsigned rankID = 0; rankID < memSpec.ranksPerChannel; rankID++)
+        {
+            powerDownManagers.push_back(std::make_unique<PowerDownManagerTimeout>(
+                config, memSpec, bankMachinesOnRank[Rank(rankID)], Rank(rankID)));
+        }
+    }
+    else if (config.powerDownPolicy == Config::PowerDownPolicyType::Predictive)
+    {
+        for (unsigned rankID = 0; rankID < memSpec.ranksPerChannel; rankID++)
+        {
+            powerDownManagers.push_back(std::make_unique<PowerDownManagerPredictive>(
+                config, memSpec, bankMachinesOnRank[Rank(rankID)], Rank(rankID)));
+        }
+    }
 
     // instantiate refresh managers (one per rank)
     if (config.refreshPolicy == Config::RefreshPolicyType::NoRefresh)
@@ -280,7 +328,9 @@ Controller::Controller(const sc_module_name& name,
         for (unsigned rankID = 0; rankID < memSpec.ranksPerChannel; rankID++)
             refreshManagers.push_back(std::make_unique<RefreshManagerDummy>());
     }
-    else if (config.refreshPolicy == Config::RefreshPolicyType::AllBank)
+    else if (config.refreshPolicy == Config::RefreshPolicyType::AllBank ||
+             config.refreshPolicy == Config::RefreshPolicyType::AllBank2x ||
+             config.refreshPolicy == Config::RefreshPolicyType::AllBank4x)
     {
         for (unsigned rankID = 0; rankID < memSpec.ranksPerChannel; rankID++)
         {
@@ -356,17 +406,56 @@ void Controller::recordBufferDepth()
     tlmRecorder->recordBufferDepth(sc_time_stamp().to_seconds(), windowAverageBufferDepth);
 }
 
+void Controller::publishMetrics()
+{
+    metricsEvent.notify(windowSizeTime);
+
+    metrics.time = sc_time_stamp().to_seconds();
+    metrics.bandwidth = static_cast<double>(metricsBytesServed) / windowSizeTime.to_seconds();
+    // Column commands that did not need an activate hit an open row
+    metrics.rowHitRate =
+        metricsColumnCommands == 0
+            ? std::numeric_limits<double>::quiet_NaN()
+            : 1.0 - static_cast<double>(std::min(metricsActivates, metricsColumnCommands)) /
+                        static_cast<double>(metricsColumnCommands);
+    metrics.queueDepth = metricsBufferDepth / windowSizeTime;
+    metricsSink->publish(metrics);
+
+    metricsBufferDepth = SC_ZERO_TIME;
+    metricsBytesServed = 0;
+    metricsColumnCommands = 0;
+    metricsActivates = 0;
+    metrics.latencyHistogram.fill(0);
+}
+
+void Controller::recordLatency(const tlm_generic_payload& trans)
+{
+    auto latency = static_cast<uint64_t>(
+        (sc_time_stamp() - ArbiterExtension::getTimeOfGeneration(trans)) / sc_time(1, SC_NS));
+
+    std::size_t bin = 0;
+    while (bin + 1 < MetricsRecord::latencyBins && (latency >> (bin + 1)) != 0)
+        bin++;
+    metrics.latencyHistogram[bin]++;
+}
+
 void Controller::controllerMethod()
 {
     // Compute and report BufferDepth
-    if (simConfig.databaseRecording && simConfig.enableWindowing)
+    bool recordBufferDepth = simConfig.databaseRecording && simConfig.enableWindowing;
+    if (recordBufferDepth || metricsSink != nullptr)
     {
         sc_time timeDiff = sc_time_stamp() - lastTimeCalled;
         lastTimeCalled = sc_time_stamp();
         const std::vector<unsigned>& bufferDepth = scheduler->getBufferDepth();
 
         for (std::size_t index = 0; index < slidingAverageBufferDepth.size(); index++)
-            slidingAverageBufferDepth[index] += bufferDepth[index] * timeDiff;
+        {
+            if (recordBufferDepth)
+                slidingAverageBufferDepth[index] += bufferDepth[index] * timeDiff;
+            if (metricsSink != nullptr)
+                metricsBufferDepth += bufferDepth[index] * timeDiff;
+        }
     }
 
     if (isFullCycle(sc_time_stamp(), memSpec.tCK))
@@ -417,13 +506,14 @@ void Controller::controllerMethod()
     bool readyCmdBlocked = false;
     if (!readyCommands.empty())
     {
-        for (auto& it : readyCommands)
-        {
-            Command command = std::get<CommandTuple::Command>(it);
-            tlm_generic_payload* trans = std::get<CommandTuple::Payload>(it);
-            std::get<CommandTuple::Timestamp>(it) =
-                checker->timeToSatisfyConstraints(command, *trans);
-        }
+        commandQueries.clear();
+        for (const auto& it : readyCommands)
+            commandQueries.emplace_back(std::get<CommandTuple::Command>(it),
+                                        *std::get<CommandTuple::Payload>(it));
+        checker->timeToSatisfyConstraints(commandQueries, earliestTimes);
+        for (std::size_t i = 0; i < readyCommands.size(); i++)
+            std::get<CommandTuple::Timestamp>(readyCommands[i]) = earliestTimes[i];
+
         auto commandTuple = cmdMux->selectCommand(readyCommands);
         if (commandTuple.has_value()) // can happen with FIFO strict
         {
@@ -458,6 +548,14 @@ void Controller::controllerMethod()
             powerDownManagers[rank]->update(command);
             checker->insert(command, *trans);
 
+            if (metricsSink != nullptr)
+            {
+                if (command.isCasCommand())
+                    metricsColumnCommands++;
+                else if (command == Command::ACT)
+                    metricsActivates++;
+            }
+
             if (command.isCasCommand())
             {
                 scheduler->removeRequest(*trans);
@@ -472,7 +570,13 @@ void Controller::controllerMethod()
                     dataResponseEvent.notify(triggerTime - sc_time_stamp());
 
                 ranksNumberOfPayloads[rank]--; // TODO: move to a different place?
+                refreshManagers[rank]->setQueuedRequests(ranksNumberOfPayloads[rank]);
             }
+            else if (isRefreshCommandPhase(command.toPhase()))
+                recordRefreshStall(command, *trans);
+            else if (isPowerDownEntryPhase(command.toPhase()) ||
+                     isPowerDownExitPhase(command.toPhase()))
+                recordPowerDown(command, *trans);
             if (ranksNumberOfPayloads[rank] == 0)
                 powerDownManagers[rank]->triggerEntry();
 
@@ -487,7 +591,7 @@ void Controller::controllerMethod()
     // (6) Restart bank machines, refresh managers and power-down managers to issue new requests for
     // the future
     sc_time timeForNextTrigger = scMaxTime;
-    sc_time localTime;
+    commandQueries.clear();
     for (auto& it : bankMachines)
     {
         it->evaluate();
@@ -495,11 +599,7 @@ void Controller::controllerMethod()
         Command command = std::get<CommandTuple::Command>(commandTuple);
         tlm_generic_payload* trans = std::get<CommandTuple::Payload>(commandTuple);
         if (command != Command::NOP)
-        {
-            localTime = checker->timeToSatisfyConstraints(command, *trans);
-            if (!(localTime == sc_time_stamp() && readyCmdBlocked))
-                timeForNextTrigger = std::min(timeForNextTrigger, localTime);
-        }
+            commandQueries.emplace_back(command, *trans);
     }
     for (auto& it : refreshManagers)
     {
@@ -508,15 +608,10 @@ void Controller::controllerMethod()
         Command command = std::get<CommandTuple::Command>(commandTuple);
         tlm_generic_payload* trans = std::get<CommandTuple::Payload>(commandTuple);
         if (command != Command::NOP)
-        {
-            localTime = checker->timeToSatisfyConstraints(command, *trans);
-            if (!(localTime == sc_time_stamp() && readyCmdBlocked))
-                timeForNextTrigger = std::min(timeForNextTrigger, localTime);
-        }
-        else
-        {
+            commandQueries.emplace_back(command, *trans);
+        else if (it->getTimeForNextTrigger() > sc_time_stamp())
             timeForNextTrigger = std::min(timeForNextTrigger, it->getTimeForNextTrigger());
-        }
+        // else: a due refresh waits for the power-down exit, which is queried below
     }
     for (auto& it : powerDownManagers)
     {
@@ -525,11 +620,16 @@ void Controller::controllerMethod()
         Command command = std::get<CommandTuple::Command>(commandTuple);
         tlm_generic_payload* trans = std::get<CommandTuple::Payload>(commandTuple);
         if (command != Command::NOP)
-        {
-            localTime = checker->timeToSatisfyConstraints(command, *trans);
-            if (!(localTime == sc_time_stamp() && readyCmdBlocked))
-                timeForNextTrigger = std::min(timeForNextTrigger, localTime);
-        }
+            commandQueries.emplace_back(command, *trans);
+        else if (it->getTimeForNextTrigger() > sc_time_stamp())
+            timeForNextTrigger = std::min(timeForNextTrigger, it->getTimeForNextTrigger());
+    }
+
+    checker->timeToSatisfyConstraints(commandQueries, earliestTimes);
+    for (const sc_time& localTime : earliestTimes)
+    {
+        if (!(localTime == sc_time_stamp() && readyCmdBlocked))
+            timeForNextTrigger = std::min(timeForNextTrigger, localTime);
     }
 
     if (timeForNextTrigger != scMaxTime)
@@ -541,8 +641,7 @@ Controller::nb_transport_fw(tlm_generic_payload& trans, tlm_phase& phase, sc_tim
 {
     if (phase == BEGIN_REQ)
     {
-        transToAcquire.payload = &trans;
-        transToAcquire.arrival = sc_time_stamp() + delay + config.thinkDelayFw;
+        transesToAcquire.push({&trans, sc_time_stamp() + delay + config.thinkDelayFw});
         beginReqEvent.notify(delay + config.thinkDelayFw);
     }
     else if (phase == END_RESP)
@@ -581,79 +680,151 @@ unsigned int Controller::transport_dbg(tlm_generic_payload& trans)
 
 void Controller::manageRequests(const sc_time& delay)
 {
-    if (transToAcquire.payload != nullptr && transToAcquire.arrival <= sc_time_stamp())
+    for (unsigned slot = 0; slot < config.channelRequestSlots; slot++)
     {
+        if (transesToAcquire.empty() || transesToAcquire.front().arrival > sc_time_stamp())
+            break;
+
+        PayloadAndArrival& transToAcquire = transesToAcquire.front();
         unsigned requiredBufferEntries =
             transToAcquire.payload->get_data_length() / memSpec.maxBytesPerBurst;
-        if (scheduler->hasBufferSpace(requiredBufferEntries))
+        if (!scheduler->hasBufferSpace(requiredBufferEntries))
         {
-            if (totalNumberOfPayloads == 0)
-                idleTimeCollector.end();
-            totalNumberOfPayloads++; // seems to be ok
+            PRINTDEBUGMESSAGE(name(), "Total number of payloads exceeded, backpressure!");
+            break;
+        }
 
-            transToAcquire.payload->acquire();
+        if (totalNumberOfPayloads == 0)
+            idleTimeCollector.end();
+        totalNumberOfPayloads++; // seems to be ok
 
-            // The following logic assumes that transactions are naturally aligned
-            const uint64_t address = transToAcquire.payload->get_address();
-            const uint64_t dataLength = transToAcquire.payload->get_data_length();
-            assert((dataLength & (dataLength - 1)) == 0); // Data length must be a power of 2
-            assert(address % dataLength == 0);            // Check if naturally aligned
+        transToAcquire.payload->acquire();
 
-            if ((address / maxBytesPerBurst) ==
-                ((address + transToAcquire.payload->get_data_length() - 1) / maxBytesPerBurst))
-            {
-                // continuous block of data that can be fetched with a single burst
-                DecodedAddress decodedAddress =
-                    addressDecoder.decodeAddress(transToAcquire.payload->get_address());
-                ControllerExtension::setAutoExtension(
-                    *transToAcquire.payload,
-                    nextChannelPayloadIDToAppend++,
-                    Rank(decodedAddress.rank),
-                    Stack(decodedAddress.stack),
-                    BankGroup(decodedAddress.bankgroup),
-                    Bank(decodedAddress.bank),
-                    Row(decodedAddress.row),
-                    Column(decodedAddress.column),
-                    (transToAcquire.payload->get_data_length() * 8) / memSpec.dataBusWidth);
-
-                Rank rank = Rank(decodedAddress.rank);
-                if (ranksNumberOfPayloads[rank] == 0)
-                    powerDownManagers[rank]->triggerExit();
-                ranksNumberOfPayloads[rank]++;
+        // The following logic assumes that transactions are naturally aligned
+        const uint64_t address = transToAcquire.payload->get_address();
+        const uint64_t dataLength = transToAcquire.payload->get_data_length();
+        assert((dataLength & (dataLength - 1)) == 0); // Data length must be a power of 2
+        assert(address % dataLength == 0);            // Check if naturally aligned
 
-                scheduler->storeRequest(*transToAcquire.payload);
-                Bank bank = Bank(decodedAddress.bank);
-                bankMachines[bank]->evaluate();
-            }
-            else
+        if ((address / maxBytesPerBurst) ==
+            ((address + transToAcquire.payload->get_data_length() - 1) / maxBytesPerBurst))
+        {
+            // continuous block of data that can be fetched with a single burst
+            DecodedAddress decodedAddress =
+                addressDecoder.decodeAddress(transToAcquire.payload->get_address());
+            ControllerExtension::setAutoExtension(
+                *transToAcquire.payload,
+                nextChannelPayloadIDToAppend++,
+                Rank(decodedAddress.rank),
+                Stack(decodedAddress.stack),
+                BankGroup(decodedAddress.bankgroup),
+                Bank(decodedAddress.bank),
+                Row(decodedAddress.row),
+                Column(decodedAddress.column),
+                (transToAcquire.payload->get_data_length() * 8) / memSpec.dataBusWidth);
+
+            Rank rank = Rank(decodedAddress.rank);
+            if (ranksNumberOfPayloads[rank] == 0)
             {
-                createChildTranses(*transToAcquire.payload);
-                const std::vector<tlm_generic_payload*>& childTranses =
-                    transToAcquire.payload->get_extension<ParentExtension>()->getChildTranses();
-                for (auto* childTrans : childTranses)
-                {
-                    Rank rank = ControllerExtension::getRank(*childTrans);
-                    if (ranksNumberOfPayloads[rank] == 0)
-                        powerDownManagers[rank]->triggerExit();
-                    ranksNumberOfPayloads[rank]++;
-
-                    scheduler->storeRequest(*childTrans);
-                    Bank bank = ControllerExtension::getBank(*childTrans);
-                    bankMachines[bank]->evaluate();
-                }
+                powerDownManagers[rank]->triggerExit();
+                rankWakeupTimes[static_cast<std::size_t>(rank)] = sc_time_stamp();
             }
+            ranksNumberOfPayloads[rank]++;
+            refreshManagers[rank]->setQueuedRequests(ranksNumberOfPayloads[rank]);
 
-            transToAcquire.payload->set_response_status(TLM_OK_RESPONSE);
-            tlm_phase bwPhase = END_REQ;
-            sc_time bwDelay = delay;
-            sendToFrontend(*transToAcquire.payload, bwPhase, bwDelay);
-            transToAcquire.payload = nullptr;
+            scheduler->storeRequest(*transToAcquire.payload);
+            Bank bank = Bank(decodedAddress.bank);
+            bankMachines[bank]->evaluate();
         }
         else
         {
-            PRINTDEBUGMESSAGE(name(), "Total number of payloads exceeded, backpressure!");
+            createChildTranses(*transToAcquire.payload);
+            const std::vector<tlm_generic_payload*>& childTranses =
+                transToAcquire.payload->get_extension<ParentExtension>()->getChildTranses();
+            for (auto* childTrans : childTranses)
+            {
+                Rank rank = ControllerExtension::getRank(*childTrans);
+                if (ranksNumberOfPayloads[rank] == 0)
+                {
+                    powerDownManagers[rank]->triggerExit();
+                    rankWakeupTimes[static_cast<std::size_t>(rank)] = sc_time_stamp();
+                }
+                ranksNumberOfPayloads[rank]++;
+                refreshManagers[rank]->setQueuedRequests(ranksNumberOfPayloads[rank]);
+
+                scheduler->storeRequest(*childTrans);
+                Bank bank = ControllerExtension::getBank(*childTrans);
+                bankMachines[bank]->evaluate();
+            }
         }
+
+        transToAcquire.payload->set_response_status(TLM_OK_RESPONSE);
+        tlm_phase bwPhase = END_REQ;
+        sc_time bwDelay = delay;
+        sendToFrontend(*transToAcquire.payload, bwPhase, bwDelay);
+        transesToAcquire.pop();
     }
+
+    // Requests forwarded in the same cycle with different delays share one event
+    if (!transesToAcquire.empty() && transesToAcquire.front().arrival > sc_time_stamp())
+        beginReqEvent.notify(transesToAcquire.front().arrival - sc_time_stamp());
+}
+
+void Controller::recordRefreshStall(Command command, const tlm_generic_payload& trans)
+{
+    Rank rank = ControllerExtension::getRank(trans);
+    Bank bank = ControllerExtension::getBank(trans);
+
+    // A refresh stalls the rank if requests are waiting for one of the refreshed banks
+    bool stalled = false;
+    if (command.isRankCommand())
+        stalled = ranksNumberOfPayloads[rank] > 0;
+    else if (command.isGroupCommand())
+    {
+        for (std::size_t bankID = (static_cast<std::size_t>(bank) % memSpec.banksPerGroup);
+             bankID < memSpec.banksPerRank;
+             bankID += memSpec.banksPerGroup)
+            stalled = stalled || !bankMachinesOnRank[rank][Bank(bankID)]->isIdle();
+    }
+    else if (command.is2BankCommand())
+    {
+        stalled = !bankMachines[bank]->isIdle() ||
+                  !bankMachines[Bank(static_cast<std::size_t>(bank) + memSpec.getPer2BankOffset())]
+                       ->isIdle();
+    }
+    else
+        stalled = !bankMachines[bank]->isIdle();
+
+    if (stalled)
+    {
+        refreshStallCycles[static_cast<std::size_t>(rank)] += static_cast<uint64_t>(
+            std::round(memSpec.getExecutionTime(command, trans) / memSpec.tCK));
+    }
+}
+
+void Controller::recordPowerDown(Command command, const tlm_generic_payload& trans)
+{
+    auto rank = static_cast<std::size_t>(ControllerExtension::getRank(trans));
+    sc_time now = sc_time_stamp();
+
+    if (isPowerDownEntryPhase(command.toPhase()))
+    {
+        powerDownEntryTimes[rank] = now;
+        return;
+    }
+
+    powerDownCycles[rank] +=
+        static_cast<uint64_t>(std::round((now - powerDownEntryTimes[rank]) / memSpec.tCK));
+
+    // A request that arrived during the power-down waits until the rank accepts commands again
+    if (rankWakeupTimes[rank] >= powerDownEntryTimes[rank])
+    {
+        sc_time readyTime = checker->timeToSatisfyConstraints(Command::ACT, trans);
+        powerDownExitDelayCycles[rank] += static_cast<uint64_t>(
+            std::round((readyTime - rankWakeupTimes[rank]) / memSpec.tCK));
+    }
+
+    powerDownEntryTimes[rank] = scMaxTime;
 }
 
 void Controller::manageResponses()
@@ -692,6 +863,7 @@ void Controller::manageResponses()
             auto rank = ControllerExtension::getRank(*nextTransInRespQueue);
             numberOfBeatsServed[static_cast<std::size_t>(rank)] +=
                 ControllerExtension::getBurstLength(*nextTransInRespQueue);
+            metricsBytesServed += nextTransInRespQueue->get_data_length();
         }
 
         if (ChildExtension::isChildTrans(*nextTransInRespQueue))
@@ -701,6 +873,9 @@ void Controller::manageResponses()
             if (ParentExtension::notifyChildTransCompletion(parentTrans))
             {
                 transToRelease.payload = &parentTrans;
+                if (metricsSink != nullptr)
+                    recordLatency(*transToRelease.payload);
+
                 tlm_phase bwPhase = BEGIN_RESP;
                 sc_time bwDelay = SC_ZERO_TIME;
 
@@ -717,6 +892,9 @@ void Controller::manageResponses()
         else
         {
             transToRelease.payload = nextTransInRespQueue;
+            if (metricsSink != nullptr)
+                recordLatency(*transToRelease.payload);
+
             tlm_phase bwPhase = BEGIN_RESP;
             sc_time bwDelay = SC_ZERO_TIME;
 
@@ -898,6 +1076,40 @@ void Controller::end_of_simulation()
               << std::fixed << std::setprecision(2) << std::setw(6) << maxBandwidth << " Gb/s | "
               << std::setw(6) << maxBandwidth / 8 << " GB/s | " << std::setw(6) << 100.0 << " %"
               << std::endl;
+
+    if (config.refreshPolicy != Config::RefreshPolicyType::NoRefresh)
+    {
+        for (std::size_t i = 0; i < memSpec.ranksPerChannel; i++)
+        {
+            std::string componentName = name();
+            if (memSpec.ranksPerChannel > 1)
+                componentName += (memSpec.pseudoChannelMode() ? ".pc" : ".ra") + std::to_string(i);
+
+            std::cout << std::left << std::setw(24) << componentName
+                      << std::string("  REF stalls:     ") << refreshStallCycles[i] << " cycles"
+                      << std::endl;
+        }
+    }
+
+    if (config.powerDownPolicy != Config::PowerDownPolicyType::NoPowerDown)
+    {
+        for (std::size_t i = 0; i < memSpec.ranksPerChannel; i++)
+        {
+            std::string componentName = name();
+            if (memSpec.ranksPerChannel > 1)
+                componentName += (memSpec.pseudoChannelMode() ? ".pc" : ".ra") + std::to_string(i);
+
+            std::cout << std::left << std::setw(24) << componentName
+                      << std::string("  PDN/SREF time:  ") << powerDownCycles[i] << " cycles"
+                      << std::endl;
+            std::cout << std::left << std::setw(24) << componentName
+                      << std::string("  PDN/SREF delay: ") << powerDownExitDelayCycles[i]
+                      << " cycles" << std::endl;
+        }
+    }
+
+    scheduler->printStatistics(name());
+    cmdMux->printStatistics(name());
 }
 
 void Controller::serialize(std::ostream& stream) const
@@ -46,6 +46,7 @@
 #include "refresh/RefreshManagerIF.h"
 #include "respqueue/RespQueueIF.h"
 #include "DRAMSys/common/Deserialize.h"
+#include "DRAMSys/common/MetricsSinkIF.h"
 #include "DRAMSys/common/Serialize.h"
 
 #include "DRAMSys/common/TlmRecorder.h"
@@ -54,6 +55,7 @@
 #include <DRAMSys/simulation/AddressDecoder.h>
 
 #include <functional>
+#include <queue>
 #include <stack>
 #include <systemc>
 #include <tlm>
@@ -74,7 +76,9 @@ public:
                const MemSpec& memSpec,
                const SimConfig& simConfig,
                const AddressDecoder& addressDecoder,
-               TlmRecorder* tlmRecorder);
+               TlmRecorder* tlmRecorder,
+               MetricsSinkIF* metricsSink,
+               unsigned int channel);
     SC_HAS_PROCESS(Controller);
 
     [[nodiscard]] bool idle() const { return totalNumberOfPayloads == 0; }
@@ -100,12 +104,14 @@ protected:
 
     virtual void controllerMethod();
     void recordBufferDepth();
+    void publishMetrics();
 
     const McConfig& config;
     const MemSpec& memSpec;
     const SimConfig& simConfig;
     const AddressDecoder& addressDecoder;
     TlmRecorder* const tlmRecorder;
+    MetricsSinkIF* const metricsSink;
 
     std::unique_ptr<SchedulerIF> scheduler;
 
@@ -118,11 +124,27 @@ protected:
     std::vector<sc_core::sc_time> slidingAverageBufferDepth;
     std::vector<double> windowAverageBufferDepth;
 
+    // Metrics of the current window, only collected with a metrics sink
+    sc_core::sc_event metricsEvent;
+    MetricsRecord metrics;
+    sc_core::sc_time metricsBufferDepth;
+    uint64_t metricsBytesServed = 0;
+    uint64_t metricsColumnCommands = 0;
+    uint64_t metricsActivates = 0;
+    void recordLatency(const tlm::tlm_generic_payload& trans);
+
     std::vector<uint64_t> numberOfBeatsServed;
+    std::vector<uint64_t> refreshStallCycles;
+    std::vector<uint64_t> powerDownCycles;
+    std::vector<uint64_t> powerDownExitDelayCycles;
+    std::vector<sc_core::sc_time> powerDownEntryTimes;
+    std::vector<sc_core::sc_time> rankWakeupTimes;
     unsigned totalNumberOfPayloads = 0;
     std::function<void()> idleCallback;
     ControllerVector<Rank, unsigned> ranksNumberOfPayloads;
     ReadyCommands readyCommands;
+    CommandQueries commandQueries;
+    std::vector<sc_core::sc_time> earliestTimes;
 
     ControllerVector<Bank, std::unique_ptr<BankMachine>> bankMachines;
     ControllerVector<Rank, ControllerVector<Bank, BankMachine*>> bankMachinesOnRank;
@@ -138,9 +160,13 @@ protected:
     {
         tlm::tlm_generic_payload* payload = nullptr;
         sc_core::sc_time arrival = sc_core::sc_max_time();
-    } transToAcquire, transToRelease;
+    } transToRelease;
+    // Up to channelRequestSlots requests can be in flight from the arbiter
+    std::queue<PayloadAndArrival> transesToAcquire;
 
     void manageResponses();
+    void recordRefreshStall(Command command, const tlm::tlm_generic_payload& trans);
+    void recordPowerDown(Command command, const tlm::tlm_generic_payload& trans);
     void manageRequests(const sc_core::sc_time& delay);
 
     sc_core::sc_event beginReqEvent, endRespEvent, controllerEvent, dataResponseEvent;
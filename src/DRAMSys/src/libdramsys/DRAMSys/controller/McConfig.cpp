@@ -44,6 +44,11 @@ McConfig::McConfig(const Config::McConfig& config, const MemSpec& memSpec) :
     schedulerBuffer(config.SchedulerBuffer.value_or(DEFAULT_SCHEDULER_BUFFER)),
     lowWatermark(config.LowWatermark.value_or(DEFAULT_LOW_WATERMARK)),
     highWatermark(config.HighWatermark.value_or(DEFAULT_HIGH_WATERMARK)),
+    blacklistingThreshold(config.BlacklistingThreshold.value_or(DEFAULT_BLACKLISTING_THRESHOLD)),
+    blacklistingClearingInterval(
+        config.BlacklistingClearingInterval.value_or(DEFAULT_BLACKLISTING_CLEARING_INTERVAL) *
+        memSpec.tCK),
+    batchMarkingCap(config.BatchMarkingCap.value_or(DEFAULT_BATCH_MARKING_CAP)),
     cmdMux(config.CmdMux.value_or(DEFAULT_CMD_MUX)),
     respQueue(config.RespQueue.value_or(DEFAULT_RESP_QUEUE)),
     arbiter(config.Arbiter.value_or(DEFAULT_ARBITER)),
@@ -52,10 +57,22 @@ McConfig::McConfig(const Config::McConfig& config, const MemSpec& memSpec) :
     requestBufferSizeWrite(
         config.RequestBufferSizeWrite.value_or(DEFAULT_REQUEST_BUFFER_SIZE_WRITE)),
     refreshPolicy(config.RefreshPolicy.value_or(DEFAULT_REFRESH_POLICY)),
+    refreshGranularity(refreshPolicy == Config::RefreshPolicyType::AllBank4x   ? 4
+                       : refreshPolicy == Config::RefreshPolicyType::AllBank2x ? 2
+                                                                               : 1),
     refreshMaxPostponed(config.RefreshMaxPostponed.value_or(DEFAULT_REFRESH_MAX_POSTPONED)),
     refreshMaxPulledin(config.RefreshMaxPulledin.value_or(DEFAULT_REFRESH_MAX_PULLEDIN)),
+    refreshFlexibility(config.RefreshFlexibility.value_or(DEFAULT_REFRESH_FLEXIBILITY)),
+    elasticRefreshThreshold(
+        config.ElasticRefreshThreshold.value_or(DEFAULT_ELASTIC_REFRESH_THRESHOLD)),
+    elasticRefreshIdleDelay(
+        config.ElasticRefreshIdleDelay.value_or(DEFAULT_ELASTIC_REFRESH_IDLE_DELAY)),
     powerDownPolicy(config.PowerDownPolicy.value_or(DEFAULT_POWER_DOWN_POLICY)),
+    powerDownTimeout(config.PowerDownTimeout.value_or(DEFAULT_POWER_DOWN_TIMEOUT) * memSpec.tCK),
+    selfRefreshTimeout(config.SelfRefreshTimeout.value_or(DEFAULT_SELF_REFRESH_TIMEOUT) *
+                       memSpec.tCK),
     maxActiveTransactions(config.MaxActiveTransactions.value_or(DEFAULT_MAX_ACTIVE_TRANSACTIONS)),
+    channelRequestSlots(config.ChannelRequestSlots.value_or(DEFAULT_CHANNEL_REQUEST_SLOTS)),
     refreshManagement(config.RefreshManagement.value_or(DEFAULT_REFRESH_MANAGEMENT)),
     arbitrationDelayFw(config.ArbitrationDelayFw.value_or(DEFAULT_ARBITRATION_DELAY_FW) * memSpec.tCK),
     arbitrationDelayBw(config.ArbitrationDelayBw.value_or(DEFAULT_ARBITRATION_DELAY_BW) * memSpec.tCK),
@@ -80,6 +97,14 @@ McConfig::McConfig(const Config::McConfig& config, const MemSpec& memSpec) :
     if (scheduler == Config::SchedulerType::Invalid)
         SC_REPORT_FATAL("McConfig", "Invalid Scheduler");
 
+    if (scheduler == Config::SchedulerType::Bliss &&
+        (blacklistingThreshold == 0 || blacklistingClearingInterval == sc_core::SC_ZERO_TIME))
+        SC_REPORT_FATAL("McConfig", "BlacklistingThreshold and BlacklistingClearingInterval must "
+                                    "be greater than zero");
+
+    if (scheduler == Config::SchedulerType::ParBs && batchMarkingCap == 0)
+        SC_REPORT_FATAL("McConfig", "BatchMarkingCap must be greater than zero");
+
     if (schedulerBuffer == Config::SchedulerBufferType::Invalid)
         SC_REPORT_FATAL("McConfig", "Invalid SchedulerBuffer");
 
@@ -92,12 +117,18 @@ McConfig::McConfig(const Config::McConfig& config, const MemSpec& memSpec) :
     if (refreshPolicy == Config::RefreshPolicyType::Invalid)
         SC_REPORT_FATAL("McConfig", "Invalid RefreshPolicy");
 
+    if (refreshFlexibility == Config::RefreshFlexibilityType::Invalid)
+        SC_REPORT_FATAL("McConfig", "Invalid RefreshFlexibility");
+
     if (powerDownPolicy == Config::PowerDownPolicyType::Invalid)
         SC_REPORT_FATAL("Configuration", "Invalid PowerDownPolicy");
 
     if (arbiter == Config::ArbiterType::Invalid)
         SC_REPORT_FATAL("Arbiter", "Invalid Arbiter");
 
+    if (channelRequestSlots < 1)
+        SC_REPORT_FATAL("Configuration", "Minimum number of channel request slots is 1!");
+
     if (requestBufferSize < 1)
         SC_REPORT_FATAL("Configuration", "Minimum request buffer size is 1!");
 
@@ -55,6 +55,10 @@ struct McConfig
     unsigned int lowWatermark;
     unsigned int highWatermark;
 
+    unsigned int blacklistingThreshold;
+    sc_core::sc_time blacklistingClearingInterval;
+    unsigned int batchMarkingCap;
+
     Config::CmdMuxType cmdMux;
     Config::RespQueueType respQueue;
     Config::ArbiterType arbiter;
@@ -64,11 +68,18 @@ struct McConfig
     unsigned int requestBufferSizeWrite;
 
     Config::RefreshPolicyType refreshPolicy;
+    unsigned int refreshGranularity;
     unsigned int refreshMaxPostponed;
     unsigned int refreshMaxPulledin;
+    Config::RefreshFlexibilityType refreshFlexibility;
+    unsigned int elasticRefreshThreshold;
+    unsigned int elasticRefreshIdleDelay;
 
     Config::PowerDownPolicyType powerDownPolicy;
+    sc_core::sc_time powerDownTimeout;
+    sc_core::sc_time selfRefreshTimeout;
     unsigned int maxActiveTransactions;
+    unsigned int channelRequestSlots;
     bool refreshManagement;
 
     sc_core::sc_time arbitrationDelayFw;
@@ -86,6 +97,9 @@ struct McConfig
         Config::SchedulerBufferType::Bankwise;
     static constexpr unsigned int DEFAULT_LOW_WATERMARK = 0;
     static constexpr unsigned int DEFAULT_HIGH_WATERMARK = 0;
+    static constexpr unsigned int DEFAULT_BLACKLISTING_THRESHOLD = 4;
+    static constexpr unsigned int DEFAULT_BLACKLISTING_CLEARING_INTERVAL = 10000;
+    static constexpr unsigned int DEFAULT_BATCH_MARKING_CAP = 5;
     static constexpr Config::CmdMuxType DEFAULT_CMD_MUX = Config::CmdMuxType::Oldest;
     static constexpr Config::RespQueueType DEFAULT_RESP_QUEUE = Config::RespQueueType::Fifo;
     static constexpr Config::ArbiterType DEFAULT_ARBITER = Config::ArbiterType::Simple;
@@ -96,9 +110,16 @@ struct McConfig
         Config::RefreshPolicyType::AllBank;
     static constexpr unsigned int DEFAULT_REFRESH_MAX_POSTPONED = 0;
     static constexpr unsigned int DEFAULT_REFRESH_MAX_PULLEDIN = 0;
+    static constexpr Config::RefreshFlexibilityType DEFAULT_REFRESH_FLEXIBILITY =
+        Config::RefreshFlexibilityType::Opportunistic;
+    static constexpr unsigned int DEFAULT_ELASTIC_REFRESH_THRESHOLD = 1;
+    static constexpr unsigned int DEFAULT_ELASTIC_REFRESH_IDLE_DELAY = 100;
     static constexpr Config::PowerDownPolicyType DEFAULT_POWER_DOWN_POLICY =
         Config::PowerDownPolicyType::NoPowerDown;
+    static constexpr unsigned int DEFAULT_POWER_DOWN_TIMEOUT = 32;
+    static constexpr unsigned int DEFAULT_SELF_REFRESH_TIMEOUT = 2048;
     static constexpr unsigned int DEFAULT_MAX_ACTIVE_TRANSACTIONS = 64;
+    static constexpr unsigned int DEFAULT_CHANNEL_REQUEST_SLOTS = 1;
     static constexpr bool DEFAULT_REFRESH_MANAGEMENT = false;
     static constexpr unsigned DEFAULT_ARBITRATION_DELAY_FW = 0;
     static constexpr unsigned DEFAULT_ARBITRATION_DELAY_BW = 0;
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef ACTIVATEWINDOW_H
+#define ACTIVATEWINDOW_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace DRAMSys
+{
+
+// Rolling window over the last N activates of a rank (tFAW, t32AW, tTAW). The entries live in
+// a fixed ring, and the earliest cycle at which the next activate may start is updated on every
+// insert so that the checkers only have to read it back.
+template <std::size_t N>
+class ActivateWindow
+{
+public:
+    explicit ActivateWindow(uint64_t windowLength = 0) : windowLength(windowLength) {}
+
+    void insert(uint64_t cycle)
+    {
+        activates[position] = cycle;
+        position = (position + 1) % N;
+
+        if (numberOfActivates < N)
+            numberOfActivates++;
+
+        // Once the ring is full, position points at the oldest of the last N activates
+        if (numberOfActivates == N)
+            earliestNextActivate = activates[position] + windowLength;
+    }
+
+    [[nodiscard]] bool full() const { return numberOfActivates == N; }
+
+    // Zero as long as fewer than N activates have been issued
+    [[nodiscard]] uint64_t getEarliestNextActivate() const { return earliestNextActivate; }
+
+private:
+    std::array<uint64_t, N> activates{};
+    std::size_t position = 0;
+    std::size_t numberOfActivates = 0;
+    uint64_t windowLength;
+    uint64_t earliestNextActivate = 0;
+};
+
+} // namespace DRAMSys
+
+#endif // ACTIVATEWINDOW_H
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "CheckerDDR5.h"
+
+#include <algorithm>
+
+namespace DRAMSys
+{
+
+CheckerDDR5::CheckerDDR5(const MemSpecDDR5& memSpec) : CheckerTable(memSpec, "CheckerDDR5")
+{
+    const uint64_t tACTPDEN = cycleClock.toCycles(memSpec.tACTPDEN);
+    const uint64_t tCCD_L = cycleClock.toCycles(memSpec.tCCD_L);
+    const uint64_t tCCD_L_WR = cycleClock.toCycles(memSpec.tCCD_L_WR);
+    const uint64_t tCCD_L_WR2 = cycleClock.toCycles(memSpec.tCCD_L_WR2);
+    const uint64_t tCCD_S = cycleClock.toCycles(memSpec.tCCD_S);
+    const uint64_t tCCD_S_WR = cycleClock.toCycles(memSpec.tCCD_S_WR);
+    const uint64_t tCK = cycleClock.toCycles(memSpec.tCK);
+    const uint64_t tCPDED = cycleClock.toCycles(memSpec.tCPDED);
+    const uint64_t tFAW = cycleClock.toCycles(memSpec.tFAW);
+    const uint64_t tPD = cycleClock.toCycles(memSpec.tPD);
+    const uint64_t tPPD = cycleClock.toCycles(memSpec.tPPD);
+    const uint64_t tPRPDEN = cycleClock.toCycles(memSpec.tPRPDEN);
+    const uint64_t tRAS = cycleClock.toCycles(memSpec.tRAS);
+    const uint64_t tRC = cycleClock.toCycles(memSpec.tRC);
+    const uint64_t tRCD = cycleClock.toCycles(memSpec.tRCD);
+    const uint64_t tREFPDEN = cycleClock.toCycles(memSpec.tREFPDEN);
+    const uint64_t tREFSBRD = cycleClock.toCycles(memSpec.tREFSBRD);
+    const uint64_t tRFC = cycleClock.toCycles(memSpec.tRFC);
+    const uint64_t tRFCsb = cycleClock.toCycles(memSpec.tRFCsb);
+    const uint64_t tRL = cycleClock.toCycles(memSpec.tRL);
+    const uint64_t tRP = cycleClock.toCycles(memSpec.tRP);
+    const uint64_t tRPRE = cycleClock.toCycles(memSpec.tRPRE);
+    const uint64_t tRPST = cycleClock.toCycles(memSpec.tRPST);
+    const uint64_t tRRD_L = cycleClock.toCycles(memSpec.tRRD_L);
+    const uint64_t tRRD_S = cycleClock.toCycles(memSpec.tRRD_S);
+    const uint64_t tRTP = cycleClock.toCycles(memSpec.tRTP);
+    const uint64_t tRTRS = cycleClock.toCycles(memSpec.tRTRS);
+    const uint64_t tWL = cycleClock.toCycles(memSpec.tWL);
+    const uint64_t tWPRE = cycleClock.toCycles(memSpec.tWPRE);
+    const uint64_t tWR = cycleClock.toCycles(memSpec.tWR);
+    const uint64_t tWTR_L = cycleClock.toCycles(memSpec.tWTR_L);
+    const uint64_t tWTR_S = cycleClock.toCycles(memSpec.tWTR_S);
+    const uint64_t tXP = cycleClock.toCycles(memSpec.tXP);
+    const uint64_t tXS = cycleClock.toCycles(memSpec.tXS);
+
+    const uint64_t tBURST = (memSpec.defaultBurstLength / memSpec.dataRate) * tCK;
+    const uint64_t tRDWR = (((tRL + tBURST) + tRPST) - tWL) + tWPRE;
+    const uint64_t tRDWR_R = (((tRL + tBURST) + tRTRS) - tWL) + tWPRE;
+    const uint64_t tWRRD_S = (tWL + tBURST) + tWTR_S;
+    const uint64_t tWRRD_L = (tWL + tBURST) + tWTR_L;
+    const uint64_t tWRRD_R = (((tWL + tBURST) + tRTRS) - tRL) + tRPRE;
+    const uint64_t tRDAACT = tRTP + tRP;
+    const uint64_t tWRPRE = (tWL + tBURST) + tWR;
+    const uint64_t tWRAACT = tWRPRE + tRP;
+    const uint64_t tRDPDEN = (tRL + tBURST) + tCK;
+    const uint64_t tWRPDEN = (tWL + tBURST) + tWR;
+    const uint64_t tWRAPDEN = ((tWL + tBURST) + tWR) + tCK;
+
+    // Column commands on the shared data bus
+    add(reads, reads, Scope::BankGroup, tCCD_L);
+    add(reads, reads, Scope::Rank, tCCD_S);
+    add(reads, reads, Scope::OtherRanks, tBURST + tRTRS);
+    add(reads, writes, Scope::Rank, tRDWR);
+    add(reads, writes, Scope::OtherRanks, tRDWR_R);
+    add(reads, {Command::PDEA, Command::PDEP}, Scope::Rank, tRDPDEN);
+
+    // A write to the same bank group waits longer if it requires an internal read-modify-write
+    add(writes, {Command::WR, Command::WRA}, Scope::BankGroup, tCCD_L_WR2);
+    add(writes, {Command::MWR, Command::MWRA}, Scope::BankGroup, tCCD_L_WR);
+    add(writes, writes, Scope::Rank, tCCD_S_WR);
+    add(writes, writes, Scope::OtherRanks, tBURST + tRTRS);
+    add(writes, reads, Scope::BankGroup, tWRRD_L);
+    add(writes, reads, Scope::Rank, tWRRD_S);
+    add(writes, reads, Scope::OtherRanks, tWRRD_R);
+
+    // Precharges after column commands, an auto-precharge behaves like a precharge of the bank
+    add({Command::RD}, {Command::PREPB}, Scope::Bank, tRTP);
+    add(reads, {Command::PRESB}, Scope::BankSet, tRTP);
+    add(reads, {Command::PREAB}, Scope::Rank, tRTP);
+    add({Command::RDA}, {Command::ACT}, Scope::Bank, tRDAACT);
+    add({Command::RDA}, sameBankRefreshes, Scope::BankSet, tRDAACT);
+    add({Command::RDA}, allBankRefreshes, Scope::Rank, tRDAACT);
+    add({Command::RDA}, {Command::SREFEN}, Scope::Rank, std::max(tRDPDEN, tRDAACT));
+
+    add({Command::WR, Command::MWR}, {Command::PREPB}, Scope::Bank, tWRPRE);
+    add({Command::WR, Command::MWR},
+        {Command::RDA},
+        Scope::Bank,
+        std::max(tWRRD_L, tWRPRE - std::min(tWRPRE, tRTP)));
+    add(writes, {Command::PRESB}, Scope::BankSet, tWRPRE);
+    add(writes, {Command::PREAB}, Scope::Rank, tWRPRE);
+    add({Command::WR, Command::MWR}, {Command::PDEA, Command::PDEP}, Scope::Rank, tWRPDEN);
+    add({Command::WRA, Command::MWRA}, {Command::ACT}, Scope::Bank, tWRAACT);
+    add({Command::WRA, Command::MWRA}, sameBankRefreshes, Scope::BankSet, tWRAACT);
+    add({Command::WRA, Command::MWRA}, allBankRefreshes, Scope::Rank, tWRAACT);
+    add({Command::WRA, Command::MWRA}, {Command::PDEA, Command::PDEP}, Scope::Rank, tWRAPDEN);
+    add({Command::WRA, Command::MWRA},
+        {Command::SREFEN},
+        Scope::Rank,
+        std::max(tWRAPDEN, tWRAACT));
+
+    // Row commands
+    add({Command::ACT}, reads, Scope::Bank, tRCD);
+    add({Command::ACT}, writes, Scope::Bank, tRCD);
+    add({Command::ACT}, {Command::ACT}, Scope::Bank, tRC);
+    add({Command::ACT}, {Command::ACT}, Scope::BankGroup, tRRD_L);
+    add({Command::ACT}, {Command::ACT}, Scope::Rank, tRRD_S);
+    add({Command::ACT}, {Command::PREPB}, Scope::Bank, tRAS);
+    add({Command::ACT}, {Command::PRESB}, Scope::BankSet, tRAS);
+    add({Command::ACT}, {Command::PREAB}, Scope::Rank, tRAS);
+    add({Command::ACT}, sameBankRefreshes, Scope::BankSet, tRC);
+    add({Command::ACT}, allBankRefreshes, Scope::Rank, tRC);
+    add({Command::ACT}, {Command::SREFEN}, Scope::Rank, tRC);
+    add({Command::ACT}, {Command::PDEA}, Scope::Rank, tACTPDEN);
+
+    add(precharges, precharges, Scope::Rank, tPPD);
+    add({Command::PREPB}, {Command::ACT}, Scope::Bank, tRP);
+    add({Command::PREPB}, sameBankRefreshes, Scope::BankSet, tRP);
+    add({Command::PRESB}, {Command::ACT}, Scope::BankSet, tRP);
+    add({Command::PRESB}, sameBankRefreshes, Scope::BankSet, tRP);
+    add({Command::PREAB}, {Command::ACT}, Scope::Rank, tRP);
+    add({Command::PREAB}, sameBankRefreshes, Scope::Rank, tRP);
+    add(precharges, allBankRefreshes, Scope::Rank, tRP);
+    add(precharges, {Command::SREFEN}, Scope::Rank, tRP);
+    add({Command::PREPB}, {Command::PDEA}, Scope::Rank, tPRPDEN);
+    add(precharges, {Command::PDEP}, Scope::Rank, tPRPDEN);
+
+    // Refresh management commands are timed like the refresh commands of the same granularity
+    add(allBankRefreshes, {Command::ACT}, Scope::Rank, tRFC);
+    add(allBankRefreshes, allBankRefreshes, Scope::Rank, tRFC);
+    add(allBankRefreshes, sameBankRefreshes, Scope::Rank, tRFC);
+    add(allBankRefreshes, {Command::SREFEN}, Scope::Rank, tRFC);
+    add(allBankRefreshes, {Command::PDEP}, Scope::Rank, tREFPDEN);
+
+    add(sameBankRefreshes, {Command::ACT}, Scope::BankSet, tRFCsb);
+    add(sameBankRefreshes, {Command::ACT}, Scope::Rank, tREFSBRD);
+    add(sameBankRefreshes, sameBankRefreshes, Scope::Rank, tRFCsb);
+    add(sameBankRefreshes, allBankRefreshes, Scope::Rank, tRFCsb);
+    add(sameBankRefreshes, {Command::SREFEN}, Scope::Rank, tRFCsb);
+    add(sameBankRefreshes, {Command::PDEA, Command::PDEP}, Scope::Rank, tREFPDEN);
+
+    // Power-down and self refresh
+    add({Command::PDEA}, {Command::PDXA}, Scope::Rank, tPD);
+    add({Command::PDEP}, {Command::PDXP}, Scope::Rank, tPD);
+    add({Command::PDXA}, {Command::PDEA}, Scope::Rank, tCPDED);
+    add({Command::PDXA}, {Command::ACT}, Scope::Rank, tXP);
+    add({Command::PDXA}, precharges, Scope::Rank, tXP);
+    add({Command::PDXA}, reads, Scope::Rank, tXP);
+    add({Command::PDXA}, writes, Scope::Rank, tXP);
+    add({Command::PDXA}, sameBankRefreshes, Scope::Rank, tXP);
+    add({Command::PDXP}, {Command::PDEP}, Scope::Rank, tCPDED);
+    add({Command::PDXP}, {Command::ACT}, Scope::Rank, tXP);
+    add({Command::PDXP}, allBankRefreshes, Scope::Rank, tXP);
+    add({Command::PDXP}, sameBankRefreshes, Scope::Rank, tXP);
+    add({Command::PDXP}, {Command::SREFEN}, Scope::Rank, tXP);
+
+    add({Command::SREFEN}, {Command::SREFEX}, Scope::Rank, tPD);
+    add({Command::SREFEX}, {Command::ACT}, Scope::Rank, tXS);
+    add({Command::SREFEX}, reads, Scope::Rank, tXS);
+    add({Command::SREFEX}, writes, Scope::Rank, tXS);
+    add({Command::SREFEX}, allBankRefreshes, Scope::Rank, tXS);
+    add({Command::SREFEX}, sameBankRefreshes, Scope::Rank, tXS);
+    add({Command::SREFEX}, {Command::PDEP}, Scope::Rank, tXS);
+    add({Command::SREFEX}, {Command::SREFEN}, Scope::Rank, tXS);
+
+    setActivateWindow(tFAW);
+}
+
+} // namespace DRAMSys
@@ -36,9 +36,11 @@
 #define CHECKERGDDR5_H
 
 #include "DRAMSys/configuration/memspec/MemSpecGDDR5.h"
+#include "DRAMSys/controller/checker/ActivateWindow.h"
 #include "DRAMSys/controller/checker/CheckerIF.h"
+#include "DRAMSys/controller/checker/CycleClock.h"
 
-#include <queue>
+#include <limits>
 #include <vector>
 
 namespace DRAMSys
@@ -55,29 +57,65 @@ public:
 
 private:
     const MemSpecGDDR5& memSpec;
+    const CycleClock cycleClock;
 
-    std::vector<ControllerVector<Bank, sc_core::sc_time>> lastScheduledByCommandAndBank;
-    std::vector<ControllerVector<BankGroup, sc_core::sc_time>> lastScheduledByCommandAndBankGroup;
-    std::vector<ControllerVector<Rank, sc_core::sc_time>> lastScheduledByCommandAndRank;
-    std::vector<sc_core::sc_time> lastScheduledByCommand;
+    // Timing parameters in clock cycles
+    uint64_t t32AW;
+    uint64_t tCCDL;
+    uint64_t tCCDS;
+    uint64_t tCK;
+    uint64_t tCKE;
+    uint64_t tCL;
+    uint64_t tFAW;
+    uint64_t tLK;
+    uint64_t tPD;
+    uint64_t tPPD;
+    uint64_t tRAS;
+    uint64_t tRC;
+    uint64_t tRCDRD;
+    uint64_t tRCDWR;
+    uint64_t tRFC;
+    uint64_t tRFCPB;
+    uint64_t tRP;
+    uint64_t tRRDL;
+    uint64_t tRRDS;
+    uint64_t tRREFD;
+    uint64_t tRTP;
+    uint64_t tRTRS;
+    uint64_t tRTW;
+    uint64_t tWCK2CK;
+    uint64_t tWCK2CKPIN;
+    uint64_t tWCK2DQI;
+    uint64_t tWCK2DQO;
+    uint64_t tWL;
+    uint64_t tWR;
+    uint64_t tWTRL;
+    uint64_t tWTRS;
+    uint64_t tXPN;
+    uint64_t tXS;
 
-    sc_core::sc_time lastCommandOnBus;
+    std::vector<ControllerVector<Bank, uint64_t>> lastScheduledByCommandAndBank;
+    std::vector<ControllerVector<BankGroup, uint64_t>> lastScheduledByCommandAndBankGroup;
+    std::vector<ControllerVector<Rank, uint64_t>> lastScheduledByCommandAndRank;
+    std::vector<uint64_t> lastScheduledByCommand;
+
+    uint64_t lastCommandOnBus;
 
     // 4 and 32 activate window
-    ControllerVector<Rank, std::queue<sc_core::sc_time>> last4Activates;
-    ControllerVector<Rank, std::queue<sc_core::sc_time>> last32Activates;
+    ControllerVector<Rank, ActivateWindow<4>> last4Activates;
+    ControllerVector<Rank, ActivateWindow<32>> last32Activates;
 
     ControllerVector<Rank, unsigned> bankwiseRefreshCounter;
 
-    const sc_core::sc_time scMaxTime = sc_core::sc_max_time();
-    sc_core::sc_time tBURST;
-    sc_core::sc_time tRDSRE;
-    sc_core::sc_time tWRSRE;
-    sc_core::sc_time tRDWR_R;
-    sc_core::sc_time tWRRD_S;
-    sc_core::sc_time tWRRD_L;
-    sc_core::sc_time tWRRD_R;
-    sc_core::sc_time tWRPRE;
+    static constexpr uint64_t maxCycle = std::numeric_limits<uint64_t>::max();
+    uint64_t tBURST;
+    uint64_t tRDSRE;
+    uint64_t tWRSRE;
+    uint64_t tRDWR_R;
+    uint64_t tWRRD_S;
+    uint64_t tWRRD_L;
+    uint64_t tWRRD_R;
+    uint64_t tWRPRE;
 };
 
 } // namespace DRAMSys
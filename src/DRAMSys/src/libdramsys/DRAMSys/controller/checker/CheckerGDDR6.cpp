@@ -45,31 +45,69 @@ namespace DRAMSys
 {
 
 CheckerGDDR6::CheckerGDDR6(const MemSpecGDDR6& memSpec) :
-    memSpec(memSpec)
+    memSpec(memSpec),
+    cycleClock(memSpec.tCK)
 {
-    lastScheduledByCommandAndBank = std::vector<ControllerVector<Bank, sc_time>>(
+    tACTPDE = cycleClock.toCycles(memSpec.tACTPDE);
+    tCCDL = cycleClock.toCycles(memSpec.tCCDL);
+    tCCDS = cycleClock.toCycles(memSpec.tCCDS);
+    tCK = cycleClock.toCycles(memSpec.tCK);
+    tCKESR = cycleClock.toCycles(memSpec.tCKESR);
+    tFAW = cycleClock.toCycles(memSpec.tFAW);
+    tLK = cycleClock.toCycles(memSpec.tLK);
+    tPD = cycleClock.toCycles(memSpec.tPD);
+    tPPD = cycleClock.toCycles(memSpec.tPPD);
+    tPREPDE = cycleClock.toCycles(memSpec.tPREPDE);
+    tRAS = cycleClock.toCycles(memSpec.tRAS);
+    tRC = cycleClock.toCycles(memSpec.tRC);
+    tRCDRD = cycleClock.toCycles(memSpec.tRCDRD);
+    tRCDWR = cycleClock.toCycles(memSpec.tRCDWR);
+    tREFPDE = cycleClock.toCycles(memSpec.tREFPDE);
+    tRFCab = cycleClock.toCycles(memSpec.tRFCab);
+    tRFCpb = cycleClock.toCycles(memSpec.tRFCpb);
+    tRL = cycleClock.toCycles(memSpec.tRL);
+    tRP = cycleClock.toCycles(memSpec.tRP);
+    tRRDL = cycleClock.toCycles(memSpec.tRRDL);
+    tRRDS = cycleClock.toCycles(memSpec.tRRDS);
+    tRREFD = cycleClock.toCycles(memSpec.tRREFD);
+    tRTP = cycleClock.toCycles(memSpec.tRTP);
+    tRTRS = cycleClock.toCycles(memSpec.tRTRS);
+    tRTW = cycleClock.toCycles(memSpec.tRTW);
+    tWCK2CK = cycleClock.toCycles(memSpec.tWCK2CK);
+    tWCK2CKPIN = cycleClock.toCycles(memSpec.tWCK2CKPIN);
+    tWCK2DQI = cycleClock.toCycles(memSpec.tWCK2DQI);
+    tWCK2DQO = cycleClock.toCycles(memSpec.tWCK2DQO);
+    tWL = cycleClock.toCycles(memSpec.tWL);
+    tWR = cycleClock.toCycles(memSpec.tWR);
+    tWTRL = cycleClock.toCycles(memSpec.tWTRL);
+    tWTRS = cycleClock.toCycles(memSpec.tWTRS);
+    tXP = cycleClock.toCycles(memSpec.tXP);
+    tXS = cycleClock.toCycles(memSpec.tXS);
+
+    lastScheduledByCommandAndBank = std::vector<ControllerVector<Bank, uint64_t>>(
         Command::numberOfCommands(),
-        ControllerVector<Bank, sc_time>(memSpec.banksPerChannel, scMaxTime));
-    lastScheduledByCommandAndBankGroup = std::vector<ControllerVector<BankGroup, sc_time>>(
+        ControllerVector<Bank, uint64_t>(memSpec.banksPerChannel, maxCycle));
+    lastScheduledByCommandAndBankGroup = std::vector<ControllerVector<BankGroup, uint64_t>>(
         Command::numberOfCommands(),
-        ControllerVector<BankGroup, sc_time>(memSpec.bankGroupsPerChannel, scMaxTime));
-    lastScheduledByCommandAndRank = std::vector<ControllerVector<Rank, sc_time>>(
+        ControllerVector<BankGroup, uint64_t>(memSpec.bankGroupsPerChannel, maxCycle));
+    lastScheduledByCommandAndRank = std::vector<ControllerVector<Rank, uint64_t>>(
         Command::numberOfCommands(),
-        ControllerVector<Rank, sc_time>(memSpec.ranksPerChannel, scMaxTime));
-    lastScheduledByCommand = std::vector<sc_time>(Command::numberOfCommands(), scMaxTime);
-    lastCommandOnBus = scMaxTime;
-    last4Activates = ControllerVector<Rank, std::queue<sc_time>>(memSpec.ranksPerChannel);
+        ControllerVector<Rank, uint64_t>(memSpec.ranksPerChannel, maxCycle));
+    lastScheduledByCommand = std::vector<uint64_t>(Command::numberOfCommands(), maxCycle);
+    lastCommandOnBus = maxCycle;
+    last4Activates = ControllerVector<Rank, ActivateWindow<4>>(
+        memSpec.ranksPerChannel, ActivateWindow<4>(tFAW));
 
     bankwiseRefreshCounter = ControllerVector<Rank, unsigned>(memSpec.ranksPerChannel);
 
-    tBURST = memSpec.defaultBurstLength / memSpec.dataRate * memSpec.tCK;
-    tRDSRE = memSpec.tRL + memSpec.tWCK2CKPIN + memSpec.tWCK2CK + memSpec.tWCK2DQO + tBURST;
-    tWRSRE = memSpec.tWL + memSpec.tWCK2CKPIN + memSpec.tWCK2CK + memSpec.tWCK2DQI + tBURST;
-    tRDWR_R = memSpec.tRL + tBURST + memSpec.tRTRS - memSpec.tWL;
-    tWRRD_R = memSpec.tWL + tBURST + memSpec.tRTRS - memSpec.tRL;
-    tWRRD_S = memSpec.tWL + tBURST + memSpec.tWTRS;
-    tWRRD_L = memSpec.tWL + tBURST + memSpec.tWTRL;
-    tWRPRE = memSpec.tWL + tBURST + memSpec.tWR;
+    tBURST = memSpec.defaultBurstLength / memSpec.dataRate * tCK;
+    tRDSRE = tRL + tWCK2CKPIN + tWCK2CK + tWCK2DQO + tBURST;
+    tWRSRE = tWL + tWCK2CKPIN + tWCK2CK + tWCK2DQI + tBURST;
+    tRDWR_R = tRL + tBURST + tRTRS - tWL;
+    tWRRD_R = tWL + tBURST + tRTRS - tRL;
+    tWRRD_S = tWL + tBURST + tWTRS;
+    tWRRD_L = tWL + tBURST + tWTRL;
+    tWRPRE = tWL + tBURST + tWR;
 }
 
 sc_time CheckerGDDR6::timeToSatisfyConstraints(Command command,
@@ -79,538 +117,520 @@ sc_time CheckerGDDR6::timeToSatisfyConstraints(Command command,
     BankGroup bankGroup = ControllerExtension::getBankGroup(payload);
     Bank bank = ControllerExtension::getBank(payload);
 
-    sc_time lastCommandStart;
-    sc_time earliestTimeToStart = sc_time_stamp();
+    uint64_t lastCommandStart = 0;
+    uint64_t earliestCycleToStart = cycleClock.now();
 
     if (command == Command::RD || command == Command::RDA)
     {
         assert(ControllerExtension::getBurstLength(payload) == 16);
 
         lastCommandStart = lastScheduledByCommandAndBank[Command::ACT][bank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRCDRD);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRCDRD);
 
         lastCommandStart = lastScheduledByCommandAndBankGroup[Command::RD][bankGroup];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tCCDL);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tCCDL);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RD][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tCCDS);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tCCDS);
 
         lastCommandStart =
             lastScheduledByCommand[Command::RD] != lastScheduledByCommandAndRank[Command::RD][rank]
                 ? lastScheduledByCommand[Command::RD]
-                : scMaxTime;
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart =
-                std::max(earliestTimeToStart, lastCommandStart + tBURST + memSpec.tRTRS);
+                : maxCycle;
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart =
+                std::max(earliestCycleToStart, lastCommandStart + tBURST + tRTRS);
 
         lastCommandStart = lastScheduledByCommandAndBankGroup[Command::RDA][bankGroup];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tCCDL);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tCCDL);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RDA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tCCDS);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tCCDS);
 
         lastCommandStart = lastScheduledByCommand[Command::RDA] !=
                                    lastScheduledByCommandAndRank[Command::RDA][rank]
                                ? lastScheduledByCommand[Command::RDA]
-                               : scMaxTime;
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart =
-                std::max(earliestTimeToStart, lastCommandStart + tBURST + memSpec.tRTRS);
+                               : maxCycle;
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart =
+                std::max(earliestCycleToStart, lastCommandStart + tBURST + tRTRS);
 
         if (command == Command::RDA)
         {
             lastCommandStart = lastScheduledByCommandAndBank[Command::WR][bank];
-            if (lastCommandStart != scMaxTime)
-                earliestTimeToStart =
-                    std::max(earliestTimeToStart, lastCommandStart + tWRPRE - memSpec.tRTP);
+            if (lastCommandStart != maxCycle)
+                earliestCycleToStart =
+                    std::max(earliestCycleToStart, lastCommandStart + tWRPRE - tRTP);
         }
 
         lastCommandStart = lastScheduledByCommandAndBankGroup[Command::WR][bankGroup];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRRD_L);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tWRRD_L);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WR][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRRD_S);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tWRRD_S);
 
         lastCommandStart =
             lastScheduledByCommand[Command::WR] != lastScheduledByCommandAndRank[Command::WR][rank]
                 ? lastScheduledByCommand[Command::WR]
-                : scMaxTime;
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRRD_R);
+                : maxCycle;
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tWRRD_R);
 
         lastCommandStart = lastScheduledByCommandAndBankGroup[Command::WRA][bankGroup];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRRD_L);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tWRRD_L);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WRA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRRD_S);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tWRRD_S);
 
         lastCommandStart = lastScheduledByCommand[Command::WRA] !=
                                    lastScheduledByCommandAndRank[Command::WRA][rank]
                                ? lastScheduledByCommand[Command::WRA]
-                               : scMaxTime;
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRRD_R);
+                               : maxCycle;
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tWRRD_R);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tXP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tXP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::SREFEX][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tLK);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tLK);
     }
     else if (command == Command::WR || command == Command::WRA)
     {
         assert(ControllerExtension::getBurstLength(payload) == 16);
 
         lastCommandStart = lastScheduledByCommandAndBank[Command::ACT][bank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRCDWR);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRCDWR);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RD][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRTW);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRTW);
 
         lastCommandStart =
             lastScheduledByCommand[Command::RD] != lastScheduledByCommandAndRank[Command::RD][rank]
                 ? lastScheduledByCommand[Command::RD]
-                : scMaxTime;
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRDWR_R);
+                : maxCycle;
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRDWR_R);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RDA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRTW);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRTW);
 
         lastCommandStart = lastScheduledByCommand[Command::RDA] !=
                                    lastScheduledByCommandAndRank[Command::RDA][rank]
                                ? lastScheduledByCommand[Command::RDA]
-                               : scMaxTime;
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRDWR_R);
+                               : maxCycle;
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRDWR_R);
 
         lastCommandStart = lastScheduledByCommandAndBankGroup[Command::WR][bankGroup];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tCCDL);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tCCDL);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WR][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tCCDS);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tCCDS);
 
         lastCommandStart =
             lastScheduledByCommand[Command::WR] != lastScheduledByCommandAndRank[Command::WR][rank]
                 ? lastScheduledByCommand[Command::WR]
-                : scMaxTime;
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart =
-                std::max(earliestTimeToStart, lastCommandStart + tBURST + memSpec.tRTRS);
+                : maxCycle;
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart =
+                std::max(earliestCycleToStart, lastCommandStart + tBURST + tRTRS);
 
         lastCommandStart = lastScheduledByCommandAndBankGroup[Command::WRA][bankGroup];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tCCDL);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tCCDL);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WRA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tCCDS);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tCCDS);
 
         lastCommandStart = lastScheduledByCommand[Command::WRA] !=
                                    lastScheduledByCommandAndRank[Command::WRA][rank]
                                ? lastScheduledByCommand[Command::WRA]
-                               : scMaxTime;
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart =
-                std::max(earliestTimeToStart, lastCommandStart + tBURST + memSpec.tRTRS);
+                               : maxCycle;
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart =
+                std::max(earliestCycleToStart, lastCommandStart + tBURST + tRTRS);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tXP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tXP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::SREFEX][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tLK);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tLK);
     }
     else if (command == Command::ACT)
     {
         lastCommandStart = lastScheduledByCommandAndBank[Command::ACT][bank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRC);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRC);
 
         lastCommandStart = lastScheduledByCommandAndBankGroup[Command::ACT][bankGroup];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRRDL);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRRDL);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::ACT][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRRDS);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRRDS);
 
         lastCommandStart = lastScheduledByCommandAndBank[Command::RDA][bank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart =
-                std::max(earliestTimeToStart, lastCommandStart + memSpec.tRTP + memSpec.tRP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRTP + tRP);
 
         lastCommandStart = lastScheduledByCommandAndBank[Command::WRA][bank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart =
-                std::max(earliestTimeToStart, lastCommandStart + tWRPRE + memSpec.tRP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tWRPRE + tRP);
 
         lastCommandStart = lastScheduledByCommandAndBank[Command::PREPB][bank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PREAB][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tXP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tXP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXP][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tXP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tXP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::REFAB][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRFCab);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRFCab);
 
         lastCommandStart = lastScheduledByCommandAndBank[Command::REFPB][bank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRFCpb);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRFCpb);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::REFPB][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRREFD);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRREFD);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::SREFEX][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tXS);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tXS);
 
-        if (last4Activates[rank].size() >= 4)
-            earliestTimeToStart =
-                std::max(earliestTimeToStart, last4Activates[rank].front() + memSpec.tFAW);
+        earliestCycleToStart =
+            std::max(earliestCycleToStart, last4Activates[rank].getEarliestNextActivate());
     }
     else if (command == Command::PREPB)
     {
         lastCommandStart = lastScheduledByCommandAndBank[Command::ACT][bank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRAS);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRAS);
 
         lastCommandStart = lastScheduledByCommandAndBank[Command::RD][bank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRTP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRTP);
 
         lastCommandStart = lastScheduledByCommandAndBank[Command::WR][bank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRPRE);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tWRPRE);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PREPB][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tPPD);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tPPD);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tXP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tXP);
     }
     else if (command == Command::PREAB)
     {
         lastCommandStart = lastScheduledByCommandAndRank[Command::ACT][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRAS);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRAS);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RD][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRTP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRTP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RDA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRTP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRTP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WR][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRPRE);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tWRPRE);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WRA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRPRE);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tWRPRE);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PREPB][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tPPD);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tPPD);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tXP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tXP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::REFPB][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRFCpb);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRFCpb);
     }
     else if (command == Command::REFAB)
     {
         lastCommandStart = lastScheduledByCommandAndRank[Command::ACT][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRC);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRC);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RDA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart =
-                std::max(earliestTimeToStart, lastCommandStart + memSpec.tRTP + memSpec.tRP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRTP + tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WRA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart =
-                std::max(earliestTimeToStart, lastCommandStart + tWRPRE + memSpec.tRP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tWRPRE + tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PREPB][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PREAB][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXP][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tXP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tXP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::REFAB][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRFCab);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRFCab);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::REFPB][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRFCpb);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRFCpb);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::SREFEX][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tXS);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tXS);
     }
     else if (command == Command::REFPB)
     {
         lastCommandStart = lastScheduledByCommandAndBank[Command::ACT][bank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRC);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRC);
 
         lastCommandStart = lastScheduledByCommandAndBankGroup[Command::ACT][bankGroup];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRRDL);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRRDL);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::ACT][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRRDS);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRRDS);
 
         lastCommandStart = lastScheduledByCommandAndBank[Command::RDA][bank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart =
-                std::max(earliestTimeToStart, lastCommandStart + memSpec.tRTP + memSpec.tRP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRTP + tRP);
 
         lastCommandStart = lastScheduledByCommandAndBank[Command::WRA][bank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart =
-                std::max(earliestTimeToStart, lastCommandStart + tWRPRE + memSpec.tRP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tWRPRE + tRP);
 
         lastCommandStart = lastScheduledByCommandAndBank[Command::PREPB][bank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PREAB][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tXP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tXP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXP][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tXP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tXP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::REFAB][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRFCab);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRFCab);
 
         lastCommandStart = lastScheduledByCommandAndBank[Command::REFPB][bank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRFCpb);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRFCpb);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::REFPB][rank];
-        if (lastCommandStart != scMaxTime)
+        if (lastCommandStart != maxCycle)
         {
             if (bankwiseRefreshCounter[rank] == 0)
-                earliestTimeToStart =
-                    std::max(earliestTimeToStart, lastCommandStart + memSpec.tRFCpb);
+                earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRFCpb);
             else
-                earliestTimeToStart =
-                    std::max(earliestTimeToStart, lastCommandStart + memSpec.tRREFD);
+                earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRREFD);
         }
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::SREFEX][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tXS);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tXS);
 
-        if (last4Activates[rank].size() >= 4)
-            earliestTimeToStart =
-                std::max(earliestTimeToStart, last4Activates[rank].front() + memSpec.tFAW);
+        earliestCycleToStart =
+            std::max(earliestCycleToStart, last4Activates[rank].getEarliestNextActivate());
     }
     else if (command == Command::PDEA)
     {
         lastCommandStart = lastScheduledByCommandAndRank[Command::ACT][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart =
-                std::max(earliestTimeToStart, lastCommandStart + memSpec.tACTPDE);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tACTPDE);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RD][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRDSRE);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRDSRE);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RDA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRDSRE);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRDSRE);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WR][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRSRE);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tWRSRE);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WRA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRSRE);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tWRSRE);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PREPB][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart =
-                std::max(earliestTimeToStart, lastCommandStart + memSpec.tPREPDE);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tPREPDE);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::REFPB][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart =
-                std::max(earliestTimeToStart, lastCommandStart + memSpec.tREFPDE);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tREFPDE);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tXP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tXP);
     }
     else if (command == Command::PDXA)
     {
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDEA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tPD);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tPD);
     }
     else if (command == Command::PDEP)
     {
         lastCommandStart = lastScheduledByCommandAndRank[Command::RD][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRDSRE);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRDSRE);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RDA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRDSRE);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRDSRE);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WRA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRSRE);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tWRSRE);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PREPB][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart =
-                std::max(earliestTimeToStart, lastCommandStart + memSpec.tPREPDE);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tPREPDE);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PREAB][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart =
-                std::max(earliestTimeToStart, lastCommandStart + memSpec.tPREPDE);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tPREPDE);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::REFAB][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart =
-                std::max(earliestTimeToStart, lastCommandStart + memSpec.tREFPDE);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tREFPDE);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::REFPB][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart =
-                std::max(earliestTimeToStart, lastCommandStart + memSpec.tREFPDE);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tREFPDE);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXP][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tXP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tXP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::SREFEX][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tXS);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tXS);
     }
     else if (command == Command::PDXP)
     {
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDEP][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tPD);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tPD);
     }
     else if (command == Command::SREFEN)
     {
         lastCommandStart = lastScheduledByCommandAndRank[Command::ACT][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRC);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRC);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RD][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRDSRE);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRDSRE);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RDA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart =
-                std::max(earliestTimeToStart,
-                         lastCommandStart + std::max(memSpec.tRTP + memSpec.tRP, tRDSRE));
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart =
+                std::max(earliestCycleToStart,
+                         lastCommandStart + std::max(tRTP + tRP, tRDSRE));
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WRA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart =
-                std::max(earliestTimeToStart, lastCommandStart + tWRPRE + memSpec.tRP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tWRPRE + tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PREPB][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PREAB][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXP][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tXP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tXP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::REFAB][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRFCab);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRFCab);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::REFPB][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRFCpb);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRFCpb);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::SREFEX][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tXS);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tXS);
     }
     else if (command == Command::SREFEX)
     {
         lastCommandStart = lastScheduledByCommandAndRank[Command::SREFEN][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tCKESR);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tCKESR);
     }
     else
         SC_REPORT_FATAL("CheckerGDDR6", "Unknown command!");
 
     // Check if command bus is free
-    if (lastCommandOnBus != scMaxTime)
-        earliestTimeToStart = std::max(earliestTimeToStart, lastCommandOnBus + memSpec.tCK);
+    if (lastCommandOnBus != maxCycle)
+        earliestCycleToStart = std::max(earliestCycleToStart, lastCommandOnBus + tCK);
 
-    return earliestTimeToStart;
+    return cycleClock.toTime(earliestCycleToStart);
 }
 
 void CheckerGDDR6::insert(Command command, const tlm_generic_payload& payload)
@@ -623,17 +643,16 @@ void CheckerGDDR6::insert(Command command, const tlm_generic_payload& payload)
                       "Changing state on bank " + std::to_string(static_cast<std::size_t>(bank)) +
                           " command is " + command.toString());
 
-    lastScheduledByCommandAndBank[command][bank] = sc_time_stamp();
-    lastScheduledByCommandAndBankGroup[command][bankGroup] = sc_time_stamp();
-    lastScheduledByCommandAndRank[command][rank] = sc_time_stamp();
-    lastScheduledByCommand[command] = sc_time_stamp();
-    lastCommandOnBus = sc_time_stamp();
+    const uint64_t currentCycle = cycleClock.now();
+    lastScheduledByCommandAndBank[command][bank] = currentCycle;
+    lastScheduledByCommandAndBankGroup[command][bankGroup] = currentCycle;
+    lastScheduledByCommandAndRank[command][rank] = currentCycle;
+    lastScheduledByCommand[command] = currentCycle;
+    lastCommandOnBus = currentCycle;
 
     if (command == Command::ACT || command == Command::REFPB)
     {
-        if (last4Activates[rank].size() == 4)
-            last4Activates[rank].pop();
-        last4Activates[rank].push(lastCommandOnBus);
+        last4Activates[rank].insert(lastCommandOnBus);
     }
 
     if (command == Command::REFPB)
@@ -46,23 +46,58 @@ using namespace tlm;
 namespace DRAMSys
 {
 
-CheckerHBM2::CheckerHBM2(const MemSpecHBM2& memSpec) : memSpec(memSpec)
+CheckerHBM2::CheckerHBM2(const MemSpecHBM2& memSpec) :
+    memSpec(memSpec),
+    cycleClock(memSpec.tCK)
 {
+    tCCDL = cycleClock.toCycles(memSpec.tCCDL);
+    tCCDR = cycleClock.toCycles(memSpec.tCCDR);
+    tCCDS = cycleClock.toCycles(memSpec.tCCDS);
+    tCK = cycleClock.toCycles(memSpec.tCK);
+    tCKE = cycleClock.toCycles(memSpec.tCKE);
+    tCKESR = cycleClock.toCycles(memSpec.tCKESR);
+    tFAW = cycleClock.toCycles(memSpec.tFAW);
+    tPD = cycleClock.toCycles(memSpec.tPD);
+    tPL = cycleClock.toCycles(memSpec.tPL);
+    tRAS = cycleClock.toCycles(memSpec.tRAS);
+    tRC = cycleClock.toCycles(memSpec.tRC);
+    tRCDRD = cycleClock.toCycles(memSpec.tRCDRD);
+    tRCDWR = cycleClock.toCycles(memSpec.tRCDWR);
+    tRFC = cycleClock.toCycles(memSpec.tRFC);
+    tRFCSB = cycleClock.toCycles(memSpec.tRFCSB);
+    tRL = cycleClock.toCycles(memSpec.tRL);
+    tRP = cycleClock.toCycles(memSpec.tRP);
+    tRRDL = cycleClock.toCycles(memSpec.tRRDL);
+    tRRDS = cycleClock.toCycles(memSpec.tRRDS);
+    tRREFD = cycleClock.toCycles(memSpec.tRREFD);
+    tRTP = cycleClock.toCycles(memSpec.tRTP);
+    tRTW = cycleClock.toCycles(memSpec.tRTW);
+    tWL = cycleClock.toCycles(memSpec.tWL);
+    tWR = cycleClock.toCycles(memSpec.tWR);
+    tWTRL = cycleClock.toCycles(memSpec.tWTRL);
+    tWTRS = cycleClock.toCycles(memSpec.tWTRS);
+    tXP = cycleClock.toCycles(memSpec.tXP);
+    tXS = cycleClock.toCycles(memSpec.tXS);
+    for (unsigned command = 0; command < Command::numberOfCommands(); command++)
+        commandLength[command] =
+            cycleClock.toCycles(memSpec.getCommandLength(static_cast<Command::Type>(command)));
+
     
-    nextCommandByBank.fill({BankVector<sc_time>(memSpec.banksPerChannel, SC_ZERO_TIME)});
-    nextCommandByBankGroup.fill({BankGroupVector<sc_time>(memSpec.bankGroupsPerChannel, SC_ZERO_TIME)});
-    nextCommandByRank.fill({RankVector<sc_time>(memSpec.ranksPerChannel, SC_ZERO_TIME)});
-    nextCommandByStack.fill({StackVector<sc_time>(memSpec.stacksPerChannel, SC_ZERO_TIME)});
-    last4ActivatesOnRank = RankVector<std::queue<sc_time>>(memSpec.ranksPerChannel);
+    nextCommandByBank.fill({BankVector<uint64_t>(memSpec.banksPerChannel, 0)});
+    nextCommandByBankGroup.fill({BankGroupVector<uint64_t>(memSpec.bankGroupsPerChannel, 0)});
+    nextCommandByRank.fill({RankVector<uint64_t>(memSpec.ranksPerChannel, 0)});
+    nextCommandByStack.fill({StackVector<uint64_t>(memSpec.stacksPerChannel, 0)});
+    last4ActivatesOnRank = RankVector<ActivateWindow<4>>(
+        memSpec.ranksPerChannel, ActivateWindow<4>(tFAW));
 
-    tBURST = ((memSpec.defaultBurstLength / memSpec.dataRate) * memSpec.tCK);
-    tRDPDE = (((memSpec.tRL + memSpec.tPL) + tBURST) + memSpec.tCK);
+    tBURST = ((memSpec.defaultBurstLength / memSpec.dataRate) * tCK);
+    tRDPDE = (((tRL + tPL) + tBURST) + tCK);
     tRDSRE = tRDPDE;
-    tWRPRE = ((memSpec.tWL + tBURST) + memSpec.tWR);
-    tWRPDE = ((((memSpec.tWL + memSpec.tPL) + tBURST) + memSpec.tCK) + memSpec.tWR);
-    tWRAPDE = ((((memSpec.tWL + memSpec.tPL) + tBURST) + memSpec.tCK) + memSpec.tWR);
-    tWRRDS = ((memSpec.tWL + tBURST) + memSpec.tWTRS);
-    tWRRDL = ((memSpec.tWL + tBURST) + memSpec.tWTRL);
+    tWRPRE = ((tWL + tBURST) + tWR);
+    tWRPDE = ((((tWL + tPL) + tBURST) + tCK) + tWR);
+    tWRAPDE = ((((tWL + tPL) + tBURST) + tCK) + tWR);
+    tWRRDS = ((tWL + tBURST) + tWTRS);
+    tWRRDL = ((tWL + tBURST) + tWTRL);
     
     bankwiseRefreshCounter = ControllerVector<Rank, unsigned>(memSpec.ranksPerChannel);
 }
@@ -75,23 +110,23 @@ sc_time CheckerHBM2::timeToSatisfyConstraints(Command command, const tlm_generic
     Stack stack = ControllerExtension::getStack(payload);
     
 
-    sc_time earliestTimeToStart = sc_time_stamp();
+    uint64_t earliestCycleToStart = cycleClock.now();
 
     
-    earliestTimeToStart = std::max(earliestTimeToStart, nextCommandByBank[command][bank]);
-    earliestTimeToStart = std::max(earliestTimeToStart, nextCommandByBankGroup[command][bankGroup]);
-    earliestTimeToStart = std::max(earliestTimeToStart, nextCommandByRank[command][rank]);
-    earliestTimeToStart = std::max(earliestTimeToStart, nextCommandByStack[command][stack]);
+    earliestCycleToStart = std::max(earliestCycleToStart, nextCommandByBank[command][bank]);
+    earliestCycleToStart = std::max(earliestCycleToStart, nextCommandByBankGroup[command][bankGroup]);
+    earliestCycleToStart = std::max(earliestCycleToStart, nextCommandByRank[command][rank]);
+    earliestCycleToStart = std::max(earliestCycleToStart, nextCommandByStack[command][stack]);
     if (command.isRasCommand())
     {
-        earliestTimeToStart = std::max(earliestTimeToStart, nextCommandOnRasBus);
+        earliestCycleToStart = std::max(earliestCycleToStart, nextCommandOnRasBus);
     }
     if (command.isCasCommand())
     {
-        earliestTimeToStart = std::max(earliestTimeToStart, nextCommandOnCasBus);
+        earliestCycleToStart = std::max(earliestCycleToStart, nextCommandOnCasBus);
     }
 
-    return earliestTimeToStart;
+    return cycleClock.toTime(earliestCycleToStart);
 }
 
 void CheckerHBM2::insert(Command command, const tlm_generic_payload& payload)
@@ -105,7 +140,7 @@ void CheckerHBM2::insert(Command command, const tlm_generic_payload& payload)
     PRINTDEBUGMESSAGE("CheckerHBM2", "Changing state on bank " + std::to_string(static_cast<std::size_t>(bank))
                       + " command is " + command.toString());
     
-    const sc_time& currentTime = sc_time_stamp();
+    const uint64_t currentCycle = cycleClock.now();
     if (command == Command::REFPB || command == Command::RFMPB)
     {
         bankwiseRefreshCounter[rank] = (bankwiseRefreshCounter[rank] + 1) % memSpec.banksPerRank;
@@ -115,93 +150,93 @@ void CheckerHBM2::insert(Command command, const tlm_generic_payload& payload)
     {
     case Command::RD:
     {
-        // Bank (RD,PREPB) memSpec.tRTP [] SameComponent()
+        // Bank (RD,PREPB) tRTP [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tRTP;
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::PREPB][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRTP;
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::PREPB][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // BankGroup (RD,RD) memSpec.tCCDL [] SameComponent()
+        // BankGroup (RD,RD) tCCDL [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCCDL;
-            sc_time &earliestTimeToStart = nextCommandByBankGroup[Command::RD][bankGroup];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCDL;
+            uint64_t& earliestCycleToStart = nextCommandByBankGroup[Command::RD][bankGroup];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // BankGroup (RD,RDA) memSpec.tCCDL [] SameComponent()
+        // BankGroup (RD,RDA) tCCDL [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCCDL;
-            sc_time &earliestTimeToStart = nextCommandByBankGroup[Command::RDA][bankGroup];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCDL;
+            uint64_t& earliestCycleToStart = nextCommandByBankGroup[Command::RDA][bankGroup];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (RD,PREAB) memSpec.tRTP [] SameComponent()
+        // Rank (RD,PREAB) tRTP [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tRTP;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PREAB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRTP;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PREAB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (RD,PDEA) tRDPDE [] SameComponent()
         {
-            const sc_time constraint = currentTime + tRDPDE;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PDEA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRDPDE;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PDEA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (RD,PDEP) tRDPDE [] SameComponent()
         {
-            const sc_time constraint = currentTime + tRDPDE;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PDEP][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRDPDE;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PDEP][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (RD,RD) memSpec.tCCDS [] SameComponent()
+        // Rank (RD,RD) tCCDS [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCCDS;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::RD][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCDS;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::RD][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (RD,RDA) memSpec.tCCDS [] SameComponent()
+        // Rank (RD,RDA) tCCDS [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCCDS;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::RDA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCDS;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::RDA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (RD,WR) memSpec.tRTW [] SameComponent()
+        // Rank (RD,WR) tRTW [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tRTW;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::WR][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRTW;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::WR][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (RD,MWR) memSpec.tRTW [] SameComponent()
+        // Rank (RD,MWR) tRTW [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tRTW;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::MWR][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRTW;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::MWR][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (RD,WRA) memSpec.tRTW [] SameComponent()
+        // Rank (RD,WRA) tRTW [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tRTW;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::WRA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRTW;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::WRA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (RD,MWRA) memSpec.tRTW [] SameComponent()
+        // Rank (RD,MWRA) tRTW [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tRTW;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::MWRA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRTW;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::MWRA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Channel (RD,RD) memSpec.tCCDR [] Different(level=<ComponentLevel.Stack: 7>)
+        // Channel (RD,RD) tCCDR [] Different(level=<ComponentLevel.Stack: 7>)
         {
-            const sc_time constraint = currentTime + memSpec.tCCDR;
+            const uint64_t constraint = currentCycle + tCCDR;
             for (unsigned int i = memSpec.stacksPerChannel * static_cast<unsigned>(0); i < memSpec.stacksPerChannel * (1 + static_cast<unsigned>(0)); i++)
             {
                 Stack currentStack{i};
@@ -209,14 +244,14 @@ void CheckerHBM2::insert(Command command, const tlm_generic_payload& payload)
                 if (currentStack == stack)
                     continue;
                 
-                sc_time &earliestTimeToStart = nextCommandByStack[Command::RD][currentStack];
-                earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+                uint64_t& earliestCycleToStart = nextCommandByStack[Command::RD][currentStack];
+                earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
-        // Channel (RD,RDA) memSpec.tCCDR [] Different(level=<ComponentLevel.Stack: 7>)
+        // Channel (RD,RDA) tCCDR [] Different(level=<ComponentLevel.Stack: 7>)
         {
-            const sc_time constraint = currentTime + memSpec.tCCDR;
+            const uint64_t constraint = currentCycle + tCCDR;
             for (unsigned int i = memSpec.stacksPerChannel * static_cast<unsigned>(0); i < memSpec.stacksPerChannel * (1 + static_cast<unsigned>(0)); i++)
             {
                 Stack currentStack{i};
@@ -224,8 +259,8 @@ void CheckerHBM2::insert(Command command, const tlm_generic_payload& payload)
                 if (currentStack == stack)
                     continue;
                 
-                sc_time &earliestTimeToStart = nextCommandByStack[Command::RDA][currentStack];
-                earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+                uint64_t& earliestCycleToStart = nextCommandByStack[Command::RDA][currentStack];
+                earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
@@ -236,114 +271,114 @@ void CheckerHBM2::insert(Command command, const tlm_generic_payload& payload)
     {
         // Bank (WR,PREPB) tWRPRE [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRPRE;
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::PREPB][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRPRE;
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::PREPB][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Bank (WR,RDA) ((memSpec.tWL + tBURST) + std::max((memSpec.tWR - memSpec.tRTP), memSpec.tWTRL)) [] SameComponent()
+        // Bank (WR,RDA) ((tWL + tBURST) + std::max((tWR - tRTP), tWTRL)) [] SameComponent()
         {
-            const sc_time constraint = currentTime + ((memSpec.tWL + tBURST) + std::max((memSpec.tWR - memSpec.tRTP), memSpec.tWTRL));
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::RDA][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + ((tWL + tBURST) + std::max((tWR - tRTP), tWTRL));
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::RDA][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // BankGroup (WR,WR) memSpec.tCCDL [] SameComponent()
+        // BankGroup (WR,WR) tCCDL [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCCDL;
-            sc_time &earliestTimeToStart = nextCommandByBankGroup[Command::WR][bankGroup];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCDL;
+            uint64_t& earliestCycleToStart = nextCommandByBankGroup[Command::WR][bankGroup];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // BankGroup (WR,MWR) memSpec.tCCDL [] SameComponent()
+        // BankGroup (WR,MWR) tCCDL [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCCDL;
-            sc_time &earliestTimeToStart = nextCommandByBankGroup[Command::MWR][bankGroup];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCDL;
+            uint64_t& earliestCycleToStart = nextCommandByBankGroup[Command::MWR][bankGroup];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // BankGroup (WR,WRA) memSpec.tCCDL [] SameComponent()
+        // BankGroup (WR,WRA) tCCDL [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCCDL;
-            sc_time &earliestTimeToStart = nextCommandByBankGroup[Command::WRA][bankGroup];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCDL;
+            uint64_t& earliestCycleToStart = nextCommandByBankGroup[Command::WRA][bankGroup];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // BankGroup (WR,MWRA) memSpec.tCCDL [] SameComponent()
+        // BankGroup (WR,MWRA) tCCDL [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCCDL;
-            sc_time &earliestTimeToStart = nextCommandByBankGroup[Command::MWRA][bankGroup];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCDL;
+            uint64_t& earliestCycleToStart = nextCommandByBankGroup[Command::MWRA][bankGroup];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // BankGroup (WR,RD) tWRRDL [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRRDL;
-            sc_time &earliestTimeToStart = nextCommandByBankGroup[Command::RD][bankGroup];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRRDL;
+            uint64_t& earliestCycleToStart = nextCommandByBankGroup[Command::RD][bankGroup];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // BankGroup (WR,RDA) tWRRDL [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRRDL;
-            sc_time &earliestTimeToStart = nextCommandByBankGroup[Command::RDA][bankGroup];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRRDL;
+            uint64_t& earliestCycleToStart = nextCommandByBankGroup[Command::RDA][bankGroup];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (WR,PREAB) tWRPRE [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRPRE;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PREAB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRPRE;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PREAB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (WR,PDEA) tWRPDE [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRPDE;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PDEA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRPDE;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PDEA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (WR,WR) memSpec.tCCDS [] SameComponent()
+        // Rank (WR,WR) tCCDS [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCCDS;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::WR][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCDS;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::WR][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (WR,MWR) memSpec.tCCDS [] SameComponent()
+        // Rank (WR,MWR) tCCDS [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCCDS;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::MWR][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCDS;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::MWR][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (WR,WRA) memSpec.tCCDS [] SameComponent()
+        // Rank (WR,WRA) tCCDS [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCCDS;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::WRA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCDS;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::WRA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (WR,MWRA) memSpec.tCCDS [] SameComponent()
+        // Rank (WR,MWRA) tCCDS [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCCDS;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::MWRA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCDS;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::MWRA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (WR,RD) tWRRDS [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRRDS;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::RD][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRRDS;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::RD][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (WR,RDA) tWRRDS [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRRDS;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::RDA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRRDS;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::RDA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
 
@@ -353,114 +388,114 @@ void CheckerHBM2::insert(Command command, const tlm_generic_payload& payload)
     {
         // Bank (MWR,PREPB) tWRPRE [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRPRE;
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::PREPB][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRPRE;
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::PREPB][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Bank (MWR,RDA) ((memSpec.tWL + tBURST) + std::max((memSpec.tWR - memSpec.tRTP), memSpec.tWTRL)) [] SameComponent()
+        // Bank (MWR,RDA) ((tWL + tBURST) + std::max((tWR - tRTP), tWTRL)) [] SameComponent()
         {
-            const sc_time constraint = currentTime + ((memSpec.tWL + tBURST) + std::max((memSpec.tWR - memSpec.tRTP), memSpec.tWTRL));
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::RDA][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + ((tWL + tBURST) + std::max((tWR - tRTP), tWTRL));
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::RDA][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // BankGroup (MWR,WR) memSpec.tCCDL [] SameComponent()
+        // BankGroup (MWR,WR) tCCDL [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCCDL;
-            sc_time &earliestTimeToStart = nextCommandByBankGroup[Command::WR][bankGroup];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCDL;
+            uint64_t& earliestCycleToStart = nextCommandByBankGroup[Command::WR][bankGroup];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // BankGroup (MWR,MWR) memSpec.tCCDL [] SameComponent()
+        // BankGroup (MWR,MWR) tCCDL [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCCDL;
-            sc_time &earliestTimeToStart = nextCommandByBankGroup[Command::MWR][bankGroup];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCDL;
+            uint64_t& earliestCycleToStart = nextCommandByBankGroup[Command::MWR][bankGroup];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // BankGroup (MWR,WRA) memSpec.tCCDL [] SameComponent()
+        // BankGroup (MWR,WRA) tCCDL [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCCDL;
-            sc_time &earliestTimeToStart = nextCommandByBankGroup[Command::WRA][bankGroup];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCDL;
+            uint64_t& earliestCycleToStart = nextCommandByBankGroup[Command::WRA][bankGroup];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // BankGroup (MWR,MWRA) memSpec.tCCDL [] SameComponent()
+        // BankGroup (MWR,MWRA) tCCDL [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCCDL;
-            sc_time &earliestTimeToStart = nextCommandByBankGroup[Command::MWRA][bankGroup];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCDL;
+            uint64_t& earliestCycleToStart = nextCommandByBankGroup[Command::MWRA][bankGroup];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // BankGroup (MWR,RD) tWRRDL [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRRDL;
-            sc_time &earliestTimeToStart = nextCommandByBankGroup[Command::RD][bankGroup];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRRDL;
+            uint64_t& earliestCycleToStart = nextCommandByBankGroup[Command::RD][bankGroup];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // BankGroup (MWR,RDA) tWRRDL [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRRDL;
-            sc_time &earliestTimeToStart = nextCommandByBankGroup[Command::RDA][bankGroup];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRRDL;
+            uint64_t& earliestCycleToStart = nextCommandByBankGroup[Command::RDA][bankGroup];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (MWR,PREAB) tWRPRE [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRPRE;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PREAB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRPRE;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PREAB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (MWR,PDEA) tWRPDE [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRPDE;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PDEA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRPDE;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PDEA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (MWR,WR) memSpec.tCCDS [] SameComponent()
+        // Rank (MWR,WR) tCCDS [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCCDS;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::WR][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCDS;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::WR][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (MWR,MWR) memSpec.tCCDS [] SameComponent()
+        // Rank (MWR,MWR) tCCDS [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCCDS;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::MWR][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCDS;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::MWR][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (MWR,WRA) memSpec.tCCDS [] SameComponent()
+        // Rank (MWR,WRA) tCCDS [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCCDS;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::WRA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCDS;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::WRA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (MWR,MWRA) memSpec.tCCDS [] SameComponent()
+        // Rank (MWR,MWRA) tCCDS [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCCDS;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::MWRA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCDS;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::MWRA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (MWR,RD) tWRRDS [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRRDS;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::RD][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRRDS;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::RD][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (MWR,RDA) tWRRDS [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRRDS;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::RDA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRRDS;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::RDA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
 
@@ -468,114 +503,114 @@ void CheckerHBM2::insert(Command command, const tlm_generic_payload& payload)
     }
     case Command::RDA:
     {
-        // Bank (RDA,ACT) ((memSpec.tRTP + memSpec.tRP) - memSpec.tCK) [] SameComponent()
+        // Bank (RDA,ACT) ((tRTP + tRP) - tCK) [] SameComponent()
         {
-            const sc_time constraint = currentTime + ((memSpec.tRTP + memSpec.tRP) - memSpec.tCK);
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::ACT][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + ((tRTP + tRP) - tCK);
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::ACT][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Bank (RDA,REFPB) (memSpec.tRTP + memSpec.tRP) [] SameComponent()
+        // Bank (RDA,REFPB) (tRTP + tRP) [] SameComponent()
         {
-            const sc_time constraint = currentTime + (memSpec.tRTP + memSpec.tRP);
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::REFPB][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tRTP + tRP);
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::REFPB][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // BankGroup (RDA,RD) memSpec.tCCDL [] SameComponent()
+        // BankGroup (RDA,RD) tCCDL [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCCDL;
-            sc_time &earliestTimeToStart = nextCommandByBankGroup[Command::RD][bankGroup];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCDL;
+            uint64_t& earliestCycleToStart = nextCommandByBankGroup[Command::RD][bankGroup];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // BankGroup (RDA,RDA) memSpec.tCCDL [] SameComponent()
+        // BankGroup (RDA,RDA) tCCDL [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCCDL;
-            sc_time &earliestTimeToStart = nextCommandByBankGroup[Command::RDA][bankGroup];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCDL;
+            uint64_t& earliestCycleToStart = nextCommandByBankGroup[Command::RDA][bankGroup];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (RDA,PDEA) tRDPDE [] SameComponent()
         {
-            const sc_time constraint = currentTime + tRDPDE;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PDEA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRDPDE;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PDEA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (RDA,PDEP) tRDPDE [] SameComponent()
         {
-            const sc_time constraint = currentTime + tRDPDE;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PDEP][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRDPDE;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PDEP][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (RDA,RD) memSpec.tCCDS [] SameComponent()
+        // Rank (RDA,RD) tCCDS [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCCDS;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::RD][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCDS;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::RD][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (RDA,RDA) memSpec.tCCDS [] SameComponent()
+        // Rank (RDA,RDA) tCCDS [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCCDS;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::RDA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCDS;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::RDA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (RDA,WR) memSpec.tRTW [] SameComponent()
+        // Rank (RDA,WR) tRTW [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tRTW;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::WR][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRTW;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::WR][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (RDA,MWR) memSpec.tRTW [] SameComponent()
+        // Rank (RDA,MWR) tRTW [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tRTW;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::MWR][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRTW;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::MWR][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (RDA,WRA) memSpec.tRTW [] SameComponent()
+        // Rank (RDA,WRA) tRTW [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tRTW;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::WRA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRTW;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::WRA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (RDA,MWRA) memSpec.tRTW [] SameComponent()
+        // Rank (RDA,MWRA) tRTW [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tRTW;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::MWRA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRTW;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::MWRA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (RDA,REFAB) (memSpec.tRTP + memSpec.tRP) [] SameComponent()
+        // Rank (RDA,REFAB) (tRTP + tRP) [] SameComponent()
         {
-            const sc_time constraint = currentTime + (memSpec.tRTP + memSpec.tRP);
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::REFAB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tRTP + tRP);
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::REFAB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (RDA,PREAB) memSpec.tRTP [] SameComponent()
+        // Rank (RDA,PREAB) tRTP [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tRTP;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PREAB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRTP;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PREAB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (RDA,SREFEN) std::max((memSpec.tRTP + memSpec.tRP), tRDSRE) [] SameComponent()
+        // Rank (RDA,SREFEN) std::max((tRTP + tRP), tRDSRE) [] SameComponent()
         {
-            const sc_time constraint = currentTime + std::max((memSpec.tRTP + memSpec.tRP), tRDSRE);
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::SREFEN][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + std::max((tRTP + tRP), tRDSRE);
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::SREFEN][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Channel (RDA,RD) memSpec.tCCDR [] Different(level=<ComponentLevel.Stack: 7>)
+        // Channel (RDA,RD) tCCDR [] Different(level=<ComponentLevel.Stack: 7>)
         {
-            const sc_time constraint = currentTime + memSpec.tCCDR;
+            const uint64_t constraint = currentCycle + tCCDR;
             for (unsigned int i = memSpec.stacksPerChannel * static_cast<unsigned>(0); i < memSpec.stacksPerChannel * (1 + static_cast<unsigned>(0)); i++)
             {
                 Stack currentStack{i};
@@ -583,14 +618,14 @@ void CheckerHBM2::insert(Command command, const tlm_generic_payload& payload)
                 if (currentStack == stack)
                     continue;
                 
-                sc_time &earliestTimeToStart = nextCommandByStack[Command::RD][currentStack];
-                earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+                uint64_t& earliestCycleToStart = nextCommandByStack[Command::RD][currentStack];
+                earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
-        // Channel (RDA,RDA) memSpec.tCCDR [] Different(level=<ComponentLevel.Stack: 7>)
+        // Channel (RDA,RDA) tCCDR [] Different(level=<ComponentLevel.Stack: 7>)
         {
-            const sc_time constraint = currentTime + memSpec.tCCDR;
+            const uint64_t constraint = currentCycle + tCCDR;
             for (unsigned int i = memSpec.stacksPerChannel * static_cast<unsigned>(0); i < memSpec.stacksPerChannel * (1 + static_cast<unsigned>(0)); i++)
             {
                 Stack currentStack{i};
@@ -598,8 +633,8 @@ void CheckerHBM2::insert(Command command, const tlm_generic_payload& payload)
                 if (currentStack == stack)
                     continue;
                 
-                sc_time &earliestTimeToStart = nextCommandByStack[Command::RDA][currentStack];
-                earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+                uint64_t& earliestCycleToStart = nextCommandByStack[Command::RDA][currentStack];
+                earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
@@ -608,137 +643,137 @@ void CheckerHBM2::insert(Command command, const tlm_generic_payload& payload)
     }
     case Command::WRA:
     {
-        // Bank (WRA,ACT) ((tWRPRE + memSpec.tRP) - memSpec.tCK) [] SameComponent()
+        // Bank (WRA,ACT) ((tWRPRE + tRP) - tCK) [] SameComponent()
         {
-            const sc_time constraint = currentTime + ((tWRPRE + memSpec.tRP) - memSpec.tCK);
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::ACT][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + ((tWRPRE + tRP) - tCK);
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::ACT][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Bank (WRA,REFPB) (tWRPRE + memSpec.tRP) [] SameComponent()
+        // Bank (WRA,REFPB) (tWRPRE + tRP) [] SameComponent()
         {
-            const sc_time constraint = currentTime + (tWRPRE + memSpec.tRP);
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::REFPB][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tWRPRE + tRP);
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::REFPB][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // BankGroup (WRA,WR) memSpec.tCCDL [] SameComponent()
+        // BankGroup (WRA,WR) tCCDL [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCCDL;
-            sc_time &earliestTimeToStart = nextCommandByBankGroup[Command::WR][bankGroup];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCDL;
+            uint64_t& earliestCycleToStart = nextCommandByBankGroup[Command::WR][bankGroup];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // BankGroup (WRA,MWR) memSpec.tCCDL [] SameComponent()
+        // BankGroup (WRA,MWR) tCCDL [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCCDL;
-            sc_time &earliestTimeToStart = nextCommandByBankGroup[Command::MWR][bankGroup];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCDL;
+            uint64_t& earliestCycleToStart = nextCommandByBankGroup[Command::MWR][bankGroup];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // BankGroup (WRA,WRA) memSpec.tCCDL [] SameComponent()
+        // BankGroup (WRA,WRA) tCCDL [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCCDL;
-            sc_time &earliestTimeToStart = nextCommandByBankGroup[Command::WRA][bankGroup];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCDL;
+            uint64_t& earliestCycleToStart = nextCommandByBankGroup[Command::WRA][bankGroup];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // BankGroup (WRA,MWRA) memSpec.tCCDL [] SameComponent()
+        // BankGroup (WRA,MWRA) tCCDL [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCCDL;
-            sc_time &earliestTimeToStart = nextCommandByBankGroup[Command::MWRA][bankGroup];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCDL;
+            uint64_t& earliestCycleToStart = nextCommandByBankGroup[Command::MWRA][bankGroup];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // BankGroup (WRA,RD) tWRRDL [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRRDL;
-            sc_time &earliestTimeToStart = nextCommandByBankGroup[Command::RD][bankGroup];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRRDL;
+            uint64_t& earliestCycleToStart = nextCommandByBankGroup[Command::RD][bankGroup];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // BankGroup (WRA,RDA) tWRRDL [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRRDL;
-            sc_time &earliestTimeToStart = nextCommandByBankGroup[Command::RDA][bankGroup];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRRDL;
+            uint64_t& earliestCycleToStart = nextCommandByBankGroup[Command::RDA][bankGroup];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (WRA,PDEA) tWRAPDE [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRAPDE;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PDEA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRAPDE;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PDEA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (WRA,PDEP) tWRAPDE [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRAPDE;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PDEP][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRAPDE;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PDEP][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (WRA,WR) memSpec.tCCDS [] SameComponent()
+        // Rank (WRA,WR) tCCDS [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCCDS;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::WR][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCDS;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::WR][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (WRA,MWR) memSpec.tCCDS [] SameComponent()
+        // Rank (WRA,MWR) tCCDS [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCCDS;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::MWR][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCDS;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::MWR][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (WRA,WRA) memSpec.tCCDS [] SameComponent()
+        // Rank (WRA,WRA) tCCDS [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCCDS;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::WRA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCDS;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::WRA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (WRA,MWRA) memSpec.tCCDS [] SameComponent()
+        // Rank (WRA,MWRA) tCCDS [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCCDS;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::MWRA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCDS;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::MWRA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (WRA,RD) tWRRDS [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRRDS;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::RD][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRRDS;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::RD][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (WRA,RDA) tWRRDS [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRRDS;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::RDA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRRDS;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::RDA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (WRA,REFAB) (tWRPRE + memSpec.tRP) [] SameComponent()
+        // Rank (WRA,REFAB) (tWRPRE + tRP) [] SameComponent()
         {
-            const sc_time constraint = currentTime + (tWRPRE + memSpec.tRP);
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::REFAB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tWRPRE + tRP);
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::REFAB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (WRA,PREAB) tWRPRE [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRPRE;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PREAB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRPRE;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PREAB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (WRA,SREFEN) (tWRPRE + memSpec.tRP) [] SameComponent()
+        // Rank (WRA,SREFEN) (tWRPRE + tRP) [] SameComponent()
         {
-            const sc_time constraint = currentTime + (tWRPRE + memSpec.tRP);
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::SREFEN][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tWRPRE + tRP);
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::SREFEN][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
 
@@ -746,137 +781,137 @@ void CheckerHBM2::insert(Command command, const tlm_generic_payload& payload)
     }
     case Command::MWRA:
     {
-        // Bank (MWRA,ACT) ((tWRPRE + memSpec.tRP) - memSpec.tCK) [] SameComponent()
+        // Bank (MWRA,ACT) ((tWRPRE + tRP) - tCK) [] SameComponent()
         {
-            const sc_time constraint = currentTime + ((tWRPRE + memSpec.tRP) - memSpec.tCK);
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::ACT][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + ((tWRPRE + tRP) - tCK);
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::ACT][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Bank (MWRA,REFPB) (tWRPRE + memSpec.tRP) [] SameComponent()
+        // Bank (MWRA,REFPB) (tWRPRE + tRP) [] SameComponent()
         {
-            const sc_time constraint = currentTime + (tWRPRE + memSpec.tRP);
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::REFPB][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tWRPRE + tRP);
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::REFPB][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // BankGroup (MWRA,WR) memSpec.tCCDL [] SameComponent()
+        // BankGroup (MWRA,WR) tCCDL [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCCDL;
-            sc_time &earliestTimeToStart = nextCommandByBankGroup[Command::WR][bankGroup];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCDL;
+            uint64_t& earliestCycleToStart = nextCommandByBankGroup[Command::WR][bankGroup];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // BankGroup (MWRA,MWR) memSpec.tCCDL [] SameComponent()
+        // BankGroup (MWRA,MWR) tCCDL [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCCDL;
-            sc_time &earliestTimeToStart = nextCommandByBankGroup[Command::MWR][bankGroup];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCDL;
+            uint64_t& earliestCycleToStart = nextCommandByBankGroup[Command::MWR][bankGroup];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // BankGroup (MWRA,WRA) memSpec.tCCDL [] SameComponent()
+        // BankGroup (MWRA,WRA) tCCDL [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCCDL;
-            sc_time &earliestTimeToStart = nextCommandByBankGroup[Command::WRA][bankGroup];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCDL;
+            uint64_t& earliestCycleToStart = nextCommandByBankGroup[Command::WRA][bankGroup];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // BankGroup (MWRA,MWRA) memSpec.tCCDL [] SameComponent()
+        // BankGroup (MWRA,MWRA) tCCDL [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCCDL;
-            sc_time &earliestTimeToStart = nextCommandByBankGroup[Command::MWRA][bankGroup];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCDL;
+            uint64_t& earliestCycleToStart = nextCommandByBankGroup[Command::MWRA][bankGroup];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // BankGroup (MWRA,RD) tWRRDL [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRRDL;
-            sc_time &earliestTimeToStart = nextCommandByBankGroup[Command::RD][bankGroup];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRRDL;
+            uint64_t& earliestCycleToStart = nextCommandByBankGroup[Command::RD][bankGroup];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // BankGroup (MWRA,RDA) tWRRDL [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRRDL;
-            sc_time &earliestTimeToStart = nextCommandByBankGroup[Command::RDA][bankGroup];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRRDL;
+            uint64_t& earliestCycleToStart = nextCommandByBankGroup[Command::RDA][bankGroup];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (MWRA,PDEA) tWRAPDE [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRAPDE;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PDEA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRAPDE;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PDEA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (MWRA,PDEP) tWRAPDE [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRAPDE;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PDEP][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRAPDE;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PDEP][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (MWRA,WR) memSpec.tCCDS [] SameComponent()
+        // Rank (MWRA,WR) tCCDS [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCCDS;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::WR][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCDS;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::WR][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (MWRA,MWR) memSpec.tCCDS [] SameComponent()
+        // Rank (MWRA,MWR) tCCDS [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCCDS;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::MWR][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCDS;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::MWR][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (MWRA,WRA) memSpec.tCCDS [] SameComponent()
+        // Rank (MWRA,WRA) tCCDS [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCCDS;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::WRA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCDS;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::WRA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (MWRA,MWRA) memSpec.tCCDS [] SameComponent()
+        // Rank (MWRA,MWRA) tCCDS [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCCDS;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::MWRA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCDS;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::MWRA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (MWRA,RD) tWRRDS [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRRDS;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::RD][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRRDS;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::RD][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (MWRA,RDA) tWRRDS [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRRDS;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::RDA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRRDS;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::RDA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (MWRA,REFAB) (tWRPRE + memSpec.tRP) [] SameComponent()
+        // Rank (MWRA,REFAB) (tWRPRE + tRP) [] SameComponent()
         {
-            const sc_time constraint = currentTime + (tWRPRE + memSpec.tRP);
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::REFAB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tWRPRE + tRP);
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::REFAB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (MWRA,PREAB) tWRPRE [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRPRE;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PREAB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRPRE;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PREAB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (MWRA,SREFEN) (tWRPRE + memSpec.tRP) [] SameComponent()
+        // Rank (MWRA,SREFEN) (tWRPRE + tRP) [] SameComponent()
         {
-            const sc_time constraint = currentTime + (tWRPRE + memSpec.tRP);
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::SREFEN][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tWRPRE + tRP);
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::SREFEN][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
 
@@ -884,165 +919,164 @@ void CheckerHBM2::insert(Command command, const tlm_generic_payload& payload)
     }
     case Command::ACT:
     {
-        // Bank (ACT,PREPB) (memSpec.tRAS + memSpec.tCK) [] SameComponent()
+        // Bank (ACT,PREPB) (tRAS + tCK) [] SameComponent()
         {
-            const sc_time constraint = currentTime + (memSpec.tRAS + memSpec.tCK);
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::PREPB][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tRAS + tCK);
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::PREPB][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Bank (ACT,RD) (memSpec.tRCDRD + memSpec.tCK) [] SameComponent()
+        // Bank (ACT,RD) (tRCDRD + tCK) [] SameComponent()
         {
-            const sc_time constraint = currentTime + (memSpec.tRCDRD + memSpec.tCK);
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::RD][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tRCDRD + tCK);
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::RD][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Bank (ACT,RDA) (memSpec.tRCDRD + memSpec.tCK) [] SameComponent()
+        // Bank (ACT,RDA) (tRCDRD + tCK) [] SameComponent()
         {
-            const sc_time constraint = currentTime + (memSpec.tRCDRD + memSpec.tCK);
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::RDA][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tRCDRD + tCK);
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::RDA][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Bank (ACT,WR) (memSpec.tRCDWR + memSpec.tCK) [] SameComponent()
+        // Bank (ACT,WR) (tRCDWR + tCK) [] SameComponent()
         {
-            const sc_time constraint = currentTime + (memSpec.tRCDWR + memSpec.tCK);
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::WR][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tRCDWR + tCK);
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::WR][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Bank (ACT,MWR) (memSpec.tRCDWR + memSpec.tCK) [] SameComponent()
+        // Bank (ACT,MWR) (tRCDWR + tCK) [] SameComponent()
         {
-            const sc_time constraint = currentTime + (memSpec.tRCDWR + memSpec.tCK);
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::MWR][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tRCDWR + tCK);
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::MWR][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Bank (ACT,WRA) (memSpec.tRCDWR + memSpec.tCK) [] SameComponent()
+        // Bank (ACT,WRA) (tRCDWR + tCK) [] SameComponent()
         {
-            const sc_time constraint = currentTime + (memSpec.tRCDWR + memSpec.tCK);
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::WRA][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tRCDWR + tCK);
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::WRA][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Bank (ACT,MWRA) (memSpec.tRCDWR + memSpec.tCK) [] SameComponent()
+        // Bank (ACT,MWRA) (tRCDWR + tCK) [] SameComponent()
         {
-            const sc_time constraint = currentTime + (memSpec.tRCDWR + memSpec.tCK);
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::MWRA][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tRCDWR + tCK);
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::MWRA][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Bank (ACT,ACT) memSpec.tRC [] SameComponent()
+        // Bank (ACT,ACT) tRC [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tRC;
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::ACT][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRC;
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::ACT][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Bank (ACT,REFPB) (memSpec.tRC + memSpec.tCK) [] SameComponent()
+        // Bank (ACT,REFPB) (tRC + tCK) [] SameComponent()
         {
-            const sc_time constraint = currentTime + (memSpec.tRC + memSpec.tCK);
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::REFPB][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tRC + tCK);
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::REFPB][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // BankGroup (ACT,ACT) memSpec.tRRDL [] SameComponent()
+        // BankGroup (ACT,ACT) tRRDL [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tRRDL;
-            sc_time &earliestTimeToStart = nextCommandByBankGroup[Command::ACT][bankGroup];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRRDL;
+            uint64_t& earliestCycleToStart = nextCommandByBankGroup[Command::ACT][bankGroup];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // BankGroup (ACT,REFPB) (memSpec.tRRDL + memSpec.tCK) [] SameComponent()
+        // BankGroup (ACT,REFPB) (tRRDL + tCK) [] SameComponent()
         {
-            const sc_time constraint = currentTime + (memSpec.tRRDL + memSpec.tCK);
-            sc_time &earliestTimeToStart = nextCommandByBankGroup[Command::REFPB][bankGroup];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tRRDL + tCK);
+            uint64_t& earliestCycleToStart = nextCommandByBankGroup[Command::REFPB][bankGroup];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (ACT,ACT) memSpec.tRRDS [] SameComponent()
+        // Rank (ACT,ACT) tRRDS [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tRRDS;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::ACT][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRRDS;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::ACT][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (ACT,REFAB) (memSpec.tRC + memSpec.tCK) [] SameComponent()
+        // Rank (ACT,REFAB) (tRC + tCK) [] SameComponent()
         {
-            const sc_time constraint = currentTime + (memSpec.tRC + memSpec.tCK);
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::REFAB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tRC + tCK);
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::REFAB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (ACT,SREFEN) (memSpec.tRC + memSpec.tCK) [] SameComponent()
+        // Rank (ACT,SREFEN) (tRC + tCK) [] SameComponent()
         {
-            const sc_time constraint = currentTime + (memSpec.tRC + memSpec.tCK);
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::SREFEN][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tRC + tCK);
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::SREFEN][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (ACT,PREAB) (memSpec.tRAS + memSpec.tCK) [] SameComponent()
+        // Rank (ACT,PREAB) (tRAS + tCK) [] SameComponent()
         {
-            const sc_time constraint = currentTime + (memSpec.tRAS + memSpec.tCK);
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PREAB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tRAS + tCK);
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PREAB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (ACT,REFPB) (memSpec.tRRDS + memSpec.tCK) [] SameComponent()
+        // Rank (ACT,REFPB) (tRRDS + tCK) [] SameComponent()
         {
-            const sc_time constraint = currentTime + (memSpec.tRRDS + memSpec.tCK);
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::REFPB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tRRDS + tCK);
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::REFPB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        last4ActivatesOnRank[rank].push(currentTime + memSpec.getCommandLength(command));
+        last4ActivatesOnRank[rank].insert(currentCycle + commandLength[command]);
 
-        if (last4ActivatesOnRank[rank].size() >= 4)
+        if (last4ActivatesOnRank[rank].full())
         {
-            sc_time constraint = last4ActivatesOnRank[rank].front() - memSpec.getCommandLength(command) + memSpec.tFAW;
+            uint64_t constraint =
+                last4ActivatesOnRank[rank].getEarliestNextActivate() - commandLength[command];
             {
-                sc_time &earliestTimeToStart = nextCommandByRank[Command::ACT][rank];
-                earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+                uint64_t& earliestCycleToStart = nextCommandByRank[Command::ACT][rank];
+                earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
             {
-                sc_time &earliestTimeToStart = nextCommandByRank[Command::REFPB][rank];
-                earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+                uint64_t& earliestCycleToStart = nextCommandByRank[Command::REFPB][rank];
+                earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
-
-            last4ActivatesOnRank[rank].pop();
         }
 
         break;
     }
     case Command::PREPB:
     {
-        // Bank (PREPB,ACT) (memSpec.tRP - memSpec.tCK) [] SameComponent()
+        // Bank (PREPB,ACT) (tRP - tCK) [] SameComponent()
         {
-            const sc_time constraint = currentTime + (memSpec.tRP - memSpec.tCK);
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::ACT][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tRP - tCK);
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::ACT][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Bank (PREPB,REFPB) memSpec.tRP [] SameComponent()
+        // Bank (PREPB,REFPB) tRP [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tRP;
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::REFPB][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRP;
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::REFPB][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (PREPB,REFAB) memSpec.tRP [] SameComponent()
+        // Rank (PREPB,REFAB) tRP [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tRP;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::REFAB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRP;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::REFAB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (PREPB,SREFEN) memSpec.tRP [] SameComponent()
+        // Rank (PREPB,SREFEN) tRP [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tRP;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::SREFEN][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRP;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::SREFEN][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
 
@@ -1050,122 +1084,121 @@ void CheckerHBM2::insert(Command command, const tlm_generic_payload& payload)
     }
     case Command::REFPB:
     {
-        // Bank (REFPB,ACT) (memSpec.tRFCSB - memSpec.tCK) [] SameComponent()
+        // Bank (REFPB,ACT) (tRFCSB - tCK) [] SameComponent()
         {
-            const sc_time constraint = currentTime + (memSpec.tRFCSB - memSpec.tCK);
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::ACT][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tRFCSB - tCK);
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::ACT][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Bank (REFPB,REFPB) memSpec.tRFCSB [] SameComponent()
+        // Bank (REFPB,REFPB) tRFCSB [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tRFCSB;
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::REFPB][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRFCSB;
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::REFPB][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // BankGroup (REFPB,REFPB) memSpec.tRREFD [] SameComponent()
+        // BankGroup (REFPB,REFPB) tRREFD [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tRREFD;
-            sc_time &earliestTimeToStart = nextCommandByBankGroup[Command::REFPB][bankGroup];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRREFD;
+            uint64_t& earliestCycleToStart = nextCommandByBankGroup[Command::REFPB][bankGroup];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // BankGroup (REFPB,REFAB) memSpec.tRFCSB [] SameComponent()
+        // BankGroup (REFPB,REFAB) tRFCSB [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tRFCSB;
-            sc_time &earliestTimeToStart = nextCommandByBankGroup[Command::REFAB][bankGroup];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRFCSB;
+            uint64_t& earliestCycleToStart = nextCommandByBankGroup[Command::REFAB][bankGroup];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // BankGroup (REFPB,PREAB) memSpec.tRFCSB [] SameComponent()
+        // BankGroup (REFPB,PREAB) tRFCSB [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tRFCSB;
-            sc_time &earliestTimeToStart = nextCommandByBankGroup[Command::PREAB][bankGroup];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRFCSB;
+            uint64_t& earliestCycleToStart = nextCommandByBankGroup[Command::PREAB][bankGroup];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // BankGroup (REFPB,SREFEN) memSpec.tRFCSB [] SameComponent()
+        // BankGroup (REFPB,SREFEN) tRFCSB [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tRFCSB;
-            sc_time &earliestTimeToStart = nextCommandByBankGroup[Command::SREFEN][bankGroup];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRFCSB;
+            uint64_t& earliestCycleToStart = nextCommandByBankGroup[Command::SREFEN][bankGroup];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (REFPB,ACT) (memSpec.tRREFD - memSpec.tCK) [] SameComponent()
+        // Rank (REFPB,ACT) (tRREFD - tCK) [] SameComponent()
         {
-            const sc_time constraint = currentTime + (memSpec.tRREFD - memSpec.tCK);
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::ACT][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tRREFD - tCK);
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::ACT][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (REFPB,REFPB) memSpec.tRFCSB [BankwiseRefreshCounter(counter=0, inversed=False)] SameComponent()
+        // Rank (REFPB,REFPB) tRFCSB [BankwiseRefreshCounter(counter=0, inversed=False)] SameComponent()
         {
             if (bankwiseRefreshCounter[rank] == 0)
             {
-            const sc_time constraint = currentTime + memSpec.tRFCSB;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::REFPB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRFCSB;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::REFPB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
-        // Rank (REFPB,REFPB) memSpec.tRREFD [BankwiseRefreshCounter(counter=0, inversed=True)] SameComponent()
+        // Rank (REFPB,REFPB) tRREFD [BankwiseRefreshCounter(counter=0, inversed=True)] SameComponent()
         {
             if (bankwiseRefreshCounter[rank] != 0)
             {
-            const sc_time constraint = currentTime + memSpec.tRREFD;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::REFPB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRREFD;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::REFPB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
-        last4ActivatesOnRank[rank].push(currentTime + memSpec.getCommandLength(command));
+        last4ActivatesOnRank[rank].insert(currentCycle + commandLength[command]);
 
-        if (last4ActivatesOnRank[rank].size() >= 4)
+        if (last4ActivatesOnRank[rank].full())
         {
-            sc_time constraint = last4ActivatesOnRank[rank].front() - memSpec.getCommandLength(command) + memSpec.tFAW;
+            uint64_t constraint =
+                last4ActivatesOnRank[rank].getEarliestNextActivate() - commandLength[command];
             {
-                sc_time &earliestTimeToStart = nextCommandByRank[Command::ACT][rank];
-                earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+                uint64_t& earliestCycleToStart = nextCommandByRank[Command::ACT][rank];
+                earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
             {
-                sc_time &earliestTimeToStart = nextCommandByRank[Command::REFPB][rank];
-                earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+                uint64_t& earliestCycleToStart = nextCommandByRank[Command::REFPB][rank];
+                earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
-
-            last4ActivatesOnRank[rank].pop();
         }
 
         break;
     }
     case Command::PREAB:
     {
-        // Rank (PREAB,ACT) (memSpec.tRP - memSpec.tCK) [] SameComponent()
+        // Rank (PREAB,ACT) (tRP - tCK) [] SameComponent()
         {
-            const sc_time constraint = currentTime + (memSpec.tRP - memSpec.tCK);
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::ACT][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tRP - tCK);
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::ACT][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (PREAB,REFAB) memSpec.tRP [] SameComponent()
+        // Rank (PREAB,REFAB) tRP [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tRP;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::REFAB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRP;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::REFAB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (PREAB,REFPB) memSpec.tRP [] SameComponent()
+        // Rank (PREAB,REFPB) tRP [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tRP;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::REFPB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRP;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::REFPB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (PREAB,SREFEN) memSpec.tRP [] SameComponent()
+        // Rank (PREAB,SREFEN) tRP [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tRP;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::SREFEN][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRP;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::SREFEN][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
 
@@ -1173,32 +1206,32 @@ void CheckerHBM2::insert(Command command, const tlm_generic_payload& payload)
     }
     case Command::REFAB:
     {
-        // Rank (REFAB,ACT) (memSpec.tRFC - memSpec.tCK) [] SameComponent()
+        // Rank (REFAB,ACT) (tRFC - tCK) [] SameComponent()
         {
-            const sc_time constraint = currentTime + (memSpec.tRFC - memSpec.tCK);
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::ACT][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tRFC - tCK);
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::ACT][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (REFAB,REFAB) memSpec.tRFC [] SameComponent()
+        // Rank (REFAB,REFAB) tRFC [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tRFC;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::REFAB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRFC;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::REFAB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (REFAB,REFPB) memSpec.tRFC [] SameComponent()
+        // Rank (REFAB,REFPB) tRFC [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tRFC;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::REFPB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRFC;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::REFPB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (REFAB,SREFEN) memSpec.tRFC [] SameComponent()
+        // Rank (REFAB,SREFEN) tRFC [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tRFC;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::SREFEN][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRFC;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::SREFEN][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
 
@@ -1206,11 +1239,11 @@ void CheckerHBM2::insert(Command command, const tlm_generic_payload& payload)
     }
     case Command::PDEA:
     {
-        // Rank (PDEA,PDXA) memSpec.tPD [] SameComponent()
+        // Rank (PDEA,PDXA) tPD [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tPD;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PDXA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tPD;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PDXA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
 
@@ -1218,11 +1251,11 @@ void CheckerHBM2::insert(Command command, const tlm_generic_payload& payload)
     }
     case Command::PDEP:
     {
-        // Rank (PDEP,PDXP) memSpec.tPD [] SameComponent()
+        // Rank (PDEP,PDXP) tPD [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tPD;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PDXP][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tPD;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PDXP][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
 
@@ -1230,67 +1263,67 @@ void CheckerHBM2::insert(Command command, const tlm_generic_payload& payload)
     }
     case Command::PDXA:
     {
-        // Rank (PDXA,PDEA) memSpec.tCKE [] SameComponent()
+        // Rank (PDXA,PDEA) tCKE [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCKE;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PDEA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCKE;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PDEA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (PDXA,REFPB) memSpec.tXP [] SameComponent()
+        // Rank (PDXA,REFPB) tXP [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tXP;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::REFPB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tXP;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::REFPB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (PDXA,PREPB) memSpec.tXP [] SameComponent()
+        // Rank (PDXA,PREPB) tXP [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tXP;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PREPB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tXP;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PREPB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (PDXA,PREAB) memSpec.tXP [] SameComponent()
+        // Rank (PDXA,PREAB) tXP [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tXP;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PREAB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tXP;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PREAB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (PDXA,RD) memSpec.tXP [] SameComponent()
+        // Rank (PDXA,RD) tXP [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tXP;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::RD][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tXP;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::RD][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (PDXA,RDA) memSpec.tXP [] SameComponent()
+        // Rank (PDXA,RDA) tXP [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tXP;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::RDA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tXP;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::RDA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (PDXA,WR) memSpec.tXP [] SameComponent()
+        // Rank (PDXA,WR) tXP [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tXP;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::WR][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tXP;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::WR][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (PDXA,WRA) memSpec.tXP [] SameComponent()
+        // Rank (PDXA,WRA) tXP [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tXP;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::WRA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tXP;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::WRA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (PDXA,ACT) (memSpec.tXP - memSpec.tCK) [] SameComponent()
+        // Rank (PDXA,ACT) (tXP - tCK) [] SameComponent()
         {
-            const sc_time constraint = currentTime + (memSpec.tXP - memSpec.tCK);
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::ACT][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tXP - tCK);
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::ACT][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
 
@@ -1298,39 +1331,39 @@ void CheckerHBM2::insert(Command command, const tlm_generic_payload& payload)
     }
     case Command::PDXP:
     {
-        // Rank (PDXP,PDEP) memSpec.tCKE [] SameComponent()
+        // Rank (PDXP,PDEP) tCKE [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCKE;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PDEP][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCKE;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PDEP][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (PDXP,REFAB) memSpec.tXP [] SameComponent()
+        // Rank (PDXP,REFAB) tXP [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tXP;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::REFAB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tXP;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::REFAB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (PDXP,REFPB) memSpec.tXP [] SameComponent()
+        // Rank (PDXP,REFPB) tXP [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tXP;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::REFPB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tXP;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::REFPB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (PDXP,SREFEN) memSpec.tXP [] SameComponent()
+        // Rank (PDXP,SREFEN) tXP [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tXP;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::SREFEN][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tXP;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::SREFEN][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (PDXP,ACT) (memSpec.tXP - memSpec.tCK) [] SameComponent()
+        // Rank (PDXP,ACT) (tXP - tCK) [] SameComponent()
         {
-            const sc_time constraint = currentTime + (memSpec.tXP - memSpec.tCK);
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::ACT][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tXP - tCK);
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::ACT][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
 
@@ -1338,46 +1371,46 @@ void CheckerHBM2::insert(Command command, const tlm_generic_payload& payload)
     }
     case Command::SREFEX:
     {
-        // Rank (SREFEX,ACT) (memSpec.tXS - memSpec.tCK) [] SameComponent()
+        // Rank (SREFEX,ACT) (tXS - tCK) [] SameComponent()
         {
-            const sc_time constraint = currentTime + (memSpec.tXS - memSpec.tCK);
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::ACT][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tXS - tCK);
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::ACT][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (SREFEX,REFPB) memSpec.tXS [] SameComponent()
+        // Rank (SREFEX,REFPB) tXS [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tXS;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::REFPB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tXS;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::REFPB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (SREFEX,REFAB) memSpec.tXS [] SameComponent()
+        // Rank (SREFEX,REFAB) tXS [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tXS;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::REFAB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tXS;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::REFAB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (SREFEX,PDEP) memSpec.tXS [] SameComponent()
+        // Rank (SREFEX,PDEP) tXS [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tXS;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PDEP][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tXS;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PDEP][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (SREFEX,SREFEN) memSpec.tXS [] SameComponent()
+        // Rank (SREFEX,SREFEN) tXS [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tXS;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::SREFEN][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tXS;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::SREFEN][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (SREFEX,SREFEX) memSpec.tCKESR [] SameComponent()
+        // Rank (SREFEX,SREFEX) tCKESR [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCKESR;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::SREFEX][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCKESR;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::SREFEX][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
 
@@ -1387,11 +1420,11 @@ void CheckerHBM2::insert(Command command, const tlm_generic_payload& payload)
     }
     if (command.isRasCommand())
     {
-        nextCommandOnRasBus = std::max(nextCommandOnRasBus, currentTime + memSpec.getCommandLength(command));
+        nextCommandOnRasBus = std::max(nextCommandOnRasBus, currentCycle + commandLength[command]);
     }
     if (command.isCasCommand())
     {
-        nextCommandOnCasBus = std::max(nextCommandOnCasBus, currentTime + memSpec.getCommandLength(command));
+        nextCommandOnCasBus = std::max(nextCommandOnCasBus, currentCycle + commandLength[command]);
     }
 }
 
@@ -37,11 +37,11 @@
 #ifndef CHECKERHBM2_H
 #define CHECKERHBM2_H
 
+#include "DRAMSys/controller/checker/ActivateWindow.h"
 #include "DRAMSys/controller/checker/CheckerIF.h"
+#include "DRAMSys/controller/checker/CycleClock.h"
 #include "DRAMSys/configuration/memspec/MemSpecHBM2.h"
 
-#include <queue>
-
 namespace DRAMSys
 {
 
@@ -54,15 +54,46 @@ public:
 
 private:
     const MemSpecHBM2& memSpec;
+    const CycleClock cycleClock;
+
+    // Timing parameters in clock cycles
+    uint64_t tCCDL;
+    uint64_t tCCDR;
+    uint64_t tCCDS;
+    uint64_t tCK;
+    uint64_t tCKE;
+    uint64_t tCKESR;
+    uint64_t tFAW;
+    uint64_t tPD;
+    uint64_t tPL;
+    uint64_t tRAS;
+    uint64_t tRC;
+    uint64_t tRCDRD;
+    uint64_t tRCDWR;
+    uint64_t tRFC;
+    uint64_t tRFCSB;
+    uint64_t tRL;
+    uint64_t tRP;
+    uint64_t tRRDL;
+    uint64_t tRRDS;
+    uint64_t tRREFD;
+    uint64_t tRTP;
+    uint64_t tRTW;
+    uint64_t tWL;
+    uint64_t tWR;
+    uint64_t tWTRL;
+    uint64_t tWTRS;
+    uint64_t tXP;
+    uint64_t tXS;
 
-    sc_core::sc_time tBURST;
-    sc_core::sc_time tRDPDE;
-    sc_core::sc_time tRDSRE;
-    sc_core::sc_time tWRPRE;
-    sc_core::sc_time tWRPDE;
-    sc_core::sc_time tWRAPDE;
-    sc_core::sc_time tWRRDS;
-    sc_core::sc_time tWRRDL;
+    uint64_t tBURST;
+    uint64_t tRDPDE;
+    uint64_t tRDSRE;
+    uint64_t tWRPRE;
+    uint64_t tWRPDE;
+    uint64_t tWRAPDE;
+    uint64_t tWRRDS;
+    uint64_t tWRRDL;
     template<typename T>
     using CommandArray = std::array<T, Command::END_ENUM>;
     template<typename T>
@@ -75,15 +106,16 @@ private:
     using StackVector = ControllerVector<Stack, T>;
 
     
-    CommandArray<BankVector<sc_core::sc_time>> nextCommandByBank;
-    CommandArray<BankGroupVector<sc_core::sc_time>> nextCommandByBankGroup;
-    CommandArray<RankVector<sc_core::sc_time>> nextCommandByRank;
-    CommandArray<StackVector<sc_core::sc_time>> nextCommandByStack;
+    CommandArray<uint64_t> commandLength;
+    CommandArray<BankVector<uint64_t>> nextCommandByBank;
+    CommandArray<BankGroupVector<uint64_t>> nextCommandByBankGroup;
+    CommandArray<RankVector<uint64_t>> nextCommandByRank;
+    CommandArray<StackVector<uint64_t>> nextCommandByStack;
     
-    RankVector<std::queue<sc_core::sc_time>> last4ActivatesOnRank;
+    RankVector<ActivateWindow<4>> last4ActivatesOnRank;
     ControllerVector<Rank, unsigned> bankwiseRefreshCounter;
-    sc_core::sc_time nextCommandOnRasBus = sc_core::SC_ZERO_TIME;
-    sc_core::sc_time nextCommandOnCasBus = sc_core::SC_ZERO_TIME;
+    uint64_t nextCommandOnRasBus = 0;
+    uint64_t nextCommandOnCasBus = 0;
 };
 
 } // namespace DRAMSys
@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "CheckerHBM3.h"
+
+#include <algorithm>
+
+namespace DRAMSys
+{
+
+CheckerHBM3::CheckerHBM3(const MemSpecHBM3& memSpec) : CheckerTable(memSpec, "CheckerHBM3")
+{
+    const uint64_t tCCDL = cycleClock.toCycles(memSpec.tCCDL);
+    const uint64_t tCCDS = cycleClock.toCycles(memSpec.tCCDS);
+    const uint64_t tCK = cycleClock.toCycles(memSpec.tCK);
+    const uint64_t tCKE = cycleClock.toCycles(memSpec.tCKE);
+    const uint64_t tCKESR = cycleClock.toCycles(memSpec.tCKESR);
+    const uint64_t tFAW = cycleClock.toCycles(memSpec.tFAW);
+    const uint64_t tPD = cycleClock.toCycles(memSpec.tPD);
+    const uint64_t tPL = cycleClock.toCycles(memSpec.tPL);
+    const uint64_t tPPD = cycleClock.toCycles(memSpec.tPPD);
+    const uint64_t tRAS = cycleClock.toCycles(memSpec.tRAS);
+    const uint64_t tRC = cycleClock.toCycles(memSpec.tRC);
+    const uint64_t tRCDRD = cycleClock.toCycles(memSpec.tRCDRD);
+    const uint64_t tRCDWR = cycleClock.toCycles(memSpec.tRCDWR);
+    const uint64_t tRFC = cycleClock.toCycles(memSpec.tRFC);
+    const uint64_t tRFCPB = cycleClock.toCycles(memSpec.tRFCPB);
+    const uint64_t tRL = cycleClock.toCycles(memSpec.tRL);
+    const uint64_t tRP = cycleClock.toCycles(memSpec.tRP);
+    const uint64_t tRRDL = cycleClock.toCycles(memSpec.tRRDL);
+    const uint64_t tRRDS = cycleClock.toCycles(memSpec.tRRDS);
+    const uint64_t tRREFD = cycleClock.toCycles(memSpec.tRREFD);
+    const uint64_t tRTP = cycleClock.toCycles(memSpec.tRTP);
+    const uint64_t tRTW = cycleClock.toCycles(memSpec.tRTW);
+    const uint64_t tWL = cycleClock.toCycles(memSpec.tWL);
+    const uint64_t tWR = cycleClock.toCycles(memSpec.tWR);
+    const uint64_t tWTRL = cycleClock.toCycles(memSpec.tWTRL);
+    const uint64_t tWTRS = cycleClock.toCycles(memSpec.tWTRS);
+    const uint64_t tXP = cycleClock.toCycles(memSpec.tXP);
+    const uint64_t tXS = cycleClock.toCycles(memSpec.tXS);
+
+    const uint64_t tBURST = (memSpec.defaultBurstLength / memSpec.dataRate) * tCK;
+    const uint64_t tRDPDE = ((tRL + tPL) + tBURST) + tCK;
+    const uint64_t tRDAACT = tRTP + tRP;
+    const uint64_t tWRPRE = (tWL + tBURST) + tWR;
+    const uint64_t tWRAACT = tWRPRE + tRP;
+    const uint64_t tWRPDE = (((tWL + tPL) + tBURST) + tCK) + tWR;
+    const uint64_t tWRRDS = (tWL + tBURST) + tWTRS;
+    const uint64_t tWRRDL = (tWL + tBURST) + tWTRL;
+
+    // Column commands of a pseudo channel share its data bus
+    add(reads, reads, Scope::BankGroup, tCCDL);
+    add(reads, reads, Scope::PseudoChannel, tCCDS);
+    add(reads, writes, Scope::PseudoChannel, tRTW);
+    add(reads, {Command::PDEA, Command::PDEP}, Scope::PseudoChannel, tRDPDE);
+
+    add(writes, writes, Scope::BankGroup, tCCDL);
+    add(writes, writes, Scope::PseudoChannel, tCCDS);
+    add(writes, reads, Scope::BankGroup, tWRRDL);
+    add(writes, reads, Scope::PseudoChannel, tWRRDS);
+
+    // Precharges after column commands, an auto-precharge behaves like a precharge of the bank.
+    // An activate is issued in two cycles and timed from its second cycle.
+    add({Command::RD}, {Command::PREPB}, Scope::Bank, tRTP);
+    add(reads, {Command::PREAB}, Scope::PseudoChannel, tRTP);
+    add({Command::RDA}, {Command::ACT}, Scope::Bank, tRDAACT - tCK);
+    add({Command::RDA}, perBankRefreshes, Scope::Bank, tRDAACT);
+    add({Command::RDA}, allBankRefreshes, Scope::PseudoChannel, tRDAACT);
+    add({Command::RDA}, {Command::SREFEN}, Scope::PseudoChannel, std::max(tRDAACT, tRDPDE));
+
+    add({Command::WR, Command::MWR}, {Command::PREPB}, Scope::Bank, tWRPRE);
+    add({Command::WR, Command::MWR},
+        {Command::RDA},
+        Scope::Bank,
+        (tWL + tBURST) + std::max(tWR - std::min(tWR, tRTP), tWTRL));
+    add(writes, {Command::PREAB}, Scope::PseudoChannel, tWRPRE);
+    add({Command::WR, Command::MWR}, {Command::PDEA}, Scope::PseudoChannel, tWRPDE);
+    add({Command::WRA, Command::MWRA}, {Command::ACT}, Scope::Bank, tWRAACT - tCK);
+    add({Command::WRA, Command::MWRA}, perBankRefreshes, Scope::Bank, tWRAACT);
+    add({Command::WRA, Command::MWRA}, allBankRefreshes, Scope::PseudoChannel, tWRAACT);
+    add({Command::WRA, Command::MWRA},
+        {Command::PDEA, Command::PDEP},
+        Scope::PseudoChannel,
+        tWRPDE);
+    add({Command::WRA, Command::MWRA}, {Command::SREFEN}, Scope::PseudoChannel, tWRAACT);
+
+    // Row commands
+    add({Command::ACT}, reads, Scope::Bank, tRCDRD + tCK);
+    add({Command::ACT}, writes, Scope::Bank, tRCDWR + tCK);
+    add({Command::ACT}, {Command::ACT}, Scope::Bank, tRC);
+    add({Command::ACT}, {Command::ACT}, Scope::BankGroup, tRRDL);
+    add({Command::ACT}, {Command::ACT}, Scope::PseudoChannel, tRRDS);
+    add({Command::ACT}, {Command::PREPB}, Scope::Bank, tRAS + tCK);
+    add({Command::ACT}, {Command::PREAB}, Scope::PseudoChannel, tRAS + tCK);
+    add({Command::ACT}, perBankRefreshes, Scope::Bank, tRC + tCK);
+    add({Command::ACT}, perBankRefreshes, Scope::BankGroup, tRRDL + tCK);
+    add({Command::ACT}, perBankRefreshes, Scope::PseudoChannel, tRRDS + tCK);
+    add({Command::ACT}, allBankRefreshes, Scope::PseudoChannel, tRC + tCK);
+    add({Command::ACT}, {Command::SREFEN}, Scope::PseudoChannel, tRC + tCK);
+
+    add({Command::PREPB}, {Command::PREPB}, Scope::PseudoChannel, tPPD);
+    add({Command::PREPB}, {Command::ACT}, Scope::Bank, tRP - tCK);
+    add({Command::PREPB}, perBankRefreshes, Scope::Bank, tRP);
+    add({Command::PREPB}, allBankRefreshes, Scope::PseudoChannel, tRP);
+    add({Command::PREPB}, {Command::SREFEN}, Scope::PseudoChannel, tRP);
+    add({Command::PREAB}, {Command::ACT}, Scope::PseudoChannel, tRP - tCK);
+    add({Command::PREAB}, perBankRefreshes, Scope::PseudoChannel, tRP);
+    add({Command::PREAB}, allBankRefreshes, Scope::PseudoChannel, tRP);
+    add({Command::PREAB}, {Command::SREFEN}, Scope::PseudoChannel, tRP);
+
+    // Refresh management commands are timed like the refresh commands of the same granularity
+    add(allBankRefreshes, {Command::ACT}, Scope::PseudoChannel, tRFC - tCK);
+    add(allBankRefreshes, allBankRefreshes, Scope::PseudoChannel, tRFC);
+    add(allBankRefreshes, perBankRefreshes, Scope::PseudoChannel, tRFC);
+    add(allBankRefreshes, {Command::SREFEN}, Scope::PseudoChannel, tRFC);
+
+    add(perBankRefreshes, {Command::ACT}, Scope::Bank, tRFCPB - tCK);
+    add(perBankRefreshes, {Command::ACT}, Scope::PseudoChannel, tRREFD - tCK);
+    add(perBankRefreshes, perBankRefreshes, Scope::Bank, tRFCPB);
+    add(perBankRefreshes, perBankRefreshes, Scope::BankGroup, tRREFD);
+    add(perBankRefreshes, perBankRefreshes, Scope::PseudoChannel, tRREFD);
+    add(perBankRefreshes, allBankRefreshes, Scope::BankGroup, tRFCPB);
+    add(perBankRefreshes, {Command::PREAB}, Scope::BankGroup, tRFCPB);
+    add(perBankRefreshes, {Command::SREFEN}, Scope::BankGroup, tRFCPB);
+
+    // Power-down and self refresh
+    add({Command::PDEA}, {Command::PDXA}, Scope::PseudoChannel, tPD);
+    add({Command::PDEP}, {Command::PDXP}, Scope::PseudoChannel, tPD);
+    add({Command::PDXA}, {Command::PDEA}, Scope::PseudoChannel, tCKE);
+    add({Command::PDXA}, {Command::ACT}, Scope::PseudoChannel, tXP - tCK);
+    add({Command::PDXA}, {Command::PREPB, Command::PREAB}, Scope::PseudoChannel, tXP);
+    add({Command::PDXA}, reads, Scope::PseudoChannel, tXP);
+    add({Command::PDXA}, writes, Scope::PseudoChannel, tXP);
+    add({Command::PDXA}, perBankRefreshes, Scope::PseudoChannel, tXP);
+    add({Command::PDXP}, {Command::PDEP}, Scope::PseudoChannel, tCKE);
+    add({Command::PDXP}, {Command::ACT}, Scope::PseudoChannel, tXP - tCK);
+    add({Command::PDXP}, allBankRefreshes, Scope::PseudoChannel, tXP);
+    add({Command::PDXP}, perBankRefreshes, Scope::PseudoChannel, tXP);
+    add({Command::PDXP}, {Command::SREFEN}, Scope::PseudoChannel, tXP);
+
+    add({Command::SREFEN}, {Command::SREFEX}, Scope::PseudoChannel, tCKESR);
+    add({Command::SREFEX}, {Command::ACT}, Scope::PseudoChannel, tXS - tCK);
+    add({Command::SREFEX}, allBankRefreshes, Scope::PseudoChannel, tXS);
+    add({Command::SREFEX}, perBankRefreshes, Scope::PseudoChannel, tXS);
+    add({Command::SREFEX}, {Command::PDEP}, Scope::PseudoChannel, tXS);
+    add({Command::SREFEX}, {Command::SREFEN}, Scope::PseudoChannel, tXS);
+
+    // Per-bank refreshes count as activates, the first per-bank refresh of a new round waits
+    // until the last one of the previous round has completed
+    setTimingReference(Command::ACT, tCK);
+    setActivateWindow(tFAW, {Command::ACT, Command::REFPB, Command::RFMPB});
+    setRefreshRound(perBankRefreshes, memSpec.banksPerRank, tRFCPB);
+}
+
+} // namespace DRAMSys
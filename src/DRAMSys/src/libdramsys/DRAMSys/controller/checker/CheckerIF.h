@@ -35,13 +35,38 @@
 #ifndef CHECKERIF_H
 #define CHECKERIF_H
 
+#include "DRAMSys/common/dramExtensions.h"
 #include "DRAMSys/controller/Command.h"
 
 #include <systemc>
+#include <vector>
 
 namespace DRAMSys
 {
 
+// Command together with its decoded target, so that the address extension of the payload only
+// has to be read once per query
+struct CommandQuery
+{
+    CommandQuery(Command command, const tlm::tlm_generic_payload& payload) :
+        command(command),
+        payload(&payload)
+    {
+        const ControllerExtension& extension = ControllerExtension::getExtension(payload);
+        bank = extension.getBank();
+        bankGroup = extension.getBankGroup();
+        rank = extension.getRank();
+    }
+
+    Command command;
+    Bank bank = Bank(0);
+    BankGroup bankGroup = BankGroup(0);
+    Rank rank = Rank(0);
+    const tlm::tlm_generic_payload* payload;
+};
+
+using CommandQueries = std::vector<CommandQuery>;
+
 class CheckerIF
 {
 protected:
@@ -57,6 +82,15 @@ public:
     [[nodiscard]] virtual sc_core::sc_time
     timeToSatisfyConstraints(Command command, const tlm::tlm_generic_payload& payload) const = 0;
     virtual void insert(Command command, const tlm::tlm_generic_payload& payload) = 0;
+
+    // Evaluates all queries in one call, earliestTimes[i] belongs to queries[i]
+    virtual void timeToSatisfyConstraints(const CommandQueries& queries,
+                                          std::vector<sc_core::sc_time>& earliestTimes) const
+    {
+        earliestTimes.resize(queries.size());
+        for (std::size_t i = 0; i < queries.size(); i++)
+            earliestTimes[i] = timeToSatisfyConstraints(queries[i].command, *queries[i].payload);
+    }
 };
 
 } // namespace DRAMSys
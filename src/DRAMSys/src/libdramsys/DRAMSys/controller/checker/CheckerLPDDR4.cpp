@@ -46,28 +46,64 @@ using namespace tlm;
 namespace DRAMSys
 {
 
-CheckerLPDDR4::CheckerLPDDR4(const MemSpecLPDDR4& memSpec) : memSpec(memSpec)
+CheckerLPDDR4::CheckerLPDDR4(const MemSpecLPDDR4& memSpec) :
+    memSpec(memSpec),
+    cycleClock(memSpec.tCK)
 {
+    tCCD = cycleClock.toCycles(memSpec.tCCD);
+    tCCDMW = cycleClock.toCycles(memSpec.tCCDMW);
+    tCK = cycleClock.toCycles(memSpec.tCK);
+    tCKE = cycleClock.toCycles(memSpec.tCKE);
+    tCMDCKE = cycleClock.toCycles(memSpec.tCMDCKE);
+    tDQS2DQ = cycleClock.toCycles(memSpec.tDQS2DQ);
+    tDQSCK = cycleClock.toCycles(memSpec.tDQSCK);
+    tDQSS = cycleClock.toCycles(memSpec.tDQSS);
+    tFAW = cycleClock.toCycles(memSpec.tFAW);
+    tPPD = cycleClock.toCycles(memSpec.tPPD);
+    tRAS = cycleClock.toCycles(memSpec.tRAS);
+    tRCD = cycleClock.toCycles(memSpec.tRCD);
+    tRCpb = cycleClock.toCycles(memSpec.tRCpb);
+    tRFCab = cycleClock.toCycles(memSpec.tRFCab);
+    tRFCpb = cycleClock.toCycles(memSpec.tRFCpb);
+    tRL = cycleClock.toCycles(memSpec.tRL);
+    tRPST = cycleClock.toCycles(memSpec.tRPST);
+    tRPab = cycleClock.toCycles(memSpec.tRPab);
+    tRPpb = cycleClock.toCycles(memSpec.tRPpb);
+    tRRD = cycleClock.toCycles(memSpec.tRRD);
+    tRTP = cycleClock.toCycles(memSpec.tRTP);
+    tRTRS = cycleClock.toCycles(memSpec.tRTRS);
+    tSR = cycleClock.toCycles(memSpec.tSR);
+    tWL = cycleClock.toCycles(memSpec.tWL);
+    tWPRE = cycleClock.toCycles(memSpec.tWPRE);
+    tWR = cycleClock.toCycles(memSpec.tWR);
+    tWTR = cycleClock.toCycles(memSpec.tWTR);
+    tXP = cycleClock.toCycles(memSpec.tXP);
+    tXSR = cycleClock.toCycles(memSpec.tXSR);
+    for (unsigned command = 0; command < Command::numberOfCommands(); command++)
+        commandLength[command] =
+            cycleClock.toCycles(memSpec.getCommandLength(static_cast<Command::Type>(command)));
+
     
-    nextCommandByBank.fill({BankVector<sc_time>(memSpec.banksPerChannel, SC_ZERO_TIME)});
-    nextCommandByRank.fill({RankVector<sc_time>(memSpec.ranksPerChannel, SC_ZERO_TIME)});
-    last4ActivatesOnRank = RankVector<std::queue<sc_time>>(memSpec.ranksPerChannel);
+    nextCommandByBank.fill({BankVector<uint64_t>(memSpec.banksPerChannel, 0)});
+    nextCommandByRank.fill({RankVector<uint64_t>(memSpec.ranksPerChannel, 0)});
+    last4ActivatesOnRank = RankVector<ActivateWindow<4>>(
+        memSpec.ranksPerChannel, ActivateWindow<4>(tFAW));
 
-    tBURST = ((memSpec.defaultBurstLength / memSpec.dataRate) * memSpec.tCK);
-    tRDWR = (((((memSpec.tRL + memSpec.tDQSCK) + tBURST) - memSpec.tWL) + memSpec.tWPRE) + memSpec.tRPST);
-    tRDWR_R = (((memSpec.tRL + tBURST) + memSpec.tRTRS) - memSpec.tWL);
-    tWRRD = (((memSpec.tWL + memSpec.tCK) + tBURST) + memSpec.tWTR);
-    tWRRD_R = (((memSpec.tWL + tBURST) + memSpec.tRTRS) - memSpec.tRL);
-    tRDPRE = ((memSpec.tRTP + tBURST) - (memSpec.tCK * 6));
-    tRDAACT = (((memSpec.tRTP + memSpec.tRPpb) + tBURST) - (memSpec.tCK * 8));
-    tWRPRE = (((((memSpec.tCK * 2) + memSpec.tWL) + memSpec.tCK) + tBURST) + memSpec.tWR);
-    tWRAACT = ((((memSpec.tWL + tBURST) + memSpec.tWR) + memSpec.tCK) + memSpec.tRPpb);
-    tACTPDEN = ((memSpec.tCK * 3) + memSpec.tCMDCKE);
-    tPRPDEN = (memSpec.tCK + memSpec.tCMDCKE);
-    tRDPDEN = (((((memSpec.tCK * 3) + memSpec.tRL) + memSpec.tDQSCK) + tBURST) + memSpec.tRPST);
-    tWRPDEN = (((((memSpec.tCK * 3) + memSpec.tWL) + ((std::ceil((memSpec.tDQSS / memSpec.tCK)) + std::ceil((memSpec.tDQS2DQ / memSpec.tCK))) * memSpec.tCK)) + tBURST) + memSpec.tWR);
-    tWRAPDEN = ((((((memSpec.tCK * 3) + memSpec.tWL) + ((std::ceil((memSpec.tDQSS / memSpec.tCK)) + std::ceil((memSpec.tDQS2DQ / memSpec.tCK))) * memSpec.tCK)) + tBURST) + memSpec.tWR) + (memSpec.tCK * 2));
-    tREFPDEN = (memSpec.tCK + memSpec.tCMDCKE);
+    tBURST = ((memSpec.defaultBurstLength / memSpec.dataRate) * tCK);
+    tRDWR = (((((tRL + tDQSCK) + tBURST) - tWL) + tWPRE) + tRPST);
+    tRDWR_R = (((tRL + tBURST) + tRTRS) - tWL);
+    tWRRD = (((tWL + tCK) + tBURST) + tWTR);
+    tWRRD_R = (((tWL + tBURST) + tRTRS) - tRL);
+    tRDPRE = ((tRTP + tBURST) - (tCK * 6));
+    tRDAACT = (((tRTP + tRPpb) + tBURST) - (tCK * 8));
+    tWRPRE = (((((tCK * 2) + tWL) + tCK) + tBURST) + tWR);
+    tWRAACT = ((((tWL + tBURST) + tWR) + tCK) + tRPpb);
+    tACTPDEN = ((tCK * 3) + tCMDCKE);
+    tPRPDEN = (tCK + tCMDCKE);
+    tRDPDEN = (((((tCK * 3) + tRL) + tDQSCK) + tBURST) + tRPST);
+    tWRPDEN = (((((tCK * 3) + tWL) + (tDQSS + tDQS2DQ)) + tBURST) + tWR);
+    tWRAPDEN = ((((((tCK * 3) + tWL) + (tDQSS + tDQS2DQ)) + tBURST) + tWR) + (tCK * 2));
+    tREFPDEN = (tCK + tCMDCKE);
     
 }
 
@@ -77,14 +113,14 @@ sc_time CheckerLPDDR4::timeToSatisfyConstraints(Command command, const tlm_gener
     Rank rank = ControllerExtension::getRank(payload);
     
 
-    sc_time earliestTimeToStart = sc_time_stamp();
+    uint64_t earliestCycleToStart = cycleClock.now();
 
     
-    earliestTimeToStart = std::max(earliestTimeToStart, nextCommandByBank[command][bank]);
-    earliestTimeToStart = std::max(earliestTimeToStart, nextCommandByRank[command][rank]);
-    earliestTimeToStart = std::max(earliestTimeToStart, nextCommandOnBus);
+    earliestCycleToStart = std::max(earliestCycleToStart, nextCommandByBank[command][bank]);
+    earliestCycleToStart = std::max(earliestCycleToStart, nextCommandByRank[command][rank]);
+    earliestCycleToStart = std::max(earliestCycleToStart, nextCommandOnBus);
 
-    return earliestTimeToStart;
+    return cycleClock.toTime(earliestCycleToStart);
 }
 
 void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
@@ -96,85 +132,85 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
     PRINTDEBUGMESSAGE("CheckerLPDDR4", "Changing state on bank " + std::to_string(static_cast<std::size_t>(bank))
                       + " command is " + command.toString());
     
-    const sc_time& currentTime = sc_time_stamp();
+    const uint64_t currentCycle = cycleClock.now();
     
     switch (command)
     {
     case Command::RD:
     {
-        // Bank (RD,PREPB) (memSpec.tRRD + (memSpec.tCK * 2)) [] SameComponent()
+        // Bank (RD,PREPB) (tRRD + (tCK * 2)) [] SameComponent()
         {
-            const sc_time constraint = currentTime + (memSpec.tRRD + (memSpec.tCK * 2));
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::PREPB][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tRRD + (tCK * 2));
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::PREPB][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (RD,PREAB) tRDPRE [] SameComponent()
         {
-            const sc_time constraint = currentTime + tRDPRE;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PREAB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRDPRE;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PREAB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (RD,PDEA) tRDPDEN [] SameComponent()
         {
-            const sc_time constraint = currentTime + tRDPDEN;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PDEA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRDPDEN;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PDEA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (RD,PDEP) tRDPDEN [] SameComponent()
         {
-            const sc_time constraint = currentTime + tRDPDEN;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PDEP][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRDPDEN;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PDEP][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (RD,RD) memSpec.tCCD [] SameComponent()
+        // Rank (RD,RD) tCCD [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCCD;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::RD][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCD;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::RD][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (RD,RDA) memSpec.tCCD [] SameComponent()
+        // Rank (RD,RDA) tCCD [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCCD;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::RDA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCD;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::RDA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (RD,WR) tRDWR [] SameComponent()
         {
-            const sc_time constraint = currentTime + tRDWR;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::WR][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRDWR;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::WR][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (RD,MWR) tRDWR [] SameComponent()
         {
-            const sc_time constraint = currentTime + tRDWR;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::MWR][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRDWR;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::MWR][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (RD,WRA) tRDWR [] SameComponent()
         {
-            const sc_time constraint = currentTime + tRDWR;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::WRA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRDWR;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::WRA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (RD,MWRA) tRDWR [] SameComponent()
         {
-            const sc_time constraint = currentTime + tRDWR;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::MWRA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRDWR;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::MWRA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Channel (RD,RD) (tBURST + memSpec.tRTRS) [] Different(level=<ComponentLevel.Rank: 3>)
+        // Channel (RD,RD) (tBURST + tRTRS) [] Different(level=<ComponentLevel.Rank: 3>)
         {
-            const sc_time constraint = currentTime + (tBURST + memSpec.tRTRS);
+            const uint64_t constraint = currentCycle + (tBURST + tRTRS);
             for (unsigned int i = memSpec.ranksPerChannel * static_cast<unsigned>(0); i < memSpec.ranksPerChannel * (1 + static_cast<unsigned>(0)); i++)
             {
                 Rank currentRank{i};
@@ -182,14 +218,14 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
                 if (currentRank == rank)
                     continue;
                 
-                sc_time &earliestTimeToStart = nextCommandByRank[Command::RD][currentRank];
-                earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+                uint64_t& earliestCycleToStart = nextCommandByRank[Command::RD][currentRank];
+                earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
-        // Channel (RD,RDA) (tBURST + memSpec.tRTRS) [] Different(level=<ComponentLevel.Rank: 3>)
+        // Channel (RD,RDA) (tBURST + tRTRS) [] Different(level=<ComponentLevel.Rank: 3>)
         {
-            const sc_time constraint = currentTime + (tBURST + memSpec.tRTRS);
+            const uint64_t constraint = currentCycle + (tBURST + tRTRS);
             for (unsigned int i = memSpec.ranksPerChannel * static_cast<unsigned>(0); i < memSpec.ranksPerChannel * (1 + static_cast<unsigned>(0)); i++)
             {
                 Rank currentRank{i};
@@ -197,14 +233,14 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
                 if (currentRank == rank)
                     continue;
                 
-                sc_time &earliestTimeToStart = nextCommandByRank[Command::RDA][currentRank];
-                earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+                uint64_t& earliestCycleToStart = nextCommandByRank[Command::RDA][currentRank];
+                earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
         // Channel (RD,WR) tRDWR_R [] Different(level=<ComponentLevel.Rank: 3>)
         {
-            const sc_time constraint = currentTime + tRDWR_R;
+            const uint64_t constraint = currentCycle + tRDWR_R;
             for (unsigned int i = memSpec.ranksPerChannel * static_cast<unsigned>(0); i < memSpec.ranksPerChannel * (1 + static_cast<unsigned>(0)); i++)
             {
                 Rank currentRank{i};
@@ -212,14 +248,14 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
                 if (currentRank == rank)
                     continue;
                 
-                sc_time &earliestTimeToStart = nextCommandByRank[Command::WR][currentRank];
-                earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+                uint64_t& earliestCycleToStart = nextCommandByRank[Command::WR][currentRank];
+                earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
         // Channel (RD,MWR) tRDWR_R [] Different(level=<ComponentLevel.Rank: 3>)
         {
-            const sc_time constraint = currentTime + tRDWR_R;
+            const uint64_t constraint = currentCycle + tRDWR_R;
             for (unsigned int i = memSpec.ranksPerChannel * static_cast<unsigned>(0); i < memSpec.ranksPerChannel * (1 + static_cast<unsigned>(0)); i++)
             {
                 Rank currentRank{i};
@@ -227,14 +263,14 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
                 if (currentRank == rank)
                     continue;
                 
-                sc_time &earliestTimeToStart = nextCommandByRank[Command::MWR][currentRank];
-                earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+                uint64_t& earliestCycleToStart = nextCommandByRank[Command::MWR][currentRank];
+                earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
         // Channel (RD,WRA) tRDWR_R [] Different(level=<ComponentLevel.Rank: 3>)
         {
-            const sc_time constraint = currentTime + tRDWR_R;
+            const uint64_t constraint = currentCycle + tRDWR_R;
             for (unsigned int i = memSpec.ranksPerChannel * static_cast<unsigned>(0); i < memSpec.ranksPerChannel * (1 + static_cast<unsigned>(0)); i++)
             {
                 Rank currentRank{i};
@@ -242,14 +278,14 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
                 if (currentRank == rank)
                     continue;
                 
-                sc_time &earliestTimeToStart = nextCommandByRank[Command::WRA][currentRank];
-                earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+                uint64_t& earliestCycleToStart = nextCommandByRank[Command::WRA][currentRank];
+                earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
         // Channel (RD,MWRA) tRDWR_R [] Different(level=<ComponentLevel.Rank: 3>)
         {
-            const sc_time constraint = currentTime + tRDWR_R;
+            const uint64_t constraint = currentCycle + tRDWR_R;
             for (unsigned int i = memSpec.ranksPerChannel * static_cast<unsigned>(0); i < memSpec.ranksPerChannel * (1 + static_cast<unsigned>(0)); i++)
             {
                 Rank currentRank{i};
@@ -257,8 +293,8 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
                 if (currentRank == rank)
                     continue;
                 
-                sc_time &earliestTimeToStart = nextCommandByRank[Command::MWRA][currentRank];
-                earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+                uint64_t& earliestCycleToStart = nextCommandByRank[Command::MWRA][currentRank];
+                earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
@@ -269,169 +305,169 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
     {
         // Bank (WR,PREPB) tWRPRE [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRPRE;
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::PREPB][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRPRE;
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::PREPB][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Bank (WR,MWR) memSpec.tCCDMW [LastBurstLength(burst_length=32, inversed=True)] SameComponent()
+        // Bank (WR,MWR) tCCDMW [LastBurstLength(burst_length=32, inversed=True)] SameComponent()
         {
             if (burstLength != 32)
             {
-            const sc_time constraint = currentTime + memSpec.tCCDMW;
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::MWR][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCDMW;
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::MWR][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
-        // Bank (WR,MWRA) memSpec.tCCDMW [LastBurstLength(burst_length=32, inversed=True)] SameComponent()
+        // Bank (WR,MWRA) tCCDMW [LastBurstLength(burst_length=32, inversed=True)] SameComponent()
         {
             if (burstLength != 32)
             {
-            const sc_time constraint = currentTime + memSpec.tCCDMW;
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::MWRA][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCDMW;
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::MWRA][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
-        // Bank (WR,MWR) (memSpec.tCCDMW + (memSpec.tCK * 8)) [LastBurstLength(burst_length=32, inversed=False)] SameComponent()
+        // Bank (WR,MWR) (tCCDMW + (tCK * 8)) [LastBurstLength(burst_length=32, inversed=False)] SameComponent()
         {
             if (burstLength == 32)
             {
-            const sc_time constraint = currentTime + (memSpec.tCCDMW + (memSpec.tCK * 8));
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::MWR][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tCCDMW + (tCK * 8));
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::MWR][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
-        // Bank (WR,MWRA) (memSpec.tCCDMW + (memSpec.tCK * 8)) [LastBurstLength(burst_length=32, inversed=False)] SameComponent()
+        // Bank (WR,MWRA) (tCCDMW + (tCK * 8)) [LastBurstLength(burst_length=32, inversed=False)] SameComponent()
         {
             if (burstLength == 32)
             {
-            const sc_time constraint = currentTime + (memSpec.tCCDMW + (memSpec.tCK * 8));
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::MWRA][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tCCDMW + (tCK * 8));
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::MWRA][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
         // Bank (WR,RDA) std::max(tWRRD, (tWRPRE - tRDPRE)) [] SameComponent()
         {
-            const sc_time constraint = currentTime + std::max(tWRRD, (tWRPRE - tRDPRE));
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::RDA][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + std::max(tWRRD, (tWRPRE - tRDPRE));
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::RDA][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (WR,PREAB) tWRPRE [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRPRE;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PREAB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRPRE;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PREAB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (WR,PDEA) tWRPDEN [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRPDEN;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PDEA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRPDEN;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PDEA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (WR,WR) memSpec.tCCD [LastBurstLength(burst_length=32, inversed=True)] SameComponent()
+        // Rank (WR,WR) tCCD [LastBurstLength(burst_length=32, inversed=True)] SameComponent()
         {
             if (burstLength != 32)
             {
-            const sc_time constraint = currentTime + memSpec.tCCD;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::WR][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCD;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::WR][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
-        // Rank (WR,MWR) memSpec.tCCD [LastBurstLength(burst_length=32, inversed=True)] SameComponent()
+        // Rank (WR,MWR) tCCD [LastBurstLength(burst_length=32, inversed=True)] SameComponent()
         {
             if (burstLength != 32)
             {
-            const sc_time constraint = currentTime + memSpec.tCCD;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::MWR][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCD;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::MWR][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
-        // Rank (WR,WRA) memSpec.tCCD [LastBurstLength(burst_length=32, inversed=True)] SameComponent()
+        // Rank (WR,WRA) tCCD [LastBurstLength(burst_length=32, inversed=True)] SameComponent()
         {
             if (burstLength != 32)
             {
-            const sc_time constraint = currentTime + memSpec.tCCD;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::WRA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCD;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::WRA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
-        // Rank (WR,MWRA) memSpec.tCCD [LastBurstLength(burst_length=32, inversed=True)] SameComponent()
+        // Rank (WR,MWRA) tCCD [LastBurstLength(burst_length=32, inversed=True)] SameComponent()
         {
             if (burstLength != 32)
             {
-            const sc_time constraint = currentTime + memSpec.tCCD;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::MWRA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCD;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::MWRA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
-        // Rank (WR,WR) (memSpec.tCCD + (memSpec.tCK * 8)) [LastBurstLength(burst_length=32, inversed=False)] SameComponent()
+        // Rank (WR,WR) (tCCD + (tCK * 8)) [LastBurstLength(burst_length=32, inversed=False)] SameComponent()
         {
             if (burstLength == 32)
             {
-            const sc_time constraint = currentTime + (memSpec.tCCD + (memSpec.tCK * 8));
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::WR][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tCCD + (tCK * 8));
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::WR][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
-        // Rank (WR,MWR) (memSpec.tCCD + (memSpec.tCK * 8)) [LastBurstLength(burst_length=32, inversed=False)] SameComponent()
+        // Rank (WR,MWR) (tCCD + (tCK * 8)) [LastBurstLength(burst_length=32, inversed=False)] SameComponent()
         {
             if (burstLength == 32)
             {
-            const sc_time constraint = currentTime + (memSpec.tCCD + (memSpec.tCK * 8));
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::MWR][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tCCD + (tCK * 8));
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::MWR][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
-        // Rank (WR,WRA) (memSpec.tCCD + (memSpec.tCK * 8)) [LastBurstLength(burst_length=32, inversed=False)] SameComponent()
+        // Rank (WR,WRA) (tCCD + (tCK * 8)) [LastBurstLength(burst_length=32, inversed=False)] SameComponent()
         {
             if (burstLength == 32)
             {
-            const sc_time constraint = currentTime + (memSpec.tCCD + (memSpec.tCK * 8));
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::WRA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tCCD + (tCK * 8));
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::WRA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
-        // Rank (WR,MWRA) (memSpec.tCCD + (memSpec.tCK * 8)) [LastBurstLength(burst_length=32, inversed=False)] SameComponent()
+        // Rank (WR,MWRA) (tCCD + (tCK * 8)) [LastBurstLength(burst_length=32, inversed=False)] SameComponent()
         {
             if (burstLength == 32)
             {
-            const sc_time constraint = currentTime + (memSpec.tCCD + (memSpec.tCK * 8));
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::MWRA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tCCD + (tCK * 8));
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::MWRA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
         // Rank (WR,RD) tWRRD [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRRD;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::RD][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRRD;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::RD][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (WR,RDA) tWRRD [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRRD;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::RDA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRRD;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::RDA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Channel (WR,WR) (tBURST + memSpec.tRTRS) [] Different(level=<ComponentLevel.Rank: 3>)
+        // Channel (WR,WR) (tBURST + tRTRS) [] Different(level=<ComponentLevel.Rank: 3>)
         {
-            const sc_time constraint = currentTime + (tBURST + memSpec.tRTRS);
+            const uint64_t constraint = currentCycle + (tBURST + tRTRS);
             for (unsigned int i = memSpec.ranksPerChannel * static_cast<unsigned>(0); i < memSpec.ranksPerChannel * (1 + static_cast<unsigned>(0)); i++)
             {
                 Rank currentRank{i};
@@ -439,14 +475,14 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
                 if (currentRank == rank)
                     continue;
                 
-                sc_time &earliestTimeToStart = nextCommandByRank[Command::WR][currentRank];
-                earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+                uint64_t& earliestCycleToStart = nextCommandByRank[Command::WR][currentRank];
+                earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
-        // Channel (WR,MWR) (tBURST + memSpec.tRTRS) [] Different(level=<ComponentLevel.Rank: 3>)
+        // Channel (WR,MWR) (tBURST + tRTRS) [] Different(level=<ComponentLevel.Rank: 3>)
         {
-            const sc_time constraint = currentTime + (tBURST + memSpec.tRTRS);
+            const uint64_t constraint = currentCycle + (tBURST + tRTRS);
             for (unsigned int i = memSpec.ranksPerChannel * static_cast<unsigned>(0); i < memSpec.ranksPerChannel * (1 + static_cast<unsigned>(0)); i++)
             {
                 Rank currentRank{i};
@@ -454,14 +490,14 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
                 if (currentRank == rank)
                     continue;
                 
-                sc_time &earliestTimeToStart = nextCommandByRank[Command::MWR][currentRank];
-                earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+                uint64_t& earliestCycleToStart = nextCommandByRank[Command::MWR][currentRank];
+                earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
-        // Channel (WR,WRA) (tBURST + memSpec.tRTRS) [] Different(level=<ComponentLevel.Rank: 3>)
+        // Channel (WR,WRA) (tBURST + tRTRS) [] Different(level=<ComponentLevel.Rank: 3>)
         {
-            const sc_time constraint = currentTime + (tBURST + memSpec.tRTRS);
+            const uint64_t constraint = currentCycle + (tBURST + tRTRS);
             for (unsigned int i = memSpec.ranksPerChannel * static_cast<unsigned>(0); i < memSpec.ranksPerChannel * (1 + static_cast<unsigned>(0)); i++)
             {
                 Rank currentRank{i};
@@ -469,14 +505,14 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
                 if (currentRank == rank)
                     continue;
                 
-                sc_time &earliestTimeToStart = nextCommandByRank[Command::WRA][currentRank];
-                earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+                uint64_t& earliestCycleToStart = nextCommandByRank[Command::WRA][currentRank];
+                earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
-        // Channel (WR,MWRA) (tBURST + memSpec.tRTRS) [] Different(level=<ComponentLevel.Rank: 3>)
+        // Channel (WR,MWRA) (tBURST + tRTRS) [] Different(level=<ComponentLevel.Rank: 3>)
         {
-            const sc_time constraint = currentTime + (tBURST + memSpec.tRTRS);
+            const uint64_t constraint = currentCycle + (tBURST + tRTRS);
             for (unsigned int i = memSpec.ranksPerChannel * static_cast<unsigned>(0); i < memSpec.ranksPerChannel * (1 + static_cast<unsigned>(0)); i++)
             {
                 Rank currentRank{i};
@@ -484,14 +520,14 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
                 if (currentRank == rank)
                     continue;
                 
-                sc_time &earliestTimeToStart = nextCommandByRank[Command::MWRA][currentRank];
-                earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+                uint64_t& earliestCycleToStart = nextCommandByRank[Command::MWRA][currentRank];
+                earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
         // Channel (WR,RD) tWRRD_R [] Different(level=<ComponentLevel.Rank: 3>)
         {
-            const sc_time constraint = currentTime + tWRRD_R;
+            const uint64_t constraint = currentCycle + tWRRD_R;
             for (unsigned int i = memSpec.ranksPerChannel * static_cast<unsigned>(0); i < memSpec.ranksPerChannel * (1 + static_cast<unsigned>(0)); i++)
             {
                 Rank currentRank{i};
@@ -499,14 +535,14 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
                 if (currentRank == rank)
                     continue;
                 
-                sc_time &earliestTimeToStart = nextCommandByRank[Command::RD][currentRank];
-                earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+                uint64_t& earliestCycleToStart = nextCommandByRank[Command::RD][currentRank];
+                earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
         // Channel (WR,RDA) tWRRD_R [] Different(level=<ComponentLevel.Rank: 3>)
         {
-            const sc_time constraint = currentTime + tWRRD_R;
+            const uint64_t constraint = currentCycle + tWRRD_R;
             for (unsigned int i = memSpec.ranksPerChannel * static_cast<unsigned>(0); i < memSpec.ranksPerChannel * (1 + static_cast<unsigned>(0)); i++)
             {
                 Rank currentRank{i};
@@ -514,8 +550,8 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
                 if (currentRank == rank)
                     continue;
                 
-                sc_time &earliestTimeToStart = nextCommandByRank[Command::RDA][currentRank];
-                earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+                uint64_t& earliestCycleToStart = nextCommandByRank[Command::RDA][currentRank];
+                earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
@@ -526,109 +562,109 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
     {
         // Bank (MWR,PREPB) tWRPRE [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRPRE;
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::PREPB][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRPRE;
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::PREPB][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Bank (MWR,MWR) memSpec.tCCDMW [LastBurstLength(burst_length=32, inversed=True)] SameComponent()
+        // Bank (MWR,MWR) tCCDMW [LastBurstLength(burst_length=32, inversed=True)] SameComponent()
         {
             if (burstLength != 32)
             {
-            const sc_time constraint = currentTime + memSpec.tCCDMW;
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::MWR][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCDMW;
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::MWR][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
-        // Bank (MWR,MWRA) memSpec.tCCDMW [LastBurstLength(burst_length=32, inversed=True)] SameComponent()
+        // Bank (MWR,MWRA) tCCDMW [LastBurstLength(burst_length=32, inversed=True)] SameComponent()
         {
             if (burstLength != 32)
             {
-            const sc_time constraint = currentTime + memSpec.tCCDMW;
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::MWRA][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCDMW;
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::MWRA][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
         // Bank (MWR,RDA) std::max(tWRRD, (tWRPRE - tRDPRE)) [] SameComponent()
         {
-            const sc_time constraint = currentTime + std::max(tWRRD, (tWRPRE - tRDPRE));
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::RDA][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + std::max(tWRRD, (tWRPRE - tRDPRE));
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::RDA][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (MWR,PREAB) tWRPRE [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRPRE;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PREAB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRPRE;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PREAB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (MWR,PDEA) tWRPDEN [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRPDEN;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PDEA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRPDEN;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PDEA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (MWR,WR) memSpec.tCCD [LastBurstLength(burst_length=32, inversed=True)] SameComponent()
+        // Rank (MWR,WR) tCCD [LastBurstLength(burst_length=32, inversed=True)] SameComponent()
         {
             if (burstLength != 32)
             {
-            const sc_time constraint = currentTime + memSpec.tCCD;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::WR][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCD;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::WR][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
-        // Rank (MWR,MWR) memSpec.tCCD [LastBurstLength(burst_length=32, inversed=True)] SameComponent()
+        // Rank (MWR,MWR) tCCD [LastBurstLength(burst_length=32, inversed=True)] SameComponent()
         {
             if (burstLength != 32)
             {
-            const sc_time constraint = currentTime + memSpec.tCCD;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::MWR][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCD;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::MWR][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
-        // Rank (MWR,WRA) memSpec.tCCD [LastBurstLength(burst_length=32, inversed=True)] SameComponent()
+        // Rank (MWR,WRA) tCCD [LastBurstLength(burst_length=32, inversed=True)] SameComponent()
         {
             if (burstLength != 32)
             {
-            const sc_time constraint = currentTime + memSpec.tCCD;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::WRA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCD;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::WRA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
-        // Rank (MWR,MWRA) memSpec.tCCD [LastBurstLength(burst_length=32, inversed=True)] SameComponent()
+        // Rank (MWR,MWRA) tCCD [LastBurstLength(burst_length=32, inversed=True)] SameComponent()
         {
             if (burstLength != 32)
             {
-            const sc_time constraint = currentTime + memSpec.tCCD;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::MWRA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCD;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::MWRA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
         // Rank (MWR,RD) tWRRD [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRRD;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::RD][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRRD;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::RD][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (MWR,RDA) tWRRD [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRRD;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::RDA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRRD;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::RDA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Channel (MWR,WR) (tBURST + memSpec.tRTRS) [] Different(level=<ComponentLevel.Rank: 3>)
+        // Channel (MWR,WR) (tBURST + tRTRS) [] Different(level=<ComponentLevel.Rank: 3>)
         {
-            const sc_time constraint = currentTime + (tBURST + memSpec.tRTRS);
+            const uint64_t constraint = currentCycle + (tBURST + tRTRS);
             for (unsigned int i = memSpec.ranksPerChannel * static_cast<unsigned>(0); i < memSpec.ranksPerChannel * (1 + static_cast<unsigned>(0)); i++)
             {
                 Rank currentRank{i};
@@ -636,14 +672,14 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
                 if (currentRank == rank)
                     continue;
                 
-                sc_time &earliestTimeToStart = nextCommandByRank[Command::WR][currentRank];
-                earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+                uint64_t& earliestCycleToStart = nextCommandByRank[Command::WR][currentRank];
+                earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
-        // Channel (MWR,MWR) (tBURST + memSpec.tRTRS) [] Different(level=<ComponentLevel.Rank: 3>)
+        // Channel (MWR,MWR) (tBURST + tRTRS) [] Different(level=<ComponentLevel.Rank: 3>)
         {
-            const sc_time constraint = currentTime + (tBURST + memSpec.tRTRS);
+            const uint64_t constraint = currentCycle + (tBURST + tRTRS);
             for (unsigned int i = memSpec.ranksPerChannel * static_cast<unsigned>(0); i < memSpec.ranksPerChannel * (1 + static_cast<unsigned>(0)); i++)
             {
                 Rank currentRank{i};
@@ -651,14 +687,14 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
                 if (currentRank == rank)
                     continue;
                 
-                sc_time &earliestTimeToStart = nextCommandByRank[Command::MWR][currentRank];
-                earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+                uint64_t& earliestCycleToStart = nextCommandByRank[Command::MWR][currentRank];
+                earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
-        // Channel (MWR,WRA) (tBURST + memSpec.tRTRS) [] Different(level=<ComponentLevel.Rank: 3>)
+        // Channel (MWR,WRA) (tBURST + tRTRS) [] Different(level=<ComponentLevel.Rank: 3>)
         {
-            const sc_time constraint = currentTime + (tBURST + memSpec.tRTRS);
+            const uint64_t constraint = currentCycle + (tBURST + tRTRS);
             for (unsigned int i = memSpec.ranksPerChannel * static_cast<unsigned>(0); i < memSpec.ranksPerChannel * (1 + static_cast<unsigned>(0)); i++)
             {
                 Rank currentRank{i};
@@ -666,14 +702,14 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
                 if (currentRank == rank)
                     continue;
                 
-                sc_time &earliestTimeToStart = nextCommandByRank[Command::WRA][currentRank];
-                earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+                uint64_t& earliestCycleToStart = nextCommandByRank[Command::WRA][currentRank];
+                earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
-        // Channel (MWR,MWRA) (tBURST + memSpec.tRTRS) [] Different(level=<ComponentLevel.Rank: 3>)
+        // Channel (MWR,MWRA) (tBURST + tRTRS) [] Different(level=<ComponentLevel.Rank: 3>)
         {
-            const sc_time constraint = currentTime + (tBURST + memSpec.tRTRS);
+            const uint64_t constraint = currentCycle + (tBURST + tRTRS);
             for (unsigned int i = memSpec.ranksPerChannel * static_cast<unsigned>(0); i < memSpec.ranksPerChannel * (1 + static_cast<unsigned>(0)); i++)
             {
                 Rank currentRank{i};
@@ -681,14 +717,14 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
                 if (currentRank == rank)
                     continue;
                 
-                sc_time &earliestTimeToStart = nextCommandByRank[Command::MWRA][currentRank];
-                earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+                uint64_t& earliestCycleToStart = nextCommandByRank[Command::MWRA][currentRank];
+                earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
         // Channel (MWR,RD) tWRRD_R [] Different(level=<ComponentLevel.Rank: 3>)
         {
-            const sc_time constraint = currentTime + tWRRD_R;
+            const uint64_t constraint = currentCycle + tWRRD_R;
             for (unsigned int i = memSpec.ranksPerChannel * static_cast<unsigned>(0); i < memSpec.ranksPerChannel * (1 + static_cast<unsigned>(0)); i++)
             {
                 Rank currentRank{i};
@@ -696,14 +732,14 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
                 if (currentRank == rank)
                     continue;
                 
-                sc_time &earliestTimeToStart = nextCommandByRank[Command::RD][currentRank];
-                earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+                uint64_t& earliestCycleToStart = nextCommandByRank[Command::RD][currentRank];
+                earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
         // Channel (MWR,RDA) tWRRD_R [] Different(level=<ComponentLevel.Rank: 3>)
         {
-            const sc_time constraint = currentTime + tWRRD_R;
+            const uint64_t constraint = currentCycle + tWRRD_R;
             for (unsigned int i = memSpec.ranksPerChannel * static_cast<unsigned>(0); i < memSpec.ranksPerChannel * (1 + static_cast<unsigned>(0)); i++)
             {
                 Rank currentRank{i};
@@ -711,8 +747,8 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
                 if (currentRank == rank)
                     continue;
                 
-                sc_time &earliestTimeToStart = nextCommandByRank[Command::RDA][currentRank];
-                earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+                uint64_t& earliestCycleToStart = nextCommandByRank[Command::RDA][currentRank];
+                earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
@@ -723,98 +759,98 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
     {
         // Bank (RDA,ACT) tRDAACT [] SameComponent()
         {
-            const sc_time constraint = currentTime + tRDAACT;
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::ACT][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRDAACT;
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::ACT][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Bank (RDA,REFPB) (tRDPRE + memSpec.tRPpb) [] SameComponent()
+        // Bank (RDA,REFPB) (tRDPRE + tRPpb) [] SameComponent()
         {
-            const sc_time constraint = currentTime + (tRDPRE + memSpec.tRPpb);
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::REFPB][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tRDPRE + tRPpb);
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::REFPB][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (RDA,PREAB) tRDPRE [] SameComponent()
         {
-            const sc_time constraint = currentTime + tRDPRE;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PREAB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRDPRE;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PREAB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (RDA,PDEA) tRDPDEN [] SameComponent()
         {
-            const sc_time constraint = currentTime + tRDPDEN;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PDEA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRDPDEN;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PDEA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (RDA,PDEP) tRDPDEN [] SameComponent()
         {
-            const sc_time constraint = currentTime + tRDPDEN;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PDEP][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRDPDEN;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PDEP][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (RDA,RD) memSpec.tCCD [] SameComponent()
+        // Rank (RDA,RD) tCCD [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCCD;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::RD][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCD;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::RD][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (RDA,RDA) memSpec.tCCD [] SameComponent()
+        // Rank (RDA,RDA) tCCD [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCCD;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::RDA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCD;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::RDA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (RDA,WR) tRDWR [] SameComponent()
         {
-            const sc_time constraint = currentTime + tRDWR;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::WR][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRDWR;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::WR][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (RDA,MWR) tRDWR [] SameComponent()
         {
-            const sc_time constraint = currentTime + tRDWR;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::MWR][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRDWR;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::MWR][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (RDA,WRA) tRDWR [] SameComponent()
         {
-            const sc_time constraint = currentTime + tRDWR;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::WRA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRDWR;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::WRA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (RDA,MWRA) tRDWR [] SameComponent()
         {
-            const sc_time constraint = currentTime + tRDWR;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::MWRA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRDWR;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::MWRA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (RDA,REFAB) (tRDPRE + memSpec.tRPpb) [] SameComponent()
+        // Rank (RDA,REFAB) (tRDPRE + tRPpb) [] SameComponent()
         {
-            const sc_time constraint = currentTime + (tRDPRE + memSpec.tRPpb);
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::REFAB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tRDPRE + tRPpb);
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::REFAB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (RDA,SREFEN) std::max(tRDPDEN, (tRDPRE + memSpec.tRPpb)) [] SameComponent()
+        // Rank (RDA,SREFEN) std::max(tRDPDEN, (tRDPRE + tRPpb)) [] SameComponent()
         {
-            const sc_time constraint = currentTime + std::max(tRDPDEN, (tRDPRE + memSpec.tRPpb));
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::SREFEN][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + std::max(tRDPDEN, (tRDPRE + tRPpb));
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::SREFEN][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Channel (RDA,RD) (tBURST + memSpec.tRTRS) [] Different(level=<ComponentLevel.Rank: 3>)
+        // Channel (RDA,RD) (tBURST + tRTRS) [] Different(level=<ComponentLevel.Rank: 3>)
         {
-            const sc_time constraint = currentTime + (tBURST + memSpec.tRTRS);
+            const uint64_t constraint = currentCycle + (tBURST + tRTRS);
             for (unsigned int i = memSpec.ranksPerChannel * static_cast<unsigned>(0); i < memSpec.ranksPerChannel * (1 + static_cast<unsigned>(0)); i++)
             {
                 Rank currentRank{i};
@@ -822,14 +858,14 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
                 if (currentRank == rank)
                     continue;
                 
-                sc_time &earliestTimeToStart = nextCommandByRank[Command::RD][currentRank];
-                earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+                uint64_t& earliestCycleToStart = nextCommandByRank[Command::RD][currentRank];
+                earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
-        // Channel (RDA,RDA) (tBURST + memSpec.tRTRS) [] Different(level=<ComponentLevel.Rank: 3>)
+        // Channel (RDA,RDA) (tBURST + tRTRS) [] Different(level=<ComponentLevel.Rank: 3>)
         {
-            const sc_time constraint = currentTime + (tBURST + memSpec.tRTRS);
+            const uint64_t constraint = currentCycle + (tBURST + tRTRS);
             for (unsigned int i = memSpec.ranksPerChannel * static_cast<unsigned>(0); i < memSpec.ranksPerChannel * (1 + static_cast<unsigned>(0)); i++)
             {
                 Rank currentRank{i};
@@ -837,14 +873,14 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
                 if (currentRank == rank)
                     continue;
                 
-                sc_time &earliestTimeToStart = nextCommandByRank[Command::RDA][currentRank];
-                earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+                uint64_t& earliestCycleToStart = nextCommandByRank[Command::RDA][currentRank];
+                earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
         // Channel (RDA,WR) tRDWR_R [] Different(level=<ComponentLevel.Rank: 3>)
         {
-            const sc_time constraint = currentTime + tRDWR_R;
+            const uint64_t constraint = currentCycle + tRDWR_R;
             for (unsigned int i = memSpec.ranksPerChannel * static_cast<unsigned>(0); i < memSpec.ranksPerChannel * (1 + static_cast<unsigned>(0)); i++)
             {
                 Rank currentRank{i};
@@ -852,14 +888,14 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
                 if (currentRank == rank)
                     continue;
                 
-                sc_time &earliestTimeToStart = nextCommandByRank[Command::WR][currentRank];
-                earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+                uint64_t& earliestCycleToStart = nextCommandByRank[Command::WR][currentRank];
+                earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
         // Channel (RDA,MWR) tRDWR_R [] Different(level=<ComponentLevel.Rank: 3>)
         {
-            const sc_time constraint = currentTime + tRDWR_R;
+            const uint64_t constraint = currentCycle + tRDWR_R;
             for (unsigned int i = memSpec.ranksPerChannel * static_cast<unsigned>(0); i < memSpec.ranksPerChannel * (1 + static_cast<unsigned>(0)); i++)
             {
                 Rank currentRank{i};
@@ -867,14 +903,14 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
                 if (currentRank == rank)
                     continue;
                 
-                sc_time &earliestTimeToStart = nextCommandByRank[Command::MWR][currentRank];
-                earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+                uint64_t& earliestCycleToStart = nextCommandByRank[Command::MWR][currentRank];
+                earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
         // Channel (RDA,WRA) tRDWR_R [] Different(level=<ComponentLevel.Rank: 3>)
         {
-            const sc_time constraint = currentTime + tRDWR_R;
+            const uint64_t constraint = currentCycle + tRDWR_R;
             for (unsigned int i = memSpec.ranksPerChannel * static_cast<unsigned>(0); i < memSpec.ranksPerChannel * (1 + static_cast<unsigned>(0)); i++)
             {
                 Rank currentRank{i};
@@ -882,14 +918,14 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
                 if (currentRank == rank)
                     continue;
                 
-                sc_time &earliestTimeToStart = nextCommandByRank[Command::WRA][currentRank];
-                earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+                uint64_t& earliestCycleToStart = nextCommandByRank[Command::WRA][currentRank];
+                earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
         // Channel (RDA,MWRA) tRDWR_R [] Different(level=<ComponentLevel.Rank: 3>)
         {
-            const sc_time constraint = currentTime + tRDWR_R;
+            const uint64_t constraint = currentCycle + tRDWR_R;
             for (unsigned int i = memSpec.ranksPerChannel * static_cast<unsigned>(0); i < memSpec.ranksPerChannel * (1 + static_cast<unsigned>(0)); i++)
             {
                 Rank currentRank{i};
@@ -897,8 +933,8 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
                 if (currentRank == rank)
                     continue;
                 
-                sc_time &earliestTimeToStart = nextCommandByRank[Command::MWRA][currentRank];
-                earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+                uint64_t& earliestCycleToStart = nextCommandByRank[Command::MWRA][currentRank];
+                earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
@@ -907,192 +943,192 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
     }
     case Command::WRA:
     {
-        // Bank (WRA,MWR) memSpec.tCCDMW [LastBurstLength(burst_length=32, inversed=True)] SameComponent()
+        // Bank (WRA,MWR) tCCDMW [LastBurstLength(burst_length=32, inversed=True)] SameComponent()
         {
             if (burstLength != 32)
             {
-            const sc_time constraint = currentTime + memSpec.tCCDMW;
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::MWR][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCDMW;
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::MWR][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
-        // Bank (WRA,MWRA) memSpec.tCCDMW [LastBurstLength(burst_length=32, inversed=True)] SameComponent()
+        // Bank (WRA,MWRA) tCCDMW [LastBurstLength(burst_length=32, inversed=True)] SameComponent()
         {
             if (burstLength != 32)
             {
-            const sc_time constraint = currentTime + memSpec.tCCDMW;
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::MWRA][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCDMW;
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::MWRA][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
-        // Bank (WRA,MWR) (memSpec.tCCDMW + (memSpec.tCK * 8)) [LastBurstLength(burst_length=32, inversed=False)] SameComponent()
+        // Bank (WRA,MWR) (tCCDMW + (tCK * 8)) [LastBurstLength(burst_length=32, inversed=False)] SameComponent()
         {
             if (burstLength == 32)
             {
-            const sc_time constraint = currentTime + (memSpec.tCCDMW + (memSpec.tCK * 8));
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::MWR][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tCCDMW + (tCK * 8));
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::MWR][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
-        // Bank (WRA,MWRA) (memSpec.tCCDMW + (memSpec.tCK * 8)) [LastBurstLength(burst_length=32, inversed=False)] SameComponent()
+        // Bank (WRA,MWRA) (tCCDMW + (tCK * 8)) [LastBurstLength(burst_length=32, inversed=False)] SameComponent()
         {
             if (burstLength == 32)
             {
-            const sc_time constraint = currentTime + (memSpec.tCCDMW + (memSpec.tCK * 8));
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::MWRA][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tCCDMW + (tCK * 8));
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::MWRA][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
         // Bank (WRA,ACT) tWRAACT [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRAACT;
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::ACT][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRAACT;
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::ACT][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Bank (WRA,REFPB) (tWRPRE + memSpec.tRPpb) [] SameComponent()
+        // Bank (WRA,REFPB) (tWRPRE + tRPpb) [] SameComponent()
         {
-            const sc_time constraint = currentTime + (tWRPRE + memSpec.tRPpb);
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::REFPB][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tWRPRE + tRPpb);
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::REFPB][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (WRA,PREAB) tWRPRE [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRPRE;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PREAB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRPRE;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PREAB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (WRA,PDEA) tWRAPDEN [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRAPDEN;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PDEA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRAPDEN;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PDEA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (WRA,PDEP) tWRAPDEN [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRAPDEN;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PDEP][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRAPDEN;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PDEP][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (WRA,WR) memSpec.tCCD [LastBurstLength(burst_length=32, inversed=True)] SameComponent()
+        // Rank (WRA,WR) tCCD [LastBurstLength(burst_length=32, inversed=True)] SameComponent()
         {
             if (burstLength != 32)
             {
-            const sc_time constraint = currentTime + memSpec.tCCD;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::WR][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCD;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::WR][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
-        // Rank (WRA,MWR) memSpec.tCCD [LastBurstLength(burst_length=32, inversed=True)] SameComponent()
+        // Rank (WRA,MWR) tCCD [LastBurstLength(burst_length=32, inversed=True)] SameComponent()
         {
             if (burstLength != 32)
             {
-            const sc_time constraint = currentTime + memSpec.tCCD;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::MWR][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCD;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::MWR][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
-        // Rank (WRA,WRA) memSpec.tCCD [LastBurstLength(burst_length=32, inversed=True)] SameComponent()
+        // Rank (WRA,WRA) tCCD [LastBurstLength(burst_length=32, inversed=True)] SameComponent()
         {
             if (burstLength != 32)
             {
-            const sc_time constraint = currentTime + memSpec.tCCD;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::WRA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCD;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::WRA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
-        // Rank (WRA,MWRA) memSpec.tCCD [LastBurstLength(burst_length=32, inversed=True)] SameComponent()
+        // Rank (WRA,MWRA) tCCD [LastBurstLength(burst_length=32, inversed=True)] SameComponent()
         {
             if (burstLength != 32)
             {
-            const sc_time constraint = currentTime + memSpec.tCCD;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::MWRA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCD;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::MWRA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
-        // Rank (WRA,WR) (memSpec.tCCD + (memSpec.tCK * 8)) [LastBurstLength(burst_length=32, inversed=False)] SameComponent()
+        // Rank (WRA,WR) (tCCD + (tCK * 8)) [LastBurstLength(burst_length=32, inversed=False)] SameComponent()
         {
             if (burstLength == 32)
             {
-            const sc_time constraint = currentTime + (memSpec.tCCD + (memSpec.tCK * 8));
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::WR][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tCCD + (tCK * 8));
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::WR][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
-        // Rank (WRA,MWR) (memSpec.tCCD + (memSpec.tCK * 8)) [LastBurstLength(burst_length=32, inversed=False)] SameComponent()
+        // Rank (WRA,MWR) (tCCD + (tCK * 8)) [LastBurstLength(burst_length=32, inversed=False)] SameComponent()
         {
             if (burstLength == 32)
             {
-            const sc_time constraint = currentTime + (memSpec.tCCD + (memSpec.tCK * 8));
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::MWR][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tCCD + (tCK * 8));
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::MWR][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
-        // Rank (WRA,WRA) (memSpec.tCCD + (memSpec.tCK * 8)) [LastBurstLength(burst_length=32, inversed=False)] SameComponent()
+        // Rank (WRA,WRA) (tCCD + (tCK * 8)) [LastBurstLength(burst_length=32, inversed=False)] SameComponent()
         {
             if (burstLength == 32)
             {
-            const sc_time constraint = currentTime + (memSpec.tCCD + (memSpec.tCK * 8));
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::WRA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tCCD + (tCK * 8));
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::WRA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
-        // Rank (WRA,MWRA) (memSpec.tCCD + (memSpec.tCK * 8)) [LastBurstLength(burst_length=32, inversed=False)] SameComponent()
+        // Rank (WRA,MWRA) (tCCD + (tCK * 8)) [LastBurstLength(burst_length=32, inversed=False)] SameComponent()
         {
             if (burstLength == 32)
             {
-            const sc_time constraint = currentTime + (memSpec.tCCD + (memSpec.tCK * 8));
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::MWRA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tCCD + (tCK * 8));
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::MWRA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
         // Rank (WRA,RD) tWRRD [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRRD;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::RD][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRRD;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::RD][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (WRA,RDA) tWRRD [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRRD;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::RDA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRRD;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::RDA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (WRA,REFAB) (tWRPRE + memSpec.tRPpb) [] SameComponent()
+        // Rank (WRA,REFAB) (tWRPRE + tRPpb) [] SameComponent()
         {
-            const sc_time constraint = currentTime + (tWRPRE + memSpec.tRPpb);
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::REFAB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tWRPRE + tRPpb);
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::REFAB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (WRA,SREFEN) std::max(tWRAPDEN, (tWRPRE + memSpec.tRPpb)) [] SameComponent()
+        // Rank (WRA,SREFEN) std::max(tWRAPDEN, (tWRPRE + tRPpb)) [] SameComponent()
         {
-            const sc_time constraint = currentTime + std::max(tWRAPDEN, (tWRPRE + memSpec.tRPpb));
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::SREFEN][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + std::max(tWRAPDEN, (tWRPRE + tRPpb));
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::SREFEN][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Channel (WRA,WR) (tBURST + memSpec.tRTRS) [] Different(level=<ComponentLevel.Rank: 3>)
+        // Channel (WRA,WR) (tBURST + tRTRS) [] Different(level=<ComponentLevel.Rank: 3>)
         {
-            const sc_time constraint = currentTime + (tBURST + memSpec.tRTRS);
+            const uint64_t constraint = currentCycle + (tBURST + tRTRS);
             for (unsigned int i = memSpec.ranksPerChannel * static_cast<unsigned>(0); i < memSpec.ranksPerChannel * (1 + static_cast<unsigned>(0)); i++)
             {
                 Rank currentRank{i};
@@ -1100,14 +1136,14 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
                 if (currentRank == rank)
                     continue;
                 
-                sc_time &earliestTimeToStart = nextCommandByRank[Command::WR][currentRank];
-                earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+                uint64_t& earliestCycleToStart = nextCommandByRank[Command::WR][currentRank];
+                earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
-        // Channel (WRA,MWR) (tBURST + memSpec.tRTRS) [] Different(level=<ComponentLevel.Rank: 3>)
+        // Channel (WRA,MWR) (tBURST + tRTRS) [] Different(level=<ComponentLevel.Rank: 3>)
         {
-            const sc_time constraint = currentTime + (tBURST + memSpec.tRTRS);
+            const uint64_t constraint = currentCycle + (tBURST + tRTRS);
             for (unsigned int i = memSpec.ranksPerChannel * static_cast<unsigned>(0); i < memSpec.ranksPerChannel * (1 + static_cast<unsigned>(0)); i++)
             {
                 Rank currentRank{i};
@@ -1115,14 +1151,14 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
                 if (currentRank == rank)
                     continue;
                 
-                sc_time &earliestTimeToStart = nextCommandByRank[Command::MWR][currentRank];
-                earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+                uint64_t& earliestCycleToStart = nextCommandByRank[Command::MWR][currentRank];
+                earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
-        // Channel (WRA,WRA) (tBURST + memSpec.tRTRS) [] Different(level=<ComponentLevel.Rank: 3>)
+        // Channel (WRA,WRA) (tBURST + tRTRS) [] Different(level=<ComponentLevel.Rank: 3>)
         {
-            const sc_time constraint = currentTime + (tBURST + memSpec.tRTRS);
+            const uint64_t constraint = currentCycle + (tBURST + tRTRS);
             for (unsigned int i = memSpec.ranksPerChannel * static_cast<unsigned>(0); i < memSpec.ranksPerChannel * (1 + static_cast<unsigned>(0)); i++)
             {
                 Rank currentRank{i};
@@ -1130,14 +1166,14 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
                 if (currentRank == rank)
                     continue;
                 
-                sc_time &earliestTimeToStart = nextCommandByRank[Command::WRA][currentRank];
-                earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+                uint64_t& earliestCycleToStart = nextCommandByRank[Command::WRA][currentRank];
+                earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
-        // Channel (WRA,MWRA) (tBURST + memSpec.tRTRS) [] Different(level=<ComponentLevel.Rank: 3>)
+        // Channel (WRA,MWRA) (tBURST + tRTRS) [] Different(level=<ComponentLevel.Rank: 3>)
         {
-            const sc_time constraint = currentTime + (tBURST + memSpec.tRTRS);
+            const uint64_t constraint = currentCycle + (tBURST + tRTRS);
             for (unsigned int i = memSpec.ranksPerChannel * static_cast<unsigned>(0); i < memSpec.ranksPerChannel * (1 + static_cast<unsigned>(0)); i++)
             {
                 Rank currentRank{i};
@@ -1145,14 +1181,14 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
                 if (currentRank == rank)
                     continue;
                 
-                sc_time &earliestTimeToStart = nextCommandByRank[Command::MWRA][currentRank];
-                earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+                uint64_t& earliestCycleToStart = nextCommandByRank[Command::MWRA][currentRank];
+                earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
         // Channel (WRA,RD) tWRRD_R [] Different(level=<ComponentLevel.Rank: 3>)
         {
-            const sc_time constraint = currentTime + tWRRD_R;
+            const uint64_t constraint = currentCycle + tWRRD_R;
             for (unsigned int i = memSpec.ranksPerChannel * static_cast<unsigned>(0); i < memSpec.ranksPerChannel * (1 + static_cast<unsigned>(0)); i++)
             {
                 Rank currentRank{i};
@@ -1160,14 +1196,14 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
                 if (currentRank == rank)
                     continue;
                 
-                sc_time &earliestTimeToStart = nextCommandByRank[Command::RD][currentRank];
-                earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+                uint64_t& earliestCycleToStart = nextCommandByRank[Command::RD][currentRank];
+                earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
         // Channel (WRA,RDA) tWRRD_R [] Different(level=<ComponentLevel.Rank: 3>)
         {
-            const sc_time constraint = currentTime + tWRRD_R;
+            const uint64_t constraint = currentCycle + tWRRD_R;
             for (unsigned int i = memSpec.ranksPerChannel * static_cast<unsigned>(0); i < memSpec.ranksPerChannel * (1 + static_cast<unsigned>(0)); i++)
             {
                 Rank currentRank{i};
@@ -1175,8 +1211,8 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
                 if (currentRank == rank)
                     continue;
                 
-                sc_time &earliestTimeToStart = nextCommandByRank[Command::RDA][currentRank];
-                earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+                uint64_t& earliestCycleToStart = nextCommandByRank[Command::RDA][currentRank];
+                earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
@@ -1185,132 +1221,132 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
     }
     case Command::MWRA:
     {
-        // Bank (MWRA,MWR) memSpec.tCCDMW [LastBurstLength(burst_length=32, inversed=True)] SameComponent()
+        // Bank (MWRA,MWR) tCCDMW [LastBurstLength(burst_length=32, inversed=True)] SameComponent()
         {
             if (burstLength != 32)
             {
-            const sc_time constraint = currentTime + memSpec.tCCDMW;
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::MWR][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCDMW;
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::MWR][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
-        // Bank (MWRA,MWRA) memSpec.tCCDMW [LastBurstLength(burst_length=32, inversed=True)] SameComponent()
+        // Bank (MWRA,MWRA) tCCDMW [LastBurstLength(burst_length=32, inversed=True)] SameComponent()
         {
             if (burstLength != 32)
             {
-            const sc_time constraint = currentTime + memSpec.tCCDMW;
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::MWRA][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCDMW;
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::MWRA][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
         // Bank (MWRA,ACT) tWRAACT [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRAACT;
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::ACT][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRAACT;
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::ACT][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Bank (MWRA,REFPB) (tWRPRE + memSpec.tRPpb) [] SameComponent()
+        // Bank (MWRA,REFPB) (tWRPRE + tRPpb) [] SameComponent()
         {
-            const sc_time constraint = currentTime + (tWRPRE + memSpec.tRPpb);
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::REFPB][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tWRPRE + tRPpb);
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::REFPB][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (MWRA,PREAB) tWRPRE [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRPRE;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PREAB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRPRE;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PREAB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (MWRA,PDEA) tWRAPDEN [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRAPDEN;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PDEA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRAPDEN;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PDEA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (MWRA,PDEP) tWRAPDEN [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRAPDEN;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PDEP][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRAPDEN;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PDEP][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (MWRA,WR) memSpec.tCCD [LastBurstLength(burst_length=32, inversed=True)] SameComponent()
+        // Rank (MWRA,WR) tCCD [LastBurstLength(burst_length=32, inversed=True)] SameComponent()
         {
             if (burstLength != 32)
             {
-            const sc_time constraint = currentTime + memSpec.tCCD;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::WR][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCD;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::WR][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
-        // Rank (MWRA,MWR) memSpec.tCCD [LastBurstLength(burst_length=32, inversed=True)] SameComponent()
+        // Rank (MWRA,MWR) tCCD [LastBurstLength(burst_length=32, inversed=True)] SameComponent()
         {
             if (burstLength != 32)
             {
-            const sc_time constraint = currentTime + memSpec.tCCD;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::MWR][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCD;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::MWR][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
-        // Rank (MWRA,WRA) memSpec.tCCD [LastBurstLength(burst_length=32, inversed=True)] SameComponent()
+        // Rank (MWRA,WRA) tCCD [LastBurstLength(burst_length=32, inversed=True)] SameComponent()
         {
             if (burstLength != 32)
             {
-            const sc_time constraint = currentTime + memSpec.tCCD;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::WRA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCD;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::WRA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
-        // Rank (MWRA,MWRA) memSpec.tCCD [LastBurstLength(burst_length=32, inversed=True)] SameComponent()
+        // Rank (MWRA,MWRA) tCCD [LastBurstLength(burst_length=32, inversed=True)] SameComponent()
         {
             if (burstLength != 32)
             {
-            const sc_time constraint = currentTime + memSpec.tCCD;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::MWRA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCCD;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::MWRA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
         // Rank (MWRA,RD) tWRRD [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRRD;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::RD][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRRD;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::RD][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (MWRA,RDA) tWRRD [] SameComponent()
         {
-            const sc_time constraint = currentTime + tWRRD;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::RDA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tWRRD;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::RDA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (MWRA,REFAB) (tWRPRE + memSpec.tRPpb) [] SameComponent()
+        // Rank (MWRA,REFAB) (tWRPRE + tRPpb) [] SameComponent()
         {
-            const sc_time constraint = currentTime + (tWRPRE + memSpec.tRPpb);
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::REFAB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tWRPRE + tRPpb);
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::REFAB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (MWRA,SREFEN) std::max(tWRAPDEN, (tWRPRE + memSpec.tRPpb)) [] SameComponent()
+        // Rank (MWRA,SREFEN) std::max(tWRAPDEN, (tWRPRE + tRPpb)) [] SameComponent()
         {
-            const sc_time constraint = currentTime + std::max(tWRAPDEN, (tWRPRE + memSpec.tRPpb));
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::SREFEN][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + std::max(tWRAPDEN, (tWRPRE + tRPpb));
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::SREFEN][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Channel (MWRA,WR) (tBURST + memSpec.tRTRS) [] Different(level=<ComponentLevel.Rank: 3>)
+        // Channel (MWRA,WR) (tBURST + tRTRS) [] Different(level=<ComponentLevel.Rank: 3>)
         {
-            const sc_time constraint = currentTime + (tBURST + memSpec.tRTRS);
+            const uint64_t constraint = currentCycle + (tBURST + tRTRS);
             for (unsigned int i = memSpec.ranksPerChannel * static_cast<unsigned>(0); i < memSpec.ranksPerChannel * (1 + static_cast<unsigned>(0)); i++)
             {
                 Rank currentRank{i};
@@ -1318,14 +1354,14 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
                 if (currentRank == rank)
                     continue;
                 
-                sc_time &earliestTimeToStart = nextCommandByRank[Command::WR][currentRank];
-                earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+                uint64_t& earliestCycleToStart = nextCommandByRank[Command::WR][currentRank];
+                earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
-        // Channel (MWRA,MWR) (tBURST + memSpec.tRTRS) [] Different(level=<ComponentLevel.Rank: 3>)
+        // Channel (MWRA,MWR) (tBURST + tRTRS) [] Different(level=<ComponentLevel.Rank: 3>)
         {
-            const sc_time constraint = currentTime + (tBURST + memSpec.tRTRS);
+            const uint64_t constraint = currentCycle + (tBURST + tRTRS);
             for (unsigned int i = memSpec.ranksPerChannel * static_cast<unsigned>(0); i < memSpec.ranksPerChannel * (1 + static_cast<unsigned>(0)); i++)
             {
                 Rank currentRank{i};
@@ -1333,14 +1369,14 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
                 if (currentRank == rank)
                     continue;
                 
-                sc_time &earliestTimeToStart = nextCommandByRank[Command::MWR][currentRank];
-                earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+                uint64_t& earliestCycleToStart = nextCommandByRank[Command::MWR][currentRank];
+                earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
-        // Channel (MWRA,WRA) (tBURST + memSpec.tRTRS) [] Different(level=<ComponentLevel.Rank: 3>)
+        // Channel (MWRA,WRA) (tBURST + tRTRS) [] Different(level=<ComponentLevel.Rank: 3>)
         {
-            const sc_time constraint = currentTime + (tBURST + memSpec.tRTRS);
+            const uint64_t constraint = currentCycle + (tBURST + tRTRS);
             for (unsigned int i = memSpec.ranksPerChannel * static_cast<unsigned>(0); i < memSpec.ranksPerChannel * (1 + static_cast<unsigned>(0)); i++)
             {
                 Rank currentRank{i};
@@ -1348,14 +1384,14 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
                 if (currentRank == rank)
                     continue;
                 
-                sc_time &earliestTimeToStart = nextCommandByRank[Command::WRA][currentRank];
-                earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+                uint64_t& earliestCycleToStart = nextCommandByRank[Command::WRA][currentRank];
+                earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
-        // Channel (MWRA,MWRA) (tBURST + memSpec.tRTRS) [] Different(level=<ComponentLevel.Rank: 3>)
+        // Channel (MWRA,MWRA) (tBURST + tRTRS) [] Different(level=<ComponentLevel.Rank: 3>)
         {
-            const sc_time constraint = currentTime + (tBURST + memSpec.tRTRS);
+            const uint64_t constraint = currentCycle + (tBURST + tRTRS);
             for (unsigned int i = memSpec.ranksPerChannel * static_cast<unsigned>(0); i < memSpec.ranksPerChannel * (1 + static_cast<unsigned>(0)); i++)
             {
                 Rank currentRank{i};
@@ -1363,14 +1399,14 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
                 if (currentRank == rank)
                     continue;
                 
-                sc_time &earliestTimeToStart = nextCommandByRank[Command::MWRA][currentRank];
-                earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+                uint64_t& earliestCycleToStart = nextCommandByRank[Command::MWRA][currentRank];
+                earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
         // Channel (MWRA,RD) tWRRD_R [] Different(level=<ComponentLevel.Rank: 3>)
         {
-            const sc_time constraint = currentTime + tWRRD_R;
+            const uint64_t constraint = currentCycle + tWRRD_R;
             for (unsigned int i = memSpec.ranksPerChannel * static_cast<unsigned>(0); i < memSpec.ranksPerChannel * (1 + static_cast<unsigned>(0)); i++)
             {
                 Rank currentRank{i};
@@ -1378,14 +1414,14 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
                 if (currentRank == rank)
                     continue;
                 
-                sc_time &earliestTimeToStart = nextCommandByRank[Command::RD][currentRank];
-                earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+                uint64_t& earliestCycleToStart = nextCommandByRank[Command::RD][currentRank];
+                earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
         // Channel (MWRA,RDA) tWRRD_R [] Different(level=<ComponentLevel.Rank: 3>)
         {
-            const sc_time constraint = currentTime + tWRRD_R;
+            const uint64_t constraint = currentCycle + tWRRD_R;
             for (unsigned int i = memSpec.ranksPerChannel * static_cast<unsigned>(0); i < memSpec.ranksPerChannel * (1 + static_cast<unsigned>(0)); i++)
             {
                 Rank currentRank{i};
@@ -1393,8 +1429,8 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
                 if (currentRank == rank)
                     continue;
                 
-                sc_time &earliestTimeToStart = nextCommandByRank[Command::RDA][currentRank];
-                earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+                uint64_t& earliestCycleToStart = nextCommandByRank[Command::RDA][currentRank];
+                earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
         }
         
@@ -1403,186 +1439,185 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
     }
     case Command::ACT:
     {
-        // Bank (ACT,PREPB) (memSpec.tRAS + (memSpec.tCK * 2)) [] SameComponent()
+        // Bank (ACT,PREPB) (tRAS + (tCK * 2)) [] SameComponent()
         {
-            const sc_time constraint = currentTime + (memSpec.tRAS + (memSpec.tCK * 2));
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::PREPB][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tRAS + (tCK * 2));
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::PREPB][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Bank (ACT,RD) memSpec.tRCD [] SameComponent()
+        // Bank (ACT,RD) tRCD [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tRCD;
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::RD][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRCD;
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::RD][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Bank (ACT,WR) memSpec.tRCD [] SameComponent()
+        // Bank (ACT,WR) tRCD [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tRCD;
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::WR][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRCD;
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::WR][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Bank (ACT,MWR) memSpec.tRCD [] SameComponent()
+        // Bank (ACT,MWR) tRCD [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tRCD;
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::MWR][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRCD;
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::MWR][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Bank (ACT,RDA) memSpec.tRCD [] SameComponent()
+        // Bank (ACT,RDA) tRCD [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tRCD;
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::RDA][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRCD;
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::RDA][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Bank (ACT,WRA) memSpec.tRCD [] SameComponent()
+        // Bank (ACT,WRA) tRCD [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tRCD;
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::WRA][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRCD;
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::WRA][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Bank (ACT,MWRA) memSpec.tRCD [] SameComponent()
+        // Bank (ACT,MWRA) tRCD [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tRCD;
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::MWRA][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRCD;
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::MWRA][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Bank (ACT,ACT) memSpec.tRCpb [] SameComponent()
+        // Bank (ACT,ACT) tRCpb [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tRCpb;
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::ACT][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRCpb;
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::ACT][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Bank (ACT,REFPB) (memSpec.tRCpb + (memSpec.tCK * 2)) [] SameComponent()
+        // Bank (ACT,REFPB) (tRCpb + (tCK * 2)) [] SameComponent()
         {
-            const sc_time constraint = currentTime + (memSpec.tRCpb + (memSpec.tCK * 2));
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::REFPB][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tRCpb + (tCK * 2));
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::REFPB][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (ACT,PREAB) (memSpec.tRAS + (memSpec.tCK * 2)) [] SameComponent()
+        // Rank (ACT,PREAB) (tRAS + (tCK * 2)) [] SameComponent()
         {
-            const sc_time constraint = currentTime + (memSpec.tRAS + (memSpec.tCK * 2));
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PREAB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tRAS + (tCK * 2));
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PREAB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (ACT,ACT) memSpec.tRRD [] SameComponent()
+        // Rank (ACT,ACT) tRRD [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tRRD;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::ACT][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRRD;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::ACT][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (ACT,REFAB) (memSpec.tRCpb + (memSpec.tCK * 2)) [] SameComponent()
+        // Rank (ACT,REFAB) (tRCpb + (tCK * 2)) [] SameComponent()
         {
-            const sc_time constraint = currentTime + (memSpec.tRCpb + (memSpec.tCK * 2));
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::REFAB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tRCpb + (tCK * 2));
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::REFAB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (ACT,SREFEN) (memSpec.tRCpb + (memSpec.tCK * 2)) [] SameComponent()
+        // Rank (ACT,SREFEN) (tRCpb + (tCK * 2)) [] SameComponent()
         {
-            const sc_time constraint = currentTime + (memSpec.tRCpb + (memSpec.tCK * 2));
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::SREFEN][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tRCpb + (tCK * 2));
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::SREFEN][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (ACT,REFPB) (memSpec.tRRD + (memSpec.tCK * 2)) [] SameComponent()
+        // Rank (ACT,REFPB) (tRRD + (tCK * 2)) [] SameComponent()
         {
-            const sc_time constraint = currentTime + (memSpec.tRRD + (memSpec.tCK * 2));
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::REFPB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tRRD + (tCK * 2));
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::REFPB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (ACT,PDEA) tACTPDEN [] SameComponent()
         {
-            const sc_time constraint = currentTime + tACTPDEN;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PDEA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tACTPDEN;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PDEA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        last4ActivatesOnRank[rank].push(currentTime + memSpec.getCommandLength(command));
+        last4ActivatesOnRank[rank].insert(currentCycle + commandLength[command]);
 
-        if (last4ActivatesOnRank[rank].size() >= 4)
+        if (last4ActivatesOnRank[rank].full())
         {
-            sc_time constraint = last4ActivatesOnRank[rank].front() - memSpec.getCommandLength(command) + memSpec.tFAW;
+            uint64_t constraint =
+                last4ActivatesOnRank[rank].getEarliestNextActivate() - commandLength[command];
             {
-                sc_time &earliestTimeToStart = nextCommandByRank[Command::ACT][rank];
-                earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+                uint64_t& earliestCycleToStart = nextCommandByRank[Command::ACT][rank];
+                earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
             {
-                sc_time &earliestTimeToStart = nextCommandByRank[Command::REFPB][rank];
-                earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+                uint64_t& earliestCycleToStart = nextCommandByRank[Command::REFPB][rank];
+                earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
-
-            last4ActivatesOnRank[rank].pop();
         }
 
         break;
     }
     case Command::PREPB:
     {
-        // Bank (PREPB,ACT) (memSpec.tRPpb - (memSpec.tCK * 2)) [] SameComponent()
+        // Bank (PREPB,ACT) (tRPpb - (tCK * 2)) [] SameComponent()
         {
-            const sc_time constraint = currentTime + (memSpec.tRPpb - (memSpec.tCK * 2));
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::ACT][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tRPpb - (tCK * 2));
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::ACT][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Bank (PREPB,REFPB) memSpec.tRPpb [] SameComponent()
+        // Bank (PREPB,REFPB) tRPpb [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tRPpb;
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::REFPB][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRPpb;
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::REFPB][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (PREPB,PREPB) memSpec.tPPD [] SameComponent()
+        // Rank (PREPB,PREPB) tPPD [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tPPD;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PREPB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tPPD;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PREPB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (PREPB,PREAB) memSpec.tPPD [] SameComponent()
+        // Rank (PREPB,PREAB) tPPD [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tPPD;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PREAB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tPPD;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PREAB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (PREPB,REFAB) memSpec.tRPpb [] SameComponent()
+        // Rank (PREPB,REFAB) tRPpb [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tRPpb;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::REFAB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRPpb;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::REFAB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (PREPB,SREFEN) memSpec.tRPpb [] SameComponent()
+        // Rank (PREPB,SREFEN) tRPpb [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tRPpb;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::SREFEN][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRPpb;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::SREFEN][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (PREPB,PDEA) tPRPDEN [] SameComponent()
         {
-            const sc_time constraint = currentTime + tPRPDEN;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PDEA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tPRPDEN;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PDEA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (PREPB,PDEP) tPRPDEN [] SameComponent()
         {
-            const sc_time constraint = currentTime + tPRPDEN;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PDEP][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tPRPDEN;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PDEP][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
 
@@ -1590,116 +1625,115 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
     }
     case Command::REFPB:
     {
-        // Bank (REFPB,ACT) (memSpec.tRFCpb - (memSpec.tCK * 2)) [] SameComponent()
+        // Bank (REFPB,ACT) (tRFCpb - (tCK * 2)) [] SameComponent()
         {
-            const sc_time constraint = currentTime + (memSpec.tRFCpb - (memSpec.tCK * 2));
-            sc_time &earliestTimeToStart = nextCommandByBank[Command::ACT][bank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tRFCpb - (tCK * 2));
+            uint64_t& earliestCycleToStart = nextCommandByBank[Command::ACT][bank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (REFPB,REFAB) memSpec.tRFCpb [] SameComponent()
+        // Rank (REFPB,REFAB) tRFCpb [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tRFCpb;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::REFAB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRFCpb;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::REFAB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (REFPB,REFPB) memSpec.tRFCpb [] SameComponent()
+        // Rank (REFPB,REFPB) tRFCpb [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tRFCpb;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::REFPB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRFCpb;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::REFPB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (REFPB,ACT) (memSpec.tRRD - (memSpec.tCK * 2)) [] SameComponent()
+        // Rank (REFPB,ACT) (tRRD - (tCK * 2)) [] SameComponent()
         {
-            const sc_time constraint = currentTime + (memSpec.tRRD - (memSpec.tCK * 2));
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::ACT][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tRRD - (tCK * 2));
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::ACT][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (REFPB,PREAB) memSpec.tRFCpb [] SameComponent()
+        // Rank (REFPB,PREAB) tRFCpb [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tRFCpb;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PREAB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRFCpb;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PREAB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (REFPB,SREFEN) memSpec.tRFCpb [] SameComponent()
+        // Rank (REFPB,SREFEN) tRFCpb [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tRFCpb;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::SREFEN][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRFCpb;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::SREFEN][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (REFPB,PDEA) tREFPDEN [] SameComponent()
         {
-            const sc_time constraint = currentTime + tREFPDEN;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PDEA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tREFPDEN;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PDEA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (REFPB,PDEP) tREFPDEN [] SameComponent()
         {
-            const sc_time constraint = currentTime + tREFPDEN;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PDEP][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tREFPDEN;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PDEP][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        last4ActivatesOnRank[rank].push(currentTime + memSpec.getCommandLength(command));
+        last4ActivatesOnRank[rank].insert(currentCycle + commandLength[command]);
 
-        if (last4ActivatesOnRank[rank].size() >= 4)
+        if (last4ActivatesOnRank[rank].full())
         {
-            sc_time constraint = last4ActivatesOnRank[rank].front() - memSpec.getCommandLength(command) + memSpec.tFAW;
+            uint64_t constraint =
+                last4ActivatesOnRank[rank].getEarliestNextActivate() - commandLength[command];
             {
-                sc_time &earliestTimeToStart = nextCommandByRank[Command::ACT][rank];
-                earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+                uint64_t& earliestCycleToStart = nextCommandByRank[Command::ACT][rank];
+                earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
             {
-                sc_time &earliestTimeToStart = nextCommandByRank[Command::REFPB][rank];
-                earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+                uint64_t& earliestCycleToStart = nextCommandByRank[Command::REFPB][rank];
+                earliestCycleToStart = std::max(earliestCycleToStart, constraint);
             }
-
-            last4ActivatesOnRank[rank].pop();
         }
 
         break;
     }
     case Command::PREAB:
     {
-        // Rank (PREAB,ACT) (memSpec.tRPab - (memSpec.tCK * 2)) [] SameComponent()
+        // Rank (PREAB,ACT) (tRPab - (tCK * 2)) [] SameComponent()
         {
-            const sc_time constraint = currentTime + (memSpec.tRPab - (memSpec.tCK * 2));
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::ACT][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tRPab - (tCK * 2));
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::ACT][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (PREAB,REFAB) memSpec.tRPab [] SameComponent()
+        // Rank (PREAB,REFAB) tRPab [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tRPab;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::REFAB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRPab;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::REFAB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (PREAB,SREFEN) memSpec.tRPab [] SameComponent()
+        // Rank (PREAB,SREFEN) tRPab [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tRPab;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::SREFEN][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRPab;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::SREFEN][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (PREAB,REFPB) memSpec.tRPab [] SameComponent()
+        // Rank (PREAB,REFPB) tRPab [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tRPab;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::REFPB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRPab;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::REFPB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (PREAB,PDEP) tPRPDEN [] SameComponent()
         {
-            const sc_time constraint = currentTime + tPRPDEN;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PDEP][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tPRPDEN;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PDEP][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
 
@@ -1707,39 +1741,39 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
     }
     case Command::REFAB:
     {
-        // Rank (REFAB,ACT) (memSpec.tRFCab - (memSpec.tCK * 2)) [] SameComponent()
+        // Rank (REFAB,ACT) (tRFCab - (tCK * 2)) [] SameComponent()
         {
-            const sc_time constraint = currentTime + (memSpec.tRFCab - (memSpec.tCK * 2));
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::ACT][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tRFCab - (tCK * 2));
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::ACT][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
         // Rank (REFAB,PDEP) tREFPDEN [] SameComponent()
         {
-            const sc_time constraint = currentTime + tREFPDEN;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PDEP][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tREFPDEN;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PDEP][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (REFAB,REFAB) memSpec.tRFCab [] SameComponent()
+        // Rank (REFAB,REFAB) tRFCab [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tRFCab;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::REFAB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRFCab;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::REFAB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (REFAB,REFPB) memSpec.tRFCab [] SameComponent()
+        // Rank (REFAB,REFPB) tRFCab [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tRFCab;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::REFPB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRFCab;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::REFPB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (REFAB,SREFEN) memSpec.tRFCab [] SameComponent()
+        // Rank (REFAB,SREFEN) tRFCab [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tRFCab;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::SREFEN][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tRFCab;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::SREFEN][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
 
@@ -1747,11 +1781,11 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
     }
     case Command::PDEA:
     {
-        // Rank (PDEA,PDXA) memSpec.tCKE [] SameComponent()
+        // Rank (PDEA,PDXA) tCKE [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCKE;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PDXA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCKE;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PDXA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
 
@@ -1759,11 +1793,11 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
     }
     case Command::PDEP:
     {
-        // Rank (PDEP,PDXP) memSpec.tCKE [] SameComponent()
+        // Rank (PDEP,PDXP) tCKE [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCKE;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PDXP][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCKE;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PDXP][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
 
@@ -1771,11 +1805,11 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
     }
     case Command::SREFEN:
     {
-        // Rank (SREFEN,SREFEX) memSpec.tSR [] SameComponent()
+        // Rank (SREFEN,SREFEX) tSR [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tSR;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::SREFEX][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tSR;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::SREFEX][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
 
@@ -1783,67 +1817,67 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
     }
     case Command::PDXA:
     {
-        // Rank (PDXA,PDEA) memSpec.tCKE [] SameComponent()
+        // Rank (PDXA,PDEA) tCKE [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCKE;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PDEA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCKE;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PDEA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (PDXA,ACT) memSpec.tXP [] SameComponent()
+        // Rank (PDXA,ACT) tXP [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tXP;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::ACT][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tXP;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::ACT][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (PDXA,PREPB) memSpec.tXP [] SameComponent()
+        // Rank (PDXA,PREPB) tXP [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tXP;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PREPB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tXP;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PREPB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (PDXA,PREAB) memSpec.tXP [] SameComponent()
+        // Rank (PDXA,PREAB) tXP [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tXP;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PREAB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tXP;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PREAB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (PDXA,RD) memSpec.tXP [] SameComponent()
+        // Rank (PDXA,RD) tXP [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tXP;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::RD][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tXP;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::RD][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (PDXA,RDA) memSpec.tXP [] SameComponent()
+        // Rank (PDXA,RDA) tXP [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tXP;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::RDA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tXP;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::RDA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (PDXA,WR) memSpec.tXP [] SameComponent()
+        // Rank (PDXA,WR) tXP [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tXP;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::WR][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tXP;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::WR][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (PDXA,WRA) memSpec.tXP [] SameComponent()
+        // Rank (PDXA,WRA) tXP [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tXP;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::WRA][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tXP;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::WRA][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (PDXA,REFPB) memSpec.tXP [] SameComponent()
+        // Rank (PDXA,REFPB) tXP [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tXP;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::REFPB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tXP;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::REFPB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
 
@@ -1851,39 +1885,39 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
     }
     case Command::PDXP:
     {
-        // Rank (PDXP,PDEP) memSpec.tCKE [] SameComponent()
+        // Rank (PDXP,PDEP) tCKE [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tCKE;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PDEP][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tCKE;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PDEP][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (PDXP,REFAB) memSpec.tXP [] SameComponent()
+        // Rank (PDXP,REFAB) tXP [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tXP;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::REFAB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tXP;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::REFAB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (PDXP,REFPB) memSpec.tXP [] SameComponent()
+        // Rank (PDXP,REFPB) tXP [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tXP;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::REFPB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tXP;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::REFPB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (PDXP,SREFEN) memSpec.tXP [] SameComponent()
+        // Rank (PDXP,SREFEN) tXP [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tXP;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::SREFEN][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tXP;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::SREFEN][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (PDXP,ACT) memSpec.tXP [] SameComponent()
+        // Rank (PDXP,ACT) tXP [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tXP;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::ACT][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tXP;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::ACT][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
 
@@ -1891,39 +1925,39 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
     }
     case Command::SREFEX:
     {
-        // Rank (SREFEX,ACT) (memSpec.tXSR - (memSpec.tCK * 2)) [] SameComponent()
+        // Rank (SREFEX,ACT) (tXSR - (tCK * 2)) [] SameComponent()
         {
-            const sc_time constraint = currentTime + (memSpec.tXSR - (memSpec.tCK * 2));
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::ACT][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + (tXSR - (tCK * 2));
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::ACT][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (SREFEX,REFAB) memSpec.tXSR [] SameComponent()
+        // Rank (SREFEX,REFAB) tXSR [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tXSR;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::REFAB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tXSR;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::REFAB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (SREFEX,REFPB) memSpec.tXSR [] SameComponent()
+        // Rank (SREFEX,REFPB) tXSR [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tXSR;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::REFPB][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tXSR;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::REFPB][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (SREFEX,PDEP) memSpec.tXSR [] SameComponent()
+        // Rank (SREFEX,PDEP) tXSR [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tXSR;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::PDEP][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tXSR;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::PDEP][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
-        // Rank (SREFEX,SREFEN) memSpec.tXSR [] SameComponent()
+        // Rank (SREFEX,SREFEN) tXSR [] SameComponent()
         {
-            const sc_time constraint = currentTime + memSpec.tXSR;
-            sc_time &earliestTimeToStart = nextCommandByRank[Command::SREFEN][rank];
-            earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            const uint64_t constraint = currentCycle + tXSR;
+            uint64_t& earliestCycleToStart = nextCommandByRank[Command::SREFEN][rank];
+            earliestCycleToStart = std::max(earliestCycleToStart, constraint);
         }
         
 
@@ -1931,7 +1965,7 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
     }
     
     }
-    nextCommandOnBus = std::max(nextCommandOnBus, currentTime + memSpec.getCommandLength(command));
+    nextCommandOnBus = std::max(nextCommandOnBus, currentCycle + commandLength[command]);
 }
 
 } // namespace DRAMSys
\ No newline at end of file
@@ -37,10 +37,11 @@
 #ifndef CHECKERLPDDR4_H
 #define CHECKERLPDDR4_H
 
+#include "DRAMSys/controller/checker/ActivateWindow.h"
 #include "DRAMSys/controller/checker/CheckerIF.h"
+#include "DRAMSys/controller/checker/CycleClock.h"
 #include "DRAMSys/configuration/memspec/MemSpecLPDDR4.h"
 
-#include <queue>
 #include <vector>
 
 namespace DRAMSys
@@ -55,22 +56,54 @@ public:
 
 private:
     const MemSpecLPDDR4& memSpec;
+    const CycleClock cycleClock;
 
-    sc_core::sc_time tBURST;
-    sc_core::sc_time tRDWR;
-    sc_core::sc_time tRDWR_R;
-    sc_core::sc_time tWRRD;
-    sc_core::sc_time tWRRD_R;
-    sc_core::sc_time tRDPRE;
-    sc_core::sc_time tRDAACT;
-    sc_core::sc_time tWRPRE;
-    sc_core::sc_time tWRAACT;
-    sc_core::sc_time tACTPDEN;
-    sc_core::sc_time tPRPDEN;
-    sc_core::sc_time tRDPDEN;
-    sc_core::sc_time tWRPDEN;
-    sc_core::sc_time tWRAPDEN;
-    sc_core::sc_time tREFPDEN;
+    // Timing parameters in clock cycles
+    uint64_t tCCD;
+    uint64_t tCCDMW;
+    uint64_t tCK;
+    uint64_t tCKE;
+    uint64_t tCMDCKE;
+    uint64_t tDQS2DQ;
+    uint64_t tDQSCK;
+    uint64_t tDQSS;
+    uint64_t tFAW;
+    uint64_t tPPD;
+    uint64_t tRAS;
+    uint64_t tRCD;
+    uint64_t tRCpb;
+    uint64_t tRFCab;
+    uint64_t tRFCpb;
+    uint64_t tRL;
+    uint64_t tRPST;
+    uint64_t tRPab;
+    uint64_t tRPpb;
+    uint64_t tRRD;
+    uint64_t tRTP;
+    uint64_t tRTRS;
+    uint64_t tSR;
+    uint64_t tWL;
+    uint64_t tWPRE;
+    uint64_t tWR;
+    uint64_t tWTR;
+    uint64_t tXP;
+    uint64_t tXSR;
+
+    uint64_t tBURST;
+    uint64_t tRDWR;
+    uint64_t tRDWR_R;
+    uint64_t tWRRD;
+    uint64_t tWRRD_R;
+    uint64_t tRDPRE;
+    uint64_t tRDAACT;
+    uint64_t tWRPRE;
+    uint64_t tWRAACT;
+    uint64_t tACTPDEN;
+    uint64_t tPRPDEN;
+    uint64_t tRDPDEN;
+    uint64_t tWRPDEN;
+    uint64_t tWRAPDEN;
+    uint64_t tREFPDEN;
     template<typename T>
     using CommandArray = std::array<T, Command::END_ENUM>;
     template<typename T>
@@ -79,11 +112,12 @@ private:
     using RankVector = ControllerVector<Rank, T>;
 
     
-    CommandArray<BankVector<sc_core::sc_time>> nextCommandByBank;
-    CommandArray<RankVector<sc_core::sc_time>> nextCommandByRank;
+    CommandArray<uint64_t> commandLength;
+    CommandArray<BankVector<uint64_t>> nextCommandByBank;
+    CommandArray<RankVector<uint64_t>> nextCommandByRank;
     
-    RankVector<std::queue<sc_core::sc_time>> last4ActivatesOnRank;
-    sc_core::sc_time nextCommandOnBus = sc_core::SC_ZERO_TIME;
+    RankVector<ActivateWindow<4>> last4ActivatesOnRank;
+    uint64_t nextCommandOnBus = 0;
 };
 
 } // namespace DRAMSys
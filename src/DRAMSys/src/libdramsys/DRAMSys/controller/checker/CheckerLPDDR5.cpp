@@ -21,227 +21,134 @@
  */
 
 #include "CheckerLPDDR5.h"
-#include "DRAMSys/common/DebugManager.h"
-#include "DRAMSys/common/utils.h"
-#include "DRAMSys/configuration/memspec/MemSpecLPDDR5.h"
-
-#include <algorithm>
-
-using namespace sc_core;
-using namespace tlm;
 
 namespace DRAMSys
 {
 
-CheckerLPDDR5::CheckerLPDDR5(const MemSpecLPDDR5& memSpec) : memSpec(memSpec)
+CheckerLPDDR5::CheckerLPDDR5(const MemSpecLPDDR5& memSpec) : CheckerTable(memSpec, "CheckerLPDDR5")
 {
-    nextCommandByBank.fill({BankVector<sc_time>(memSpec.banksPerChannel, SC_ZERO_TIME)});
-    nextCommandByBankGroup.fill({BankGroupVector<sc_time>(memSpec.bankGroupsPerChannel, SC_ZERO_TIME)});
-    nextCommandByRank.fill({RankVector<sc_time>(memSpec.ranksPerChannel, SC_ZERO_TIME)});
-    // Initialize queue container per rank (ControllerVector has no fill())
-    last4ActivatesOnRank = RankVector<std::queue<sc_time>>(memSpec.ranksPerChannel);
-
-    // Pre-calculate LPDDR5 timing constraints
-    tBURST = (memSpec.defaultBurstLength / memSpec.dataRate) * memSpec.tCK;
-    
+    const uint64_t tCK = cycleClock.toCycles(memSpec.tCK);
+    const uint64_t tFAW = cycleClock.toCycles(memSpec.tFAW);
+    const uint64_t tRAS = cycleClock.toCycles(memSpec.tRAS);
+    const uint64_t tRCpb = cycleClock.toCycles(memSpec.tRCpb);
+    const uint64_t tRFCab = cycleClock.toCycles(memSpec.tRFCab);
+    const uint64_t tRFCpb = cycleClock.toCycles(memSpec.tRFCpb);
+    const uint64_t tRL = cycleClock.toCycles(memSpec.tRL);
+    const uint64_t tRPab = cycleClock.toCycles(memSpec.tRPab);
+    const uint64_t tRPpb = cycleClock.toCycles(memSpec.tRPpb);
+    const uint64_t tRRD = cycleClock.toCycles(memSpec.tRRD);
+    const uint64_t tRTRS = cycleClock.toCycles(memSpec.tRTRS);
+    const uint64_t tWL = cycleClock.toCycles(memSpec.tWL);
+    const uint64_t tWR = cycleClock.toCycles(memSpec.tWR);
+    const uint64_t tWTR_L = cycleClock.toCycles(memSpec.tWTR_L);
+    const uint64_t tWTR_S = cycleClock.toCycles(memSpec.tWTR_S);
+
+    const uint64_t tBURST = (memSpec.defaultBurstLength / memSpec.dataRate) * tCK;
+
     // Read-to-Write delays
-    tRDWR_S = memSpec.tRL + tBURST + memSpec.tWTR_S - memSpec.tWL;
-    tRDWR_L = memSpec.tRL + tBURST + memSpec.tWTR_L - memSpec.tWL;
-    tRDWR_R = memSpec.tRL + tBURST + memSpec.tRTRS - memSpec.tWL;
+    const uint64_t tRDWR_S = tRL + tBURST + tWTR_S - tWL;
+    const uint64_t tRDWR_L = tRL + tBURST + tWTR_L - tWL;
+    const uint64_t tRDWR_R = tRL + tBURST + tRTRS - tWL;
 
     // Write-to-Read delays
-    tWRRD_S = memSpec.tWL + tBURST + memSpec.tWTR_S;
-    tWRRD_L = memSpec.tWL + tBURST + memSpec.tWTR_L;
-    tWRRD_R = memSpec.tWL + tBURST + memSpec.tRTRS - memSpec.tRL;
+    const uint64_t tWRRD_S = tWL + tBURST + tWTR_S;
+    const uint64_t tWRRD_L = tWL + tBURST + tWTR_L;
+    const uint64_t tWRRD_R = tWL + tBURST + tRTRS - tRL;
 
     // Other command delays (approximate where DRAMUtils lacks parameters)
     // tRTP not available in DRAMUtils for LPDDR5; approximate with read data window length
-    tRDPRE = memSpec.tRL + tBURST;
-    tWRPRE = memSpec.tWL + tBURST + memSpec.tWR;
+    const uint64_t tRDPRE = tRL + tBURST;
+    const uint64_t tWRPRE = tWL + tBURST + tWR;
     // Use per-bank precharge timing for ACT after precharge
-    tWRAACT = tWRPRE + memSpec.tRPpb;
-    tRDAACT = tRDPRE + memSpec.tRPpb;
-}
+    const uint64_t tWRAACT = tWRPRE + tRPpb;
+    const uint64_t tRDAACT = tRDPRE + tRPpb;
 
-sc_time CheckerLPDDR5::timeToSatisfyConstraints(Command command, const tlm_generic_payload& payload) const
-{
-    Bank bank = ControllerExtension::getBank(payload);
-    BankGroup bankGroup = ControllerExtension::getBankGroup(payload);
-    Rank rank = ControllerExtension::getRank(payload);
-
-    sc_time earliestTimeToStart = sc_time_stamp();
+    std::vector<Constraint> constraints;
+    for (Command read : {Command::RD, Command::RDA})
+    {
+        constraints.insert(constraints.end(), {
+            // Same rank, different bank group (approximate without tCCD_L)
+            {read, Command::RD, Scope::Rank, tCK},
+            {read, Command::RDA, Scope::Rank, tCK},
+            {read, Command::WR, Scope::Rank, tRDWR_L},
+            {read, Command::WRA, Scope::Rank, tRDWR_L},
+
+            // Same rank, same bank group (approximate without tCCD_S)
+            {read, Command::RD, Scope::BankGroup, tCK},
+            {read, Command::RDA, Scope::BankGroup, tCK},
+            {read, Command::WR, Scope::BankGroup, tRDWR_S},
+            {read, Command::WRA, Scope::BankGroup, tRDWR_S},
+
+            // Different rank
+            {read, Command::RD, Scope::OtherRanks, tBURST + tRTRS},
+            {read, Command::RDA, Scope::OtherRanks, tBURST + tRTRS},
+            {read, Command::WR, Scope::OtherRanks, tRDWR_R},
+            {read, Command::WRA, Scope::OtherRanks, tRDWR_R},
+        });
+        setBusOccupancy(read, tBURST);
+    }
+    for (Command write : {Command::WR, Command::WRA})
+    {
+        constraints.insert(constraints.end(), {
+            // Same rank, different bank group (no tCCD_L available; use tCK baseline)
+            {write, Command::RD, Scope::Rank, tWRRD_L},
+            {write, Command::RDA, Scope::Rank, tWRRD_L},
+            {write, Command::WR, Scope::Rank, tCK},
+            {write, Command::WRA, Scope::Rank, tCK},
+
+            // Same rank, same bank group (no tCCD_S available; use tCK baseline)
+            {write, Command::RD, Scope::BankGroup, tWRRD_S},
+            {write, Command::RDA, Scope::BankGroup, tWRRD_S},
+            {write, Command::WR, Scope::BankGroup, tCK},
+            {write, Command::WRA, Scope::BankGroup, tCK},
+
+            // Different rank
+            {write, Command::RD, Scope::OtherRanks, tWRRD_R},
+            {write, Command::RDA, Scope::OtherRanks, tWRRD_R},
+            {write, Command::WR, Scope::OtherRanks, tBURST + tRTRS},
+            {write, Command::WRA, Scope::OtherRanks, tBURST + tRTRS},
+        });
+        setBusOccupancy(write, tBURST);
+    }
 
-    earliestTimeToStart = std::max(earliestTimeToStart, nextCommandByBank[command][bank]);
-    earliestTimeToStart = std::max(earliestTimeToStart, nextCommandByBankGroup[command][bankGroup]);
-    earliestTimeToStart = std::max(earliestTimeToStart, nextCommandByRank[command][rank]);
-    earliestTimeToStart = std::max(earliestTimeToStart, nextCommandOnBus);
+    constraints.insert(constraints.end(), {
+        {Command::RD, Command::PREPB, Scope::Bank, tRDPRE},
+        {Command::RDA, Command::ACT, Scope::Bank, tRDAACT},
+        {Command::RDA, Command::REFAB, Scope::Rank, tRDPRE + tRPpb},
 
-    return earliestTimeToStart;
-}
+        {Command::WR, Command::PREPB, Scope::Bank, tWRPRE},
+        {Command::WRA, Command::ACT, Scope::Bank, tWRAACT},
 
-void CheckerLPDDR5::insert(Command command, const tlm_generic_payload& payload)
-{
-    const Bank bank = ControllerExtension::getBank(payload);
-    const BankGroup bankGroup = ControllerExtension::getBankGroup(payload);
-    const Rank rank = ControllerExtension::getRank(payload);
+        // tRCD not available in DRAMUtils for LPDDR5; no additional constraint for RD/WR
+        {Command::ACT, Command::PREPB, Scope::Bank, tRAS},
+        {Command::ACT, Command::ACT, Scope::Bank, tRCpb},
+        {Command::ACT, Command::ACT, Scope::Rank, tRRD},
+        {Command::ACT, Command::ACT, Scope::BankGroup, tRRD},
 
-    PRINTDEBUGMESSAGE("CheckerLPDDR5", "Changing state on bank " + std::to_string(static_cast<std::size_t>(bank))
-                      + " command is " + command.toString());
+        {Command::PREPB, Command::ACT, Scope::Bank, tRPpb},
+        {Command::PREAB, Command::ACT, Scope::Rank, tRPab},
 
-    const sc_time& currentTime = sc_time_stamp();
-    
-    // Most commands need to wait for tBURST time on the bus
-    sc_time busBusyUntil = currentTime + tBURST;
+        {Command::REFAB, Command::ACT, Scope::Rank, tRFCab},
+        {Command::REFAB, Command::REFAB, Scope::Rank, tRFCab},
+        {Command::REFPB, Command::ACT, Scope::Bank, tRFCpb},
 
-    switch (command)
-    {
-    case Command::RD:
-    case Command::RDA:
-    {
-        // Same rank, different bank group (approximate without tCCD_L)
-        nextCommandByRank[Command::RD][rank] = std::max(nextCommandByRank[Command::RD][rank], currentTime + memSpec.tCK);
-        nextCommandByRank[Command::RDA][rank] = std::max(nextCommandByRank[Command::RDA][rank], currentTime + memSpec.tCK);
-        nextCommandByRank[Command::WR][rank] = std::max(nextCommandByRank[Command::WR][rank], currentTime + tRDWR_L);
-        nextCommandByRank[Command::WRA][rank] = std::max(nextCommandByRank[Command::WRA][rank], currentTime + tRDWR_L);
-
-        // Same rank, same bank group (approximate without tCCD_S)
-        nextCommandByBankGroup[Command::RD][bankGroup] = std::max(nextCommandByBankGroup[Command::RD][bankGroup], currentTime + memSpec.tCK);
-        nextCommandByBankGroup[Command::RDA][bankGroup] = std::max(nextCommandByBankGroup[Command::RDA][bankGroup], currentTime + memSpec.tCK);
-        nextCommandByBankGroup[Command::WR][bankGroup] = std::max(nextCommandByBankGroup[Command::WR][bankGroup], currentTime + tRDWR_S);
-        nextCommandByBankGroup[Command::WRA][bankGroup] = std::max(nextCommandByBankGroup[Command::WRA][bankGroup], currentTime + tRDWR_S);
-
-        // Different rank
-        for (unsigned int i = 0; i < memSpec.ranksPerChannel; i++)
-        {
-            Rank r{i};
-            if (r == rank) continue;
-            nextCommandByRank[Command::RD][r] = std::max(nextCommandByRank[Command::RD][r], currentTime + tBURST + memSpec.tRTRS);
-            nextCommandByRank[Command::RDA][r] = std::max(nextCommandByRank[Command::RDA][r], currentTime + tBURST + memSpec.tRTRS);
-            nextCommandByRank[Command::WR][r] = std::max(nextCommandByRank[Command::WR][r], currentTime + tRDWR_R);
-            nextCommandByRank[Command::WRA][r] = std::max(nextCommandByRank[Command::WRA][r], currentTime + tRDWR_R);
-        }
-
-        if (command == Command::RDA)
-        {
-            nextCommandByBank[Command::ACT][bank] = std::max(nextCommandByBank[Command::ACT][bank], currentTime + tRDAACT);
-            nextCommandByRank[Command::REFAB][rank] = std::max(nextCommandByRank[Command::REFAB][rank], currentTime + tRDPRE + memSpec.tRPpb);
-        }
-        else // RD
-        {
-            nextCommandByBank[Command::PREPB][bank] = std::max(nextCommandByBank[Command::PREPB][bank], currentTime + tRDPRE);
-        }
-        break;
-    }
-    case Command::WR:
-    case Command::WRA:
-    {
-        // Same rank, different bank group
-        nextCommandByRank[Command::RD][rank] = std::max(nextCommandByRank[Command::RD][rank], currentTime + tWRRD_L);
-        nextCommandByRank[Command::RDA][rank] = std::max(nextCommandByRank[Command::RDA][rank], currentTime + tWRRD_L);
-        // No tCCD_L available; use tCK baseline
-        nextCommandByRank[Command::WR][rank] = std::max(nextCommandByRank[Command::WR][rank], currentTime + memSpec.tCK);
-        nextCommandByRank[Command::WRA][rank] = std::max(nextCommandByRank[Command::WRA][rank], currentTime + memSpec.tCK);
-
-        // Same rank, same bank group
-        nextCommandByBankGroup[Command::RD][bankGroup] = std::max(nextCommandByBankGroup[Command::RD][bankGroup], currentTime + tWRRD_S);
-        nextCommandByBankGroup[Command::RDA][bankGroup] = std::max(nextCommandByBankGroup[Command::RDA][bankGroup], currentTime + tWRRD_S);
-        // No tCCD_S available; use tCK baseline
-        nextCommandByBankGroup[Command::WR][bankGroup] = std::max(nextCommandByBankGroup[Command::WR][bankGroup], currentTime + memSpec.tCK);
-        nextCommandByBankGroup[Command::WRA][bankGroup] = std::max(nextCommandByBankGroup[Command::WRA][bankGroup], currentTime + memSpec.tCK);
-
-        // Different rank
-        for (unsigned int i = 0; i < memSpec.ranksPerChannel; i++)
-        {
-            Rank r{i};
-            if (r == rank) continue;
-            nextCommandByRank[Command::RD][r] = std::max(nextCommandByRank[Command::RD][r], currentTime + tWRRD_R);
-            nextCommandByRank[Command::RDA][r] = std::max(nextCommandByRank[Command::RDA][r], currentTime + tWRRD_R);
-            nextCommandByRank[Command::WR][r] = std::max(nextCommandByRank[Command::WR][r], currentTime + tBURST + memSpec.tRTRS);
-            nextCommandByRank[Command::WRA][r] = std::max(nextCommandByRank[Command::WRA][r], currentTime + tBURST + memSpec.tRTRS);
-        }
-        
-        if (command == Command::WRA)
-        {
-            nextCommandByBank[Command::ACT][bank] = std::max(nextCommandByBank[Command::ACT][bank], currentTime + tWRAACT);
-        }
-        else // WR
-        {
-            nextCommandByBank[Command::PREPB][bank] = std::max(nextCommandByBank[Command::PREPB][bank], currentTime + tWRPRE);
-        }
-        break;
-    }
-    case Command::ACT:
-    {
-        nextCommandByBank[Command::PREPB][bank] = std::max(nextCommandByBank[Command::PREPB][bank], currentTime + memSpec.tRAS);
-        // tRCD not available in DRAMUtils for LPDDR5; no additional constraint here
-        nextCommandByBank[Command::RD][bank] = std::max(nextCommandByBank[Command::RD][bank], currentTime + SC_ZERO_TIME);
-        nextCommandByBank[Command::RDA][bank] = std::max(nextCommandByBank[Command::RDA][bank], currentTime + SC_ZERO_TIME);
-        nextCommandByBank[Command::WR][bank] = std::max(nextCommandByBank[Command::WR][bank], currentTime + SC_ZERO_TIME);
-        nextCommandByBank[Command::WRA][bank] = std::max(nextCommandByBank[Command::WRA][bank], currentTime + SC_ZERO_TIME);
-        nextCommandByBank[Command::ACT][bank] = std::max(nextCommandByBank[Command::ACT][bank], currentTime + memSpec.tRCpb);
-
-        // Same rank, different bank group
-        nextCommandByRank[Command::ACT][rank] = std::max(nextCommandByRank[Command::ACT][rank], currentTime + memSpec.tRRD);
-
-        // Same rank, same bank group
-        nextCommandByBankGroup[Command::ACT][bankGroup] = std::max(nextCommandByBankGroup[Command::ACT][bankGroup], currentTime + memSpec.tRRD);
-        
-        // tFAW handling
-        last4ActivatesOnRank[rank].push(currentTime);
-        if (last4ActivatesOnRank[rank].size() > 4)
-            last4ActivatesOnRank[rank].pop();
-        if (last4ActivatesOnRank[rank].size() == 4)
-        {
-            sc_time fourthLastActivate = last4ActivatesOnRank[rank].front();
-            nextCommandByRank[Command::ACT][rank] = std::max(nextCommandByRank[Command::ACT][rank], fourthLastActivate + memSpec.tFAW);
-        }
-        busBusyUntil = currentTime + memSpec.tCK; // ACT is short
-        break;
-    }
-    case Command::PREPB:
-    {
-        nextCommandByBank[Command::ACT][bank] = std::max(nextCommandByBank[Command::ACT][bank], currentTime + memSpec.tRPpb);
-        busBusyUntil = currentTime + memSpec.tCK; // PRE is short
-        break;
-    }
-    case Command::PREAB:
-    {
-        // Block ACT on this rank for tRPab
-        nextCommandByRank[Command::ACT][rank] = std::max(nextCommandByRank[Command::ACT][rank], currentTime + memSpec.tRPab);
-        busBusyUntil = currentTime + memSpec.tCK; // PRE is short
-        break;
-    }
-    case Command::REFAB:
-    {
-        // Block ACT on this rank for tRFCab
-        nextCommandByRank[Command::ACT][rank] = std::max(nextCommandByRank[Command::ACT][rank], currentTime + memSpec.tRFCab);
-        nextCommandByRank[Command::REFAB][rank] = std::max(nextCommandByRank[Command::REFAB][rank], currentTime + memSpec.tRFCab);
-        busBusyUntil = currentTime + memSpec.tCK; // REF is short
-        break;
-    }
-    case Command::REFPB:
-    {
-        nextCommandByBank[Command::ACT][bank] = std::max(nextCommandByBank[Command::ACT][bank], currentTime + memSpec.tRFCpb);
-        busBusyUntil = currentTime + memSpec.tCK; // REF is short
-        break;
-    }
-    case Command::SREFEN:
-    {
-        nextCommandByRank[Command::SREFEX][rank] = std::max(nextCommandByRank[Command::SREFEX][rank], currentTime + memSpec.tCK);
-        busBusyUntil = currentTime + memSpec.tCK; // SREF is short
-        break;
-    }
-    case Command::SREFEX:
-    {
+        {Command::SREFEN, Command::SREFEX, Scope::Rank, tCK},
         // Approximate: allow ACT after a short delay on this rank
-        nextCommandByRank[Command::ACT][rank] = std::max(nextCommandByRank[Command::ACT][rank], currentTime + memSpec.tCK);
-        busBusyUntil = currentTime + memSpec.tCK; // SREF is short
-        break;
-    }
-    default:
-        busBusyUntil = currentTime + memSpec.getCommandLength(command);
-    }
-    nextCommandOnBus = std::max(nextCommandOnBus, busBusyUntil);
+        {Command::SREFEX, Command::ACT, Scope::Rank, tCK},
+    });
+    compile(constraints);
+
+    // ACT, PRE, REF and SREF are short commands on the bus
+    for (Command command : {Command::ACT,
+                            Command::PREPB,
+                            Command::PREAB,
+                            Command::REFAB,
+                            Command::REFPB,
+                            Command::SREFEN,
+                            Command::SREFEX})
+        setBusOccupancy(command, tCK);
+
+    setActivateWindow(tFAW);
 }
 
 } // namespace DRAMSys
@@ -23,56 +23,18 @@
 #ifndef CHECKERLPDDR5_H
 #define CHECKERLPDDR5_H
 
-#include "DRAMSys/controller/checker/CheckerIF.h"
 #include "DRAMSys/configuration/memspec/MemSpecLPDDR5.h"
-
-#include <queue>
-#include <vector>
+#include "DRAMSys/controller/checker/CheckerTable.h"
 
 namespace DRAMSys
 {
 
-class CheckerLPDDR5 final : public CheckerIF
+class CheckerLPDDR5 final : public CheckerTable
 {
 public:
     explicit CheckerLPDDR5(const MemSpecLPDDR5& memSpec);
-    [[nodiscard]] sc_core::sc_time timeToSatisfyConstraints(Command command, const tlm::tlm_generic_payload& payload) const override;
-    void insert(Command command, const tlm::tlm_generic_payload& payload) override;
-
-private:
-    const MemSpecLPDDR5& memSpec;
-
-    // Pre-calculated timing values for LPDDR5
-    sc_core::sc_time tBURST;
-    sc_core::sc_time tRDWR_S; // Read to Write, Same Bank Group
-    sc_core::sc_time tRDWR_L; // Read to Write, Different Bank Group
-    sc_core::sc_time tRDWR_R; // Read to Write, Different Rank
-    sc_core::sc_time tWRRD_S; // Write to Read, Same Bank Group
-    sc_core::sc_time tWRRD_L; // Write to Read, Different Bank Group
-    sc_core::sc_time tWRRD_R; // Write to Read, Different Rank
-    sc_core::sc_time tRDPRE;
-    sc_core::sc_time tWRPRE;
-    sc_core::sc_time tWRAACT;
-    sc_core::sc_time tRDAACT;
-
-    template<typename T>
-    using CommandArray = std::array<T, Command::END_ENUM>;
-    template<typename T>
-    using BankVector = ControllerVector<Bank, T>;
-    template<typename T>
-    using BankGroupVector = ControllerVector<BankGroup, T>;
-    template<typename T>
-    using RankVector = ControllerVector<Rank, T>;
-
-    // Timing constraint states
-    CommandArray<BankVector<sc_core::sc_time>> nextCommandByBank;
-    CommandArray<BankGroupVector<sc_core::sc_time>> nextCommandByBankGroup;
-    CommandArray<RankVector<sc_core::sc_time>> nextCommandByRank;
-
-    RankVector<std::queue<sc_core::sc_time>> last4ActivatesOnRank;
-    sc_core::sc_time nextCommandOnBus = sc_core::SC_ZERO_TIME;
 };
 
 } // namespace DRAMSys
 
-#endif // CHECKERLPDDR5_H
\ No newline at end of file
+#endif // CHECKERLPDDR5_H
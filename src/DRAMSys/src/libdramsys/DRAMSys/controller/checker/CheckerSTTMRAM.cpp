@@ -45,27 +45,53 @@ namespace DRAMSys
 {
 
 CheckerSTTMRAM::CheckerSTTMRAM(const MemSpecSTTMRAM& memSpec) :
-    memSpec(memSpec)
+    memSpec(memSpec),
+    cycleClock(memSpec.tCK)
 {
-    lastScheduledByCommandAndBank = std::vector<ControllerVector<Bank, sc_time>>(
+    tACTPDEN = cycleClock.toCycles(memSpec.tACTPDEN);
+    tAL = cycleClock.toCycles(memSpec.tAL);
+    tCCD = cycleClock.toCycles(memSpec.tCCD);
+    tCK = cycleClock.toCycles(memSpec.tCK);
+    tCKE = cycleClock.toCycles(memSpec.tCKE);
+    tCKESR = cycleClock.toCycles(memSpec.tCKESR);
+    tFAW = cycleClock.toCycles(memSpec.tFAW);
+    tPD = cycleClock.toCycles(memSpec.tPD);
+    tPRPDEN = cycleClock.toCycles(memSpec.tPRPDEN);
+    tRAS = cycleClock.toCycles(memSpec.tRAS);
+    tRC = cycleClock.toCycles(memSpec.tRC);
+    tRCD = cycleClock.toCycles(memSpec.tRCD);
+    tRL = cycleClock.toCycles(memSpec.tRL);
+    tRP = cycleClock.toCycles(memSpec.tRP);
+    tRRD = cycleClock.toCycles(memSpec.tRRD);
+    tRTP = cycleClock.toCycles(memSpec.tRTP);
+    tRTRS = cycleClock.toCycles(memSpec.tRTRS);
+    tWL = cycleClock.toCycles(memSpec.tWL);
+    tWR = cycleClock.toCycles(memSpec.tWR);
+    tWTR = cycleClock.toCycles(memSpec.tWTR);
+    tXP = cycleClock.toCycles(memSpec.tXP);
+    tXS = cycleClock.toCycles(memSpec.tXS);
+    tXSDLL = cycleClock.toCycles(memSpec.tXSDLL);
+
+    lastScheduledByCommandAndBank = std::vector<ControllerVector<Bank, uint64_t>>(
         Command::numberOfCommands(),
-        ControllerVector<Bank, sc_time>(memSpec.banksPerChannel, scMaxTime));
-    lastScheduledByCommandAndRank = std::vector<ControllerVector<Rank, sc_time>>(
+        ControllerVector<Bank, uint64_t>(memSpec.banksPerChannel, maxCycle));
+    lastScheduledByCommandAndRank = std::vector<ControllerVector<Rank, uint64_t>>(
         Command::numberOfCommands(),
-        ControllerVector<Rank, sc_time>(memSpec.ranksPerChannel, scMaxTime));
-    lastScheduledByCommand = std::vector<sc_time>(Command::numberOfCommands(), scMaxTime);
-    lastCommandOnBus = scMaxTime;
-    last4Activates = ControllerVector<Rank, std::queue<sc_time>>(memSpec.ranksPerChannel);
-
-    tBURST = memSpec.defaultBurstLength / memSpec.dataRate * memSpec.tCK;
-    tRDWR = memSpec.tRL + tBURST + 2 * memSpec.tCK - memSpec.tWL;
-    tRDWR_R = memSpec.tRL + tBURST + memSpec.tRTRS - memSpec.tWL;
-    tWRRD = memSpec.tWL + tBURST + memSpec.tWTR - memSpec.tAL;
-    tWRRD_R = memSpec.tWL + tBURST + memSpec.tRTRS - memSpec.tRL;
-    tWRPRE = memSpec.tWL + tBURST + memSpec.tWR;
-    tRDPDEN = memSpec.tRL + tBURST + memSpec.tCK;
-    tWRPDEN = memSpec.tWL + tBURST + memSpec.tWR;
-    tWRAPDEN = memSpec.tWL + tBURST + memSpec.tWR + memSpec.tCK;
+        ControllerVector<Rank, uint64_t>(memSpec.ranksPerChannel, maxCycle));
+    lastScheduledByCommand = std::vector<uint64_t>(Command::numberOfCommands(), maxCycle);
+    lastCommandOnBus = maxCycle;
+    last4Activates = ControllerVector<Rank, ActivateWindow<4>>(
+        memSpec.ranksPerChannel, ActivateWindow<4>(tFAW));
+
+    tBURST = memSpec.defaultBurstLength / memSpec.dataRate * tCK;
+    tRDWR = tRL + tBURST + 2 * tCK - tWL;
+    tRDWR_R = tRL + tBURST + tRTRS - tWL;
+    tWRRD = tWL + tBURST + tWTR - tAL;
+    tWRRD_R = tWL + tBURST + tRTRS - tRL;
+    tWRPRE = tWL + tBURST + tWR;
+    tRDPDEN = tRL + tBURST + tCK;
+    tWRPDEN = tWL + tBURST + tWR;
+    tWRAPDEN = tWL + tBURST + tWR + tCK;
 }
 
 sc_time CheckerSTTMRAM::timeToSatisfyConstraints(Command command,
@@ -74,73 +100,72 @@ sc_time CheckerSTTMRAM::timeToSatisfyConstraints(Command command,
     Rank rank = ControllerExtension::getRank(payload);
     Bank bank = ControllerExtension::getBank(payload);
 
-    sc_time lastCommandStart;
-    sc_time earliestTimeToStart = sc_time_stamp();
+    uint64_t lastCommandStart = 0;
+    uint64_t earliestCycleToStart = cycleClock.now();
 
     if (command == Command::RD || command == Command::RDA)
     {
         assert(ControllerExtension::getBurstLength(payload) == 8);
 
         lastCommandStart = lastScheduledByCommandAndBank[Command::ACT][bank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart =
-                std::max(earliestTimeToStart, lastCommandStart + memSpec.tRCD - memSpec.tAL);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRCD - tAL);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RD][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tCCD);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tCCD);
 
         lastCommandStart =
             lastScheduledByCommand[Command::RD] != lastScheduledByCommandAndRank[Command::RD][rank]
                 ? lastScheduledByCommand[Command::RD]
-                : scMaxTime;
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart =
-                std::max(earliestTimeToStart, lastCommandStart + tBURST + memSpec.tRTRS);
+                : maxCycle;
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart =
+                std::max(earliestCycleToStart, lastCommandStart + tBURST + tRTRS);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RDA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tCCD);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tCCD);
 
         lastCommandStart = lastScheduledByCommand[Command::RDA] !=
                                    lastScheduledByCommandAndRank[Command::RDA][rank]
                                ? lastScheduledByCommand[Command::RDA]
-                               : scMaxTime;
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart =
-                std::max(earliestTimeToStart, lastCommandStart + tBURST + memSpec.tRTRS);
+                               : maxCycle;
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart =
+                std::max(earliestCycleToStart, lastCommandStart + tBURST + tRTRS);
 
         if (command == Command::RDA)
         {
             lastCommandStart = lastScheduledByCommandAndBank[Command::WR][bank];
-            if (lastCommandStart != scMaxTime)
-                earliestTimeToStart = std::max(
-                    earliestTimeToStart, lastCommandStart + tWRPRE - memSpec.tRTP - memSpec.tAL);
+            if (lastCommandStart != maxCycle)
+                earliestCycleToStart = std::max(
+                    earliestCycleToStart, lastCommandStart + tWRPRE - tRTP - tAL);
         }
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WR][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRRD);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tWRRD);
 
         lastCommandStart = lastScheduledByCommand[Command::WR];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRRD_R);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tWRRD_R);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WRA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRRD);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tWRRD);
 
         lastCommandStart = lastScheduledByCommand[Command::WRA];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRRD_R);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tWRRD_R);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tXP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tXP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::SREFEX][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tXSDLL);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tXSDLL);
     }
     else if (command == Command::WR || command == Command::WRA || command == Command::MWR ||
              command == Command::MWRA)
@@ -148,278 +173,268 @@ sc_time CheckerSTTMRAM::timeToSatisfyConstraints(Command command,
         assert(ControllerExtension::getBurstLength(payload) == 8);
 
         lastCommandStart = lastScheduledByCommandAndBank[Command::ACT][bank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart =
-                std::max(earliestTimeToStart, lastCommandStart + memSpec.tRCD - memSpec.tAL);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRCD - tAL);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RD][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRDWR);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRDWR);
 
         lastCommandStart =
             lastScheduledByCommand[Command::RD] != lastScheduledByCommandAndRank[Command::RD][rank]
                 ? lastScheduledByCommand[Command::RD]
-                : scMaxTime;
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRDWR_R);
+                : maxCycle;
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRDWR_R);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RDA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRDWR);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRDWR);
 
         lastCommandStart = lastScheduledByCommand[Command::RDA] !=
                                    lastScheduledByCommandAndRank[Command::RDA][rank]
                                ? lastScheduledByCommand[Command::RDA]
-                               : scMaxTime;
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRDWR_R);
+                               : maxCycle;
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRDWR_R);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WR][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tCCD);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tCCD);
 
         lastCommandStart =
             lastScheduledByCommand[Command::WR] != lastScheduledByCommandAndRank[Command::WR][rank]
                 ? lastScheduledByCommand[Command::WR]
-                : scMaxTime;
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart =
-                std::max(earliestTimeToStart, lastCommandStart + tBURST + memSpec.tRTRS);
+                : maxCycle;
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart =
+                std::max(earliestCycleToStart, lastCommandStart + tBURST + tRTRS);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WRA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tCCD);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tCCD);
 
         lastCommandStart = lastScheduledByCommand[Command::WRA] !=
                                    lastScheduledByCommandAndRank[Command::WRA][rank]
                                ? lastScheduledByCommand[Command::WRA]
-                               : scMaxTime;
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart =
-                std::max(earliestTimeToStart, lastCommandStart + tBURST + memSpec.tRTRS);
+                               : maxCycle;
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart =
+                std::max(earliestCycleToStart, lastCommandStart + tBURST + tRTRS);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tXP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tXP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::SREFEX][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tXSDLL);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tXSDLL);
     }
     else if (command == Command::ACT)
     {
         lastCommandStart = lastScheduledByCommandAndBank[Command::ACT][bank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRC);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRC);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::ACT][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRRD);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRRD);
 
         lastCommandStart = lastScheduledByCommandAndBank[Command::RDA][bank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart =
-                std::max(earliestTimeToStart,
-                         lastCommandStart + memSpec.tAL + memSpec.tRTP + memSpec.tRP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart =
+                std::max(earliestCycleToStart,
+                         lastCommandStart + tAL + tRTP + tRP);
 
         lastCommandStart = lastScheduledByCommandAndBank[Command::WRA][bank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart =
-                std::max(earliestTimeToStart, lastCommandStart + tWRPRE + memSpec.tRP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tWRPRE + tRP);
 
         lastCommandStart = lastScheduledByCommandAndBank[Command::PREPB][bank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PREAB][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tXP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tXP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXP][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tXP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tXP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::SREFEX][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tXS);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tXS);
 
-        if (last4Activates[rank].size() >= 4)
-            earliestTimeToStart =
-                std::max(earliestTimeToStart, last4Activates[rank].front() + memSpec.tFAW);
+        earliestCycleToStart =
+            std::max(earliestCycleToStart, last4Activates[rank].getEarliestNextActivate());
     }
     else if (command == Command::PREPB)
     {
         lastCommandStart = lastScheduledByCommandAndBank[Command::ACT][bank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRAS);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRAS);
 
         lastCommandStart = lastScheduledByCommandAndBank[Command::RD][bank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart =
-                std::max(earliestTimeToStart, lastCommandStart + memSpec.tAL + memSpec.tRTP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tAL + tRTP);
 
         lastCommandStart = lastScheduledByCommandAndBank[Command::WR][bank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRPRE);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tWRPRE);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tXP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tXP);
     }
     else if (command == Command::PREAB)
     {
         lastCommandStart = lastScheduledByCommandAndRank[Command::ACT][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRAS);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRAS);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RD][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart =
-                std::max(earliestTimeToStart, lastCommandStart + memSpec.tAL + memSpec.tRTP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tAL + tRTP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RDA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart =
-                std::max(earliestTimeToStart, lastCommandStart + memSpec.tAL + memSpec.tRTP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tAL + tRTP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WR][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRPRE);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tWRPRE);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WRA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRPRE);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tWRPRE);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tXP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tXP);
     }
     else if (command == Command::PDEA)
     {
         lastCommandStart = lastScheduledByCommandAndRank[Command::ACT][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart =
-                std::max(earliestTimeToStart, lastCommandStart + memSpec.tACTPDEN);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tACTPDEN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RD][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRDPDEN);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRDPDEN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RDA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRDPDEN);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRDPDEN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WR][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRPDEN);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tWRPDEN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WRA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRAPDEN);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tWRAPDEN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PREPB][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart =
-                std::max(earliestTimeToStart, lastCommandStart + memSpec.tPRPDEN);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tPRPDEN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tCKE);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tCKE);
     }
     else if (command == Command::PDXA)
     {
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDEA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tPD);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tPD);
     }
     else if (command == Command::PDEP)
     {
         lastCommandStart = lastScheduledByCommandAndRank[Command::RD][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRDPDEN);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRDPDEN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RDA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRDPDEN);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRDPDEN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WRA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRAPDEN);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tWRAPDEN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PREPB][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart =
-                std::max(earliestTimeToStart, lastCommandStart + memSpec.tPRPDEN);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tPRPDEN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PREAB][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart =
-                std::max(earliestTimeToStart, lastCommandStart + memSpec.tPRPDEN);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tPRPDEN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXP][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tCKE);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tCKE);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::SREFEX][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tXS);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tXS);
     }
     else if (command == Command::PDXP)
     {
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDEP][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tPD);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tPD);
     }
     else if (command == Command::SREFEN)
     {
         lastCommandStart = lastScheduledByCommandAndRank[Command::ACT][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRC);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRC);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RDA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(
-                earliestTimeToStart,
-                lastCommandStart + std::max(tRDPDEN, memSpec.tAL + memSpec.tRTP + memSpec.tRP));
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(
+                earliestCycleToStart,
+                lastCommandStart + std::max(tRDPDEN, tAL + tRTP + tRP));
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WRA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(
-                earliestTimeToStart, lastCommandStart + std::max(tWRAPDEN, tWRPRE + memSpec.tRP));
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(
+                earliestCycleToStart, lastCommandStart + std::max(tWRAPDEN, tWRPRE + tRP));
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PREPB][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PREAB][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXP][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tXP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tXP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::SREFEX][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tXS);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tXS);
     }
     else if (command == Command::SREFEX)
     {
         lastCommandStart = lastScheduledByCommandAndRank[Command::SREFEN][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tCKESR);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tCKESR);
     }
     else
         SC_REPORT_FATAL("CheckerSTTMRAM", "Unknown command!");
 
-    if (lastCommandOnBus != scMaxTime)
-        earliestTimeToStart = std::max(earliestTimeToStart, lastCommandOnBus + memSpec.tCK);
+    if (lastCommandOnBus != maxCycle)
+        earliestCycleToStart = std::max(earliestCycleToStart, lastCommandOnBus + tCK);
 
-    return earliestTimeToStart;
+    return cycleClock.toTime(earliestCycleToStart);
 }
 
 void CheckerSTTMRAM::insert(Command command, const tlm_generic_payload& payload)
@@ -437,17 +452,16 @@ void CheckerSTTMRAM::insert(Command command, const tlm_generic_payload& payload)
                       "Changing state on bank " + std::to_string(static_cast<std::size_t>(bank)) +
                           " command is " + command.toString());
 
-    lastScheduledByCommandAndRank[command][rank] = sc_time_stamp();
-    lastScheduledByCommandAndBank[command][bank] = sc_time_stamp();
-    lastScheduledByCommand[command] = sc_time_stamp();
+    const uint64_t currentCycle = cycleClock.now();
+    lastScheduledByCommandAndRank[command][rank] = currentCycle;
+    lastScheduledByCommandAndBank[command][bank] = currentCycle;
+    lastScheduledByCommand[command] = currentCycle;
 
-    lastCommandOnBus = sc_time_stamp();
+    lastCommandOnBus = currentCycle;
 
     if (command == Command::ACT)
     {
-        if (last4Activates[rank].size() == 4)
-            last4Activates[rank].pop();
-        last4Activates[rank].push(sc_time_stamp());
+        last4Activates[rank].insert(currentCycle);
     }
 }
 
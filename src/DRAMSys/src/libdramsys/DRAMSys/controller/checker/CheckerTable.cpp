@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "CheckerTable.h"
+#include "DRAMSys/common/DebugManager.h"
+
+#include <algorithm>
+
+using namespace sc_core;
+using namespace tlm;
+
+namespace DRAMSys
+{
+
+const CheckerTable::Commands CheckerTable::reads = {Command::RD, Command::RDA};
+const CheckerTable::Commands CheckerTable::writes = {
+    Command::WR, Command::WRA, Command::MWR, Command::MWRA};
+const CheckerTable::Commands CheckerTable::precharges = {
+    Command::PREPB, Command::PRESB, Command::PREAB};
+const CheckerTable::Commands CheckerTable::allBankRefreshes = {Command::REFAB, Command::RFMAB};
+const CheckerTable::Commands CheckerTable::sameBankRefreshes = {Command::REFSB, Command::RFMSB};
+const CheckerTable::Commands CheckerTable::perBankRefreshes = {Command::REFPB, Command::RFMPB};
+
+CheckerTable::CheckerTable(const MemSpec& memSpec, std::string name) :
+    cycleClock(memSpec.tCK),
+    memSpec(memSpec),
+    name(std::move(name)),
+    nextCommandByBank(memSpec.banksPerChannel, CommandArray<uint64_t>{}),
+    nextCommandByBankSet(memSpec.ranksPerChannel * memSpec.banksPerGroup, CommandArray<uint64_t>{}),
+    nextCommandByBankGroup(memSpec.bankGroupsPerChannel, CommandArray<uint64_t>{}),
+    nextCommandByRank(memSpec.ranksPerChannel, CommandArray<uint64_t>{}),
+    last4ActivatesOnRank(memSpec.ranksPerChannel),
+    refreshesInRound(memSpec.ranksPerChannel, 0)
+{
+    for (unsigned command = 0; command < Command::numberOfCommands(); command++)
+    {
+        const Command::Type type = static_cast<Command::Type>(command);
+        busOccupancy[command] = cycleClock.toCycles(memSpec.getCommandLength(type));
+        if (memSpec.hasRasAndCasBus() && Command(type).isRasCommand())
+            commandBus[command] = 1;
+    }
+}
+
+void CheckerTable::compile(const std::vector<Constraint>& constraints)
+{
+    for (const auto& constraint : constraints)
+        addDelay(constraint.previous, constraint.next, constraint.scope, constraint.delay);
+}
+
+void CheckerTable::add(const Commands& previous, const Commands& next, Scope scope, uint64_t delay)
+{
+    for (Command previousCommand : previous)
+        for (Command nextCommand : next)
+            addDelay(previousCommand, nextCommand, scope, delay);
+}
+
+void CheckerTable::addDelay(Command previous, Command next, Scope scope, uint64_t delay)
+{
+    uint64_t& tableDelay = delays[static_cast<std::size_t>(scope)][previous][next];
+    tableDelay = std::max(tableDelay, delay);
+    hasDelays[static_cast<std::size_t>(scope)][previous] = true;
+
+    usesBankGroups = usesBankGroups || scope == Scope::BankGroup;
+    usesBankSets = usesBankSets || scope == Scope::BankSet;
+}
+
+void CheckerTable::setActivateWindow(uint64_t tFAW, const Commands& activates)
+{
+    this->tFAW = tFAW;
+    for (Command command : activates)
+        inActivateWindow[command] = true;
+    last4ActivatesOnRank = ControllerVector<Rank, ActivateWindow<4>>(memSpec.ranksPerChannel,
+                                                                      ActivateWindow<4>(tFAW));
+}
+
+void CheckerTable::setRefreshRound(const Commands& refreshes,
+                                   unsigned refreshesPerRound,
+                                   uint64_t delay)
+{
+    for (Command command : refreshes)
+        inRefreshRound[command] = true;
+    this->refreshesPerRound = refreshesPerRound;
+    refreshRoundDelay = delay;
+}
+
+void CheckerTable::setBusOccupancy(Command command, uint64_t cycles)
+{
+    busOccupancy[command] = cycles;
+}
+
+void CheckerTable::setTimingReference(Command command, uint64_t cycles)
+{
+    timingReference[command] = cycles;
+}
+
+sc_time CheckerTable::timeToSatisfyConstraints(Command command,
+                                               const tlm_generic_payload& payload) const
+{
+    const CommandQuery query(command, payload);
+    return cycleClock.toTime(
+        earliestCycle(query.command, query.bank, query.bankGroup, query.rank, cycleClock.now()));
+}
+
+void CheckerTable::timeToSatisfyConstraints(const CommandQueries& queries,
+                                            std::vector<sc_time>& earliestTimes) const
+{
+    earliestTimes.resize(queries.size());
+    const uint64_t now = cycleClock.now();
+    for (std::size_t i = 0; i < queries.size(); i++)
+    {
+        const CommandQuery& query = queries[i];
+        earliestTimes[i] = cycleClock.toTime(
+            earliestCycle(query.command, query.bank, query.bankGroup, query.rank, now));
+    }
+}
+
+std::size_t CheckerTable::bankSet(Bank bank, Rank rank) const
+{
+    return static_cast<std::size_t>(rank) * memSpec.banksPerGroup +
+           static_cast<std::size_t>(bank) % memSpec.banksPerGroup;
+}
+
+uint64_t CheckerTable::earliestCycle(
+    Command command, Bank bank, BankGroup bankGroup, Rank rank, uint64_t now) const
+{
+    uint64_t earliestCycleToStart = std::max(now, nextCommandOnBus[commandBus[command]]);
+    earliestCycleToStart = std::max(earliestCycleToStart, nextCommandByBank[bank][command]);
+    earliestCycleToStart = std::max(earliestCycleToStart, nextCommandByRank[rank][command]);
+    if (usesBankGroups)
+        earliestCycleToStart =
+            std::max(earliestCycleToStart, nextCommandByBankGroup[bankGroup][command]);
+    if (usesBankSets)
+        earliestCycleToStart =
+            std::max(earliestCycleToStart, nextCommandByBankSet[bankSet(bank, rank)][command]);
+    return earliestCycleToStart;
+}
+
+void CheckerTable::insert(Command command, const tlm_generic_payload& payload)
+{
+    const Bank bank = ControllerExtension::getBank(payload);
+    const Rank rank = ControllerExtension::getRank(payload);
+
+    PRINTDEBUGMESSAGE(name,
+                      "Changing state on bank " + std::to_string(static_cast<std::size_t>(bank)) +
+                          " command is " + command.toString());
+
+    const uint64_t currentCycle = cycleClock.now();
+
+    if (hasDelays[static_cast<std::size_t>(Scope::Bank)][command])
+        apply(nextCommandByBank[bank],
+              delays[static_cast<std::size_t>(Scope::Bank)][command],
+              currentCycle);
+
+    if (hasDelays[static_cast<std::size_t>(Scope::BankSet)][command])
+        apply(nextCommandByBankSet[bankSet(bank, rank)],
+              delays[static_cast<std::size_t>(Scope::BankSet)][command],
+              currentCycle);
+
+    if (hasDelays[static_cast<std::size_t>(Scope::BankGroup)][command])
+        apply(nextCommandByBankGroup[ControllerExtension::getBankGroup(payload)],
+              delays[static_cast<std::size_t>(Scope::BankGroup)][command],
+              currentCycle);
+
+    if (hasDelays[static_cast<std::size_t>(Scope::Rank)][command])
+        apply(nextCommandByRank[rank],
+              delays[static_cast<std::size_t>(Scope::Rank)][command],
+              currentCycle);
+
+    if (hasDelays[static_cast<std::size_t>(Scope::OtherRanks)][command])
+    {
+        for (unsigned rankID = 0; rankID < memSpec.ranksPerChannel; rankID++)
+        {
+            if (Rank(rankID) != rank)
+                apply(nextCommandByRank[Rank(rankID)],
+                      delays[static_cast<std::size_t>(Scope::OtherRanks)][command],
+                      currentCycle);
+        }
+    }
+
+    if (inActivateWindow[command] && tFAW != 0)
+    {
+        last4ActivatesOnRank[rank].insert(currentCycle + timingReference[command]);
+        const uint64_t earliestNextActivate = last4ActivatesOnRank[rank].getEarliestNextActivate();
+        for (std::size_t next = 0; next < inActivateWindow.size(); next++)
+        {
+            if (inActivateWindow[next])
+                nextCommandByRank[rank][next] = std::max(
+                    nextCommandByRank[rank][next],
+                    earliestNextActivate - std::min(earliestNextActivate, timingReference[next]));
+        }
+    }
+
+    if (inRefreshRound[command])
+    {
+        refreshesInRound[rank] = (refreshesInRound[rank] + 1) % refreshesPerRound;
+        if (refreshesInRound[rank] == 0)
+        {
+            for (std::size_t next = 0; next < inRefreshRound.size(); next++)
+            {
+                if (inRefreshRound[next])
+                    nextCommandByRank[rank][next] =
+                        std::max(nextCommandByRank[rank][next], currentCycle + refreshRoundDelay);
+            }
+        }
+    }
+
+    uint64_t& nextCommandOnCommandBus = nextCommandOnBus[commandBus[command]];
+    nextCommandOnCommandBus =
+        std::max(nextCommandOnCommandBus, currentCycle + busOccupancy[command]);
+}
+
+void CheckerTable::apply(CommandArray<uint64_t>& nextCommand,
+                         const CommandArray<uint64_t>& delays,
+                         uint64_t currentCycle)
+{
+    // A zero delay only moves the entry up to the current cycle, which every later request
+    // satisfies anyway, so the loop can run over the whole row without branches
+    for (std::size_t next = 0; next < nextCommand.size(); next++)
+        nextCommand[next] = std::max(nextCommand[next], currentCycle + delays[next]);
+}
+
+} // namespace DRAMSys
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CHECKERTABLE_H
+#define CHECKERTABLE_H
+
+#include "DRAMSys/configuration/memspec/MemSpec.h"
+#include "DRAMSys/controller/checker/ActivateWindow.h"
+#include "DRAMSys/controller/checker/CheckerIF.h"
+#include "DRAMSys/controller/checker/CycleClock.h"
+
+#include <array>
+#include <string>
+#include <vector>
+
+namespace DRAMSys
+{
+
+// Generic checker that is driven by a list of (previous command, next command, scope, delay)
+// constraints. A standard only describes its constraints, which are compiled into dense delay
+// rows per scope and previous command when the checker is constructed.
+class CheckerTable : public CheckerIF
+{
+public:
+    [[nodiscard]] sc_core::sc_time
+    timeToSatisfyConstraints(Command command, const tlm::tlm_generic_payload& payload) const override;
+    void timeToSatisfyConstraints(const CommandQueries& queries,
+                                  std::vector<sc_core::sc_time>& earliestTimes) const override;
+    void insert(Command command, const tlm::tlm_generic_payload& payload) override;
+
+protected:
+    enum class Scope
+    {
+        Bank,       // same bank
+        BankSet,    // same bank index in all bank groups of the rank
+        BankGroup,  // same bank group
+        Rank,       // same rank
+        OtherRanks, // all other ranks of the channel
+        END_ENUM,
+        PseudoChannel = Rank // the pseudo channels of HBM are modeled as ranks
+    };
+
+    struct Constraint
+    {
+        Command previous;
+        Command next;
+        Scope scope;
+        uint64_t delay;
+    };
+
+    using Commands = std::vector<Command>;
+
+    // Command groups for constraints that apply to all of their commands alike
+    static const Commands reads;
+    static const Commands writes;
+    static const Commands precharges;
+    static const Commands allBankRefreshes;  // REFAB, RFMAB
+    static const Commands sameBankRefreshes; // REFSB, RFMSB
+    static const Commands perBankRefreshes;  // REFPB, RFMPB
+
+    CheckerTable(const MemSpec& memSpec, std::string name);
+
+    void compile(const std::vector<Constraint>& constraints);
+    // Adds the delay between every previous and every next command
+    void add(const Commands& previous, const Commands& next, Scope scope, uint64_t delay);
+    // The given commands are counted in the activate window of their rank and held back by it
+    void setActivateWindow(uint64_t tFAW, const Commands& activates = {Command::ACT});
+    // After every refreshesPerRound-th of the given commands on a rank, the next one on the rank
+    // has to wait for the delay (e.g. tRFCpb after all banks have been refreshed once)
+    void setRefreshRound(const Commands& refreshes, unsigned refreshesPerRound, uint64_t delay);
+    void setBusOccupancy(Command command, uint64_t cycles);
+    // Cycles from the start of a multi-cycle command to the cycle its timings refer to, only
+    // needed for activate windows that mix commands of different lengths
+    void setTimingReference(Command command, uint64_t cycles);
+
+    const CycleClock cycleClock;
+
+private:
+    template<typename T>
+    using CommandArray = std::array<T, Command::END_ENUM>;
+    using DelayTable = CommandArray<CommandArray<uint64_t>>;
+    static constexpr std::size_t numberOfScopes = static_cast<std::size_t>(Scope::END_ENUM);
+
+    void addDelay(Command previous, Command next, Scope scope, uint64_t delay);
+    [[nodiscard]] std::size_t bankSet(Bank bank, Rank rank) const;
+    [[nodiscard]] uint64_t
+    earliestCycle(Command command, Bank bank, BankGroup bankGroup, Rank rank, uint64_t now) const;
+
+    static void apply(CommandArray<uint64_t>& nextCommand,
+                      const CommandArray<uint64_t>& delays,
+                      uint64_t currentCycle);
+
+    const MemSpec& memSpec;
+    const std::string name;
+
+    // delays[scope][previous][next], rows without any constraint are skipped
+    std::array<DelayTable, numberOfScopes> delays{};
+    std::array<CommandArray<bool>, numberOfScopes> hasDelays{};
+    bool usesBankGroups = false;
+    bool usesBankSets = false;
+
+    ControllerVector<Bank, CommandArray<uint64_t>> nextCommandByBank;
+    std::vector<CommandArray<uint64_t>> nextCommandByBankSet;
+    ControllerVector<BankGroup, CommandArray<uint64_t>> nextCommandByBankGroup;
+    ControllerVector<Rank, CommandArray<uint64_t>> nextCommandByRank;
+
+    // Standards with separate row and column command buses put the row commands on bus 1
+    CommandArray<std::size_t> commandBus{};
+    CommandArray<uint64_t> busOccupancy{};
+    std::array<uint64_t, 2> nextCommandOnBus{};
+
+    uint64_t tFAW = 0;
+    CommandArray<bool> inActivateWindow{};
+    CommandArray<uint64_t> timingReference{};
+    ControllerVector<Rank, ActivateWindow<4>> last4ActivatesOnRank;
+
+    CommandArray<bool> inRefreshRound{};
+    unsigned refreshesPerRound = 0;
+    uint64_t refreshRoundDelay = 0;
+    ControllerVector<Rank, unsigned> refreshesInRound;
+};
+
+} // namespace DRAMSys
+
+#endif // CHECKERTABLE_H
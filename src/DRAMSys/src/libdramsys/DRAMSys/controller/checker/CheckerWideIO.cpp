@@ -45,27 +45,47 @@ namespace DRAMSys
 {
 
 CheckerWideIO::CheckerWideIO(const MemSpecWideIO& memSpec) :
-    memSpec(memSpec)
+    memSpec(memSpec),
+    cycleClock(memSpec.tCK)
 {
-    lastScheduledByCommandAndBank = std::vector<ControllerVector<Bank, sc_time>>(
+    tCK = cycleClock.toCycles(memSpec.tCK);
+    tCKE = cycleClock.toCycles(memSpec.tCKE);
+    tCKESR = cycleClock.toCycles(memSpec.tCKESR);
+    tRAS = cycleClock.toCycles(memSpec.tRAS);
+    tRC = cycleClock.toCycles(memSpec.tRC);
+    tRCD = cycleClock.toCycles(memSpec.tRCD);
+    tRFC = cycleClock.toCycles(memSpec.tRFC);
+    tRL = cycleClock.toCycles(memSpec.tRL);
+    tRP = cycleClock.toCycles(memSpec.tRP);
+    tRRD = cycleClock.toCycles(memSpec.tRRD);
+    tRTRS = cycleClock.toCycles(memSpec.tRTRS);
+    tTAW = cycleClock.toCycles(memSpec.tTAW);
+    tWL = cycleClock.toCycles(memSpec.tWL);
+    tWR = cycleClock.toCycles(memSpec.tWR);
+    tWTR = cycleClock.toCycles(memSpec.tWTR);
+    tXP = cycleClock.toCycles(memSpec.tXP);
+    tXSR = cycleClock.toCycles(memSpec.tXSR);
+
+    lastScheduledByCommandAndBank = std::vector<ControllerVector<Bank, uint64_t>>(
         Command::numberOfCommands(),
-        ControllerVector<Bank, sc_time>(memSpec.banksPerChannel, scMaxTime));
-    lastScheduledByCommandAndRank = std::vector<ControllerVector<Rank, sc_time>>(
+        ControllerVector<Bank, uint64_t>(memSpec.banksPerChannel, maxCycle));
+    lastScheduledByCommandAndRank = std::vector<ControllerVector<Rank, uint64_t>>(
         Command::numberOfCommands(),
-        ControllerVector<Rank, sc_time>(memSpec.ranksPerChannel, scMaxTime));
-    lastScheduledByCommand = std::vector<sc_time>(Command::numberOfCommands(), scMaxTime);
-    lastCommandOnBus = scMaxTime;
-    last2Activates = ControllerVector<Rank, std::queue<sc_time>>(memSpec.ranksPerChannel);
-
-    tBURST = memSpec.defaultBurstLength * memSpec.tCK;
-    tRDWR = memSpec.tRL + tBURST + memSpec.tCK;
-    tRDWR_R = memSpec.tRL + tBURST + memSpec.tRTRS - memSpec.tWL;
-    tWRPRE = memSpec.tWL + tBURST - memSpec.tCK + memSpec.tWR;
-    tWRRD = memSpec.tWL + tBURST - memSpec.tCK + memSpec.tWTR;
-    tWRRD_R = memSpec.tWL + tBURST + memSpec.tRTRS - memSpec.tRL;
-    tRDPDEN = memSpec.tRL + tBURST; // + memSpec.tCK; ??
-    tWRPDEN = memSpec.tWL + tBURST + memSpec.tWR - memSpec.tCK;
-    tWRAPDEN = memSpec.tWL + tBURST + memSpec.tWR; // + memSpec.tCK; ??
+        ControllerVector<Rank, uint64_t>(memSpec.ranksPerChannel, maxCycle));
+    lastScheduledByCommand = std::vector<uint64_t>(Command::numberOfCommands(), maxCycle);
+    lastCommandOnBus = maxCycle;
+    last2Activates = ControllerVector<Rank, ActivateWindow<2>>(
+        memSpec.ranksPerChannel, ActivateWindow<2>(tTAW));
+
+    tBURST = memSpec.defaultBurstLength * tCK;
+    tRDWR = tRL + tBURST + tCK;
+    tRDWR_R = tRL + tBURST + tRTRS - tWL;
+    tWRPRE = tWL + tBURST - tCK + tWR;
+    tWRRD = tWL + tBURST - tCK + tWTR;
+    tWRRD_R = tWL + tBURST + tRTRS - tRL;
+    tRDPDEN = tRL + tBURST; // + tCK; ??
+    tWRPDEN = tWL + tBURST + tWR - tCK;
+    tWRAPDEN = tWL + tBURST + tWR; // + tCK; ??
 }
 
 sc_time CheckerWideIO::timeToSatisfyConstraints(Command command,
@@ -74,8 +94,8 @@ sc_time CheckerWideIO::timeToSatisfyConstraints(Command command,
     Rank rank = ControllerExtension::getRank(payload);
     Bank bank = ControllerExtension::getBank(payload);
 
-    sc_time lastCommandStart;
-    sc_time earliestTimeToStart = sc_time_stamp();
+    uint64_t lastCommandStart = 0;
+    uint64_t earliestCycleToStart = cycleClock.now();
 
     if (command == Command::RD || command == Command::RDA)
     {
@@ -84,66 +104,66 @@ sc_time CheckerWideIO::timeToSatisfyConstraints(Command command,
         assert(burstLength <= memSpec.maxBurstLength);
 
         lastCommandStart = lastScheduledByCommandAndBank[Command::ACT][bank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRCD);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRCD);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RD][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tBURST);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tBURST);
 
         lastCommandStart =
             lastScheduledByCommand[Command::RD] != lastScheduledByCommandAndRank[Command::RD][rank]
                 ? lastScheduledByCommand[Command::RD]
-                : scMaxTime;
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart =
-                std::max(earliestTimeToStart, lastCommandStart + tBURST + memSpec.tRTRS);
+                : maxCycle;
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart =
+                std::max(earliestCycleToStart, lastCommandStart + tBURST + tRTRS);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RDA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tBURST);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tBURST);
 
         lastCommandStart = lastScheduledByCommand[Command::RDA] !=
                                    lastScheduledByCommandAndRank[Command::RDA][rank]
                                ? lastScheduledByCommand[Command::RDA]
-                               : scMaxTime;
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart =
-                std::max(earliestTimeToStart, lastCommandStart + tBURST + memSpec.tRTRS);
+                               : maxCycle;
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart =
+                std::max(earliestCycleToStart, lastCommandStart + tBURST + tRTRS);
 
         if (command == Command::RDA)
         {
             lastCommandStart = lastScheduledByCommandAndBank[Command::WR][bank];
-            if (lastCommandStart != scMaxTime)
-                earliestTimeToStart =
-                    std::max(earliestTimeToStart, lastCommandStart + tWRPRE - tBURST);
+            if (lastCommandStart != maxCycle)
+                earliestCycleToStart =
+                    std::max(earliestCycleToStart, lastCommandStart + tWRPRE - tBURST);
         }
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WR][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRRD);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tWRRD);
 
         lastCommandStart =
             lastScheduledByCommand[Command::WR] != lastScheduledByCommandAndRank[Command::WR][rank]
                 ? lastScheduledByCommand[Command::WR]
-                : scMaxTime;
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRRD_R);
+                : maxCycle;
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tWRRD_R);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WRA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRRD);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tWRRD);
 
         lastCommandStart = lastScheduledByCommand[Command::WRA] !=
                                    lastScheduledByCommandAndRank[Command::WRA][rank]
                                ? lastScheduledByCommand[Command::WRA]
-                               : scMaxTime;
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRRD_R);
+                               : maxCycle;
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tWRRD_R);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tXP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tXP);
     }
     else if (command == Command::WR || command == Command::WRA || command == Command::MWR ||
              command == Command::MWRA)
@@ -153,293 +173,288 @@ sc_time CheckerWideIO::timeToSatisfyConstraints(Command command,
         assert(burstLength <= memSpec.maxBurstLength);
 
         lastCommandStart = lastScheduledByCommandAndBank[Command::ACT][bank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRCD);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRCD);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RD][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRDWR);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRDWR);
 
         lastCommandStart =
             lastScheduledByCommand[Command::RD] != lastScheduledByCommandAndRank[Command::RD][rank]
                 ? lastScheduledByCommand[Command::RD]
-                : scMaxTime;
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRDWR_R);
+                : maxCycle;
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRDWR_R);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RDA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRDWR);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRDWR);
 
         lastCommandStart = lastScheduledByCommand[Command::RDA] !=
                                    lastScheduledByCommandAndRank[Command::RDA][rank]
                                ? lastScheduledByCommand[Command::RDA]
-                               : scMaxTime;
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRDWR_R);
+                               : maxCycle;
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRDWR_R);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WR][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tBURST);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tBURST);
 
         lastCommandStart =
             lastScheduledByCommand[Command::WR] != lastScheduledByCommandAndRank[Command::WR][rank]
                 ? lastScheduledByCommand[Command::WR]
-                : scMaxTime;
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart =
-                std::max(earliestTimeToStart, lastCommandStart + tBURST + memSpec.tRTRS);
+                : maxCycle;
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart =
+                std::max(earliestCycleToStart, lastCommandStart + tBURST + tRTRS);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WRA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tBURST);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tBURST);
 
         lastCommandStart = lastScheduledByCommand[Command::WRA] !=
                                    lastScheduledByCommandAndRank[Command::WRA][rank]
                                ? lastScheduledByCommand[Command::WRA]
-                               : scMaxTime;
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart =
-                std::max(earliestTimeToStart, lastCommandStart + tBURST + memSpec.tRTRS);
+                               : maxCycle;
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart =
+                std::max(earliestCycleToStart, lastCommandStart + tBURST + tRTRS);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tXP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tXP);
     }
     else if (command == Command::ACT)
     {
         lastCommandStart = lastScheduledByCommandAndBank[Command::ACT][bank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRC);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRC);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::ACT][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRRD);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRRD);
 
         lastCommandStart = lastScheduledByCommandAndBank[Command::RDA][bank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart =
-                std::max(earliestTimeToStart, lastCommandStart + tBURST + memSpec.tRP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tBURST + tRP);
 
         lastCommandStart = lastScheduledByCommandAndBank[Command::WRA][bank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart =
-                std::max(earliestTimeToStart, lastCommandStart + tWRPRE + memSpec.tRP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tWRPRE + tRP);
 
         lastCommandStart = lastScheduledByCommandAndBank[Command::PREPB][bank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PREAB][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::REFAB][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRFC);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRFC);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tXP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tXP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXP][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tXP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tXP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::SREFEX][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tXSR);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tXSR);
 
-        if (last2Activates[rank].size() >= 2)
-            earliestTimeToStart =
-                std::max(earliestTimeToStart, last2Activates[rank].front() + memSpec.tTAW);
+        earliestCycleToStart =
+            std::max(earliestCycleToStart, last2Activates[rank].getEarliestNextActivate());
     }
     else if (command == Command::PREPB)
     {
         lastCommandStart = lastScheduledByCommandAndBank[Command::ACT][bank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRAS);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRAS);
 
         lastCommandStart = lastScheduledByCommandAndBank[Command::RD][bank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tBURST);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tBURST);
 
         lastCommandStart = lastScheduledByCommandAndBank[Command::WR][bank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRPRE);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tWRPRE);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tXP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tXP);
     }
     else if (command == Command::PREAB)
     {
         lastCommandStart = lastScheduledByCommandAndRank[Command::ACT][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRAS);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRAS);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RD][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tBURST);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tBURST);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RDA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tBURST);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tBURST);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WR][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRPRE);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tWRPRE);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WRA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRPRE);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tWRPRE);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tXP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tXP);
     }
     else if (command == Command::REFAB)
     {
         lastCommandStart = lastScheduledByCommandAndRank[Command::ACT][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRC);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRC);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RDA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart =
-                std::max(earliestTimeToStart, lastCommandStart + tBURST + memSpec.tRP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tBURST + tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WRA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart =
-                std::max(earliestTimeToStart, lastCommandStart + tWRPRE + memSpec.tRP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tWRPRE + tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PREPB][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PREAB][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::REFAB][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRFC);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRFC);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXP][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tXP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tXP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::SREFEX][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tXSR);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tXSR);
     }
     else if (command == Command::PDEA)
     {
         lastCommandStart = lastScheduledByCommandAndRank[Command::RD][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRDPDEN);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRDPDEN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RDA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRDPDEN);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRDPDEN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WR][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRPDEN);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tWRPDEN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WRA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRAPDEN);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tWRAPDEN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tCKE);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tCKE);
     }
     else if (command == Command::PDXA)
     {
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDEA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tCKE);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tCKE);
     }
     else if (command == Command::PDEP)
     {
         lastCommandStart = lastScheduledByCommandAndRank[Command::RD][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRDPDEN);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRDPDEN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RDA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRDPDEN);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRDPDEN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WRA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRAPDEN);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tWRAPDEN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXP][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tCKE);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tCKE);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::SREFEX][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tXSR);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tXSR);
     }
     else if (command == Command::PDXP)
     {
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDEP][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tCKE);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tCKE);
     }
     else if (command == Command::SREFEN)
     {
         lastCommandStart = lastScheduledByCommandAndRank[Command::ACT][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRC);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRC);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RDA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(
-                earliestTimeToStart, lastCommandStart + std::max(tRDPDEN, tBURST + memSpec.tRP));
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(
+                earliestCycleToStart, lastCommandStart + std::max(tRDPDEN, tBURST + tRP));
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WRA][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(
-                earliestTimeToStart, lastCommandStart + std::max(tWRAPDEN, tWRPRE + memSpec.tRP));
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(
+                earliestCycleToStart, lastCommandStart + std::max(tWRAPDEN, tWRPRE + tRP));
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PREPB][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PREAB][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXP][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tXP);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tXP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::REFAB][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tRFC);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tRFC);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::SREFEX][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tXSR);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tXSR);
     }
     else if (command == Command::SREFEX)
     {
         lastCommandStart = lastScheduledByCommandAndRank[Command::SREFEN][rank];
-        if (lastCommandStart != scMaxTime)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec.tCKESR);
+        if (lastCommandStart != maxCycle)
+            earliestCycleToStart = std::max(earliestCycleToStart, lastCommandStart + tCKESR);
     }
     else
         SC_REPORT_FATAL("CheckerWideIO", "Unknown command!");
 
     // Check if command bus is free
-    if (lastCommandOnBus != scMaxTime)
-        earliestTimeToStart = std::max(earliestTimeToStart, lastCommandOnBus + memSpec.tCK);
+    if (lastCommandOnBus != maxCycle)
+        earliestCycleToStart = std::max(earliestCycleToStart, lastCommandOnBus + tCK);
 
-    return earliestTimeToStart;
+    return cycleClock.toTime(earliestCycleToStart);
 }
 
 void CheckerWideIO::insert(Command command, const tlm_generic_payload& payload)
@@ -457,16 +472,15 @@ void CheckerWideIO::insert(Command command, const tlm_generic_payload& payload)
                       "Changing state on bank " + std::to_string(static_cast<std::size_t>(bank)) +
                           " command is " + command.toString());
 
-    lastScheduledByCommandAndBank[command][bank] = sc_time_stamp();
-    lastScheduledByCommandAndRank[command][rank] = sc_time_stamp();
-    lastScheduledByCommand[command] = sc_time_stamp();
-    lastCommandOnBus = sc_time_stamp();
+    const uint64_t currentCycle = cycleClock.now();
+    lastScheduledByCommandAndBank[command][bank] = currentCycle;
+    lastScheduledByCommandAndRank[command][rank] = currentCycle;
+    lastScheduledByCommand[command] = currentCycle;
+    lastCommandOnBus = currentCycle;
 
     if (command == Command::ACT)
     {
-        if (last2Activates[rank].size() == 2)
-            last2Activates[rank].pop();
-        last2Activates[rank].push(sc_time_stamp());
+        last2Activates[rank].insert(currentCycle);
     }
 }
 
@@ -36,9 +36,11 @@
 #define CHECKERWIDEIO2_H
 
 #include "DRAMSys/configuration/memspec/MemSpecWideIO2.h"
+#include "DRAMSys/controller/checker/ActivateWindow.h"
 #include "DRAMSys/controller/checker/CheckerIF.h"
+#include "DRAMSys/controller/checker/CycleClock.h"
 
-#include <queue>
+#include <limits>
 #include <vector>
 
 namespace DRAMSys
@@ -55,26 +57,51 @@ public:
 
 private:
     const MemSpecWideIO2& memSpec;
+    const CycleClock cycleClock;
 
-    std::vector<ControllerVector<Bank, sc_core::sc_time>> lastScheduledByCommandAndBank;
-    std::vector<ControllerVector<Rank, sc_core::sc_time>> lastScheduledByCommandAndRank;
-    std::vector<sc_core::sc_time> lastScheduledByCommand;
-    sc_core::sc_time lastCommandOnBus;
+    // Timing parameters in clock cycles
+    uint64_t tCCD;
+    uint64_t tCK;
+    uint64_t tCKE;
+    uint64_t tCKESR;
+    uint64_t tDQSCK;
+    uint64_t tFAW;
+    uint64_t tRAS;
+    uint64_t tRCD;
+    uint64_t tRCpb;
+    uint64_t tRFCab;
+    uint64_t tRFCpb;
+    uint64_t tRL;
+    uint64_t tRPab;
+    uint64_t tRPpb;
+    uint64_t tRRD;
+    uint64_t tRTP;
+    uint64_t tRTRS;
+    uint64_t tWL;
+    uint64_t tWR;
+    uint64_t tWTR;
+    uint64_t tXP;
+    uint64_t tXSR;
+
+    std::vector<ControllerVector<Bank, uint64_t>> lastScheduledByCommandAndBank;
+    std::vector<ControllerVector<Rank, uint64_t>> lastScheduledByCommandAndRank;
+    std::vector<uint64_t> lastScheduledByCommand;
+    uint64_t lastCommandOnBus;
 
     // Four activate window
-    ControllerVector<Rank, std::queue<sc_core::sc_time>> last4Activates;
+    ControllerVector<Rank, ActivateWindow<4>> last4Activates;
 
-    const sc_core::sc_time scMaxTime = sc_core::sc_max_time();
-    sc_core::sc_time tBURST;
-    sc_core::sc_time tRDPRE;
-    sc_core::sc_time tRDPDEN;
-    sc_core::sc_time tRDWR;
-    sc_core::sc_time tRDWR_R;
-    sc_core::sc_time tWRPRE;
-    sc_core::sc_time tWRPDEN;
-    sc_core::sc_time tWRAPDEN;
-    sc_core::sc_time tWRRD;
-    sc_core::sc_time tWRRD_R;
+    static constexpr uint64_t maxCycle = std::numeric_limits<uint64_t>::max();
+    uint64_t tBURST;
+    uint64_t tRDPRE;
+    uint64_t tRDPDEN;
+    uint64_t tRDWR;
+    uint64_t tRDWR_R;
+    uint64_t tWRPRE;
+    uint64_t tWRPDEN;
+    uint64_t tWRAPDEN;
+    uint64_t tWRRD;
+    uint64_t tWRRD_R;
 };
 
 } // namespace DRAMSys
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CYCLECLOCK_H
+#define CYCLECLOCK_H
+
+#include <cstdint>
+#include <systemc>
+
+namespace DRAMSys
+{
+
+// The checkers keep their timing state in whole clock cycles. Conversion from and to sc_time
+// only happens when a checker is constructed and when it hands a result back to the controller.
+class CycleClock
+{
+public:
+    explicit CycleClock(const sc_core::sc_time& tCK) : tCK(tCK.value()) {}
+
+    // Durations that are not a multiple of tCK are rounded up to the next clock edge
+    [[nodiscard]] uint64_t toCycles(const sc_core::sc_time& duration) const
+    {
+        return (duration.value() + tCK - 1) / tCK;
+    }
+
+    [[nodiscard]] sc_core::sc_time toTime(uint64_t cycle) const
+    {
+        return sc_core::sc_time::from_value(cycle * tCK);
+    }
+
+    // Commands that are issued between two clock edges count from the next edge
+    [[nodiscard]] uint64_t now() const { return (sc_core::sc_time_stamp().value() + tCK - 1) / tCK; }
+
+private:
+    const uint64_t tCK;
+};
+
+} // namespace DRAMSys
+
+#endif // CYCLECLOCK_H
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "CasSpacingStatistics.h"
+
+#include <iomanip>
+#include <iostream>
+
+using namespace sc_core;
+
+namespace DRAMSys
+{
+
+CasSpacingStatistics::CasSpacingStatistics(const MemSpec& memSpec) : memSpec(memSpec) {}
+
+void CasSpacingStatistics::commandIssued(const CommandTuple::Type& commandTuple,
+                                         bool furtherCasReady)
+{
+    if (!std::get<CommandTuple::Command>(commandTuple).isCasCommand())
+        return;
+
+    const tlm::tlm_generic_payload& payload = *std::get<CommandTuple::Payload>(commandTuple);
+    Rank rank = ControllerExtension::getRank(payload);
+    BankGroup bankGroup = ControllerExtension::getBankGroup(payload);
+    sc_time now = sc_time_stamp();
+
+    if (lastCasValid && lastFurtherCasReady)
+    {
+        Target target = OtherRank;
+        if (rank == lastRank)
+            target = bankGroup == lastBankGroup ? SameBankGroup : OtherBankGroup;
+
+        numSpacings[target]++;
+        spacingCycles[target] += static_cast<uint64_t>((now - lastCasTime) / memSpec.tCK + 0.5);
+    }
+
+    lastCasValid = true;
+    lastFurtherCasReady = furtherCasReady;
+    lastRank = rank;
+    lastBankGroup = bankGroup;
+    lastCasTime = now;
+}
+
+void CasSpacingStatistics::print(const std::string& name) const
+{
+    auto average = [this](Target target)
+    {
+        return numSpacings[target] != 0 ? static_cast<double>(spacingCycles[target]) /
+                                              static_cast<double>(numSpacings[target])
+                                        : 0.0;
+    };
+
+    std::cout << std::left << std::setw(24) << name << std::string("  CAS-to-CAS:     ")
+              << std::fixed << std::setprecision(2) << "same BG " << numSpacings[SameBankGroup]
+              << " x " << average(SameBankGroup) << " cycles | other BG "
+              << numSpacings[OtherBankGroup] << " x " << average(OtherBankGroup)
+              << " cycles | other rank " << numSpacings[OtherRank] << " x " << average(OtherRank)
+              << " cycles" << std::endl;
+}
+
+} // namespace DRAMSys
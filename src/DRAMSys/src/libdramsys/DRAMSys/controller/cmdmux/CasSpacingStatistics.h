@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CASSPACINGSTATISTICS_H
+#define CASSPACINGSTATISTICS_H
+
+#include "DRAMSys/configuration/memspec/MemSpec.h"
+#include "DRAMSys/controller/Command.h"
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <systemc>
+
+namespace DRAMSys
+{
+
+// Distance between consecutive CAS commands, separated by whether the second command targets the
+// same bank group, another bank group of the same rank or another rank. Only distances following
+// a CAS command that was issued while further CAS commands were ready are counted, so idle periods
+// of the data bus do not distort the averages.
+class CasSpacingStatistics
+{
+public:
+    explicit CasSpacingStatistics(const MemSpec& memSpec);
+
+    void commandIssued(const CommandTuple::Type& commandTuple, bool furtherCasReady);
+    void print(const std::string& name) const;
+
+private:
+    enum Target
+    {
+        SameBankGroup,
+        OtherBankGroup,
+        OtherRank,
+        NumTargets
+    };
+
+    const MemSpec& memSpec;
+
+    bool lastCasValid = false;
+    bool lastFurtherCasReady = false;
+    Rank lastRank = Rank(0);
+    BankGroup lastBankGroup = BankGroup(0);
+    sc_core::sc_time lastCasTime = sc_core::SC_ZERO_TIME;
+
+    std::array<uint64_t, NumTargets> numSpacings{};
+    std::array<uint64_t, NumTargets> spacingCycles{};
+};
+
+} // namespace DRAMSys
+
+#endif // CASSPACINGSTATISTICS_H
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "CmdMuxBankGroup.h"
+
+#include <algorithm>
+#include <systemc>
+#include <tuple>
+
+using namespace sc_core;
+
+namespace DRAMSys
+{
+
+BankGroupCasSelector::BankGroupCasSelector(const MemSpec& memSpec) :
+    lookAhead(memSpec.getCasToCasSameBankGroup()),
+    noBankGroup(memSpec.bankGroupsPerChannel),
+    lastCasBankGroup(noBankGroup),
+    casPerBankGroup(memSpec.bankGroupsPerChannel),
+    casSpacingStatistics(memSpec)
+{
+}
+
+ReadyCommands::const_iterator
+BankGroupCasSelector::select(const ReadyCommands& readyCommands,
+                             ReadyCommands::const_iterator oldestCas)
+{
+    sc_time now = sc_time_stamp();
+    sc_time horizon = now + lookAhead;
+
+    std::fill(casPerBankGroup.begin(), casPerBankGroup.end(), 0);
+    unsigned numIssuableCas = 0;
+    for (const auto& it : readyCommands)
+    {
+        if (!std::get<CommandTuple::Command>(it).isCasCommand())
+            continue;
+
+        sc_time timestamp = std::get<CommandTuple::Timestamp>(it);
+        if (timestamp <= horizon)
+        {
+            casPerBankGroup[static_cast<std::size_t>(
+                ControllerExtension::getBankGroup(*std::get<CommandTuple::Payload>(it)))]++;
+        }
+        if (timestamp == now)
+            numIssuableCas++;
+    }
+
+    if (numIssuableCas < 2)
+        return oldestCas;
+
+    auto result = oldestCas;
+    bool lastOtherGroup = false;
+    unsigned lastGroupSize = 0;
+    uint64_t lastPayloadID = UINT64_MAX;
+    for (auto it = readyCommands.cbegin(); it != readyCommands.cend(); it++)
+    {
+        if (!std::get<CommandTuple::Command>(*it).isCasCommand() ||
+            std::get<CommandTuple::Timestamp>(*it) != now)
+            continue;
+
+        const tlm::tlm_generic_payload& payload = *std::get<CommandTuple::Payload>(*it);
+        auto bankGroup = static_cast<std::size_t>(ControllerExtension::getBankGroup(payload));
+        bool otherGroup = bankGroup != lastCasBankGroup;
+        unsigned groupSize = casPerBankGroup[bankGroup];
+        uint64_t payloadID = ControllerExtension::getChannelPayloadID(payload);
+
+        // The payload IDs are compared the other way round, the oldest request wins
+        if (std::tie(otherGroup, groupSize, lastPayloadID) >
+            std::tie(lastOtherGroup, lastGroupSize, payloadID))
+        {
+            lastOtherGroup = otherGroup;
+            lastGroupSize = groupSize;
+            lastPayloadID = payloadID;
+            result = it;
+        }
+    }
+
+    return result;
+}
+
+void BankGroupCasSelector::commandIssued(const CommandTuple::Type& commandTuple,
+                                         const ReadyCommands& readyCommands)
+{
+    if (!std::get<CommandTuple::Command>(commandTuple).isCasCommand())
+        return;
+
+    lastCasBankGroup = static_cast<std::size_t>(
+        ControllerExtension::getBankGroup(*std::get<CommandTuple::Payload>(commandTuple)));
+
+    bool furtherCasReady =
+        std::count_if(readyCommands.cbegin(),
+                      readyCommands.cend(),
+                      [](const CommandTuple::Type& it)
+                      { return std::get<CommandTuple::Command>(it).isCasCommand(); }) >= 2;
+    casSpacingStatistics.commandIssued(commandTuple, furtherCasReady);
+}
+
+void BankGroupCasSelector::printStatistics(const std::string& name) const
+{
+    casSpacingStatistics.print(name);
+}
+
+CmdMuxBankGroup::CmdMuxBankGroup(const MemSpec& memSpec) :
+    CmdMuxOldest(memSpec),
+    casSelector(memSpec)
+{
+}
+
+std::optional<CommandTuple::Type> CmdMuxBankGroup::selectCommand(const ReadyCommands& readyCommands)
+{
+    auto result = CmdMuxOldest::selectCommand(readyCommands);
+    if (result.has_value())
+        casSelector.commandIssued(*result, readyCommands);
+    return result;
+}
+
+ReadyCommands::const_iterator
+CmdMuxBankGroup::selectCasCommand(const ReadyCommands& readyCommands,
+                                  ReadyCommands::const_iterator oldestCas)
+{
+    return casSelector.select(readyCommands, oldestCas);
+}
+
+void CmdMuxBankGroup::printStatistics(const std::string& name) const
+{
+    casSelector.printStatistics(name);
+}
+
+CmdMuxBankGroupRasCas::CmdMuxBankGroupRasCas(const MemSpec& memSpec) :
+    CmdMuxOldestRasCas(memSpec),
+    casSelector(memSpec)
+{
+}
+
+std::optional<CommandTuple::Type>
+CmdMuxBankGroupRasCas::selectCommand(const ReadyCommands& readyCommands)
+{
+    auto result = CmdMuxOldestRasCas::selectCommand(readyCommands);
+    if (result.has_value())
+        casSelector.commandIssued(*result, readyCommands);
+    return result;
+}
+
+ReadyCommands::const_iterator
+CmdMuxBankGroupRasCas::selectCasCommand(const ReadyCommands& readyCommands,
+                                        ReadyCommands::const_iterator oldestCas)
+{
+    return casSelector.select(readyCommands, oldestCas);
+}
+
+void CmdMuxBankGroupRasCas::printStatistics(const std::string& name) const
+{
+    casSelector.printStatistics(name);
+}
+
+} // namespace DRAMSys
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef CMDMUXBANKGROUP_H
+#define CMDMUXBANKGROUP_H
+
+#include "DRAMSys/configuration/memspec/MemSpec.h"
+#include "DRAMSys/controller/cmdmux/CasSpacingStatistics.h"
+#include "DRAMSys/controller/cmdmux/CmdMuxOldest.h"
+
+#include <vector>
+
+namespace DRAMSys
+{
+
+// Choice among several CAS commands that can be issued in the current cycle. A command of a bank
+// group other than the one of the last CAS command of the channel is preferred, because the next
+// CAS command to the same bank group has to wait tCCD_L instead of tCCD_S. Further ties are broken
+// by the number of CAS commands of the bank group that can be issued now or within tCCD_L, so that
+// the remaining commands more likely belong to other bank groups, and then by the oldest request.
+class BankGroupCasSelector
+{
+public:
+    explicit BankGroupCasSelector(const MemSpec& memSpec);
+
+    ReadyCommands::const_iterator select(const ReadyCommands& readyCommands,
+                                         ReadyCommands::const_iterator oldestCas);
+    void commandIssued(const CommandTuple::Type& commandTuple, const ReadyCommands& readyCommands);
+    void printStatistics(const std::string& name) const;
+
+private:
+    const sc_core::sc_time lookAhead;
+    const std::size_t noBankGroup;
+    std::size_t lastCasBankGroup;
+    std::vector<unsigned> casPerBankGroup;
+    CasSpacingStatistics casSpacingStatistics;
+};
+
+// Same as "Oldest", but a CAS command is chosen by the BankGroupCasSelector
+class CmdMuxBankGroup : public CmdMuxOldest
+{
+public:
+    explicit CmdMuxBankGroup(const MemSpec& memSpec);
+    std::optional<CommandTuple::Type> selectCommand(const ReadyCommands& readyCommands) override;
+    void printStatistics(const std::string& name) const override;
+
+protected:
+    ReadyCommands::const_iterator selectCasCommand(const ReadyCommands& readyCommands,
+                                                   ReadyCommands::const_iterator oldestCas) override;
+
+private:
+    BankGroupCasSelector casSelector;
+};
+
+class CmdMuxBankGroupRasCas : public CmdMuxOldestRasCas
+{
+public:
+    explicit CmdMuxBankGroupRasCas(const MemSpec& memSpec);
+    std::optional<CommandTuple::Type> selectCommand(const ReadyCommands& readyCommands) override;
+    void printStatistics(const std::string& name) const override;
+
+protected:
+    ReadyCommands::const_iterator selectCasCommand(const ReadyCommands& readyCommands,
+                                                   ReadyCommands::const_iterator oldestCas) override;
+
+private:
+    BankGroupCasSelector casSelector;
+};
+
+} // namespace DRAMSys
+
+#endif // CMDMUXBANKGROUP_H
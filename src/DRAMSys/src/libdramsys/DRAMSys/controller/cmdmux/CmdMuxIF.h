@@ -38,6 +38,7 @@
 #include "DRAMSys/controller/Command.h"
 
 #include <optional>
+#include <string>
 
 namespace DRAMSys
 {
@@ -55,6 +56,7 @@ public:
     virtual ~CmdMuxIF() = default;
 
     virtual std::optional<CommandTuple::Type> selectCommand(const ReadyCommands& readyCommands) = 0;
+    virtual void printStatistics([[maybe_unused]] const std::string& name) const {}
 };
 
 } // namespace DRAMSys
@@ -78,9 +78,19 @@ std::optional<CommandTuple::Type> CmdMuxOldest::selectCommand(const ReadyCommand
     if (std::get<CommandTuple::Timestamp>(*result) != sc_time_stamp())
         return std::nullopt;
 
+    if (std::get<CommandTuple::Command>(*result).isCasCommand())
+        result = selectCasCommand(readyCommands, result);
+
     return *result;
 }
 
+ReadyCommands::const_iterator
+CmdMuxOldest::selectCasCommand([[maybe_unused]] const ReadyCommands& readyCommands,
+                               ReadyCommands::const_iterator oldestCas)
+{
+    return oldestCas;
+}
+
 CmdMuxOldestRasCas::CmdMuxOldestRasCas(const MemSpec& memSpec) : memSpec(memSpec)
 {
     readyRasCommands.reserve(memSpec.banksPerChannel);
@@ -153,6 +163,11 @@ std::optional<CommandTuple::Type> CmdMuxOldestRasCas::selectCommand(const ReadyC
         }
     }
 
+    if (resultCas != readyCasCommands.cend() &&
+        std::get<CommandTuple::Command>(*resultCas).isCasCommand() &&
+        std::get<CommandTuple::Timestamp>(*resultCas) == sc_time_stamp())
+        resultCas = selectCasCommand(readyCasCommands, resultCas);
+
     readyRasCasCommands.clear();
 
     if (resultRas != readyRasCommands.cend())
@@ -190,4 +205,11 @@ std::optional<CommandTuple::Type> CmdMuxOldestRasCas::selectCommand(const ReadyC
     return *result;
 }
 
+ReadyCommands::const_iterator
+CmdMuxOldestRasCas::selectCasCommand([[maybe_unused]] const ReadyCommands& readyCommands,
+                                     ReadyCommands::const_iterator oldestCas)
+{
+    return oldestCas;
+}
+
 } // namespace DRAMSys
@@ -47,6 +47,12 @@ public:
     explicit CmdMuxOldest(const MemSpec& memSpec);
     std::optional<CommandTuple::Type> selectCommand(const ReadyCommands& readyCommands) override;
 
+protected:
+    // Called if the oldest command is a CAS command that can be issued now, returns the CAS
+    // command of readyCommands that is issued instead
+    virtual ReadyCommands::const_iterator selectCasCommand(const ReadyCommands& readyCommands,
+                                                           ReadyCommands::const_iterator oldestCas);
+
 private:
     const MemSpec& memSpec;
     const sc_core::sc_time scMaxTime = sc_core::sc_max_time();
@@ -58,6 +64,12 @@ public:
     explicit CmdMuxOldestRasCas(const MemSpec& memSpec);
     std::optional<CommandTuple::Type> selectCommand(const ReadyCommands& readyCommands) override;
 
+protected:
+    // Called if the oldest command is a CAS command that can be issued now, returns the CAS
+    // command of readyCommands that is issued instead
+    virtual ReadyCommands::const_iterator selectCasCommand(const ReadyCommands& readyCommands,
+                                                           ReadyCommands::const_iterator oldestCas);
+
 private:
     const MemSpec& memSpec;
     ReadyCommands readyRasCommands;
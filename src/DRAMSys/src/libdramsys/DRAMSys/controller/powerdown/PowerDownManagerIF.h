@@ -49,6 +49,7 @@ public:
     virtual void triggerEntry() = 0;
     virtual void triggerExit() = 0;
     virtual void triggerInterruption() = 0;
+    virtual sc_core::sc_time getTimeForNextTrigger() { return sc_core::sc_max_time(); }
 };
 
 } // namespace DRAMSys
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "PowerDownManagerPredictive.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace sc_core;
+
+namespace DRAMSys
+{
+
+namespace
+{
+
+std::size_t getBin(uint64_t cycles)
+{
+    std::size_t bin = 0;
+    while (cycles != 0)
+    {
+        bin++;
+        cycles >>= 1;
+    }
+    return bin;
+}
+
+// Smallest length in cycles that falls into the bin
+uint64_t getLowerBound(std::size_t bin)
+{
+    return bin == 0 ? 0 : uint64_t(1) << (bin - 1);
+}
+
+} // namespace
+
+PowerDownManagerPredictive::PowerDownManagerPredictive(
+    const McConfig& config,
+    const MemSpec& memSpec,
+    ControllerVector<Bank, BankMachine*>& bankMachinesOnRank,
+    Rank rank) :
+    PowerDownManagerTimeout(config, memSpec, bankMachinesOnRank, rank),
+    activePowerDownBreakEven(memSpec.getBreakEvenActivePowerDown()),
+    prechargePowerDownBreakEven(memSpec.getBreakEvenPrechargePowerDown()),
+    selfRefreshBreakEven(memSpec.getBreakEvenSelfRefresh())
+{
+    if (rank != Rank(0))
+        return;
+
+    if (activePowerDownBreakEven == sc_max_time())
+        SC_REPORT_WARNING("PowerDownManagerPredictive",
+                          "Active power-down draws at least the standby power and is not used");
+    if (prechargePowerDownBreakEven == sc_max_time())
+        SC_REPORT_WARNING("PowerDownManagerPredictive",
+                          "Precharge power-down draws at least the standby power and is not used");
+    if (selfRefreshBreakEven == sc_max_time())
+        SC_REPORT_WARNING("PowerDownManagerPredictive",
+                          "Self-refresh draws at least the standby power and is not used");
+}
+
+void PowerDownManagerPredictive::triggerExit()
+{
+    if (controllerIdle)
+    {
+        auto cycles = static_cast<uint64_t>(std::round((sc_time_stamp() - idleStart) / tCK));
+        histogram[std::min(getBin(cycles), NUMBER_OF_BINS - 1)]++;
+
+        if (++numberOfIntervals == AGING_THRESHOLD)
+        {
+            numberOfIntervals = 0;
+            for (auto& count : histogram)
+            {
+                count /= 2;
+                numberOfIntervals += count;
+            }
+        }
+    }
+
+    PowerDownManagerTimeout::triggerExit();
+}
+
+sc_time PowerDownManagerPredictive::getPowerDownEntryTime() const
+{
+    return getEntryTime(allBanksPrecharged() ? prechargePowerDownBreakEven
+                                             : activePowerDownBreakEven);
+}
+
+sc_time PowerDownManagerPredictive::getSelfRefreshEntryTime() const
+{
+    return getEntryTime(selfRefreshBreakEven);
+}
+
+sc_time PowerDownManagerPredictive::getEntryTime(const sc_time& breakEven) const
+{
+    if (breakEven == sc_max_time())
+        return sc_max_time();
+
+    // Without any history the break-even time is used as timeout
+    if (numberOfIntervals == 0)
+        return idleStart + breakEven;
+
+    auto breakEvenCycles = static_cast<uint64_t>(std::round(breakEven / tCK));
+
+    std::array<uint64_t, NUMBER_OF_BINS + 1> longerIntervals{};
+    for (std::size_t bin = NUMBER_OF_BINS; bin > 0; bin--)
+        longerIntervals[bin - 1] = longerIntervals[bin] + histogram[bin - 1];
+
+    // The decision is taken at the start of the idle period and reevaluated whenever the idle
+    // time reaches the next bin. The idle period is predicted to last for the median length of
+    // all recorded intervals that are at least as long as the current idle time.
+    for (std::size_t bin = 0; bin < NUMBER_OF_BINS; bin++)
+    {
+        uint64_t idleCycles = getLowerBound(bin);
+
+        // The idle period already exceeds all recorded ones, use the break-even time as timeout
+        if (longerIntervals[bin] == 0)
+            return idleStart + static_cast<double>(std::max(idleCycles, breakEvenCycles)) * tCK;
+
+        std::size_t medianBin = bin;
+        uint64_t count = histogram[bin];
+        while (2 * count < longerIntervals[bin])
+            count += histogram[++medianBin];
+
+        uint64_t predictedCycles = (getLowerBound(medianBin) + getLowerBound(medianBin + 1)) / 2;
+        if (predictedCycles >= idleCycles + breakEvenCycles)
+            return idleStart + static_cast<double>(idleCycles) * tCK;
+    }
+
+    return sc_max_time();
+}
+
+} // namespace DRAMSys
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef POWERDOWNMANAGERPREDICTIVE_H
+#define POWERDOWNMANAGERPREDICTIVE_H
+
+#include "DRAMSys/controller/powerdown/PowerDownManagerTimeout.h"
+
+#include <array>
+#include <cstdint>
+
+namespace DRAMSys
+{
+
+/**
+ * Learns the distribution of idle interval lengths of the rank and enters power-down or
+ * self-refresh only while the predicted remaining idle time exceeds the break-even time of the
+ * state, which the memspec derives from the exit latency and the standby and low-power currents.
+ */
+class PowerDownManagerPredictive final : public PowerDownManagerTimeout
+{
+public:
+    PowerDownManagerPredictive(const McConfig& config,
+                               const MemSpec& memSpec,
+                               ControllerVector<Bank, BankMachine*>& bankMachinesOnRank,
+                               Rank rank);
+
+    void triggerExit() override;
+
+private:
+    [[nodiscard]] sc_core::sc_time getPowerDownEntryTime() const override;
+    [[nodiscard]] sc_core::sc_time getSelfRefreshEntryTime() const override;
+    [[nodiscard]] sc_core::sc_time getEntryTime(const sc_core::sc_time& breakEven) const;
+
+    const sc_core::sc_time activePowerDownBreakEven;
+    const sc_core::sc_time prechargePowerDownBreakEven;
+    const sc_core::sc_time selfRefreshBreakEven;
+
+    // Bin i counts the idle intervals whose length in cycles has a bit width of i
+    static constexpr std::size_t NUMBER_OF_BINS = 48;
+    // The counts are halved when this many intervals were recorded, so old behaviour fades out
+    static constexpr uint64_t AGING_THRESHOLD = 1024;
+
+    std::array<uint64_t, NUMBER_OF_BINS> histogram{};
+    uint64_t numberOfIntervals = 0;
+};
+
+} // namespace DRAMSys
+
+#endif // POWERDOWNMANAGERPREDICTIVE_H
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "PowerDownManagerTimeout.h"
+
+#include "DRAMSys/controller/BankMachine.h"
+
+using namespace sc_core;
+using namespace tlm;
+
+namespace DRAMSys
+{
+
+PowerDownManagerTimeout::PowerDownManagerTimeout(
+    const McConfig& config,
+    const MemSpec& memSpec,
+    ControllerVector<Bank, BankMachine*>& bankMachinesOnRank,
+    Rank rank) :
+    tCK(memSpec.tCK),
+    bankMachinesOnRank(bankMachinesOnRank),
+    powerDownTimeout(config.powerDownTimeout),
+    selfRefreshTimeout(config.selfRefreshTimeout),
+    powerDownEntryTime(config.powerDownTimeout),
+    selfRefreshEntryTime(config.selfRefreshTimeout)
+{
+    setUpDummy(powerDownPayload, UINT64_MAX - 1, rank);
+}
+
+void PowerDownManagerTimeout::triggerEntry()
+{
+    if (controllerIdle)
+        return;
+
+    controllerIdle = true;
+    idleStart = sc_time_stamp();
+    powerDownEntryTime = getPowerDownEntryTime();
+    selfRefreshEntryTime = getSelfRefreshEntryTime();
+}
+
+void PowerDownManagerTimeout::triggerExit()
+{
+    controllerIdle = false;
+
+    if (state != State::Idle)
+        exitTriggered = true;
+}
+
+void PowerDownManagerTimeout::triggerInterruption()
+{
+    // Only valid for the next evaluation, the refresh managers are evaluated before
+    interrupted = true;
+
+    if (state != State::Idle)
+        exitTriggered = true;
+}
+
+sc_time PowerDownManagerTimeout::getTimeForNextTrigger()
+{
+    if (!controllerIdle || exitTriggered)
+        return scMaxTime;
+
+    if (state == State::Idle)
+        return std::min(powerDownEntryTime, selfRefreshEntryTime);
+
+    if (state == State::PrechargePdn)
+        return selfRefreshEntryTime;
+
+    return scMaxTime;
+}
+
+CommandTuple::Type PowerDownManagerTimeout::getNextCommand()
+{
+    return {nextCommand, &powerDownPayload, SC_ZERO_TIME};
+}
+
+void PowerDownManagerTimeout::evaluate()
+{
+    nextCommand = Command::NOP;
+    bool refreshDue = interrupted;
+    interrupted = false;
+
+    if (exitTriggered)
+    {
+        if (state == State::ActivePdn)
+            nextCommand = Command::PDXA;
+        else if (state == State::PrechargePdn)
+            nextCommand = Command::PDXP;
+        else if (state == State::SelfRefresh)
+            nextCommand = Command::SREFEX;
+        else if (state == State::ExtraRefresh)
+            nextCommand = Command::REFAB;
+        return;
+    }
+
+    if (!controllerIdle || refreshDue)
+        return;
+
+    sc_time now = sc_time_stamp();
+    if (state == State::Idle)
+    {
+        bool precharged = allBanksPrecharged();
+        if (precharged && now >= selfRefreshEntryTime)
+            nextCommand = Command::SREFEN;
+        else if (now >= powerDownEntryTime)
+            nextCommand = precharged ? Command::PDEP : Command::PDEA;
+    }
+    else if (state == State::PrechargePdn && now >= selfRefreshEntryTime)
+    {
+        // Self-refresh is entered via the idle state
+        nextCommand = Command::PDXP;
+    }
+}
+
+void PowerDownManagerTimeout::update(Command command)
+{
+    switch (command)
+    {
+    case Command::PDEA:
+        state = State::ActivePdn;
+        break;
+    case Command::PDEP:
+        state = State::PrechargePdn;
+        break;
+    case Command::SREFEN:
+        state = State::SelfRefresh;
+        break;
+    case Command::PDXA:
+    case Command::PDXP:
+        state = State::Idle;
+        exitTriggered = false;
+        break;
+    case Command::SREFEX:
+        state = State::ExtraRefresh;
+        break;
+    case Command::REFAB:
+        if (state == State::ExtraRefresh)
+        {
+            state = State::Idle;
+            exitTriggered = false;
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+sc_time PowerDownManagerTimeout::getPowerDownEntryTime() const
+{
+    return idleStart + powerDownTimeout;
+}
+
+sc_time PowerDownManagerTimeout::getSelfRefreshEntryTime() const
+{
+    return idleStart + selfRefreshTimeout;
+}
+
+bool PowerDownManagerTimeout::allBanksPrecharged() const
+{
+    for (const auto* it : bankMachinesOnRank)
+    {
+        if (!it->isPrecharged())
+            return false;
+    }
+    return true;
+}
+
+} // namespace DRAMSys
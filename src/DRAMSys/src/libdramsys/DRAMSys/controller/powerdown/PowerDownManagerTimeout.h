@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef POWERDOWNMANAGERTIMEOUT_H
+#define POWERDOWNMANAGERTIMEOUT_H
+
+#include "DRAMSys/common/dramExtensions.h"
+#include "DRAMSys/controller/McConfig.h"
+#include "DRAMSys/controller/powerdown/PowerDownManagerIF.h"
+
+#include <systemc>
+
+namespace DRAMSys
+{
+
+class BankMachine;
+
+/**
+ * Enters power-down once the rank has been idle for PowerDownTimeout and self-refresh once it
+ * has been idle for SelfRefreshTimeout. Derived policies decide about the entry times per idle
+ * period.
+ */
+class PowerDownManagerTimeout : public PowerDownManagerIF
+{
+public:
+    PowerDownManagerTimeout(const McConfig& config,
+                            const MemSpec& memSpec,
+                            ControllerVector<Bank, BankMachine*>& bankMachinesOnRank,
+                            Rank rank);
+
+    void triggerEntry() override;
+    void triggerExit() override;
+    void triggerInterruption() override;
+    sc_core::sc_time getTimeForNextTrigger() override;
+
+    CommandTuple::Type getNextCommand() override;
+    void update(Command command) override;
+    void evaluate() override;
+
+protected:
+    // Times at which the current idle period enters power-down and self-refresh
+    [[nodiscard]] virtual sc_core::sc_time getPowerDownEntryTime() const;
+    [[nodiscard]] virtual sc_core::sc_time getSelfRefreshEntryTime() const;
+
+    [[nodiscard]] bool allBanksPrecharged() const;
+
+    const sc_core::sc_time tCK;
+    sc_core::sc_time idleStart = sc_core::SC_ZERO_TIME;
+    bool controllerIdle = true;
+
+private:
+
+    enum class State
+    {
+        Idle,
+        ActivePdn,
+        PrechargePdn,
+        SelfRefresh,
+        ExtraRefresh
+    } state = State::Idle;
+    tlm::tlm_generic_payload powerDownPayload;
+    ControllerVector<Bank, BankMachine*>& bankMachinesOnRank;
+    Command nextCommand = Command::NOP;
+
+    const sc_core::sc_time powerDownTimeout;
+    const sc_core::sc_time selfRefreshTimeout;
+    sc_core::sc_time powerDownEntryTime = sc_core::SC_ZERO_TIME;
+    sc_core::sc_time selfRefreshEntryTime = sc_core::SC_ZERO_TIME;
+
+    bool exitTriggered = false;
+    bool interrupted = false;
+
+    const sc_core::sc_time scMaxTime = sc_core::sc_max_time();
+};
+
+} // namespace DRAMSys
+
+#endif // POWERDOWNMANAGERTIMEOUT_H
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "ElasticRefresh.h"
+
+#include "DRAMSys/controller/BankMachine.h"
+
+#include <cmath>
+
+using namespace sc_core;
+
+namespace DRAMSys
+{
+
+ElasticRefresh::ElasticRefresh(const McConfig& config,
+                               const MemSpec& memSpec,
+                               const ControllerVector<Bank, BankMachine*>& bankMachinesOnRank,
+                               int maxPostponed,
+                               int maxPulledin) :
+    enabled(config.refreshFlexibility == Config::RefreshFlexibilityType::Elastic),
+    memSpec(memSpec),
+    bankMachinesOnRank(bankMachinesOnRank),
+    threshold(config.elasticRefreshThreshold),
+    idleDelay(config.elasticRefreshIdleDelay * memSpec.tCK),
+    maxPostponed(maxPostponed),
+    maxPulledin(maxPulledin)
+{
+}
+
+void ElasticRefresh::setQueuedRequests(unsigned requests)
+{
+    if (requests == 0 && queuedRequests != 0)
+        idleSince = sc_time_stamp();
+
+    queuedRequests = requests;
+}
+
+bool ElasticRefresh::isDemandLow() const
+{
+    if (!enabled || queuedRequests >= threshold)
+        return false;
+
+    for (const auto* bankMachine : bankMachinesOnRank)
+    {
+        if (bankMachine->hasFurtherRowHit())
+            return false;
+    }
+
+    return true;
+}
+
+sc_time ElasticRefresh::getIdleRefreshTime(int flexibilityCounter) const
+{
+    if (!enabled || queuedRequests != 0 || flexibilityCounter <= maxPulledin)
+        return scMaxTime;
+
+    // The full delay applies when the pull-in budget is almost used up, no delay when the
+    // postpone budget is exhausted
+    double fraction = static_cast<double>(maxPostponed - flexibilityCounter) /
+                      static_cast<double>(maxPostponed - maxPulledin);
+    return idleSince + std::ceil(idleDelay * fraction / memSpec.tCK) * memSpec.tCK;
+}
+
+} // namespace DRAMSys
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef ELASTICREFRESH_H
+#define ELASTICREFRESH_H
+
+#include "DRAMSys/configuration/memspec/MemSpec.h"
+#include "DRAMSys/controller/McConfig.h"
+
+#include <systemc>
+
+namespace DRAMSys
+{
+
+class BankMachine;
+
+// Demand tracking for the elastic refresh flexibility of a rank. A due refresh is only postponed
+// while many requests are queued for the rank or a bank is serving a row with further hits.
+// Postponed refreshes are paid back and further refreshes are pulled in once the rank has been
+// idle for a delay that shrinks linearly with the number of postponed refreshes.
+class ElasticRefresh
+{
+public:
+    ElasticRefresh(const McConfig& config,
+                   const MemSpec& memSpec,
+                   const ControllerVector<Bank, BankMachine*>& bankMachinesOnRank,
+                   int maxPostponed,
+                   int maxPulledin);
+
+    void setQueuedRequests(unsigned requests);
+
+    [[nodiscard]] bool isEnabled() const { return enabled; }
+    [[nodiscard]] bool isDemandLow() const;
+    [[nodiscard]] sc_core::sc_time getIdleRefreshTime(int flexibilityCounter) const;
+
+private:
+    const bool enabled;
+    const MemSpec& memSpec;
+    const ControllerVector<Bank, BankMachine*>& bankMachinesOnRank;
+    const unsigned threshold;
+    const sc_core::sc_time idleDelay;
+    const int maxPostponed;
+    const int maxPulledin;
+
+    unsigned queuedRequests = 0;
+    sc_core::sc_time idleSince = sc_core::SC_ZERO_TIME;
+    const sc_core::sc_time scMaxTime = sc_core::sc_max_time();
+};
+
+} // namespace DRAMSys
+
+#endif // ELASTICREFRESH_H
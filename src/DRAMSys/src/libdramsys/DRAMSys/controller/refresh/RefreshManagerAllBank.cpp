@@ -55,8 +55,9 @@ RefreshManagerAllBank::RefreshManagerAllBank(
     memSpec(memSpec),
     bankMachinesOnRank(bankMachinesOnRank),
     powerDownManager(powerDownManager),
-    maxPostponed(static_cast<int>(config.refreshMaxPostponed)),
-    maxPulledin(-static_cast<int>(config.refreshMaxPulledin)),
+    maxPostponed(static_cast<int>(config.refreshMaxPostponed * config.refreshGranularity)),
+    maxPulledin(-static_cast<int>(config.refreshMaxPulledin * config.refreshGranularity)),
+    elasticRefresh(config, memSpec, bankMachinesOnRank, maxPostponed, maxPulledin),
     refreshManagement(config.refreshManagement)
 {
     timeForNextTrigger = getTimeForFirstTrigger(
@@ -89,10 +90,13 @@ void RefreshManagerAllBank::evaluate()
         if (state == State::Regular)
         {
             bool doRefresh = true;
-            if (flexibilityCounter == maxPostponed) // forced refresh
+            // forced refresh, elastic refreshes are also enforced while the demand is low
+            if (forcedRefresh || flexibilityCounter == maxPostponed ||
+                elasticRefresh.isDemandLow())
             {
                 for (auto* it : bankMachinesOnRank)
                     it->block();
+                forcedRefresh = true;
             }
             else
             {
@@ -140,6 +144,17 @@ void RefreshManagerAllBank::evaluate()
             }
         }
     }
+    else if (!sleeping &&
+             sc_time_stamp() >= elasticRefresh.getIdleRefreshTime(flexibilityCounter))
+    {
+        // Pay back a postponed refresh or pull in a refresh during an idle gap
+        if (activatedBanks > 0)
+            nextCommand = Command::PREAB;
+        else
+            nextCommand = Command::REFAB;
+
+        return;
+    }
 
     if (refreshManagement)
     {
@@ -199,6 +214,7 @@ void RefreshManagerAllBank::update(Command command)
         activatedBanks = 0;
         break;
     case Command::REFAB:
+        forcedRefresh = false;
         if (sleeping)
         {
             // Refresh command after SREFEX
@@ -206,6 +222,11 @@ void RefreshManagerAllBank::update(Command command)
             timeForNextTrigger = sc_time_stamp() + memSpec.getRefreshIntervalAB();
             sleeping = false;
         }
+        else if (elasticRefresh.isEnabled() && sc_time_stamp() < timeForNextTrigger)
+        {
+            // Refresh issued during an idle gap
+            flexibilityCounter--;
+        }
         else
         {
             if (state == State::Pulledin)
@@ -239,9 +260,18 @@ void RefreshManagerAllBank::update(Command command)
 
 sc_time RefreshManagerAllBank::getTimeForNextTrigger()
 {
+    sc_time idleRefreshTime = elasticRefresh.getIdleRefreshTime(flexibilityCounter);
+    if (!sleeping && idleRefreshTime > sc_time_stamp())
+        return std::min(timeForNextTrigger, idleRefreshTime);
+
     return timeForNextTrigger;
 }
 
+void RefreshManagerAllBank::setQueuedRequests(unsigned requests)
+{
+    elasticRefresh.setQueuedRequests(requests);
+}
+
 void RefreshManagerAllBank::serialize(std::ostream& stream) const
 {
     stream.write(reinterpret_cast<char const*>(&timeForNextTrigger), sizeof(timeForNextTrigger));
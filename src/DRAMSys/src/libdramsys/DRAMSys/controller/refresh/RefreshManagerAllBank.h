@@ -39,6 +39,7 @@
 
 #include "DRAMSys/configuration/memspec/MemSpec.h"
 #include "DRAMSys/controller/McConfig.h"
+#include "DRAMSys/controller/refresh/ElasticRefresh.h"
 #include "DRAMSys/controller/refresh/RefreshManagerIF.h"
 
 #include <systemc>
@@ -63,6 +64,7 @@ public:
     void evaluate() override;
     void update(Command command) override;
     sc_core::sc_time getTimeForNextTrigger() override;
+    void setQueuedRequests(unsigned requests) override;
 
     void serialize(std::ostream& stream) const override;
     void deserialize(std::istream& stream) override;
@@ -81,10 +83,12 @@ private:
     Command nextCommand = Command::NOP;
 
     unsigned activatedBanks = 0;
+    bool forcedRefresh = false;
 
     int flexibilityCounter = 0;
     const int maxPostponed;
     const int maxPulledin;
+    ElasticRefresh elasticRefresh;
 
     bool sleeping = false;
     const bool refreshManagement;
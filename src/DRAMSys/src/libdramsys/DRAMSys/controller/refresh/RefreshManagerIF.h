@@ -52,6 +52,7 @@ class RefreshManagerIF : public ManagerIF, public Serialize, public Deserialize
 {
 public:
     virtual sc_core::sc_time getTimeForNextTrigger() = 0;
+    virtual void setQueuedRequests([[maybe_unused]] unsigned requests) {}
 
 protected:
     static sc_core::sc_time getTimeForFirstTrigger(const sc_core::sc_time& tCK,
@@ -39,6 +39,8 @@
 #include "DRAMSys/controller/BankMachine.h"
 #include "DRAMSys/controller/powerdown/PowerDownManagerIF.h"
 
+#include <limits>
+
 using namespace sc_core;
 using namespace tlm;
 
@@ -114,29 +116,7 @@ void RefreshManagerPer2Bank::evaluate()
             bool allBankPairsBusy = true;
 
             if (!skipSelection)
-            {
-                currentIterator = remainingBankMachines.begin();
-                for (auto bankIt = remainingBankMachines.begin();
-                     bankIt != remainingBankMachines.end();
-                     bankIt++)
-                {
-                    bool pairIsBusy = false;
-                    for (const auto* pairIt : *bankIt)
-                    {
-                        if (!pairIt->isIdle())
-                        {
-                            pairIsBusy = true;
-                            break;
-                        }
-                    }
-                    if (!pairIsBusy)
-                    {
-                        allBankPairsBusy = false;
-                        currentIterator = bankIt;
-                        break;
-                    }
-                }
-            }
+                allBankPairsBusy = !selectBankMachines();
 
             if (allBankPairsBusy && !forcedRefresh)
             {
@@ -168,30 +148,7 @@ void RefreshManagerPer2Bank::evaluate()
         }
 
         // if (state == RmState::Pulledin)
-        bool allBankPairsBusy = true;
-
-        currentIterator = remainingBankMachines.begin();
-        for (auto bankIt = remainingBankMachines.begin(); bankIt != remainingBankMachines.end();
-             bankIt++)
-        {
-            bool pairIsBusy = false;
-            for (const auto* pairIt : *bankIt)
-            {
-                if (!pairIt->isIdle())
-                {
-                    pairIsBusy = true;
-                    break;
-                }
-            }
-            if (!pairIsBusy)
-            {
-                allBankPairsBusy = false;
-                currentIterator = bankIt;
-                break;
-            }
-        }
-
-        if (allBankPairsBusy)
+        if (!selectBankMachines())
         {
             state = State::Regular;
             timeForNextTrigger += memSpec.getRefreshIntervalP2B();
@@ -213,6 +170,36 @@ void RefreshManagerPer2Bank::evaluate()
     }
 }
 
+bool RefreshManagerPer2Bank::selectBankMachines()
+{
+    // Pairs of idle banks are refreshed first, those with the fewest open rows before others.
+    // If all remaining pairs contain busy banks, the pair with the fewest busy banks and pending
+    // row hits is selected for a forced refresh.
+    bool pairIsIdle = false;
+    unsigned minCost = std::numeric_limits<unsigned>::max();
+
+    for (auto bankIt = remainingBankMachines.begin(); bankIt != remainingBankMachines.end();
+         bankIt++)
+    {
+        bool isIdle = true;
+        unsigned cost = 0;
+        for (const auto* pairIt : *bankIt)
+        {
+            isIdle = isIdle && pairIt->isIdle();
+            cost += pairIt->getRefreshCost();
+        }
+
+        if ((isIdle && !pairIsIdle) || (isIdle == pairIsIdle && cost < minCost))
+        {
+            currentIterator = bankIt;
+            pairIsIdle = isIdle;
+            minCost = cost;
+        }
+    }
+
+    return pairIsIdle;
+}
+
 void RefreshManagerPer2Bank::update(Command command)
 {
     switch (command)
@@ -71,6 +71,8 @@ public:
     void deserialize(std::istream& stream) override;
 
 private:
+    bool selectBankMachines();
+
     enum class State
     {
         Regular,
@@ -54,7 +54,8 @@ RefreshManagerPerBank::RefreshManagerPerBank(
     memSpec(memSpec),
     powerDownManager(powerDownManager),
     maxPostponed(static_cast<int>(config.refreshMaxPostponed * memSpec.banksPerRank)),
-    maxPulledin(-static_cast<int>(config.refreshMaxPulledin * memSpec.banksPerRank))
+    maxPulledin(-static_cast<int>(config.refreshMaxPulledin * memSpec.banksPerRank)),
+    elasticRefresh(config, memSpec, bankMachinesOnRank, maxPostponed, maxPulledin)
 {
     timeForNextTrigger = getTimeForFirstTrigger(
         memSpec.tCK, memSpec.getRefreshIntervalPB(), rank, memSpec.ranksPerChannel);
@@ -91,24 +92,12 @@ void RefreshManagerPerBank::evaluate()
 
         if (state == State::Regular)
         {
-            bool forcedRefresh = (flexibilityCounter == maxPostponed);
+            bool forcedRefresh = skipSelection || (flexibilityCounter == maxPostponed) ||
+                                 elasticRefresh.isDemandLow();
             bool allBanksBusy = true;
 
             if (!skipSelection)
-            {
-                currentIterator = remainingBankMachines.begin();
-
-                for (auto it = remainingBankMachines.begin(); it != remainingBankMachines.end();
-                     it++)
-                {
-                    if ((*it)->isIdle())
-                    {
-                        currentIterator = it;
-                        allBanksBusy = false;
-                        break;
-                    }
-                }
-            }
+                allBanksBusy = !selectBankMachine();
 
             if (allBanksBusy && !forcedRefresh)
             {
@@ -117,36 +106,22 @@ void RefreshManagerPerBank::evaluate()
                 return;
             }
 
-            // TODO: bank should already be blocked for precharge and selection should be skipped
+            // The bank is blocked before the precharge, otherwise it could be activated again
+            if (forcedRefresh)
+            {
+                (*currentIterator)->block();
+                skipSelection = true;
+            }
+
             if ((*currentIterator)->isActivated())
                 nextCommand = Command::PREPB;
             else
-            {
                 nextCommand = Command::REFPB;
-
-                if (forcedRefresh)
-                {
-                    (*currentIterator)->block();
-                    skipSelection = true;
-                }
-            }
             return;
         }
 
         // if (state == RmState::Pulledin)
-        bool allBanksBusy = true;
-
-        for (auto it = remainingBankMachines.begin(); it != remainingBankMachines.end(); it++)
-        {
-            if ((*it)->isIdle())
-            {
-                currentIterator = it;
-                allBanksBusy = false;
-                break;
-            }
-        }
-
-        if (allBanksBusy)
+        if (!selectBankMachine())
         {
             state = State::Regular;
             timeForNextTrigger += memSpec.getRefreshIntervalPB();
@@ -160,6 +135,37 @@ void RefreshManagerPerBank::evaluate()
 
         return;
     }
+
+    if (!sleeping && sc_time_stamp() >= elasticRefresh.getIdleRefreshTime(flexibilityCounter))
+    {
+        // Pay back a postponed refresh or pull in a refresh during an idle gap
+        selectBankMachine();
+        if ((*currentIterator)->isActivated())
+            nextCommand = Command::PREPB;
+        else
+            nextCommand = Command::REFPB;
+    }
+}
+
+bool RefreshManagerPerBank::selectBankMachine()
+{
+    // Idle banks are refreshed first, precharged ones before activated ones. If all remaining
+    // banks are busy, the one without pending row hits is selected for a forced refresh.
+    currentIterator = remainingBankMachines.begin();
+    unsigned minCost = (*currentIterator)->getRefreshCost();
+
+    for (auto it = std::next(currentIterator); it != remainingBankMachines.end() && minCost != 0;
+         it++)
+    {
+        unsigned cost = (*it)->getRefreshCost();
+        if (cost < minCost)
+        {
+            currentIterator = it;
+            minCost = cost;
+        }
+    }
+
+    return (*currentIterator)->isIdle();
 }
 
 void RefreshManagerPerBank::update(Command command)
@@ -173,6 +179,13 @@ void RefreshManagerPerBank::update(Command command)
             remainingBankMachines = allBankMachines;
         currentIterator = remainingBankMachines.begin();
 
+        if (elasticRefresh.isEnabled() && sc_time_stamp() < timeForNextTrigger)
+        {
+            // Refresh issued during an idle gap
+            flexibilityCounter--;
+            break;
+        }
+
         if (state == State::Pulledin)
             flexibilityCounter--;
         else
@@ -212,9 +225,18 @@ void RefreshManagerPerBank::update(Command command)
 
 sc_time RefreshManagerPerBank::getTimeForNextTrigger()
 {
+    sc_time idleRefreshTime = elasticRefresh.getIdleRefreshTime(flexibilityCounter);
+    if (!sleeping && idleRefreshTime > sc_time_stamp())
+        return std::min(timeForNextTrigger, idleRefreshTime);
+
     return timeForNextTrigger;
 }
 
+void RefreshManagerPerBank::setQueuedRequests(unsigned requests)
+{
+    elasticRefresh.setQueuedRequests(requests);
+}
+
 void RefreshManagerPerBank::serialize(std::ostream& stream) const
 {
     stream.write(reinterpret_cast<char const*>(&timeForNextTrigger), sizeof(timeForNextTrigger));
@@ -39,6 +39,8 @@
 #include "DRAMSys/controller/BankMachine.h"
 #include "DRAMSys/controller/powerdown/PowerDownManagerIF.h"
 
+#include <limits>
+
 using namespace sc_core;
 using namespace tlm;
 
@@ -55,6 +57,7 @@ RefreshManagerSameBank::RefreshManagerSameBank(
     powerDownManager(powerDownManager),
     maxPostponed(static_cast<int>(config.refreshMaxPostponed * memSpec.banksPerGroup)),
     maxPulledin(-static_cast<int>(config.refreshMaxPulledin * memSpec.banksPerGroup)),
+    elasticRefresh(config, memSpec, bankMachinesOnRank, maxPostponed, maxPulledin),
     refreshManagement(config.refreshManagement)
 {
     timeForNextTrigger = getTimeForFirstTrigger(
@@ -112,33 +115,12 @@ void RefreshManagerSameBank::evaluate()
 
         if (state == State::Regular)
         {
-            bool forcedRefresh = (flexibilityCounter == maxPostponed);
+            bool forcedRefresh = skipSelection || (flexibilityCounter == maxPostponed) ||
+                                 elasticRefresh.isDemandLow();
             bool allGroupsBusy = true;
 
             if (!skipSelection)
-            {
-                currentIterator = remainingBankMachines.begin();
-                for (auto bankIt = remainingBankMachines.begin();
-                     bankIt != remainingBankMachines.end();
-                     bankIt++)
-                {
-                    bool groupIsBusy = false;
-                    for (const auto* groupIt : *bankIt)
-                    {
-                        if (!groupIt->isIdle())
-                        {
-                            groupIsBusy = true;
-                            break;
-                        }
-                    }
-                    if (!groupIsBusy)
-                    {
-                        allGroupsBusy = false;
-                        currentIterator = bankIt;
-                        break;
-                    }
-                }
-            }
+                allGroupsBusy = !selectBankMachines();
 
             if (allGroupsBusy && !forcedRefresh)
             {
@@ -147,6 +129,15 @@ void RefreshManagerSameBank::evaluate()
             }
             else
             {
+                // The banks are blocked before the precharge, otherwise they could be activated
+                // again
+                if (forcedRefresh)
+                {
+                    for (auto* it : *currentIterator)
+                        it->block();
+                    skipSelection = true;
+                }
+
                 nextCommand = Command::REFSB;
                 for (const auto* it : *currentIterator)
                 {
@@ -156,44 +147,12 @@ void RefreshManagerSameBank::evaluate()
                         break;
                     }
                 }
-
-                // TODO: banks should already be blocked for precharge and selection should be
-                // skipped only check for forced refresh, also block for PRESB
-                if (nextCommand == Command::REFSB && forcedRefresh)
-                {
-                    for (auto* it : *currentIterator)
-                        it->block();
-                    skipSelection = true;
-                }
                 return;
             }
         }
         else // if (state == RmState::Pulledin)
         {
-            bool allGroupsBusy = true;
-
-            currentIterator = remainingBankMachines.begin();
-            for (auto bankIt = remainingBankMachines.begin(); bankIt != remainingBankMachines.end();
-                 bankIt++)
-            {
-                bool groupIsBusy = false;
-                for (const auto* groupIt : *bankIt)
-                {
-                    if (!groupIt->isIdle())
-                    {
-                        groupIsBusy = true;
-                        break;
-                    }
-                }
-                if (!groupIsBusy)
-                {
-                    allGroupsBusy = false;
-                    currentIterator = bankIt;
-                    break;
-                }
-            }
-
-            if (allGroupsBusy)
+            if (!selectBankMachines())
             {
                 state = State::Regular;
                 timeForNextTrigger += memSpec.getRefreshIntervalSB();
@@ -213,6 +172,22 @@ void RefreshManagerSameBank::evaluate()
             }
         }
     }
+    else if (!sleeping &&
+             sc_time_stamp() >= elasticRefresh.getIdleRefreshTime(flexibilityCounter))
+    {
+        // Pay back a postponed refresh or pull in a refresh during an idle gap
+        selectBankMachines();
+        nextCommand = Command::REFSB;
+        for (const auto* it : *currentIterator)
+        {
+            if (it->isActivated())
+            {
+                nextCommand = Command::PRESB;
+                break;
+            }
+        }
+        return;
+    }
 
     if (refreshManagement)
     {
@@ -286,6 +261,36 @@ void RefreshManagerSameBank::evaluate()
     }
 }
 
+bool RefreshManagerSameBank::selectBankMachines()
+{
+    // Groups of idle banks are refreshed first, those with the fewest open rows before others.
+    // If all remaining groups contain busy banks, the group with the fewest busy banks and
+    // pending row hits is selected for a forced refresh.
+    bool groupIsIdle = false;
+    unsigned minCost = std::numeric_limits<unsigned>::max();
+
+    for (auto bankIt = remainingBankMachines.begin(); bankIt != remainingBankMachines.end();
+         bankIt++)
+    {
+        bool isIdle = true;
+        unsigned cost = 0;
+        for (const auto* groupIt : *bankIt)
+        {
+            isIdle = isIdle && groupIt->isIdle();
+            cost += groupIt->getRefreshCost();
+        }
+
+        if ((isIdle && !groupIsIdle) || (isIdle == groupIsIdle && cost < minCost))
+        {
+            currentIterator = bankIt;
+            groupIsIdle = isIdle;
+            minCost = cost;
+        }
+    }
+
+    return groupIsIdle;
+}
+
 void RefreshManagerSameBank::update(Command command)
 {
     switch (command)
@@ -297,6 +302,13 @@ void RefreshManagerSameBank::update(Command command)
             remainingBankMachines = allBankMachines;
         currentIterator = remainingBankMachines.begin();
 
+        if (elasticRefresh.isEnabled() && sc_time_stamp() < timeForNextTrigger)
+        {
+            // Refresh issued during an idle gap
+            flexibilityCounter--;
+            break;
+        }
+
         if (state == State::Pulledin)
             flexibilityCounter--;
         else
@@ -336,9 +348,18 @@ void RefreshManagerSameBank::update(Command command)
 
 sc_time RefreshManagerSameBank::getTimeForNextTrigger()
 {
+    sc_time idleRefreshTime = elasticRefresh.getIdleRefreshTime(flexibilityCounter);
+    if (!sleeping && idleRefreshTime > sc_time_stamp())
+        return std::min(timeForNextTrigger, idleRefreshTime);
+
     return timeForNextTrigger;
 }
 
+void RefreshManagerSameBank::setQueuedRequests(unsigned requests)
+{
+    elasticRefresh.setQueuedRequests(requests);
+}
+
 void RefreshManagerSameBank::serialize(std::ostream& stream) const
 {
     stream.write(reinterpret_cast<char const*>(&timeForNextTrigger), sizeof(timeForNextTrigger));
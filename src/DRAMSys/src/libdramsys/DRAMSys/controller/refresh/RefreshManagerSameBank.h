@@ -39,6 +39,7 @@
 
 #include "DRAMSys/configuration/memspec/MemSpec.h"
 #include "DRAMSys/controller/McConfig.h"
+#include "DRAMSys/controller/refresh/ElasticRefresh.h"
 #include "DRAMSys/controller/refresh/RefreshManagerIF.h"
 
 #include <list>
@@ -65,11 +66,14 @@ public:
     void evaluate() override;
     void update(Command command) override;
     sc_core::sc_time getTimeForNextTrigger() override;
+    void setQueuedRequests(unsigned requests) override;
 
     void serialize(std::ostream& stream) const override;
     void deserialize(std::istream& stream) override;
 
 private:
+    bool selectBankMachines();
+
     enum class State
     {
         Regular,
@@ -88,6 +92,7 @@ private:
     int flexibilityCounter = 0;
     const int maxPostponed;
     const int maxPulledin;
+    ElasticRefresh elasticRefresh;
 
     bool sleeping = false;
     bool skipSelection = false;
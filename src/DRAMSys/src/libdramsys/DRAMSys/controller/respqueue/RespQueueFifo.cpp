@@ -40,19 +40,26 @@ using namespace tlm;
 namespace DRAMSys
 {
 
+RespQueueFifo::RespQueueFifo() : buffer(INITIAL_SIZE), indexMask(INITIAL_SIZE - 1) {}
+
 void RespQueueFifo::insertPayload(tlm_generic_payload* payload, sc_time strobeEnd)
 {
-    buffer.emplace(payload, strobeEnd);
+    if (size == buffer.size())
+        grow();
+
+    buffer[(head + size) & indexMask] = {payload, strobeEnd};
+    size++;
 }
 
 tlm_generic_payload* RespQueueFifo::nextPayload()
 {
-    if (!buffer.empty())
+    if (size != 0)
     {
-        std::pair<tlm_generic_payload*, sc_time> element = buffer.front();
+        std::pair<tlm_generic_payload*, sc_time>& element = buffer[head];
         if (element.second <= sc_time_stamp())
         {
-            buffer.pop();
+            head = (head + 1) & indexMask;
+            size--;
             return element.first;
         }
     }
@@ -61,13 +68,24 @@ tlm_generic_payload* RespQueueFifo::nextPayload()
 
 sc_time RespQueueFifo::getTriggerTime() const
 {
-    if (!buffer.empty())
+    if (size != 0)
     {
-        sc_time triggerTime = buffer.front().second;
+        sc_time triggerTime = buffer[head].second;
         if (triggerTime > sc_time_stamp())
             return triggerTime;
     }
     return scMaxTime;
 }
 
+void RespQueueFifo::grow()
+{
+    std::vector<std::pair<tlm_generic_payload*, sc_time>> newBuffer(buffer.size() * 2);
+    for (std::size_t i = 0; i < size; i++)
+        newBuffer[i] = buffer[(head + i) & indexMask];
+
+    buffer = std::move(newBuffer);
+    indexMask = buffer.size() - 1;
+    head = 0;
+}
+
 } // namespace DRAMSys
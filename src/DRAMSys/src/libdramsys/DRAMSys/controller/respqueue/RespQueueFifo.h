@@ -37,23 +37,32 @@
 
 #include "DRAMSys/controller/respqueue/RespQueueIF.h"
 
-#include <queue>
 #include <systemc>
 #include <tlm>
 #include <utility>
+#include <vector>
 
 namespace DRAMSys
 {
 
+// Responses are stored in a ring that is only enlarged when it is full.
 class RespQueueFifo final : public RespQueueIF
 {
 public:
+    RespQueueFifo();
     void insertPayload(tlm::tlm_generic_payload* payload, sc_core::sc_time strobeEnd) override;
     tlm::tlm_generic_payload* nextPayload() override;
     [[nodiscard]] sc_core::sc_time getTriggerTime() const override;
 
 private:
-    std::queue<std::pair<tlm::tlm_generic_payload*, sc_core::sc_time>> buffer;
+    void grow();
+
+    static constexpr std::size_t INITIAL_SIZE = 64;
+
+    std::vector<std::pair<tlm::tlm_generic_payload*, sc_core::sc_time>> buffer;
+    std::size_t indexMask;
+    std::size_t head = 0;
+    std::size_t size = 0;
     const sc_core::sc_time scMaxTime = sc_core::sc_max_time();
 };
 
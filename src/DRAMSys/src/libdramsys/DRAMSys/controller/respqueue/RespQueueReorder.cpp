@@ -36,46 +36,94 @@
 
 #include "DRAMSys/common/dramExtensions.h"
 
+#include <algorithm>
+#include <cassert>
+
 using namespace sc_core;
 using namespace tlm;
 
 namespace DRAMSys
 {
 
+RespQueueReorder::RespQueueReorder() : buffer(INITIAL_SIZE), indexMask(INITIAL_SIZE - 1) {}
+
 void RespQueueReorder::insertPayload(tlm_generic_payload* payload, sc_time strobeEnd)
 {
-    buffer[ControllerExtension::getChannelPayloadID(*payload)] = {payload, strobeEnd};
+    uint64_t payloadID = ControllerExtension::getChannelPayloadID(*payload);
+    while (buffer[payloadID & indexMask].remaining != 0 &&
+           buffer[payloadID & indexMask].payloadID != payloadID)
+        grow();
+
+    Slot& slot = buffer[payloadID & indexMask];
+
+    if (slot.remaining == 0)
+    {
+        slot.payloadID = payloadID;
+        slot.remaining = 1;
+        if (ChildExtension::isChildTrans(*payload))
+        {
+            tlm_generic_payload& parentTrans = ChildExtension::getParentTrans(*payload);
+            slot.remaining = static_cast<unsigned>(
+                parentTrans.get_extension<ParentExtension>()->getChildTranses().size());
+        }
+    }
+    slot.responses.emplace_back(payload, strobeEnd);
 }
 
 tlm_generic_payload* RespQueueReorder::nextPayload()
 {
-    if (!buffer.empty())
+    Slot& slot = buffer[nextPayloadID & indexMask];
+    if (slot.remaining == 0 || slot.payloadID != nextPayloadID)
+        return nullptr;
+
+    auto response = std::find_if(slot.responses.begin(),
+                                 slot.responses.end(),
+                                 [](const std::pair<tlm_generic_payload*, sc_time>& element)
+                                 { return element.second <= sc_time_stamp(); });
+    if (response == slot.responses.end())
+        return nullptr;
+
+    tlm_generic_payload* payload = response->first;
+    slot.responses.erase(response);
+    slot.remaining--;
+    if (slot.remaining == 0)
     {
-        if (buffer.begin()->first == nextPayloadID)
-        {
-            std::pair<tlm_generic_payload*, sc_time> element = buffer.begin()->second;
-            if (element.second <= sc_time_stamp())
-            {
-                buffer.erase(nextPayloadID++);
-                return element.first;
-            }
-        }
+        assert(slot.responses.empty());
+        nextPayloadID++;
     }
-    return nullptr;
+    return payload;
 }
 
 sc_time RespQueueReorder::getTriggerTime() const
 {
-    if (!buffer.empty())
+    const Slot& slot = buffer[nextPayloadID & indexMask];
+    if (slot.remaining == 0 || slot.payloadID != nextPayloadID || slot.responses.empty())
+        return scMaxTime;
+
+    sc_time triggerTime = std::min_element(slot.responses.cbegin(),
+                                           slot.responses.cend(),
+                                           [](const auto& lhs, const auto& rhs)
+                                           { return lhs.second < rhs.second; })
+                              ->second;
+    if (triggerTime > sc_time_stamp())
+        return triggerTime;
+
+    return scMaxTime;
+}
+
+void RespQueueReorder::grow()
+{
+    std::vector<Slot> newBuffer(buffer.size() * 2);
+    uint64_t newIndexMask = newBuffer.size() - 1;
+
+    for (auto& slot : buffer)
     {
-        if (buffer.begin()->first == nextPayloadID)
-        {
-            sc_time triggerTime = buffer.begin()->second.second;
-            if (triggerTime > sc_time_stamp())
-                return triggerTime;
-        }
+        if (slot.remaining != 0)
+            newBuffer[slot.payloadID & newIndexMask] = std::move(slot);
     }
-    return scMaxTime;
+
+    buffer = std::move(newBuffer);
+    indexMask = newIndexMask;
 }
 
 } // namespace DRAMSys
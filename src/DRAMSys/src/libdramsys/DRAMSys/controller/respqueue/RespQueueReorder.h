@@ -37,23 +37,42 @@
 
 #include "DRAMSys/controller/respqueue/RespQueueIF.h"
 
-#include <map>
+#include <cstdint>
 #include <systemc>
 #include <tlm>
+#include <utility>
+#include <vector>
 
 namespace DRAMSys
 {
 
+// Responses are stored in a ring indexed by their channel payload ID. The IDs of all payloads in
+// the controller lie within a small window, the ring is only enlarged if a new ID would wrap onto
+// an occupied slot. Child transactions share the ID of their parent and are collected in the same
+// slot, which is released when all children of the parent have been returned.
 class RespQueueReorder final : public RespQueueIF
 {
 public:
+    RespQueueReorder();
     void insertPayload(tlm::tlm_generic_payload* payload, sc_core::sc_time strobeEnd) override;
     tlm::tlm_generic_payload* nextPayload() override;
     [[nodiscard]] sc_core::sc_time getTriggerTime() const override;
 
 private:
+    struct Slot
+    {
+        uint64_t payloadID = 0;
+        unsigned remaining = 0;
+        std::vector<std::pair<tlm::tlm_generic_payload*, sc_core::sc_time>> responses;
+    };
+
+    void grow();
+
+    static constexpr std::size_t INITIAL_SIZE = 64;
+
     uint64_t nextPayloadID = 1;
-    std::map<uint64_t, std::pair<tlm::tlm_generic_payload*, sc_core::sc_time>> buffer;
+    std::vector<Slot> buffer;
+    uint64_t indexMask;
     const sc_core::sc_time scMaxTime = sc_core::sc_max_time();
 };
 
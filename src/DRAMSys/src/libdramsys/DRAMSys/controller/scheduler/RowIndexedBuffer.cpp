@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "RowIndexedBuffer.h"
+
+using namespace tlm;
+
+namespace DRAMSys
+{
+
+RowIndexedBuffer::RowIndexedBuffer() : rowSlots(16)
+{
+}
+
+void RowIndexedBuffer::push_back(tlm_generic_payload* payload)
+{
+    Index index;
+    if (freeEntries.empty())
+    {
+        index = static_cast<Index>(entries.size());
+        entries.emplace_back();
+    }
+    else
+    {
+        index = freeEntries.back();
+        freeEntries.pop_back();
+    }
+
+    Entry& entry = entries[index];
+    entry.payload = payload;
+    entry.row = ControllerExtension::getRow(*payload);
+
+    entry.prev = tail;
+    entry.next = NONE;
+    if (tail != NONE)
+        entries[tail].next = index;
+    else
+        head = index;
+    tail = index;
+    numEntries++;
+
+    if (2 * (numRows + 1) > rowSlots.size())
+        growRowTable();
+
+    RowSlot& slot = rowSlots[findSlot(entry.row)];
+    entry.prevInRow = slot.tail;
+    entry.nextInRow = NONE;
+    if (slot.count == 0)
+    {
+        slot.row = entry.row;
+        slot.head = index;
+        numRows++;
+    }
+    else
+        entries[slot.tail].nextInRow = index;
+    slot.tail = index;
+    slot.count++;
+}
+
+void RowIndexedBuffer::remove(tlm_generic_payload* payload)
+{
+    Row row = ControllerExtension::getRow(*payload);
+    std::size_t slotIndex = findSlot(row);
+    RowSlot& slot = rowSlots[slotIndex];
+
+    // The scheduled payload is the oldest row hit in most cases, so the walk usually ends at the
+    // head of the row FIFO.
+    Index index = slot.count == 0 ? NONE : slot.head;
+    while (index != NONE && entries[index].payload != payload)
+        index = entries[index].nextInRow;
+
+    if (index == NONE)
+        return;
+
+    Entry& entry = entries[index];
+
+    if (entry.prev != NONE)
+        entries[entry.prev].next = entry.next;
+    else
+        head = entry.next;
+    if (entry.next != NONE)
+        entries[entry.next].prev = entry.prev;
+    else
+        tail = entry.prev;
+
+    if (entry.prevInRow != NONE)
+        entries[entry.prevInRow].nextInRow = entry.nextInRow;
+    else
+        slot.head = entry.nextInRow;
+    if (entry.nextInRow != NONE)
+        entries[entry.nextInRow].prevInRow = entry.prevInRow;
+    else
+        slot.tail = entry.prevInRow;
+
+    entry = Entry();
+    freeEntries.push_back(index);
+    numEntries--;
+
+    slot.count--;
+    if (slot.count == 0)
+    {
+        eraseSlot(slotIndex);
+        numRows--;
+    }
+}
+
+tlm_generic_payload* RowIndexedBuffer::front() const
+{
+    return head != NONE ? entries[head].payload : nullptr;
+}
+
+tlm_generic_payload* RowIndexedBuffer::frontRowHit(Row row) const
+{
+    const RowSlot& slot = rowSlots[findSlot(row)];
+    return slot.count != 0 ? entries[slot.head].payload : nullptr;
+}
+
+unsigned RowIndexedBuffer::numRowHits(Row row) const
+{
+    return rowSlots[findSlot(row)].count;
+}
+
+RowIndexedBuffer::RowHitRange RowIndexedBuffer::rowHits(Row row) const
+{
+    const RowSlot& slot = rowSlots[findSlot(row)];
+    return {entries, slot.count != 0 ? slot.head : NONE};
+}
+
+std::size_t RowIndexedBuffer::homeSlot(Row row) const
+{
+    // Fibonacci hashing, rows of neighboring requests are often consecutive
+    uint64_t hash = static_cast<uint64_t>(row) * UINT64_C(0x9E3779B97F4A7C15);
+    return static_cast<std::size_t>(hash >> 32) & (rowSlots.size() - 1);
+}
+
+std::size_t RowIndexedBuffer::findSlot(Row row) const
+{
+    std::size_t mask = rowSlots.size() - 1;
+    std::size_t slot = homeSlot(row);
+    while (rowSlots[slot].count != 0 && rowSlots[slot].row != row)
+        slot = (slot + 1) & mask;
+    return slot;
+}
+
+void RowIndexedBuffer::eraseSlot(std::size_t slot)
+{
+    // Backward shift deletion keeps the probe sequences intact without tombstones
+    std::size_t mask = rowSlots.size() - 1;
+    std::size_t next = slot;
+    while (true)
+    {
+        next = (next + 1) & mask;
+        if (rowSlots[next].count == 0)
+            break;
+
+        std::size_t home = homeSlot(rowSlots[next].row);
+        bool homeBetween = slot <= next ? (slot < home && home <= next)
+                                        : (slot < home || home <= next);
+        if (homeBetween)
+            continue;
+
+        rowSlots[slot] = rowSlots[next];
+        slot = next;
+    }
+    rowSlots[slot] = RowSlot();
+}
+
+void RowIndexedBuffer::growRowTable()
+{
+    std::vector<RowSlot> oldSlots(rowSlots.size() * 2);
+    oldSlots.swap(rowSlots);
+    for (const auto& oldSlot : oldSlots)
+    {
+        if (oldSlot.count != 0)
+            rowSlots[findSlot(oldSlot.row)] = oldSlot;
+    }
+}
+
+} // namespace DRAMSys
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef ROWINDEXEDBUFFER_H
+#define ROWINDEXEDBUFFER_H
+
+#include "DRAMSys/common/dramExtensions.h"
+
+#include <cstdint>
+#include <iterator>
+#include <tlm>
+#include <vector>
+
+namespace DRAMSys
+{
+
+/*
+ * Request buffer of a single bank that keeps the arrival order of all payloads and, in addition,
+ * a FIFO of payloads per row. The row FIFOs are reached through a small open-addressing table,
+ * so that the oldest row hit and the number of row hits can be found without scanning the
+ * buffer. All entries live in a pool and are linked by index, no allocation happens once the
+ * pool has reached the maximum buffer depth.
+ */
+class RowIndexedBuffer
+{
+    using Index = std::uint32_t;
+    static constexpr Index NONE = UINT32_MAX;
+
+    struct Entry
+    {
+        tlm::tlm_generic_payload* payload = nullptr;
+        Row row = Row(0);
+        Index prev = NONE;
+        Index next = NONE;
+        Index prevInRow = NONE;
+        Index nextInRow = NONE;
+    };
+
+    struct RowSlot
+    {
+        Row row = Row(0);
+        Index head = NONE;
+        Index tail = NONE;
+        unsigned count = 0; // zero marks an empty slot
+    };
+
+public:
+    class RowHitIterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = tlm::tlm_generic_payload*;
+        using difference_type = std::ptrdiff_t;
+        using pointer = value_type*;
+        using reference = value_type;
+
+        RowHitIterator(const std::vector<Entry>& entries, Index index) :
+            entries(&entries),
+            index(index)
+        {
+        }
+
+        reference operator*() const { return (*entries)[index].payload; }
+
+        RowHitIterator& operator++()
+        {
+            index = (*entries)[index].nextInRow;
+            return *this;
+        }
+
+        RowHitIterator operator++(int)
+        {
+            RowHitIterator previous = *this;
+            ++(*this);
+            return previous;
+        }
+
+        bool operator==(const RowHitIterator& other) const { return index == other.index; }
+        bool operator!=(const RowHitIterator& other) const { return index != other.index; }
+
+    private:
+        const std::vector<Entry>* entries;
+        Index index;
+    };
+
+    class RowHitRange
+    {
+    public:
+        RowHitRange(const std::vector<Entry>& entries, Index head) : entries(entries), head(head)
+        {
+        }
+
+        [[nodiscard]] RowHitIterator begin() const { return {entries, head}; }
+        [[nodiscard]] RowHitIterator end() const { return {entries, NONE}; }
+        [[nodiscard]] bool empty() const { return head == NONE; }
+
+    private:
+        const std::vector<Entry>& entries;
+        Index head;
+    };
+
+    RowIndexedBuffer();
+
+    void push_back(tlm::tlm_generic_payload* payload);
+    void remove(tlm::tlm_generic_payload* payload);
+
+    [[nodiscard]] bool empty() const { return numEntries == 0; }
+    [[nodiscard]] std::size_t size() const { return numEntries; }
+    [[nodiscard]] tlm::tlm_generic_payload* front() const;
+
+    // Oldest payload that targets the given row or nullptr
+    [[nodiscard]] tlm::tlm_generic_payload* frontRowHit(Row row) const;
+    [[nodiscard]] unsigned numRowHits(Row row) const;
+    // All payloads that target the given row in arrival order
+    [[nodiscard]] RowHitRange rowHits(Row row) const;
+
+private:
+    [[nodiscard]] std::size_t homeSlot(Row row) const;
+    [[nodiscard]] std::size_t findSlot(Row row) const;
+    void eraseSlot(std::size_t slot);
+    void growRowTable();
+
+    std::vector<Entry> entries;
+    std::vector<Index> freeEntries;
+    Index head = NONE;
+    Index tail = NONE;
+    std::size_t numEntries = 0;
+
+    std::vector<RowSlot> rowSlots;
+    std::size_t numRows = 0;
+};
+
+} // namespace DRAMSys
+
+#endif // ROWINDEXEDBUFFER_H
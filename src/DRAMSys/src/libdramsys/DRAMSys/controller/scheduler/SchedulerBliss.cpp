@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "SchedulerBliss.h"
+
+#include "DRAMSys/controller/scheduler/BufferCounterBankwise.h"
+#include "DRAMSys/controller/scheduler/BufferCounterReadWrite.h"
+#include "DRAMSys/controller/scheduler/BufferCounterShared.h"
+
+#include <algorithm>
+#include <cassert>
+
+using namespace sc_core;
+using namespace tlm;
+
+namespace DRAMSys
+{
+
+SchedulerBliss::SchedulerBliss(const McConfig& config, const MemSpec& memSpec) :
+    blacklistingThreshold(config.blacklistingThreshold),
+    clearingInterval(config.blacklistingClearingInterval),
+    nextClearingTime(config.blacklistingClearingInterval)
+{
+    buffer = ControllerVector<Bank, std::list<Request>>(memSpec.banksPerChannel);
+    lastServiceTime = ControllerVector<Bank, sc_time>(memSpec.banksPerChannel, SC_ZERO_TIME);
+
+    if (config.schedulerBuffer == Config::SchedulerBufferType::Bankwise)
+        bufferCounter = std::make_unique<BufferCounterBankwise>(config.requestBufferSize,
+                                                                memSpec.banksPerChannel);
+    else if (config.schedulerBuffer == Config::SchedulerBufferType::ReadWrite)
+        bufferCounter = std::make_unique<BufferCounterReadWrite>(config.requestBufferSizeRead,
+                                                                 config.requestBufferSizeWrite);
+    else if (config.schedulerBuffer == Config::SchedulerBufferType::Shared)
+        bufferCounter = std::make_unique<BufferCounterShared>(config.requestBufferSize);
+}
+
+bool SchedulerBliss::hasBufferSpace(unsigned entries) const
+{
+    return bufferCounter->hasBufferSpace(entries);
+}
+
+void SchedulerBliss::storeRequest(tlm_generic_payload& payload)
+{
+    clearBlacklistIfDue();
+
+    buffer[ControllerExtension::getBank(payload)].push_back(
+        {&payload, ThreadStatistics::getThread(payload), sc_time_stamp(), SC_ZERO_TIME});
+    bufferCounter->storeRequest(payload);
+}
+
+void SchedulerBliss::removeRequest(tlm_generic_payload& payload)
+{
+    bufferCounter->removeRequest(payload);
+
+    Bank bank = ControllerExtension::getBank(payload);
+    std::list<Request>& bankBuffer = buffer[bank];
+    sc_time now = sc_time_stamp();
+
+    auto served = std::find_if(bankBuffer.begin(),
+                               bankBuffer.end(),
+                               [&payload](const Request& request)
+                               { return request.payload == &payload; });
+    assert(served != bankBuffer.end());
+    Thread thread = served->thread;
+
+    // All waiting requests of other threads are delayed by the request served now
+    for (auto& request : bankBuffer)
+    {
+        if (request.thread != thread)
+            request.interference += now - std::max(lastServiceTime[bank], request.arrival);
+    }
+    lastServiceTime[bank] = now;
+
+    threadStatistics.requestServed(thread, now - served->arrival, served->interference);
+    bankBuffer.erase(served);
+
+    clearBlacklistIfDue();
+
+    if (thread == lastServedThread)
+    {
+        servedInRow++;
+    }
+    else
+    {
+        lastServedThread = thread;
+        servedInRow = 1;
+    }
+
+    if (servedInRow >= blacklistingThreshold)
+    {
+        auto threadID = static_cast<std::size_t>(thread);
+        if (threadID >= blacklist.size())
+            blacklist.resize(threadID + 1, false);
+        blacklist[threadID] = true;
+    }
+}
+
+tlm_generic_payload* SchedulerBliss::getNextRequest(const BankMachine& bankMachine) const
+{
+    const std::list<Request>& bankBuffer = buffer[bankMachine.getBank()];
+    if (bankBuffer.empty())
+        return nullptr;
+
+    // Priorities: not blacklisted, row hit, oldest
+    bool activated = bankMachine.isActivated();
+    Row openRow = bankMachine.getOpenRow();
+    tlm_generic_payload* nextRequest = nullptr;
+    unsigned nextPriority = 4;
+    for (const auto& request : bankBuffer)
+    {
+        unsigned priority = (isBlacklisted(request.thread) ? 2 : 0) +
+                            ((activated && ControllerExtension::getRow(*request.payload) == openRow)
+                                 ? 0
+                                 : 1);
+        if (priority < nextPriority)
+        {
+            nextRequest = request.payload;
+            nextPriority = priority;
+            if (priority == 0)
+                break;
+        }
+    }
+    return nextRequest;
+}
+
+bool SchedulerBliss::hasFurtherRowHit(Bank bank,
+                                      Row row,
+                                      [[maybe_unused]] tlm_command command) const
+{
+    unsigned rowHitCounter = 0;
+    for (const auto& request : buffer[bank])
+    {
+        if (ControllerExtension::getRow(*request.payload) == row)
+        {
+            rowHitCounter++;
+            if (rowHitCounter == 2)
+                return true;
+        }
+    }
+    return false;
+}
+
+bool SchedulerBliss::hasFurtherRequest(Bank bank, [[maybe_unused]] tlm_command command) const
+{
+    return (buffer[bank].size() >= 2);
+}
+
+const std::vector<unsigned>& SchedulerBliss::getBufferDepth() const
+{
+    return bufferCounter->getBufferDepth();
+}
+
+void SchedulerBliss::printStatistics(const std::string& name) const
+{
+    threadStatistics.print(name);
+}
+
+bool SchedulerBliss::isBlacklisted(Thread thread) const
+{
+    auto threadID = static_cast<std::size_t>(thread);
+    return threadID < blacklist.size() && blacklist[threadID];
+}
+
+void SchedulerBliss::clearBlacklistIfDue()
+{
+    if (sc_time_stamp() < nextClearingTime)
+        return;
+
+    std::fill(blacklist.begin(), blacklist.end(), false);
+    while (nextClearingTime <= sc_time_stamp())
+        nextClearingTime += clearingInterval;
+}
+
+} // namespace DRAMSys
@@ -45,7 +45,7 @@ namespace DRAMSys
 
 SchedulerFrFcfs::SchedulerFrFcfs(const McConfig& config, const MemSpec& memSpec)
 {
-    buffer = ControllerVector<Bank, std::list<tlm_generic_payload*>>(memSpec.banksPerChannel);
+    buffer = ControllerVector<Bank, RowIndexedBuffer>(memSpec.banksPerChannel);
 
     if (config.schedulerBuffer == Config::SchedulerBufferType::Bankwise)
         bufferCounter = std::make_unique<BufferCounterBankwise>(config.requestBufferSize,
@@ -71,15 +71,7 @@ void SchedulerFrFcfs::storeRequest(tlm_generic_payload& payload)
 void SchedulerFrFcfs::removeRequest(tlm_generic_payload& payload)
 {
     bufferCounter->removeRequest(payload);
-    Bank bank = ControllerExtension::getBank(payload);
-    for (auto it = buffer[bank].begin(); it != buffer[bank].end(); it++)
-    {
-        if (*it == &payload)
-        {
-            buffer[bank].erase(it);
-            break;
-        }
-    }
+    buffer[ControllerExtension::getBank(payload)].remove(&payload);
 }
 
 tlm_generic_payload* SchedulerFrFcfs::getNextRequest(const BankMachine& bankMachine) const
@@ -90,12 +82,9 @@ tlm_generic_payload* SchedulerFrFcfs::getNextRequest(const BankMachine& bankMach
         if (bankMachine.isActivated())
         {
             // Search for row hit
-            Row openRow = bankMachine.getOpenRow();
-            for (auto* it : buffer[bank])
-            {
-                if (ControllerExtension::getRow(*it) == openRow)
-                    return it;
-            }
+            tlm_generic_payload* rowHit = buffer[bank].frontRowHit(bankMachine.getOpenRow());
+            if (rowHit != nullptr)
+                return rowHit;
         }
         // No row hit found or bank precharged
         return buffer[bank].front();
@@ -107,17 +96,7 @@ bool SchedulerFrFcfs::hasFurtherRowHit(Bank bank,
                                        Row row,
                                        [[maybe_unused]] tlm_command command) const
 {
-    unsigned rowHitCounter = 0;
-    for (auto* it : buffer[bank])
-    {
-        if (ControllerExtension::getRow(*it) == row)
-        {
-            rowHitCounter++;
-            if (rowHitCounter == 2)
-                return true;
-        }
-    }
-    return false;
+    return buffer[bank].numRowHits(row) >= 2;
 }
 
 bool SchedulerFrFcfs::hasFurtherRequest(Bank bank, [[maybe_unused]] tlm_command command) const
@@ -45,7 +45,7 @@ namespace DRAMSys
 
 SchedulerFrFcfsGrp::SchedulerFrFcfsGrp(const McConfig& config, const MemSpec& memSpec)
 {
-    buffer = ControllerVector<Bank, std::list<tlm_generic_payload*>>(memSpec.banksPerChannel);
+    buffer = ControllerVector<Bank, RowIndexedBuffer>(memSpec.banksPerChannel);
 
     if (config.schedulerBuffer == Config::SchedulerBufferType::Bankwise)
         bufferCounter = std::make_unique<BufferCounterBankwise>(config.requestBufferSize,
@@ -72,15 +72,7 @@ void SchedulerFrFcfsGrp::removeRequest(tlm_generic_payload& trans)
 {
     bufferCounter->removeRequest(trans);
     lastCommand = trans.get_command();
-    Bank bank = ControllerExtension::getBank(trans);
-    for (auto it = buffer[bank].begin(); it != buffer[bank].end(); it++)
-    {
-        if (*it == &trans)
-        {
-            buffer[bank].erase(it);
-            break;
-        }
-    }
+    buffer[ControllerExtension::getBank(trans)].remove(&trans);
 }
 
 tlm_generic_payload* SchedulerFrFcfsGrp::getNextRequest(const BankMachine& bankMachine) const
@@ -91,13 +83,7 @@ tlm_generic_payload* SchedulerFrFcfsGrp::getNextRequest(const BankMachine& bankM
         if (bankMachine.isActivated())
         {
             // Filter all row hits
-            Row openRow = bankMachine.getOpenRow();
-            std::list<tlm_generic_payload*> rowHits;
-            for (auto* it : buffer[bank])
-            {
-                if (ControllerExtension::getRow(*it) == openRow)
-                    rowHits.push_back(it);
-            }
+            auto rowHits = buffer[bank].rowHits(bankMachine.getOpenRow());
 
             if (!rowHits.empty())
             {
@@ -132,17 +118,7 @@ bool SchedulerFrFcfsGrp::hasFurtherRowHit(Bank bank,
                                           Row row,
                                           [[maybe_unused]] tlm_command command) const
 {
-    unsigned rowHitCounter = 0;
-    for (auto* it : buffer[bank])
-    {
-        if (ControllerExtension::getRow(*it) == row)
-        {
-            rowHitCounter++;
-            if (rowHitCounter == 2)
-                return true;
-        }
-    }
-    return false;
+    return buffer[bank].numRowHits(row) >= 2;
 }
 
 bool SchedulerFrFcfsGrp::hasFurtherRequest(Bank bank, [[maybe_unused]] tlm_command command) const
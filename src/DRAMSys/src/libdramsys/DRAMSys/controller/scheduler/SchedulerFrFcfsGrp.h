@@ -38,9 +38,9 @@
 #include "DRAMSys/common/dramExtensions.h"
 #include "DRAMSys/controller/BankMachine.h"
 #include "DRAMSys/controller/scheduler/BufferCounterIF.h"
+#include "DRAMSys/controller/scheduler/RowIndexedBuffer.h"
 #include "DRAMSys/controller/scheduler/SchedulerIF.h"
 
-#include <list>
 #include <memory>
 #include <tlm>
 #include <vector>
@@ -63,7 +63,7 @@ public:
     [[nodiscard]] const std::vector<unsigned>& getBufferDepth() const override;
 
 private:
-    ControllerVector<Bank, std::list<tlm::tlm_generic_payload*>> buffer;
+    ControllerVector<Bank, RowIndexedBuffer> buffer;
     tlm::tlm_command lastCommand = tlm::TLM_READ_COMMAND;
     std::unique_ptr<BufferCounterIF> bufferCounter;
 };
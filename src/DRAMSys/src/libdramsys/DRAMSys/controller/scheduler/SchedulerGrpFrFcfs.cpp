@@ -45,8 +45,8 @@ namespace DRAMSys
 
 SchedulerGrpFrFcfs::SchedulerGrpFrFcfs(const McConfig& config, const MemSpec& memSpec)
 {
-    readBuffer = ControllerVector<Bank, std::list<tlm_generic_payload*>>(memSpec.banksPerChannel);
-    writeBuffer = ControllerVector<Bank, std::list<tlm_generic_payload*>>(memSpec.banksPerChannel);
+    readBuffer = ControllerVector<Bank, RowIndexedBuffer>(memSpec.banksPerChannel);
+    writeBuffer = ControllerVector<Bank, RowIndexedBuffer>(memSpec.banksPerChannel);
 
     if (config.schedulerBuffer == Config::SchedulerBufferType::Bankwise)
         bufferCounter = std::make_unique<BufferCounterBankwise>(config.requestBufferSize,
@@ -99,12 +99,10 @@ tlm_generic_payload* SchedulerGrpFrFcfs::getNextRequest(const BankMachine& bankM
             if (bankMachine.isActivated())
             {
                 // Search for read row hit
-                Row openRow = bankMachine.getOpenRow();
-                for (auto* it : readBuffer[bank])
-                {
-                    if (ControllerExtension::getRow(*it) == openRow)
-                        return it;
-                }
+                tlm_generic_payload* rowHit =
+                    readBuffer[bank].frontRowHit(bankMachine.getOpenRow());
+                if (rowHit != nullptr)
+                    return rowHit;
             }
             // No read row hit found or bank precharged
             return readBuffer[bank].front();
@@ -114,12 +112,10 @@ tlm_generic_payload* SchedulerGrpFrFcfs::getNextRequest(const BankMachine& bankM
             if (bankMachine.isActivated())
             {
                 // Search for write row hit
-                Row openRow = bankMachine.getOpenRow();
-                for (auto* it : writeBuffer[bank])
-                {
-                    if (ControllerExtension::getRow(*it) == openRow)
-                        return it;
-                }
+                tlm_generic_payload* rowHit =
+                    writeBuffer[bank].frontRowHit(bankMachine.getOpenRow());
+                if (rowHit != nullptr)
+                    return rowHit;
             }
             // No write row hit found or bank precharged
             return writeBuffer[bank].front();
@@ -132,12 +128,9 @@ tlm_generic_payload* SchedulerGrpFrFcfs::getNextRequest(const BankMachine& bankM
         if (bankMachine.isActivated())
         {
             // Search for write row hit
-            Row openRow = bankMachine.getOpenRow();
-            for (auto* it : writeBuffer[bank])
-            {
-                if (ControllerExtension::getRow(*it) == openRow)
-                    return it;
-            }
+            tlm_generic_payload* rowHit = writeBuffer[bank].frontRowHit(bankMachine.getOpenRow());
+            if (rowHit != nullptr)
+                return rowHit;
         }
         // No write row hit found or bank precharged
         return writeBuffer[bank].front();
@@ -147,12 +140,9 @@ tlm_generic_payload* SchedulerGrpFrFcfs::getNextRequest(const BankMachine& bankM
         if (bankMachine.isActivated())
         {
             // Search for read row hit
-            Row openRow = bankMachine.getOpenRow();
-            for (auto* it : readBuffer[bank])
-            {
-                if (ControllerExtension::getRow(*it) == openRow)
-                    return it;
-            }
+            tlm_generic_payload* rowHit = readBuffer[bank].frontRowHit(bankMachine.getOpenRow());
+            if (rowHit != nullptr)
+                return rowHit;
         }
         // No read row hit found or bank precharged
         return readBuffer[bank].front();
@@ -163,32 +153,12 @@ tlm_generic_payload* SchedulerGrpFrFcfs::getNextRequest(const BankMachine& bankM
 bool SchedulerGrpFrFcfs::hasFurtherRowHit(Bank bank, Row row, tlm_command command) const
 {
     // TODO: do this based on current RD/WR mode
-    unsigned rowHitCounter = 0;
     if (command == tlm::TLM_READ_COMMAND)
     {
-        for (auto* it : readBuffer[bank])
-        {
-            if (ControllerExtension::getRow(*it) == row)
-            {
-                rowHitCounter++;
-                if (rowHitCounter == 2)
-                    return true;
-            }
-        }
-        return false;
-    }
-
-    for (auto* it : writeBuffer[bank])
-    {
-        if (ControllerExtension::getRow(*it) == row)
-        {
-            rowHitCounter++;
-            if (rowHitCounter == 2)
-                return true;
-        }
+        return readBuffer[bank].numRowHits(row) >= 2;
     }
 
-    return false;
+    return writeBuffer[bank].numRowHits(row) >= 2;
 }
 
 bool SchedulerGrpFrFcfs::hasFurtherRequest(Bank bank, tlm_command command) const
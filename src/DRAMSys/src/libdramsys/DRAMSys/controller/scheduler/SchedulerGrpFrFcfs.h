@@ -38,9 +38,9 @@
 #include "DRAMSys/common/dramExtensions.h"
 #include "DRAMSys/controller/BankMachine.h"
 #include "DRAMSys/controller/scheduler/BufferCounterIF.h"
+#include "DRAMSys/controller/scheduler/RowIndexedBuffer.h"
 #include "DRAMSys/controller/scheduler/SchedulerIF.h"
 
-#include <list>
 #include <memory>
 #include <tlm>
 #include <vector>
@@ -63,8 +63,8 @@ public:
     [[nodiscard]] const std::vector<unsigned>& getBufferDepth() const override;
 
 private:
-    ControllerVector<Bank, std::list<tlm::tlm_generic_payload*>> readBuffer;
-    ControllerVector<Bank, std::list<tlm::tlm_generic_payload*>> writeBuffer;
+    ControllerVector<Bank, RowIndexedBuffer> readBuffer;
+    ControllerVector<Bank, RowIndexedBuffer> writeBuffer;
     tlm::tlm_command lastCommand = tlm::TLM_READ_COMMAND;
     std::unique_ptr<BufferCounterIF> bufferCounter;
 };
@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "SchedulerGrpFrFcfsAdaptiveWm.h"
+
+#include "DRAMSys/controller/scheduler/BufferCounterBankwise.h"
+#include "DRAMSys/controller/scheduler/BufferCounterReadWrite.h"
+#include "DRAMSys/controller/scheduler/BufferCounterShared.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+
+using namespace tlm;
+
+namespace DRAMSys
+{
+
+SchedulerGrpFrFcfsAdaptiveWm::SchedulerGrpFrFcfsAdaptiveWm(const McConfig& config,
+                                                           const MemSpec& memSpec) :
+    banksPerRank(memSpec.banksPerRank),
+    turnaroundStatistics(memSpec)
+{
+    readBuffer = ControllerVector<Bank, RowIndexedBuffer>(memSpec.banksPerChannel);
+    writeBuffer = ControllerVector<Bank, RowIndexedBuffer>(memSpec.banksPerChannel);
+    numWritesOnRank = ControllerVector<Rank, unsigned>(memSpec.ranksPerChannel, 0);
+
+    if (config.schedulerBuffer == Config::SchedulerBufferType::Bankwise)
+        bufferCounter = std::make_unique<BufferCounterBankwise>(config.requestBufferSize,
+                                                                memSpec.banksPerChannel);
+    else if (config.schedulerBuffer == Config::SchedulerBufferType::ReadWrite)
+        bufferCounter = std::make_unique<BufferCounterReadWrite>(config.requestBufferSizeRead,
+                                                                 config.requestBufferSizeWrite);
+    else if (config.schedulerBuffer == Config::SchedulerBufferType::Shared)
+        bufferCounter = std::make_unique<BufferCounterShared>(config.requestBufferSize);
+
+    SC_REPORT_WARNING("SchedulerGrpFrFcfsAdaptiveWm", "Hazard detection not yet implemented!");
+}
+
+bool SchedulerGrpFrFcfsAdaptiveWm::hasBufferSpace(unsigned entries) const
+{
+    return bufferCounter->hasBufferSpace(entries);
+}
+
+void SchedulerGrpFrFcfsAdaptiveWm::storeRequest(tlm_generic_payload& payload)
+{
+    if (payload.is_read())
+    {
+        readBuffer[ControllerExtension::getBank(payload)].push_back(&payload);
+    }
+    else
+    {
+        writeBuffer[ControllerExtension::getBank(payload)].push_back(&payload);
+        numWritesOnRank[ControllerExtension::getRank(payload)]++;
+    }
+    bufferCounter->storeRequest(payload);
+    evaluateWriteMode();
+}
+
+void SchedulerGrpFrFcfsAdaptiveWm::removeRequest(tlm_generic_payload& payload)
+{
+    bufferCounter->removeRequest(payload);
+    Bank bank = ControllerExtension::getBank(payload);
+
+    if (payload.is_read())
+    {
+        readBuffer[bank].remove(&payload);
+        readServedSinceDrain = true;
+    }
+    else
+    {
+        writeBuffer[bank].remove(&payload);
+        numWritesOnRank[ControllerExtension::getRank(payload)]--;
+        if (writeMode && drainBudget > 0)
+        {
+            drainBudget--;
+            numDrainedWrites++;
+        }
+    }
+
+    turnaroundStatistics.requestServed(payload,
+                                       bufferCounter->getNumReadRequests() +
+                                               bufferCounter->getNumWriteRequests() !=
+                                           0);
+    evaluateWriteMode();
+}
+
+tlm_generic_payload*
+SchedulerGrpFrFcfsAdaptiveWm::getNextRequest(const BankMachine& bankMachine) const
+{
+    Bank bank = bankMachine.getBank();
+
+    if (!writeMode)
+    {
+        if (!readBuffer[bank].empty())
+        {
+            if (bankMachine.isActivated())
+            {
+                // Search for read row hit
+                tlm_generic_payload* rowHit =
+                    readBuffer[bank].frontRowHit(bankMachine.getOpenRow());
+                if (rowHit != nullptr)
+                    return rowHit;
+            }
+            // No read row hit found or bank precharged
+            return readBuffer[bank].front();
+        }
+        return nullptr;
+    }
+
+    // Writes of other ranks wait for their own drain to avoid rank switches
+    if (!writeBuffer[bank].empty() &&
+        Rank(static_cast<std::size_t>(bank) / banksPerRank) == drainRank)
+    {
+        if (bankMachine.isActivated())
+        {
+            // Search for write row hit
+            tlm_generic_payload* rowHit = writeBuffer[bank].frontRowHit(bankMachine.getOpenRow());
+            if (rowHit != nullptr)
+                return rowHit;
+        }
+        // No row hit found or bank precharged
+        return writeBuffer[bank].front();
+    }
+
+    return nullptr;
+}
+
+bool SchedulerGrpFrFcfsAdaptiveWm::hasFurtherRowHit(Bank bank,
+                                                    Row row,
+                                                    [[maybe_unused]] tlm::tlm_command command) const
+{
+    if (!writeMode)
+    {
+        return readBuffer[bank].numRowHits(row) >= 2;
+    }
+
+    return writeBuffer[bank].numRowHits(row) >= 2;
+}
+
+bool SchedulerGrpFrFcfsAdaptiveWm::hasFurtherRequest(Bank bank,
+                                                     [[maybe_unused]] tlm::tlm_command command) const
+{
+    if (!writeMode)
+    {
+        return (readBuffer[bank].size() >= 2);
+    }
+
+    return (writeBuffer[bank].size() >= 2);
+}
+
+const std::vector<unsigned>& SchedulerGrpFrFcfsAdaptiveWm::getBufferDepth() const
+{
+    return bufferCounter->getBufferDepth();
+}
+
+void SchedulerGrpFrFcfsAdaptiveWm::printStatistics(const std::string& name) const
+{
+    double avgDrainSize =
+        numDrains != 0 ? static_cast<double>(numDrainedWrites) / static_cast<double>(numDrains)
+                       : 0.0;
+    std::cout << std::left << std::setw(24) << name << std::string("  Write drains:   ")
+              << numDrains << " | " << std::fixed << std::setprecision(2) << avgDrainSize
+              << " writes per drain" << std::endl;
+    turnaroundStatistics.print(name);
+}
+
+void SchedulerGrpFrFcfsAdaptiveWm::evaluateWriteMode()
+{
+    unsigned numReads = bufferCounter->getNumReadRequests();
+    unsigned numWrites = bufferCounter->getNumWriteRequests();
+
+    if (writeMode)
+    {
+        if (numWritesOnRank[drainRank] != 0 && drainBudget != 0)
+            return;
+
+        if (numReads == 0 && numWrites != 0)
+            startWriteDrain();
+        else
+            writeMode = false;
+    }
+    else if (numWrites != 0)
+    {
+        // At least one read is served between two drains so that reads cannot starve
+        if (numReads == 0 ||
+            (readServedSinceDrain && numWrites >= std::max(numReads, MIN_DRAIN_SIZE)))
+            startWriteDrain();
+    }
+}
+
+void SchedulerGrpFrFcfsAdaptiveWm::startWriteDrain()
+{
+    auto rankWithMostWrites = std::max_element(numWritesOnRank.begin(), numWritesOnRank.end());
+    drainRank = Rank(std::distance(numWritesOnRank.begin(), rankWithMostWrites));
+    unsigned writesOnRank = *rankWithMostWrites;
+
+    unsigned numReads = bufferCounter->getNumReadRequests();
+    if (numReads == 0)
+    {
+        drainBudget = writesOnRank;
+    }
+    else
+    {
+        // Bank-level parallelism of the writes on the selected rank
+        unsigned writeBanks = 0;
+        for (uint64_t bankID = static_cast<std::size_t>(drainRank) * banksPerRank;
+             bankID < (static_cast<std::size_t>(drainRank) + 1) * banksPerRank;
+             bankID++)
+        {
+            if (!writeBuffer[Bank(bankID)].empty())
+                writeBanks++;
+        }
+
+        // The more reads are waiting, the shorter the drain
+        unsigned numWrites = bufferCounter->getNumWriteRequests();
+        unsigned sharedDrain =
+            (writesOnRank * numWrites + numReads + numWrites - 1) / (numReads + numWrites);
+        drainBudget = std::min(writesOnRank, std::max(writeBanks, sharedDrain));
+    }
+
+    writeMode = true;
+    readServedSinceDrain = false;
+    numDrains++;
+}
+
+} // namespace DRAMSys
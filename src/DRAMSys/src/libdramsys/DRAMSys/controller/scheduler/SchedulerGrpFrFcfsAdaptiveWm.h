@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SCHEDULERGRPFRFCFSADAPTIVEWM_H
+#define SCHEDULERGRPFRFCFSADAPTIVEWM_H
+
+#include "DRAMSys/common/dramExtensions.h"
+#include "DRAMSys/controller/BankMachine.h"
+#include "DRAMSys/controller/scheduler/BufferCounterIF.h"
+#include "DRAMSys/controller/scheduler/RowIndexedBuffer.h"
+#include "DRAMSys/controller/scheduler/SchedulerIF.h"
+#include "DRAMSys/controller/scheduler/TurnaroundStatistics.h"
+
+#include <memory>
+#include <tlm>
+#include <vector>
+
+namespace DRAMSys
+{
+
+// "GrpFrFcfsWm" scheduler without fixed watermarks. A write drain starts when no reads are pending
+// or when the writes outnumber the reads. The drain is restricted to the rank with most pending
+// writes and its size is chosen from the share of pending reads, but covers at least all banks of
+// that rank with pending writes.
+class SchedulerGrpFrFcfsAdaptiveWm final : public SchedulerIF
+{
+public:
+    explicit SchedulerGrpFrFcfsAdaptiveWm(const McConfig& config, const MemSpec& memSpec);
+    [[nodiscard]] bool hasBufferSpace(unsigned entries) const override;
+    void storeRequest(tlm::tlm_generic_payload& payload) override;
+    void removeRequest(tlm::tlm_generic_payload& payload) override;
+    [[nodiscard]] tlm::tlm_generic_payload*
+    getNextRequest(const BankMachine& bankMachine) const override;
+    [[nodiscard]] bool
+    hasFurtherRowHit(Bank bank, Row row, tlm::tlm_command command) const override;
+    [[nodiscard]] bool hasFurtherRequest(Bank bank, tlm::tlm_command command) const override;
+    [[nodiscard]] const std::vector<unsigned>& getBufferDepth() const override;
+    void printStatistics(const std::string& name) const override;
+
+private:
+    void evaluateWriteMode();
+    void startWriteDrain();
+
+    // Smallest number of writes that justifies a turnaround while reads are pending
+    static constexpr unsigned MIN_DRAIN_SIZE = 4;
+
+    const uint64_t banksPerRank;
+    ControllerVector<Bank, RowIndexedBuffer> readBuffer;
+    ControllerVector<Bank, RowIndexedBuffer> writeBuffer;
+    ControllerVector<Rank, unsigned> numWritesOnRank;
+    std::unique_ptr<BufferCounterIF> bufferCounter;
+
+    bool writeMode = false;
+    Rank drainRank = Rank(0);
+    unsigned drainBudget = 0;
+    bool readServedSinceDrain = true;
+
+    uint64_t numDrains = 0;
+    uint64_t numDrainedWrites = 0;
+    TurnaroundStatistics turnaroundStatistics;
+};
+
+} // namespace DRAMSys
+
+#endif // SCHEDULERGRPFRFCFSADAPTIVEWM_H
@@ -45,12 +45,13 @@ namespace DRAMSys
 
 SchedulerGrpFrFcfsWm::SchedulerGrpFrFcfsWm(const McConfig& config, const MemSpec& memSpec) :
     lowWatermark(config.lowWatermark),
-    highWatermark(config.highWatermark)
+    highWatermark(config.highWatermark),
+    turnaroundStatistics(memSpec)
 {
     readBuffer =
-        ControllerVector<Bank, std::list<tlm_generic_payload*>>(memSpec.banksPerChannel);
+        ControllerVector<Bank, RowIndexedBuffer>(memSpec.banksPerChannel);
     writeBuffer =
-        ControllerVector<Bank, std::list<tlm_generic_payload*>>(memSpec.banksPerChannel);
+        ControllerVector<Bank, RowIndexedBuffer>(memSpec.banksPerChannel);
 
     if (config.schedulerBuffer == Config::SchedulerBufferType::Bankwise)
         bufferCounter = std::make_unique<BufferCounterBankwise>(config.requestBufferSize,
@@ -92,6 +93,10 @@ void SchedulerGrpFrFcfsWm::removeRequest(tlm_generic_payload& payload)
     else
         writeBuffer[bank].remove(&payload);
 
+    turnaroundStatistics.requestServed(payload,
+                                       bufferCounter->getNumReadRequests() +
+                                               bufferCounter->getNumWriteRequests() !=
+                                           0);
     evaluateWriteMode();
 }
 
@@ -106,12 +111,10 @@ tlm_generic_payload* SchedulerGrpFrFcfsWm::getNextRequest(const BankMachine& ban
             if (bankMachine.isActivated())
             {
                 // Search for read row hit
-                Row openRow = bankMachine.getOpenRow();
-                for (auto* it : readBuffer[bank])
-                {
-                    if (ControllerExtension::getRow(*it) == openRow)
-                        return it;
-                }
+                tlm_generic_payload* rowHit =
+                    readBuffer[bank].frontRowHit(bankMachine.getOpenRow());
+                if (rowHit != nullptr)
+                    return rowHit;
             }
             // No read row hit found or bank precharged
             return readBuffer[bank].front();
@@ -124,12 +127,9 @@ tlm_generic_payload* SchedulerGrpFrFcfsWm::getNextRequest(const BankMachine& ban
         if (bankMachine.isActivated())
         {
             // Search for write row hit
-            Row openRow = bankMachine.getOpenRow();
-            for (auto* it : writeBuffer[bank])
-            {
-                if (ControllerExtension::getRow(*it) == openRow)
-                    return it;
-            }
+            tlm_generic_payload* rowHit = writeBuffer[bank].frontRowHit(bankMachine.getOpenRow());
+            if (rowHit != nullptr)
+                return rowHit;
         }
         // No row hit found or bank precharged
         return writeBuffer[bank].front();
@@ -142,32 +142,12 @@ bool SchedulerGrpFrFcfsWm::hasFurtherRowHit(Bank bank,
                                             Row row,
                                             [[maybe_unused]] tlm::tlm_command command) const
 {
-    unsigned rowHitCounter = 0;
     if (!writeMode)
     {
-        for (const auto* it : readBuffer[bank])
-        {
-            if (ControllerExtension::getRow(*it) == row)
-            {
-                rowHitCounter++;
-                if (rowHitCounter == 2)
-                    return true;
-            }
-        }
-        return false;
-    }
-
-    for (auto* it : writeBuffer[bank])
-    {
-        if (ControllerExtension::getRow(*it) == row)
-        {
-            rowHitCounter++;
-            if (rowHitCounter == 2)
-                return true;
-        }
+        return readBuffer[bank].numRowHits(row) >= 2;
     }
 
-    return false;
+    return writeBuffer[bank].numRowHits(row) >= 2;
 }
 
 bool SchedulerGrpFrFcfsWm::hasFurtherRequest(Bank bank,
@@ -186,6 +166,11 @@ const std::vector<unsigned>& SchedulerGrpFrFcfsWm::getBufferDepth() const
     return bufferCounter->getBufferDepth();
 }
 
+void SchedulerGrpFrFcfsWm::printStatistics(const std::string& name) const
+{
+    turnaroundStatistics.print(name);
+}
+
 void SchedulerGrpFrFcfsWm::evaluateWriteMode()
 {
     if (writeMode)
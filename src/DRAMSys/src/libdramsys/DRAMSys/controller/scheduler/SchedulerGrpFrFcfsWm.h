@@ -38,9 +38,10 @@
 #include "DRAMSys/common/dramExtensions.h"
 #include "DRAMSys/controller/BankMachine.h"
 #include "DRAMSys/controller/scheduler/BufferCounterIF.h"
+#include "DRAMSys/controller/scheduler/RowIndexedBuffer.h"
 #include "DRAMSys/controller/scheduler/SchedulerIF.h"
+#include "DRAMSys/controller/scheduler/TurnaroundStatistics.h"
 
-#include <list>
 #include <memory>
 #include <tlm>
 #include <vector>
@@ -61,16 +62,18 @@ public:
     hasFurtherRowHit(Bank bank, Row row, tlm::tlm_command command) const override;
     [[nodiscard]] bool hasFurtherRequest(Bank bank, tlm::tlm_command command) const override;
     [[nodiscard]] const std::vector<unsigned>& getBufferDepth() const override;
+    void printStatistics(const std::string& name) const override;
 
 private:
     void evaluateWriteMode();
 
-    ControllerVector<Bank, std::list<tlm::tlm_generic_payload*>> readBuffer;
-    ControllerVector<Bank, std::list<tlm::tlm_generic_payload*>> writeBuffer;
+    ControllerVector<Bank, RowIndexedBuffer> readBuffer;
+    ControllerVector<Bank, RowIndexedBuffer> writeBuffer;
     std::unique_ptr<BufferCounterIF> bufferCounter;
     const unsigned lowWatermark;
     const unsigned highWatermark;
     bool writeMode = false;
+    TurnaroundStatistics turnaroundStatistics;
 };
 
 } // namespace DRAMSys
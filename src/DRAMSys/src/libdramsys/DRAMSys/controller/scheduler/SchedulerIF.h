@@ -37,6 +37,7 @@
 
 #include "DRAMSys/common/dramExtensions.h"
 
+#include <string>
 #include <tlm>
 #include <vector>
 
@@ -66,6 +67,7 @@ public:
     hasFurtherRowHit(Bank bank, Row row, tlm::tlm_command command) const = 0;
     [[nodiscard]] virtual bool hasFurtherRequest(Bank bank, tlm::tlm_command command) const = 0;
     [[nodiscard]] virtual const std::vector<unsigned>& getBufferDepth() const = 0;
+    virtual void printStatistics([[maybe_unused]] const std::string& name) const {}
 };
 
 } // namespace DRAMSys
@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "SchedulerParBs.h"
+
+#include "DRAMSys/controller/scheduler/BufferCounterBankwise.h"
+#include "DRAMSys/controller/scheduler/BufferCounterReadWrite.h"
+#include "DRAMSys/controller/scheduler/BufferCounterShared.h"
+
+#include <algorithm>
+#include <cassert>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <numeric>
+#include <tuple>
+
+using namespace sc_core;
+using namespace tlm;
+
+namespace DRAMSys
+{
+
+SchedulerParBs::SchedulerParBs(const McConfig& config, const MemSpec& memSpec) :
+    markingCap(config.batchMarkingCap)
+{
+    buffer = ControllerVector<Bank, std::list<Request>>(memSpec.banksPerChannel);
+    lastServiceTime = ControllerVector<Bank, sc_time>(memSpec.banksPerChannel, SC_ZERO_TIME);
+
+    if (config.schedulerBuffer == Config::SchedulerBufferType::Bankwise)
+        bufferCounter = std::make_unique<BufferCounterBankwise>(config.requestBufferSize,
+                                                                memSpec.banksPerChannel);
+    else if (config.schedulerBuffer == Config::SchedulerBufferType::ReadWrite)
+        bufferCounter = std::make_unique<BufferCounterReadWrite>(config.requestBufferSizeRead,
+                                                                 config.requestBufferSizeWrite);
+    else if (config.schedulerBuffer == Config::SchedulerBufferType::Shared)
+        bufferCounter = std::make_unique<BufferCounterShared>(config.requestBufferSize);
+}
+
+bool SchedulerParBs::hasBufferSpace(unsigned entries) const
+{
+    return bufferCounter->hasBufferSpace(entries);
+}
+
+void SchedulerParBs::storeRequest(tlm_generic_payload& payload)
+{
+    buffer[ControllerExtension::getBank(payload)].push_back(
+        {&payload, ThreadStatistics::getThread(payload), sc_time_stamp(), SC_ZERO_TIME, false});
+    bufferCounter->storeRequest(payload);
+
+    if (numMarkedRequests == 0)
+        formBatch();
+}
+
+void SchedulerParBs::removeRequest(tlm_generic_payload& payload)
+{
+    bufferCounter->removeRequest(payload);
+
+    Bank bank = ControllerExtension::getBank(payload);
+    std::list<Request>& bankBuffer = buffer[bank];
+    sc_time now = sc_time_stamp();
+
+    auto served = std::find_if(bankBuffer.begin(),
+                               bankBuffer.end(),
+                               [&payload](const Request& request)
+                               { return request.payload == &payload; });
+    assert(served != bankBuffer.end());
+    Thread thread = served->thread;
+
+    // All waiting requests of other threads are delayed by the request served now
+    for (auto& request : bankBuffer)
+    {
+        if (request.thread != thread)
+            request.interference += now - std::max(lastServiceTime[bank], request.arrival);
+    }
+    lastServiceTime[bank] = now;
+
+    threadStatistics.requestServed(thread, now - served->arrival, served->interference);
+    if (served->marked)
+        numMarkedRequests--;
+    bankBuffer.erase(served);
+
+    if (numMarkedRequests == 0)
+        formBatch();
+}
+
+tlm_generic_payload* SchedulerParBs::getNextRequest(const BankMachine& bankMachine) const
+{
+    const std::list<Request>& bankBuffer = buffer[bankMachine.getBank()];
+    if (bankBuffer.empty())
+        return nullptr;
+
+    bool activated = bankMachine.isActivated();
+    Row openRow = bankMachine.getOpenRow();
+    const Request* nextRequest = nullptr;
+    unsigned nextPriority = 4;
+    unsigned nextRank = std::numeric_limits<unsigned>::max();
+    for (const auto& request : bankBuffer)
+    {
+        unsigned priority = (request.marked ? 0 : 2) +
+                            ((activated && ControllerExtension::getRow(*request.payload) == openRow)
+                                 ? 0
+                                 : 1);
+        unsigned rank = getRank(request.thread);
+        // Requests are ordered by arrival, so the oldest one wins a tie
+        if (priority < nextPriority || (priority == nextPriority && rank < nextRank))
+        {
+            nextRequest = &request;
+            nextPriority = priority;
+            nextRank = rank;
+        }
+    }
+    return nextRequest->payload;
+}
+
+bool SchedulerParBs::hasFurtherRowHit(Bank bank,
+                                      Row row,
+                                      [[maybe_unused]] tlm_command command) const
+{
+    unsigned rowHitCounter = 0;
+    for (const auto& request : buffer[bank])
+    {
+        if (ControllerExtension::getRow(*request.payload) == row)
+        {
+            rowHitCounter++;
+            if (rowHitCounter == 2)
+                return true;
+        }
+    }
+    return false;
+}
+
+bool SchedulerParBs::hasFurtherRequest(Bank bank, [[maybe_unused]] tlm_command command) const
+{
+    return (buffer[bank].size() >= 2);
+}
+
+const std::vector<unsigned>& SchedulerParBs::getBufferDepth() const
+{
+    return bufferCounter->getBufferDepth();
+}
+
+void SchedulerParBs::printStatistics(const std::string& name) const
+{
+    std::cout << std::left << std::setw(24) << name << std::string("  Batches:        ")
+              << numBatches << std::endl;
+    threadStatistics.print(name);
+}
+
+unsigned SchedulerParBs::getRank(Thread thread) const
+{
+    auto threadID = static_cast<std::size_t>(thread);
+    return threadID < threadRanks.size() ? threadRanks[threadID]
+                                         : std::numeric_limits<unsigned>::max();
+}
+
+void SchedulerParBs::formBatch()
+{
+    std::vector<unsigned> maxBankLoad;
+    std::vector<unsigned> totalLoad;
+    std::vector<unsigned> bankLoad;
+
+    for (auto& bankBuffer : buffer)
+    {
+        std::fill(bankLoad.begin(), bankLoad.end(), 0);
+        for (auto& request : bankBuffer)
+        {
+            auto threadID = static_cast<std::size_t>(request.thread);
+            if (threadID >= bankLoad.size())
+            {
+                bankLoad.resize(threadID + 1, 0);
+                maxBankLoad.resize(threadID + 1, 0);
+                totalLoad.resize(threadID + 1, 0);
+            }
+
+            if (bankLoad[threadID] < markingCap)
+            {
+                request.marked = true;
+                bankLoad[threadID]++;
+                totalLoad[threadID]++;
+                numMarkedRequests++;
+            }
+        }
+
+        for (std::size_t threadID = 0; threadID < bankLoad.size(); threadID++)
+            maxBankLoad[threadID] = std::max(maxBankLoad[threadID], bankLoad[threadID]);
+    }
+
+    if (numMarkedRequests == 0)
+        return;
+
+    numBatches++;
+
+    // Shortest job first: the thread with the lowest maximum bank load is ranked highest, the
+    // total load breaks ties
+    std::vector<std::size_t> threadOrder(totalLoad.size());
+    std::iota(threadOrder.begin(), threadOrder.end(), 0);
+    std::stable_sort(threadOrder.begin(),
+                     threadOrder.end(),
+                     [&](std::size_t lhs, std::size_t rhs)
+                     {
+                         return std::tie(maxBankLoad[lhs], totalLoad[lhs]) <
+                                std::tie(maxBankLoad[rhs], totalLoad[rhs]);
+                     });
+
+    threadRanks.assign(totalLoad.size(), std::numeric_limits<unsigned>::max());
+    unsigned rank = 0;
+    for (std::size_t threadID : threadOrder)
+    {
+        if (totalLoad[threadID] != 0)
+            threadRanks[threadID] = rank++;
+    }
+}
+
+} // namespace DRAMSys
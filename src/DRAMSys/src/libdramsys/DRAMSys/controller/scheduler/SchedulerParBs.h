@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SCHEDULERPARBS_H
+#define SCHEDULERPARBS_H
+
+#include "DRAMSys/common/dramExtensions.h"
+#include "DRAMSys/controller/BankMachine.h"
+#include "DRAMSys/controller/McConfig.h"
+#include "DRAMSys/controller/scheduler/BufferCounterIF.h"
+#include "DRAMSys/controller/scheduler/SchedulerIF.h"
+#include "DRAMSys/controller/scheduler/ThreadStatistics.h"
+
+#include <list>
+#include <memory>
+#include <systemc>
+#include <tlm>
+#include <vector>
+
+namespace DRAMSys
+{
+
+// Parallelism-aware batch scheduler (PAR-BS): when no marked requests are left, up to
+// BatchMarkingCap of the oldest requests of each thread are marked in each bank and the threads
+// are ranked shortest job first by their maximum number of marked requests on a single bank.
+// Priorities per bank: marked, row hit, thread rank, oldest.
+class SchedulerParBs final : public SchedulerIF
+{
+public:
+    explicit SchedulerParBs(const McConfig& config, const MemSpec& memSpec);
+    [[nodiscard]] bool hasBufferSpace(unsigned entries) const override;
+    void storeRequest(tlm::tlm_generic_payload& payload) override;
+    void removeRequest(tlm::tlm_generic_payload& payload) override;
+    [[nodiscard]] tlm::tlm_generic_payload*
+    getNextRequest(const BankMachine& bankMachine) const override;
+    [[nodiscard]] bool
+    hasFurtherRowHit(Bank bank, Row row, tlm::tlm_command command) const override;
+    [[nodiscard]] bool hasFurtherRequest(Bank bank, tlm::tlm_command command) const override;
+    [[nodiscard]] const std::vector<unsigned>& getBufferDepth() const override;
+    void printStatistics(const std::string& name) const override;
+
+private:
+    struct Request
+    {
+        tlm::tlm_generic_payload* payload;
+        Thread thread;
+        sc_core::sc_time arrival;
+        sc_core::sc_time interference;
+        bool marked;
+    };
+
+    [[nodiscard]] unsigned getRank(Thread thread) const;
+    void formBatch();
+
+    ControllerVector<Bank, std::list<Request>> buffer;
+    ControllerVector<Bank, sc_core::sc_time> lastServiceTime;
+    std::unique_ptr<BufferCounterIF> bufferCounter;
+
+    const unsigned markingCap;
+    unsigned numMarkedRequests = 0;
+    uint64_t numBatches = 0;
+    std::vector<unsigned> threadRanks;
+
+    ThreadStatistics threadStatistics;
+};
+
+} // namespace DRAMSys
+
+#endif // SCHEDULERPARBS_H
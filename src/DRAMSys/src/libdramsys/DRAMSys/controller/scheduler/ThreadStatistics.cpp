@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "ThreadStatistics.h"
+
+#include <iomanip>
+#include <iostream>
+
+using namespace sc_core;
+using namespace tlm;
+
+namespace DRAMSys
+{
+
+Thread ThreadStatistics::getThread(tlm_generic_payload& payload)
+{
+    tlm_generic_payload* trans = &payload;
+    if (ChildExtension::isChildTrans(*trans))
+        trans = &ChildExtension::getParentTrans(*trans);
+
+    if (trans->get_extension<ArbiterExtension>() == nullptr)
+        return Thread(0);
+
+    return ArbiterExtension::getThread(*trans);
+}
+
+void ThreadStatistics::requestServed(Thread thread,
+                                     const sc_time& latency,
+                                     const sc_time& interference)
+{
+    auto threadID = static_cast<std::size_t>(thread);
+    if (threadID >= threads.size())
+        threads.resize(threadID + 1);
+
+    Counters& counters = threads[threadID];
+    counters.requests++;
+    counters.latency += latency;
+    counters.interference += interference;
+}
+
+void ThreadStatistics::print(const std::string& name) const
+{
+    for (std::size_t threadID = 0; threadID < threads.size(); threadID++)
+    {
+        const Counters& counters = threads[threadID];
+        if (counters.requests == 0)
+            continue;
+
+        sc_time avgLatency = counters.latency / static_cast<double>(counters.requests);
+        sc_time aloneLatency = counters.latency - counters.interference;
+        double slowdown = aloneLatency > SC_ZERO_TIME ? counters.latency / aloneLatency : 1.0;
+
+        std::cout << std::left << std::setw(24) << name << std::string("  Thread ")
+                  << std::setw(8) << threadID << std::string("requests: ") << std::setw(10)
+                  << counters.requests << std::string(" avg. latency: ") << std::setw(14)
+                  << avgLatency.to_string() << std::string(" slowdown: ") << std::fixed
+                  << std::setprecision(2) << slowdown << std::endl;
+    }
+}
+
+} // namespace DRAMSys
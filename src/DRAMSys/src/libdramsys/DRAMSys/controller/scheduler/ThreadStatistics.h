@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef THREADSTATISTICS_H
+#define THREADSTATISTICS_H
+
+#include "DRAMSys/common/dramExtensions.h"
+
+#include <cstdint>
+#include <string>
+#include <systemc>
+#include <tlm>
+#include <vector>
+
+namespace DRAMSys
+{
+
+// Per-thread service statistics of thread-aware schedulers. The interference time of a request
+// is the part of its queueing time during which requests of other threads were served on the
+// same bank, the slowdown of a thread is estimated as its total queueing time divided by its
+// queueing time without interference.
+class ThreadStatistics
+{
+public:
+    // Child transactions carry no arbiter extension, they are attributed to the thread of their
+    // parent. Requests without any arbiter extension are attributed to thread 0.
+    static Thread getThread(tlm::tlm_generic_payload& payload);
+
+    void requestServed(Thread thread,
+                       const sc_core::sc_time& latency,
+                       const sc_core::sc_time& interference);
+    void print(const std::string& name) const;
+
+private:
+    struct Counters
+    {
+        uint64_t requests = 0;
+        sc_core::sc_time latency = sc_core::SC_ZERO_TIME;
+        sc_core::sc_time interference = sc_core::SC_ZERO_TIME;
+    };
+
+    std::vector<Counters> threads;
+};
+
+} // namespace DRAMSys
+
+#endif // THREADSTATISTICS_H
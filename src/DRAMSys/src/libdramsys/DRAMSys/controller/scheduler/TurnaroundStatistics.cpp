@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "TurnaroundStatistics.h"
+
+#include <iomanip>
+#include <iostream>
+
+using namespace sc_core;
+using namespace tlm;
+
+namespace DRAMSys
+{
+
+TurnaroundStatistics::TurnaroundStatistics(const MemSpec& memSpec) : memSpec(memSpec) {}
+
+void TurnaroundStatistics::requestServed(const tlm_generic_payload& payload,
+                                         bool furtherRequestsPending)
+{
+    sc_time now = sc_time_stamp();
+    bool isRead = payload.is_read();
+    Rank rank = ControllerExtension::getRank(payload);
+
+    if (!firstRequest)
+    {
+        bool turnaround = false;
+        if (lastWasRead && !isRead)
+        {
+            readToWrite++;
+            turnaround = true;
+        }
+        else if (!lastWasRead && isRead)
+        {
+            writeToRead++;
+            turnaround = true;
+        }
+
+        if (rank != lastRank)
+        {
+            rankSwitches++;
+            turnaround = true;
+        }
+
+        if (turnaround && lastPending && now > lastBurstEnd)
+            wastedTime += now - lastBurstEnd;
+    }
+
+    firstRequest = false;
+    lastWasRead = isRead;
+    lastRank = rank;
+    lastPending = furtherRequestsPending;
+    double burstCycles = static_cast<double>(ControllerExtension::getBurstLength(payload)) /
+                         static_cast<double>(memSpec.dataRate);
+    lastBurstEnd = now + memSpec.tCK * burstCycles;
+}
+
+void TurnaroundStatistics::print(const std::string& name) const
+{
+    std::cout << std::left << std::setw(24) << name << std::string("  Turnarounds:    ")
+              << readToWrite << " R->W | " << writeToRead << " W->R | " << rankSwitches
+              << " rank switches | " << std::fixed << std::setprecision(0)
+              << (wastedTime / memSpec.tCK) << " wasted bus cycles" << std::endl;
+}
+
+} // namespace DRAMSys
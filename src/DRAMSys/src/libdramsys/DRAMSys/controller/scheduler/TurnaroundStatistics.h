@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef TURNAROUNDSTATISTICS_H
+#define TURNAROUNDSTATISTICS_H
+
+#include "DRAMSys/common/dramExtensions.h"
+#include "DRAMSys/configuration/memspec/MemSpec.h"
+
+#include <cstdint>
+#include <string>
+#include <systemc>
+#include <tlm>
+
+namespace DRAMSys
+{
+
+// Counts read-to-write and write-to-read turnarounds and rank switches of the CAS commands issued
+// for the requests of a scheduler. The data bus time between the end of the previous burst and
+// the next CAS command after a turnaround is counted as wasted if further requests were pending.
+class TurnaroundStatistics
+{
+public:
+    explicit TurnaroundStatistics(const MemSpec& memSpec);
+
+    void requestServed(const tlm::tlm_generic_payload& payload, bool furtherRequestsPending);
+    void print(const std::string& name) const;
+
+private:
+    const MemSpec& memSpec;
+
+    bool firstRequest = true;
+    bool lastWasRead = true;
+    Rank lastRank = Rank(0);
+    bool lastPending = false;
+    sc_core::sc_time lastBurstEnd = sc_core::SC_ZERO_TIME;
+
+    uint64_t readToWrite = 0;
+    uint64_t writeToRead = 0;
+    uint64_t rankSwitches = 0;
+    sc_core::sc_time wastedTime = sc_core::SC_ZERO_TIME;
+};
+
+} // namespace DRAMSys
+
+#endif // TURNAROUNDSTATISTICS_H
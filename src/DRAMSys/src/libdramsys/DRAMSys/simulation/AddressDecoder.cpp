@@ -39,14 +39,41 @@
 #include "AddressDecoder.h"
 #include "DRAMSys/config/AddressMapping.h"
 
+#include <algorithm>
+#include <array>
 #include <bitset>
 #include <cmath>
 #include <iomanip>
 #include <iostream>
 
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
 namespace DRAMSys
 {
 
+// Shifts and xors only, so that loops over many addresses can be vectorized
+static uint64_t foldParity(uint64_t value)
+{
+    value ^= value >> 32;
+    value ^= value >> 16;
+    value ^= value >> 8;
+    value ^= value >> 4;
+    value ^= value >> 2;
+    value ^= value >> 1;
+    return value & UINT64_C(1);
+}
+
+static uint64_t parity(uint64_t value)
+{
+#if defined(__GNUC__)
+    return static_cast<uint64_t>(__builtin_parityll(value));
+#else
+    return foldParity(value);
+#endif
+}
+
 static void addMapping(std::vector<Config::AddressMapping::BitEntry> const& mappingVector,
                        std::vector<unsigned>& bitVector,
                        std::vector<std::vector<unsigned>>& xorVector)
@@ -125,6 +152,117 @@ AddressDecoder::AddressDecoder(const Config::AddressMapping& addressMapping)
 
     bankgroupsPerRank = bankGroups;
     banksPerGroup = banks;
+
+    channelField = compileField(vChannelBits);
+    rankField = compileField(vRankBits);
+    stackField = compileField(vStackBits);
+    bankGroupField = compileField(vBankGroupBits);
+    bankField = compileField(vBankBits);
+    rowField = compileField(vRowBits);
+    columnField = compileField(vColumnBits);
+    byteField = compileField(vByteBits);
+
+    for (const auto& xorBits : vXor)
+    {
+        uint64_t mask = 0;
+        for (unsigned xorBit : xorBits)
+            mask ^= UINT64_C(1) << xorBit;
+
+        // A later gate on the same bit overwrites the result of an earlier one
+        auto gate = std::find_if(xorGates.begin(),
+                                 xorGates.end(),
+                                 [&xorBits](const XorGate& entry)
+                                 { return entry.bit == xorBits[0]; });
+        if (gate != xorGates.end())
+            gate->mask = mask;
+        else
+            xorGates.push_back({xorBits[0], mask});
+    }
+
+    for (const XorGate& gate : xorGates)
+    {
+        if ((channelField.mask >> gate.bit) & UINT64_C(1))
+            channelXorGates.push_back(gate);
+    }
+}
+
+AddressDecoder::CompiledField AddressDecoder::compileField(const std::vector<unsigned>& bits)
+{
+    CompiledField field;
+
+    for (unsigned offset = 0; offset < bits.size(); offset++)
+    {
+        field.mask |= UINT64_C(1) << bits[offset];
+
+        if (offset > 0 && bits[offset] <= bits[offset - 1])
+            field.ascending = false;
+
+        if (!field.runs.empty())
+        {
+            BitRun& run = field.runs.back();
+            if (bits[offset] == run.position + (offset - run.offset))
+            {
+                run.mask = (run.mask << 1) | UINT64_C(1);
+                continue;
+            }
+        }
+
+        field.runs.push_back({bits[offset], offset, UINT64_C(1)});
+    }
+
+    return field;
+}
+
+unsigned AddressDecoder::CompiledField::extract(uint64_t address) const
+{
+#if defined(__BMI2__)
+    if (ascending)
+        return static_cast<unsigned>(_pext_u64(address, mask));
+#endif
+
+    uint64_t value = 0;
+    for (const BitRun& run : runs)
+        value |= ((address >> run.position) & run.mask) << run.offset;
+
+    return static_cast<unsigned>(value);
+}
+
+void AddressDecoder::CompiledField::extract(const uint64_t* addresses,
+                                            std::size_t count,
+                                            unsigned* values) const
+{
+#if defined(__BMI2__)
+    if (ascending)
+    {
+        for (std::size_t index = 0; index < count; index++)
+            values[index] = static_cast<unsigned>(_pext_u64(addresses[index], mask));
+        return;
+    }
+#endif
+
+    std::fill(values, values + count, 0);
+    for (const BitRun& run : runs)
+    {
+        // Local copies, otherwise the stores to values could alias the run
+        const unsigned position = run.position;
+        const unsigned offset = run.offset;
+        const uint64_t runMask = run.mask;
+        for (std::size_t index = 0; index < count; index++)
+            values[index] |=
+                static_cast<unsigned>(((addresses[index] >> position) & runMask) << offset);
+    }
+}
+
+uint64_t AddressDecoder::applyXor(uint64_t encAddr, const std::vector<XorGate>& gates)
+{
+    uint64_t address = encAddr;
+    for (const XorGate& gate : gates)
+    {
+        address &= ~(UINT64_C(1) << gate.bit);
+        address |= parity(encAddr & gate.mask) << gate.bit;
+    }
+
+    return address;
 }
 
 void AddressDecoder::plausibilityCheck(const MemSpec& memSpec)
@@ -200,52 +338,100 @@ DecodedAddress AddressDecoder::decodeAddress(uint64_t encAddr) const
                            ")")
                               .c_str());
 
-    // Apply XOR
-    // For each used xor:
-    //   Get the first bit and second bit. Apply a bitwise xor operator and save it back to the
-    //   first bit.
-    auto tempAddr = encAddr;
-    for (const auto& it : vXor)
-    {
-        uint64_t xoredBit = std::accumulate(it.cbegin(),
-                                            it.cend(),
-                                            0,
-                                            [tempAddr](uint64_t acc, unsigned xorBit)
-                                            { return acc ^= (tempAddr >> xorBit) & UINT64_C(1); });
-        encAddr &= ~(UINT64_C(1) << it[0]);
-        encAddr |= xoredBit << it[0];
-    }
-
-    DecodedAddress decAddr;
+    uint64_t address = applyXor(encAddr, xorGates);
 
-    for (unsigned it = 0; it < vChannelBits.size(); it++)
-        decAddr.channel |= ((encAddr >> vChannelBits[it]) & UINT64_C(1)) << it;
+    DecodedAddress decAddr(channelField.extract(address),
+                           rankField.extract(address),
+                           stackField.extract(address),
+                           bankGroupField.extract(address),
+                           bankField.extract(address),
+                           rowField.extract(address),
+                           columnField.extract(address),
+                           byteField.extract(address));
 
-    for (unsigned it = 0; it < vRankBits.size(); it++)
-        decAddr.rank |= ((encAddr >> vRankBits[it]) & UINT64_C(1)) << it;
-
-    for (unsigned it = 0; it < vStackBits.size(); it++)
-        decAddr.stack |= ((encAddr >> vStackBits[it]) & UINT64_C(1)) << it;
+    decAddr.bankgroup = decAddr.bankgroup + decAddr.rank * bankgroupsPerRank;
+    decAddr.bank = decAddr.bank + decAddr.bankgroup * banksPerGroup;
 
-    for (unsigned it = 0; it < vBankGroupBits.size(); it++)
-        decAddr.bankgroup |= ((encAddr >> vBankGroupBits[it]) & UINT64_C(1)) << it;
+    return decAddr;
+}
 
-    for (unsigned it = 0; it < vBankBits.size(); it++)
-        decAddr.bank |= ((encAddr >> vBankBits[it]) & UINT64_C(1)) << it;
+void AddressDecoder::decodeBatch(const uint64_t* encAddrs,
+                                 std::size_t count,
+                                 DecodedAddressSoA& decAddrs) const
+{
+    decAddrs.resize(count);
 
-    for (unsigned it = 0; it < vRowBits.size(); it++)
-        decAddr.row |= ((encAddr >> vRowBits[it]) & UINT64_C(1)) << it;
+    constexpr std::size_t chunkSize = 1024;
+    std::array<uint64_t, chunkSize> addresses{};
 
-    for (unsigned it = 0; it < vColumnBits.size(); it++)
-        decAddr.column |= ((encAddr >> vColumnBits[it]) & UINT64_C(1)) << it;
+    for (std::size_t first = 0; first < count; first += chunkSize)
+    {
+        const std::size_t size = std::min(chunkSize, count - first);
+        const uint64_t* chunk = encAddrs + first;
+
+        uint64_t highestAddress = 0;
+        for (std::size_t index = 0; index < size; index++)
+            highestAddress = std::max(highestAddress, chunk[index]);
+
+        if (highestAddress > maximumAddress)
+            SC_REPORT_WARNING("AddressDecoder",
+                              ("Address " + std::to_string(highestAddress) +
+                               " out of range (maximum address is " +
+                               std::to_string(maximumAddress) + ")")
+                                  .c_str());
+
+        std::copy(chunk, chunk + size, addresses.begin());
+        for (const XorGate& gate : xorGates)
+        {
+            const unsigned bit = gate.bit;
+            const uint64_t gateMask = gate.mask;
+            for (std::size_t index = 0; index < size; index++)
+                addresses[index] = (addresses[index] & ~(UINT64_C(1) << bit)) |
+                                   (foldParity(chunk[index] & gateMask) << bit);
+        }
 
-    for (unsigned it = 0; it < vByteBits.size(); it++)
-        decAddr.byte |= ((encAddr >> vByteBits[it]) & UINT64_C(1)) << it;
+        channelField.extract(addresses.data(), size, decAddrs.channel.data() + first);
+        rankField.extract(addresses.data(), size, decAddrs.rank.data() + first);
+        stackField.extract(addresses.data(), size, decAddrs.stack.data() + first);
+        bankGroupField.extract(addresses.data(), size, decAddrs.bankgroup.data() + first);
+        bankField.extract(addresses.data(), size, decAddrs.bank.data() + first);
+        rowField.extract(addresses.data(), size, decAddrs.row.data() + first);
+        columnField.extract(addresses.data(), size, decAddrs.column.data() + first);
+        byteField.extract(addresses.data(), size, decAddrs.byte.data() + first);
+
+        unsigned* rank = decAddrs.rank.data() + first;
+        unsigned* bankgroup = decAddrs.bankgroup.data() + first;
+        unsigned* bank = decAddrs.bank.data() + first;
+        for (std::size_t index = 0; index < size; index++)
+        {
+            bankgroup[index] += rank[index] * bankgroupsPerRank;
+            bank[index] += bankgroup[index] * banksPerGroup;
+        }
+    }
+}
 
-    decAddr.bankgroup = decAddr.bankgroup + decAddr.rank * bankgroupsPerRank;
-    decAddr.bank = decAddr.bank + decAddr.bankgroup * banksPerGroup;
+void DecodedAddressSoA::resize(std::size_t size)
+{
+    channel.resize(size);
+    rank.resize(size);
+    stack.resize(size);
+    bankgroup.resize(size);
+    bank.resize(size);
+    row.resize(size);
+    column.resize(size);
+    byte.resize(size);
+}
 
-    return decAddr;
+DecodedAddress DecodedAddressSoA::operator[](std::size_t index) const
+{
+    return {channel[index],
+            rank[index],
+            stack[index],
+            bankgroup[index],
+            bank[index],
+            row[index],
+            column[index],
+            byte[index]};
 }
 
 unsigned AddressDecoder::decodeChannel(uint64_t encAddr) const
@@ -257,28 +443,7 @@ unsigned AddressDecoder::decodeChannel(uint64_t encAddr) const
                            ")")
                               .c_str());
 
-    // Apply XOR
-    // For each used xor:
-    //   Get the first bit and second bit. Apply a bitwise xor operator and save it back to the
-    //   first bit.
-    auto tempAddr = encAddr;
-    for (const auto& it : vXor)
-    {
-        uint64_t xoredBit = std::accumulate(it.cbegin(),
-                                            it.cend(),
-                                            0,
-                                            [tempAddr](uint64_t acc, unsigned xorBit)
-                                            { return acc ^= (tempAddr >> xorBit) & UINT64_C(1); });
-        encAddr &= ~(UINT64_C(1) << it[0]);
-        encAddr |= xoredBit << it[0];
-    }
-
-    unsigned channel = 0;
-
-    for (unsigned it = 0; it < vChannelBits.size(); it++)
-        channel |= ((encAddr >> vChannelBits[it]) & UINT64_C(1)) << it;
-
-    return channel;
+    return channelField.extract(applyXor(encAddr, channelXorGates));
 }
 
 uint64_t AddressDecoder::encodeAddress(DecodedAddress decodedAddress) const
@@ -42,6 +42,7 @@
 #include "DRAMSys/config/DRAMSysConfiguration.h"
 #include "DRAMSys/configuration/memspec/MemSpec.h"
 
+#include <cstddef>
 #include <utility>
 #include <vector>
 
@@ -81,6 +82,23 @@ struct DecodedAddress
     unsigned byte = 0;
 };
 
+// Struct-of-arrays output of AddressDecoder::decodeBatch
+struct DecodedAddressSoA
+{
+    std::vector<unsigned> channel;
+    std::vector<unsigned> rank;
+    std::vector<unsigned> stack;
+    std::vector<unsigned> bankgroup;
+    std::vector<unsigned> bank;
+    std::vector<unsigned> row;
+    std::vector<unsigned> column;
+    std::vector<unsigned> byte;
+
+    void resize(std::size_t size);
+    [[nodiscard]] std::size_t size() const { return channel.size(); }
+    [[nodiscard]] DecodedAddress operator[](std::size_t index) const;
+};
+
 class AddressDecoder
 {
 public:
@@ -88,6 +106,9 @@ public:
 
     [[nodiscard]] DecodedAddress decodeAddress(uint64_t encAddr) const;
     [[nodiscard]] unsigned decodeChannel(uint64_t encAddr) const;
+    // Decodes count addresses at once, the field loops are written to be vectorized
+    void
+    decodeBatch(const uint64_t* encAddrs, std::size_t count, DecodedAddressSoA& decAddrs) const;
     [[nodiscard]] uint64_t encodeAddress(DecodedAddress decodedAddress) const;
     [[nodiscard]] uint64_t maxAddress() const { return maximumAddress; }
 
@@ -100,6 +121,48 @@ private:
 
     uint64_t maximumAddress;
 
+    // Mapping compiled at construction, a field is extracted with PEXT if BMI2 is available and
+    // its bits are listed in ascending order, otherwise with one shift and mask per run of
+    // consecutive bits
+    struct BitRun
+    {
+        unsigned position;
+        unsigned offset;
+        uint64_t mask;
+    };
+
+    struct CompiledField
+    {
+        uint64_t mask = 0;
+        bool ascending = true;
+        std::vector<BitRun> runs;
+
+        [[nodiscard]] unsigned extract(uint64_t address) const;
+        void extract(const uint64_t* addresses, std::size_t count, unsigned* values) const;
+    };
+
+    // Each xor gate overwrites its bit with the parity of the original address bits in its mask
+    struct XorGate
+    {
+        unsigned bit;
+        uint64_t mask;
+    };
+
+    std::vector<XorGate> xorGates;
+    std::vector<XorGate> channelXorGates;
+
+    CompiledField channelField;
+    CompiledField rankField;
+    CompiledField stackField;
+    CompiledField bankGroupField;
+    CompiledField bankField;
+    CompiledField rowField;
+    CompiledField columnField;
+    CompiledField byteField;
+
+    static CompiledField compileField(const std::vector<unsigned>& bits);
+    static uint64_t applyXor(uint64_t encAddr, const std::vector<XorGate>& gates);
+
     // This container stores for each used xor gate a pair of address bits, the first bit is
     // overwritten with the result
     std::vector<std::vector<unsigned>> vXor;
@@ -60,6 +60,7 @@ Arbiter::Arbiter(const sc_module_name& name,
     tCK(memSpec.tCK),
     arbitrationDelayFw(mcConfig.arbitrationDelayFw),
     arbitrationDelayBw(mcConfig.arbitrationDelayBw),
+    channelRequestSlots(mcConfig.channelRequestSlots),
     bytesPerBeat(memSpec.dataBusWidth / 8),
     addressOffset(simConfig.addressOffset)
 {
@@ -105,7 +106,7 @@ void Arbiter::end_of_elaboration()
     nextThreadPayloadIDToAppend = ControllerVector<Thread, std::uint64_t>(tSocket.size(), 1);
 
     // channel side
-    channelIsBusy = ControllerVector<Channel, bool>(iSocket.size(), false);
+    requestsInFlightOnChannel = ControllerVector<Channel, unsigned>(iSocket.size(), 0);
     pendingRequestsOnChannel = ControllerVector<Channel, std::queue<tlm_generic_payload*>>(
         iSocket.size(), std::queue<tlm_generic_payload*>());
     nextChannelPayloadIDToAppend = ControllerVector<Channel, std::uint64_t>(iSocket.size(), 1);
@@ -143,9 +144,8 @@ void ArbiterReorder::end_of_elaboration()
     activeTransactionsOnThread = ControllerVector<Thread, unsigned int>(tSocket.size(), 0);
     outstandingEndReqOnThread =
         ControllerVector<Thread, tlm_generic_payload*>(tSocket.size(), nullptr);
-    pendingResponsesOnThread =
-        ControllerVector<Thread, std::set<tlm_generic_payload*, ThreadPayloadIDCompare>>(
-            tSocket.size(), std::set<tlm_generic_payload*, ThreadPayloadIDCompare>());
+    pendingResponsesOnThread = ControllerVector<Thread, std::vector<tlm_generic_payload*>>(
+        tSocket.size(), std::vector<tlm_generic_payload*>(maxActiveTransactions, nullptr));
     nextThreadPayloadIDToReturn = ControllerVector<Thread, std::uint64_t>(tSocket.size(), 1);
 
     lastEndReqOnChannel = ControllerVector<Channel, sc_time>(iSocket.size(), sc_max_time());
@@ -217,9 +217,9 @@ void ArbiterSimple::peqCallback(tlm_generic_payload& cbTrans, const tlm_phase& c
         ArbiterExtension::setIDAndTimeOfGeneration(
             cbTrans, nextThreadPayloadIDToAppend[thread]++, sc_time_stamp());
 
-        if (!channelIsBusy[channel])
+        if (requestsInFlightOnChannel[channel] < channelRequestSlots)
         {
-            channelIsBusy[channel] = true;
+            requestsInFlightOnChannel[channel]++;
 
             tlm_phase tPhase = BEGIN_REQ;
             sc_time tDelay = arbitrationDelayFw;
@@ -249,7 +249,7 @@ void ArbiterSimple::peqCallback(tlm_generic_payload& cbTrans, const tlm_phase& c
             iSocket[static_cast<int>(channel)]->nb_transport_fw(tPayload, tPhase, tDelay);
         }
         else
-            channelIsBusy[channel] = false;
+            requestsInFlightOnChannel[channel]--;
     }
     else if (cbPhase == BEGIN_RESP) // from memory controller
     {
@@ -337,7 +337,7 @@ void ArbiterFifo::peqCallback(tlm_generic_payload& cbTrans, const tlm_phase& cbP
             iSocket[static_cast<int>(channel)]->nb_transport_fw(tPayload, tPhase, tDelay);
         }
         else
-            channelIsBusy[channel] = false;
+            requestsInFlightOnChannel[channel]--;
     }
     else if (cbPhase == BEGIN_RESP) // from memory controller
     {
@@ -393,9 +393,9 @@ void ArbiterFifo::peqCallback(tlm_generic_payload& cbTrans, const tlm_phase& cbP
     {
         pendingRequestsOnChannel[channel].push(&cbTrans);
 
-        if (!channelIsBusy[channel])
+        if (requestsInFlightOnChannel[channel] < channelRequestSlots)
         {
-            channelIsBusy[channel] = true;
+            requestsInFlightOnChannel[channel]++;
 
             tlm_generic_payload& tPayload = *pendingRequestsOnChannel[channel].front();
             pendingRequestsOnChannel[channel].pop();
@@ -467,7 +467,7 @@ void ArbiterReorder::peqCallback(tlm_generic_payload& cbTrans, const tlm_phase&
             iSocket[static_cast<int>(channel)]->nb_transport_fw(tPayload, tPhase, tDelay);
         }
         else
-            channelIsBusy[channel] = false;
+            requestsInFlightOnChannel[channel]--;
     }
     else if (cbPhase == BEGIN_RESP) // from memory controller
     {
@@ -502,13 +502,15 @@ void ArbiterReorder::peqCallback(tlm_generic_payload& cbTrans, const tlm_phase&
         else
             activeTransactionsOnThread[thread]--;
 
-        tlm_generic_payload& tPayload = **pendingResponsesOnThread[thread].begin();
+        tlm_generic_payload*& nextPayload =
+            pendingResponsesOnThread[thread][nextThreadPayloadIDToReturn[thread] %
+                                             maxActiveTransactions];
 
-        if (!pendingResponsesOnThread[thread].empty() &&
-            ArbiterExtension::getThreadPayloadID(tPayload) == nextThreadPayloadIDToReturn[thread])
+        if (nextPayload != nullptr)
         {
+            tlm_generic_payload& tPayload = *nextPayload;
+            nextPayload = nullptr;
             nextThreadPayloadIDToReturn[thread]++;
-            pendingResponsesOnThread[thread].erase(pendingResponsesOnThread[thread].begin());
 
             tlm_phase tPhase = BEGIN_RESP;
             sc_time tDelay = tCK;
@@ -526,9 +528,9 @@ void ArbiterReorder::peqCallback(tlm_generic_payload& cbTrans, const tlm_phase&
     {
         pendingRequestsOnChannel[channel].push(&cbTrans);
 
-        if (!channelIsBusy[channel])
+        if (requestsInFlightOnChannel[channel] < channelRequestSlots)
         {
-            channelIsBusy[channel] = true;
+            requestsInFlightOnChannel[channel]++;
 
             tlm_generic_payload& tPayload = *pendingRequestsOnChannel[channel].front();
             pendingRequestsOnChannel[channel].pop();
@@ -540,19 +542,22 @@ void ArbiterReorder::peqCallback(tlm_generic_payload& cbTrans, const tlm_phase&
     }
     else if (cbPhase == RESP_ARBITRATION)
     {
-        pendingResponsesOnThread[thread].insert(&cbTrans);
+        std::uint64_t threadPayloadID = ArbiterExtension::getThreadPayloadID(cbTrans);
+        pendingResponsesOnThread[thread][threadPayloadID % maxActiveTransactions] = &cbTrans;
 
         if (!threadIsBusy[thread])
         {
-            tlm_generic_payload& tPayload = **pendingResponsesOnThread[thread].begin();
+            tlm_generic_payload*& nextPayload =
+                pendingResponsesOnThread[thread][nextThreadPayloadIDToReturn[thread] %
+                                                 maxActiveTransactions];
 
-            if (ArbiterExtension::getThreadPayloadID(tPayload) ==
-                nextThreadPayloadIDToReturn[thread])
+            if (nextPayload != nullptr)
             {
+                tlm_generic_payload& tPayload = *nextPayload;
+                nextPayload = nullptr;
                 threadIsBusy[thread] = true;
 
                 nextThreadPayloadIDToReturn[thread]++;
-                pendingResponsesOnThread[thread].erase(pendingResponsesOnThread[thread].begin());
                 tlm_phase tPhase = BEGIN_RESP;
                 sc_time tDelay =
                     lastEndRespOnThread[thread] == sc_time_stamp() ? tCK : SC_ZERO_TIME;
@@ -47,7 +47,6 @@
 
 #include <iostream>
 #include <queue>
-#include <set>
 #include <systemc>
 #include <tlm>
 #include <tlm_utils/multi_passthrough_initiator_socket.h>
@@ -83,7 +82,8 @@ protected:
     virtual void peqCallback(tlm::tlm_generic_payload& payload, const tlm::tlm_phase& phase) = 0;
 
     ControllerVector<Thread, bool> threadIsBusy;
-    ControllerVector<Channel, bool> channelIsBusy;
+    // Number of requests forwarded to a channel controller that are not yet acknowledged
+    ControllerVector<Channel, unsigned> requestsInFlightOnChannel;
 
     ControllerVector<Channel, std::queue<tlm::tlm_generic_payload*>> pendingRequestsOnChannel;
 
@@ -104,6 +104,7 @@ protected:
     const sc_core::sc_time tCK;
     const sc_core::sc_time arbitrationDelayFw;
     const sc_core::sc_time arbitrationDelayBw;
+    const unsigned channelRequestSlots;
 
     const unsigned bytesPerBeat;
     const uint64_t addressOffset;
@@ -167,19 +168,9 @@ private:
     ControllerVector<Thread, unsigned int> activeTransactionsOnThread;
     const unsigned maxActiveTransactions;
 
-    struct ThreadPayloadIDCompare
-    {
-        bool operator()(const tlm::tlm_generic_payload* lhs,
-                        const tlm::tlm_generic_payload* rhs) const
-        {
-            return ArbiterExtension::getThreadPayloadID(*lhs) <
-                   ArbiterExtension::getThreadPayloadID(*rhs);
-        }
-    };
-
     ControllerVector<Thread, tlm::tlm_generic_payload*> outstandingEndReqOnThread;
-    ControllerVector<Thread, std::set<tlm::tlm_generic_payload*, ThreadPayloadIDCompare>>
-        pendingResponsesOnThread;
+    // Reorder window per thread, indexed by the thread payload ID modulo maxActiveTransactions
+    ControllerVector<Thread, std::vector<tlm::tlm_generic_payload*>> pendingResponsesOnThread;
 
     ControllerVector<Channel, sc_core::sc_time> lastEndReqOnChannel;
     ControllerVector<Thread, sc_core::sc_time> lastEndRespOnThread;
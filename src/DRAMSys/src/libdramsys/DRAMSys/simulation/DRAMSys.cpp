@@ -50,23 +50,18 @@
 
 #include "DRAMSys/configuration/memspec/MemSpecDDR3.h"
 #include "DRAMSys/configuration/memspec/MemSpecDDR4.h"
+#include "DRAMSys/configuration/memspec/MemSpecDDR5.h"
 #include "DRAMSys/configuration/memspec/MemSpecGDDR5.h"
 #include "DRAMSys/configuration/memspec/MemSpecGDDR5X.h"
 #include "DRAMSys/configuration/memspec/MemSpecGDDR6.h"
 #include "DRAMSys/configuration/memspec/MemSpecHBM2.h"
+#include "DRAMSys/configuration/memspec/MemSpecHBM3.h"
 #include "DRAMSys/configuration/memspec/MemSpecLPDDR4.h"
+#include "DRAMSys/configuration/memspec/MemSpecLPDDR5.h"
 #include "DRAMSys/configuration/memspec/MemSpecSTTMRAM.h"
 #include "DRAMSys/configuration/memspec/MemSpecWideIO.h"
 #include "DRAMSys/configuration/memspec/MemSpecWideIO2.h"
 
-#ifdef DDR5_SIM
-#include "DRAMSys/configuration/memspec/MemSpecDDR5.h"
-#endif
-#include "DRAMSys/configuration/memspec/MemSpecLPDDR5.h"
-#ifdef HBM3_SIM
-#include "DRAMSys/configuration/memspec/MemSpecHBM3.h"
-#endif
-
 #include <cstdlib>
 #include <iostream>
 #include <memory>
@@ -79,7 +74,8 @@ namespace DRAMSys
 
 DRAMSys::DRAMSys(const sc_core::sc_module_name& name, const Config::Configuration& config) :
     sc_module(name),
-    memSpec(createMemSpec(config.memspec)),
+    memSpecConfig(applyRefreshMode(config)),
+    memSpec(createMemSpec(memSpecConfig)),
     simConfig(config.simconfig),
     mcConfig(config.mcconfig, *memSpec),
     addressDecoder(std::make_unique<AddressDecoder>(config.addressmapping)),
@@ -92,13 +88,16 @@ DRAMSys::DRAMSys(const sc_core::sc_module_name& name, const Config::Configuratio
     // Setup the debug manager:
     setupDebugManager(simConfig.simulationName);
 
+    std::string traceName = simConfig.simulationName;
+    if (!config.simulationid.empty())
+        traceName = config.simulationid + '_' + traceName;
+
+    if (simConfig.metricsExport != Config::MetricsExportType::None)
+        setupMetricsSink(traceName);
+
     // Instantiate all internal DRAMSys modules:
     if (simConfig.databaseRecording)
     {
-        std::string traceName = simConfig.simulationName;
-        if (!config.simulationid.empty())
-            traceName = config.simulationid + '_' + traceName;
-
         // Create and properly initialize TLM recorders.
         // They need to be ready before creating some modules.
         setupTlmRecorders(traceName, config);
@@ -112,10 +111,16 @@ DRAMSys::DRAMSys(const sc_core::sc_module_name& name, const Config::Configuratio
                                              *memSpec,
                                              simConfig,
                                              *addressDecoder,
-                                             &tlmRecorders[i]));
+                                             &tlmRecorders[i],
+                                             metricsSink.get(),
+                                             i));
 
-            drams.emplace_back(std::make_unique<Dram>(
-                ("dram" + std::to_string(i)).c_str(), simConfig, *memSpec, &tlmRecorders[i]));
+            drams.emplace_back(std::make_unique<Dram>(("dram" + std::to_string(i)).c_str(),
+                                                      simConfig,
+                                                      *memSpec,
+                                                      &tlmRecorders[i],
+                                                      metricsSink.get(),
+                                                      i));
 
             if (simConfig.checkTLM2Protocol)
                 controllersTlmCheckers.emplace_back(
@@ -149,10 +154,16 @@ DRAMSys::DRAMSys(const sc_core::sc_module_name& name, const Config::Configuratio
                                              *memSpec,
                                              simConfig,
                                              *addressDecoder,
-                                             nullptr));
+                                             nullptr,
+                                             metricsSink.get(),
+                                             i));
 
-            drams.emplace_back(std::make_unique<Dram>(
-                ("dram" + std::to_string(i)).c_str(), simConfig, *memSpec, nullptr));
+            drams.emplace_back(std::make_unique<Dram>(("dram" + std::to_string(i)).c_str(),
+                                                      simConfig,
+                                                      *memSpec,
+                                                      nullptr,
+                                                      metricsSink.get(),
+                                                      i));
 
             if (simConfig.checkTLM2Protocol)
             {
@@ -218,19 +229,22 @@ void DRAMSys::setupTlmRecorders(const std::string& traceName, const Config::Conf
     tlmRecorders.reserve(memSpec->numberOfChannels);
     for (std::size_t i = 0; i < memSpec->numberOfChannels; i++)
     {
+        std::string extension =
+            simConfig.recordingFormat == Config::RecordingFormatType::Columnar ? ".tcb" : ".tdb";
         std::string dbName =
-            std::string(name()) + "_" + traceName + "_ch" + std::to_string(i) + ".tdb";
+            std::string(name()) + "_" + traceName + "_ch" + std::to_string(i) + extension;
         std::string recorderName = "tlmRecorder" + std::to_string(i);
 
         nlohmann::json mcconfig;
         nlohmann::json memspec;
         mcconfig[Config::McConfig::KEY] = config.mcconfig;
-        memspec[Config::MemSpecConstants::KEY] = config.memspec;
+        memspec[Config::MemSpecConstants::KEY] = memSpecConfig;
 
         tlmRecorders.emplace_back(recorderName,
                                   simConfig,
                                   mcConfig,
                                   *memSpec,
+                                  *addressDecoder,
                                   dbName,
                                   mcconfig.dump(),
                                   memspec.dump(),
@@ -238,6 +252,19 @@ void DRAMSys::setupTlmRecorders(const std::string& traceName, const Config::Conf
     }
 }
 
+void DRAMSys::setupMetricsSink(const std::string& traceName)
+{
+    std::string output = simConfig.metricsOutput;
+    if (output.empty())
+    {
+        std::string extension =
+            simConfig.metricsExport == Config::MetricsExportType::CSV ? ".csv" : ".jsonl";
+        output = std::string(name()) + "_" + traceName + "_metrics" + extension;
+    }
+
+    metricsSink = std::make_unique<StreamMetricsSink>(output, simConfig.metricsExport);
+}
+
 bool DRAMSys::idle() const
 {
     return std::all_of(controllers.cbegin(),
@@ -253,6 +280,18 @@ void DRAMSys::registerIdleCallback(const std::function<void()>& idleCallback)
     }
 }
 
+void DRAMSys::startRecording()
+{
+    for (auto& tlmRecorder : tlmRecorders)
+        tlmRecorder.startRecording();
+}
+
+void DRAMSys::stopRecording()
+{
+    for (auto& tlmRecorder : tlmRecorders)
+        tlmRecorder.stopRecording();
+}
+
 void DRAMSys::end_of_simulation()
 {
     if (simConfig.powerAnalysis)
@@ -266,6 +305,9 @@ void DRAMSys::end_of_simulation()
         for (auto& tlmRecorder : tlmRecorders)
             tlmRecorder.finalize();
     }
+
+    if (metricsSink)
+        metricsSink->close();
 }
 
 void DRAMSys::logo()
@@ -333,16 +375,12 @@ std::unique_ptr<const MemSpec> DRAMSys::createMemSpec(const DRAMUtils::MemSpec::
             return std::make_unique<const MemSpecGDDR6>(v);
         else if constexpr (std::is_same_v<T, DRAMUtils::MemSpec::MemSpecSTTMRAM>)
             return std::make_unique<const MemSpecSTTMRAM>(v);
-#ifdef DDR5_SIM
         else if constexpr ((std::is_same_v<T, DRAMUtils::MemSpec::MemSpecDDR5>))
             return std::make_unique<const MemSpecDDR5>(v);
-#endif
         else if constexpr ((std::is_same_v<T, DRAMUtils::MemSpec::MemSpecLPDDR5>))
             return std::make_unique<const MemSpecLPDDR5>(v);
-#ifdef HBM3_SIM
         else if constexpr ((std::is_same_v<T, DRAMUtils::MemSpec::MemSpecHBM3>))
             return std::make_unique<const MemSpecHBM3>(v);
-#endif
         else
         {
             SC_REPORT_FATAL("Configuration", "Unsupported DRAM type");
@@ -351,6 +389,42 @@ std::unique_ptr<const MemSpec> DRAMSys::createMemSpec(const DRAMUtils::MemSpec::
     }, memSpec.getVariant());
 }
 
+DRAMUtils::MemSpec::MemSpecVariant DRAMSys::applyRefreshMode(const Config::Configuration& config)
+{
+    using DRAMUtils::MemSpec::RefModeTypeDDR4;
+    using DRAMUtils::MemSpec::RefModeTypeDDR5;
+
+    DRAMUtils::MemSpec::MemSpecVariant memSpec = config.memspec;
+    Config::RefreshPolicyType refreshPolicy =
+        config.mcconfig.RefreshPolicy.value_or(McConfig::DEFAULT_REFRESH_POLICY);
+
+    if (refreshPolicy != Config::RefreshPolicyType::AllBank2x &&
+        refreshPolicy != Config::RefreshPolicyType::AllBank4x)
+        return memSpec;
+
+    // Fine granularity refresh overrides the refresh mode of the memspec, the memspec then
+    // provides the shortened refresh interval and the matching tRFC
+    bool fourTimes = refreshPolicy == Config::RefreshPolicyType::AllBank4x;
+    std::visit([fourTimes](auto& v) {
+        using T = std::decay_t<decltype(v)>;
+
+        if constexpr (std::is_same_v<T, DRAMUtils::MemSpec::MemSpecDDR4>)
+            v.memarchitecturespec.RefMode =
+                fourTimes ? RefModeTypeDDR4::REF_MODE_4 : RefModeTypeDDR4::REF_MODE_2;
+        else if constexpr (std::is_same_v<T, DRAMUtils::MemSpec::MemSpecDDR5>)
+        {
+            if (fourTimes)
+                SC_REPORT_FATAL("Configuration", "DDR5 supports fine granularity refresh 2x only");
+            v.memarchitecturespec.RefMode = RefModeTypeDDR5::REF_MODE_2;
+        }
+        else
+            SC_REPORT_FATAL("Configuration",
+                            "Fine granularity refresh not supported by this memory standard");
+    }, memSpec.getVariant());
+
+    return memSpec;
+}
+
 std::unique_ptr<Arbiter> DRAMSys::createArbiter(const SimConfig& simConfig,
                                                 const McConfig& mcConfig,
                                                 const MemSpec& memSpec,
@@ -43,6 +43,7 @@
 #define DRAMSYS_H
 
 #include "DRAMSys/common/DramATRecorder.h"
+#include "DRAMSys/common/StreamMetricsSink.h"
 #include "DRAMSys/common/TlmATRecorder.h"
 #include "DRAMSys/common/TlmRecorder.h"
 #include "DRAMSys/common/tlm2_base_protocol_checker.h"
@@ -93,9 +94,20 @@ public:
      */
     void registerIdleCallback(const std::function<void()>& idleCallback);
 
+    /**
+     * Starts or stops the database recording of all channels at the current simulation time.
+     * Requests that are already in flight are recorded completely. Calling stopRecording() before
+     * the simulation starts leaves the recording entirely to the caller.
+     * Has no effect if DatabaseRecording is disabled.
+     */
+    void startRecording();
+    void stopRecording();
+
 private:
     static void logo();
     static std::unique_ptr<const MemSpec> createMemSpec(const DRAMUtils::MemSpec::MemSpecVariant& memSpec);
+    static DRAMUtils::MemSpec::MemSpecVariant
+    applyRefreshMode(const Config::Configuration& config);
     static std::unique_ptr<Arbiter> createArbiter(const SimConfig& simConfig,
                                                   const McConfig& mcConfig,
                                                   const MemSpec& memSpec,
@@ -105,15 +117,21 @@ private:
 
     void setupDebugManager(const std::string& traceName) const;
     void setupTlmRecorders(const std::string& traceName, const Config::Configuration& configLib);
+    void setupMetricsSink(const std::string& traceName);
 
     void report();
 
+    // Memspec with the refresh mode of the RefreshPolicy, referenced by memSpec
+    const DRAMUtils::MemSpec::MemSpecVariant memSpecConfig;
     std::unique_ptr<const MemSpec> memSpec;
     SimConfig simConfig;
     McConfig mcConfig;
 
     std::unique_ptr<AddressDecoder> addressDecoder;
 
+    // Live metrics of all channels, only created if MetricsExport is enabled
+    std::unique_ptr<MetricsSinkIF> metricsSink;
+
     // TLM 2.0 Protocol Checkers
     std::vector<std::unique_ptr<tlm_utils::tlm2_base_protocol_checker<>>> controllersTlmCheckers;
 
@@ -43,16 +43,23 @@
 
 #include "DRAMSys/common/DebugManager.h"
 #include "DRAMSys/common/TlmRecorder.h"
+#include "DRAMSys/common/utils.h"
 #include "DRAMSys/config/SimConfig.h"
 #include <sysc/kernel/sc_module.h>
 
+#include <algorithm>
 #include <cassert>
+#include <cerrno>
 #include <cstdlib>
+#include <cstring>
 
 #ifdef _WIN32
 #include <windows.h>
 #else
+#include <fcntl.h>
 #include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #endif
 
 #include <DRAMPower/command/Command.h>
@@ -66,16 +73,35 @@ namespace DRAMSys
 Dram::Dram(const sc_module_name& name,
            const SimConfig& simConfig,
            const MemSpec& memSpec,
-           TlmRecorder* tlmRecorder) :
+           TlmRecorder* tlmRecorder,
+           MetricsSinkIF* metricsSink,
+           unsigned int channel) :
     sc_module(name),
     memSpec(memSpec),
     storeMode(simConfig.storeMode),
     channelSize(memSpec.getSimMemSizeInBytes() / memSpec.numberOfChannels),
     useMalloc(simConfig.useMalloc),
+    storageBackend(simConfig.storageBackend),
     tlmRecorder(tlmRecorder),
+    metricsSink(metricsSink),
+    enableWindowing(simConfig.enableWindowing),
     powerWindowSize(memSpec.tCK * simConfig.windowSize)
 {
-    if (storeMode == Config::StoreModeType::Store)
+    powerMetrics.type = MetricsRecord::Type::Power;
+    powerMetrics.channel = channel;
+
+    if (storeMode == Config::StoreModeType::Store &&
+        storageBackend == Config::StorageBackendType::Sparse)
+    {
+        sparseMemory = std::make_unique<SparseMemory>(channelSize, simConfig.storagePageSize);
+    }
+    else if (storeMode == Config::StoreModeType::Store &&
+             (storageBackend == Config::StorageBackendType::SharedMemory ||
+              storageBackend == Config::StorageBackendType::File))
+    {
+        memory = mapSharedStorage(simConfig.storagePath + "." + basename());
+    }
+    else if (storeMode == Config::StoreModeType::Store)
     {
         if (useMalloc)
         {
@@ -116,14 +142,60 @@ Dram::Dram(const sc_module_name& name,
         }
     }
 
-    if (simConfig.powerAnalysis && simConfig.enableWindowing)
+    if (simConfig.powerAnalysis && (simConfig.enableWindowing || metricsSink != nullptr))
         SC_THREAD(powerWindow);
 }
 
 Dram::~Dram()
 {
-    if (useMalloc)
+    if (memory == nullptr)
+        return;
+
+    if (storageBackend == Config::StorageBackendType::Flat && useMalloc)
         free(memory);
+#ifndef _WIN32
+    else
+        munmap(memory, channelSize);
+#endif
+}
+
+unsigned char* Dram::mapSharedStorage(const std::string& path)
+{
+#ifdef _WIN32
+    SC_REPORT_FATAL("Dram", "On Windows shared storage is not yet supported");
+    return nullptr;
+#else
+    // POSIX shared memory objects live in /dev/shm, their name has a single leading slash
+    int fileDescriptor = (storageBackend == Config::StorageBackendType::SharedMemory)
+                             ? shm_open(("/" + path).c_str(), O_RDWR | O_CREAT, 0600)
+                             : open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fileDescriptor < 0)
+        SC_REPORT_FATAL(name(),
+                        ("Could not open storage " + path + ": " + std::strerror(errno)).c_str());
+
+    // An existing image is attached with its contents, a new one is created with zeros
+    struct stat status{};
+    if (fstat(fileDescriptor, &status) != 0 ||
+        (static_cast<uint64_t>(status.st_size) < channelSize &&
+         ftruncate(fileDescriptor, static_cast<off_t>(channelSize)) != 0))
+    {
+        const int error = errno;
+        close(fileDescriptor);
+        SC_REPORT_FATAL(name(),
+                        ("Could not resize storage " + path + ": " + std::strerror(error)).c_str());
+    }
+
+    void* mapping =
+        mmap(nullptr, channelSize, PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, 0);
+    const int error = errno;
+    close(fileDescriptor);
+
+    if (mapping == MAP_FAILED)
+        SC_REPORT_FATAL(name(),
+                        ("Could not map storage " + path + ": " + std::strerror(error)).c_str());
+
+    return static_cast<unsigned char*>(mapping);
+#endif
 }
 
 void Dram::reportPower()
@@ -144,6 +216,8 @@ void Dram::reportPower()
               << energy / time << std::string(" W")
               << std::endl;
 
+    reportPowerDownSavings();
+
     if (tlmRecorder != nullptr)
     {
         tlmRecorder->recordPower(sc_time_stamp().to_seconds(),
@@ -151,6 +225,47 @@ void Dram::reportPower()
     }
 }
 
+void Dram::reportPowerDownSavings()
+{
+    DRAMPower::timestamp_t timestamp = DRAMPower->getLastCommandTime();
+    DRAMPower::energy_t coreEnergy = DRAMPower->calcCoreEnergy(timestamp);
+    DRAMPower::SimulationStats stats = DRAMPower->getWindowStats(timestamp);
+
+    uint64_t activeCycles = 0;
+    uint64_t prechargedCycles = 0;
+    uint64_t activePowerDownCycles = 0;
+    uint64_t prechargedPowerDownCycles = 0;
+    for (const auto& rank : stats.rank_total)
+    {
+        activeCycles += rank.cycles.act;
+        prechargedCycles += rank.cycles.pre;
+        activePowerDownCycles += rank.cycles.powerDownAct;
+        prechargedPowerDownCycles += rank.cycles.powerDownPre + rank.cycles.selfRefresh;
+    }
+
+    if (activePowerDownCycles + prechargedPowerDownCycles == 0)
+        return;
+
+    // The power-down cycles are charged with the average standby energy per cycle that the
+    // rank consumes while it is awake
+    DRAMPower::energy_info_t bankEnergy = coreEnergy.aggregated_bank_energy();
+    double activeStandbyEnergy = 0.0;
+    if (activeCycles != 0)
+        activeStandbyEnergy = (bankEnergy.E_bg_act + coreEnergy.E_bg_act_shared) /
+                              static_cast<double>(activeCycles) *
+                              static_cast<double>(activePowerDownCycles);
+    double prechargedStandbyEnergy = 0.0;
+    if (prechargedCycles != 0)
+        prechargedStandbyEnergy = bankEnergy.E_bg_pre / static_cast<double>(prechargedCycles) *
+                                  static_cast<double>(prechargedPowerDownCycles);
+
+    double savedEnergy = activeStandbyEnergy + prechargedStandbyEnergy - coreEnergy.E_PDNA -
+                         coreEnergy.E_PDNP - coreEnergy.E_sref;
+
+    std::cout << name() << std::string("  PD Energy Saved: ") << std::defaultfloat
+              << std::setprecision(3) << savedEnergy << std::string(" J") << std::endl;
+}
+
 tlm_sync_enum Dram::nb_transport_fw(tlm_generic_payload& trans, tlm_phase& phase, sc_time& delay)
 {
     assert(phase >= BEGIN_RD && phase <= END_SREF);
@@ -249,54 +364,108 @@ void Dram::b_transport(tlm_generic_payload& trans, [[maybe_unused]] sc_time& del
 
 void Dram::executeRead(tlm::tlm_generic_payload& trans) const
 {
-    unsigned char* phyAddr = memory + trans.get_address();
-
-    if (trans.get_byte_enable_ptr() == nullptr)
+    if (!sparseMemory)
     {
-        memcpy(trans.get_data_ptr(), phyAddr, trans.get_data_length());
+        copyData(trans.get_data_ptr(),
+                 memory + trans.get_address(),
+                 trans.get_data_length(),
+                 trans,
+                 0);
+        return;
     }
-    else
+
+    // Transactions are split at page boundaries of the sparse storage
+    for (std::size_t offset = 0; offset < trans.get_data_length();)
     {
-        for (std::size_t i = 0; i < trans.get_data_length(); i++)
-        {
-            std::size_t byteEnableIndex = i % trans.get_byte_enable_length();
-            if (trans.get_byte_enable_ptr()[byteEnableIndex] == TLM_BYTE_ENABLED)
-            {
-                trans.get_data_ptr()[i] = phyAddr[i];
-            }
-        }
+        uint64_t address = trans.get_address() + offset;
+        std::size_t length = std::min<uint64_t>(trans.get_data_length() - offset,
+                                                sparseMemory->bytesToPageEnd(address));
+        copyData(trans.get_data_ptr() + offset,
+                 sparseMemory->readPointer(address),
+                 length,
+                 trans,
+                 offset);
+        offset += length;
     }
 }
 
 void Dram::executeWrite(const tlm::tlm_generic_payload& trans)
 {
-    unsigned char* phyAddr = memory + trans.get_address();
+    if (!sparseMemory)
+    {
+        copyData(memory + trans.get_address(),
+                 trans.get_data_ptr(),
+                 trans.get_data_length(),
+                 trans,
+                 0);
+        return;
+    }
+
+    for (std::size_t offset = 0; offset < trans.get_data_length();)
+    {
+        uint64_t address = trans.get_address() + offset;
+        std::size_t length = std::min<uint64_t>(trans.get_data_length() - offset,
+                                                sparseMemory->bytesToPageEnd(address));
+        copyData(sparseMemory->writePointer(address),
+                 trans.get_data_ptr() + offset,
+                 length,
+                 trans,
+                 offset);
+        offset += length;
+    }
+}
 
+void Dram::copyData(unsigned char* destination,
+                    const unsigned char* source,
+                    std::size_t length,
+                    const tlm::tlm_generic_payload& trans,
+                    std::size_t offset)
+{
     if (trans.get_byte_enable_ptr() == nullptr)
     {
-        memcpy(phyAddr, trans.get_data_ptr(), trans.get_data_length());
+        memcpy(destination, source, length);
     }
     else
     {
-        for (std::size_t i = 0; i < trans.get_data_length(); i++)
-        {
-            std::size_t byteEnableIndex = i % trans.get_byte_enable_length();
-            if (trans.get_byte_enable_ptr()[byteEnableIndex] == TLM_BYTE_ENABLED)
-            {
-                phyAddr[i] = trans.get_data_ptr()[i];
-            }
-        }
+        maskedCopy(destination,
+                   source,
+                   length,
+                   trans.get_byte_enable_ptr(),
+                   trans.get_byte_enable_length(),
+                   offset);
     }
 }
 
 void Dram::serialize(std::ostream& stream) const
 {
-    stream.write(reinterpret_cast<char const*>(memory), channelSize);
+    if (sparseMemory)
+        sparseMemory->serialize(stream);
+    else
+        stream.write(reinterpret_cast<char const*>(memory), channelSize);
 }
 
 void Dram::deserialize(std::istream& stream)
 {
-    stream.read(reinterpret_cast<char*>(memory), channelSize);
+    if (sparseMemory)
+        sparseMemory->deserialize(stream);
+    else
+        stream.read(reinterpret_cast<char*>(memory), channelSize);
+}
+
+SparseMemory::Snapshot Dram::snapshot() const
+{
+    if (!sparseMemory)
+        SC_REPORT_FATAL(name(), "Snapshots require the sparse storage backend");
+
+    return sparseMemory->snapshot();
+}
+
+void Dram::restore(const SparseMemory::Snapshot& snapshot)
+{
+    if (!sparseMemory)
+        SC_REPORT_FATAL(name(), "Snapshots require the sparse storage backend");
+
+    sparseMemory->restore(snapshot);
 }
 
 void Dram::powerWindow()
@@ -316,17 +485,25 @@ void Dram::powerWindow()
 
         currentEnergy = this->DRAMPower->getTotalEnergy(clkCycles);
         windowEnergy = currentEnergy - previousEnergy;
+        previousEnergy = currentEnergy;
 
         // During operation the energy should never be zero since the device is always consuming
         assert(!(windowEnergy < 1e-15));
 
-        if (tlmRecorder)
+        if (tlmRecorder && enableWindowing)
         {
             // Store the time (in seconds) and the current average power (in mW) into the database
             tlmRecorder->recordPower(sc_time_stamp().to_seconds(),
                                      windowEnergy / powerWindowSizeSeconds);
         }
 
+        if (metricsSink != nullptr)
+        {
+            powerMetrics.time = sc_time_stamp().to_seconds();
+            powerMetrics.power = windowEnergy / powerWindowSizeSeconds;
+            metricsSink->publish(powerMetrics);
+        }
+
         // Here considering that DRAMPower provides the energy in J and the power in W
         PRINTDEBUGMESSAGE(this->name(),
                           std::string("\tWindow Energy: \t") +
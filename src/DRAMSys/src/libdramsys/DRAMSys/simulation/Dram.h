@@ -43,10 +43,12 @@
 #define DRAM_H
 
 #include "DRAMSys/common/Deserialize.h"
+#include "DRAMSys/common/MetricsSinkIF.h"
 #include "DRAMSys/common/Serialize.h"
 #include "DRAMSys/common/TlmRecorder.h"
 #include "DRAMSys/configuration/memspec/MemSpec.h"
 #include "DRAMSys/simulation/SimConfig.h"
+#include "DRAMSys/simulation/SparseMemory.h"
 
 #include <DRAMPower/command/CmdType.h>
 #include <DRAMPower/dram/dram_base.h>
@@ -65,20 +67,32 @@ protected:
 
     // Data Storage:
     const Config::StoreModeType storeMode;
-    unsigned char* memory;
+    unsigned char* memory = nullptr;
     const uint64_t channelSize;
     const bool useMalloc;
+    const Config::StorageBackendType storageBackend;
+    std::unique_ptr<SparseMemory> sparseMemory;
+
+    // Maps a shared memory object or file of the channel size, external processes can map it
+    // as well to access the storage while the simulation runs
+    unsigned char* mapSharedStorage(const std::string& path);
 
     TlmRecorder* const tlmRecorder;
+    MetricsSinkIF* const metricsSink;
+    const bool enableWindowing;
     sc_core::sc_time powerWindowSize;
+    MetricsRecord powerMetrics;
 
     std::unique_ptr<DRAMPower::dram_base<DRAMPower::CmdType>> DRAMPower;
 
     // This Thread is only triggered when Power Simulation is enabled.
     // It estimates the current average power which will be stored in the trace database for
-    // visualization purposes.
+    // visualization purposes and published to the metrics sink.
     void powerWindow();
 
+    // Estimates the background energy saved by power-down and self-refresh
+    void reportPowerDownSavings();
+
     virtual tlm::tlm_sync_enum nb_transport_fw(tlm::tlm_generic_payload& trans,
                                                tlm::tlm_phase& phase,
                                                sc_core::sc_time& delay);
@@ -88,11 +102,21 @@ protected:
     void executeRead(tlm::tlm_generic_payload& trans) const;
     void executeWrite(const tlm::tlm_generic_payload& trans);
 
+    // Copies length bytes, offset is the position of the first byte in the payload and selects
+    // the byte enables
+    static void copyData(unsigned char* destination,
+                         const unsigned char* source,
+                         std::size_t length,
+                         const tlm::tlm_generic_payload& trans,
+                         std::size_t offset);
+
 public:
     Dram(const sc_core::sc_module_name& name,
          const SimConfig& simConfig,
          const MemSpec& memSpec,
-         TlmRecorder* tlmRecorder);
+         TlmRecorder* tlmRecorder,
+         MetricsSinkIF* metricsSink,
+         unsigned int channel);
     SC_HAS_PROCESS(Dram);
 
     Dram(const Dram&) = delete;
@@ -111,6 +135,10 @@ public:
 
     void serialize(std::ostream& stream) const override;
     void deserialize(std::istream& stream) override;
+
+    // Copy-on-write checkpoints, only supported by the sparse storage backend
+    [[nodiscard]] SparseMemory::Snapshot snapshot() const;
+    void restore(const SparseMemory::Snapshot& snapshot);
 };
 
 } // namespace DRAMSys
@@ -45,9 +45,18 @@ namespace DRAMSys
 SimConfig::SimConfig(const Config::SimConfig& simConfig) :
     simulationName(simConfig.SimulationName.value_or(DEFAULT_SIMULATION_NAME.data())),
     databaseRecording(simConfig.DatabaseRecording.value_or(DEFAULT_DATABASE_RECORDING)),
+    recordingFormat(simConfig.RecordingFormat.value_or(DEFAULT_RECORDING_FORMAT)),
+    recordingMode(simConfig.RecordingMode.value_or(DEFAULT_RECORDING_MODE)),
+    recordingSampling(simConfig.RecordingSampling.value_or(DEFAULT_RECORDING_SAMPLING)),
+    recordingStart(simConfig.RecordingStart.value_or(DEFAULT_RECORDING_START)),
+    recordingStop(simConfig.RecordingStop.value_or(DEFAULT_RECORDING_STOP)),
+    recordingFilter(simConfig.RecordingFilter),
     powerAnalysis(simConfig.PowerAnalysis.value_or(DEFAULT_POWER_ANALYSIS)),
     enableWindowing(simConfig.EnableWindowing.value_or(DEFAULT_ENABLE_WINDOWING)),
     windowSize(simConfig.WindowSize.value_or(DEFAULT_WINDOW_SIZE)),
+    metricsExport(simConfig.MetricsExport.value_or(DEFAULT_METRICS_EXPORT)),
+    // An empty output selects a file named after the simulation and the trace
+    metricsOutput(simConfig.MetricsOutput.value_or("")),
     debug(simConfig.Debug.value_or(DEFAULT_DEBUG)),
     simulationProgressBar(
         simConfig.SimulationProgressBar.value_or(DEFAULT_SIMULATION_PROGRESS_BAR)),
@@ -55,11 +64,45 @@ SimConfig::SimConfig(const Config::SimConfig& simConfig) :
     useMalloc(simConfig.UseMalloc.value_or(DEFAULT_USE_MALLOC)),
     addressOffset(simConfig.AddressOffset.value_or(DEFAULT_ADDRESS_OFFSET)),
     storeMode(simConfig.StoreMode.value_or(DEFAULT_STORE_MODE)),
+    storageBackend(simConfig.StorageBackend.value_or(DEFAULT_STORAGE_BACKEND)),
+    storagePageSize(simConfig.StoragePageSize.value_or(DEFAULT_STORAGE_PAGE_SIZE)),
+    // The storage of each channel is named after the simulation by default
+    storagePath(simConfig.StoragePath.value_or(simulationName)),
     togglingRate(simConfig.TogglingRate)
 {
     if (storeMode == Config::StoreModeType::Invalid)
         SC_REPORT_FATAL("SimConfig", "Invalid StoreMode");
 
+    if (recordingFormat == Config::RecordingFormatType::Invalid)
+        SC_REPORT_FATAL("SimConfig", "Invalid RecordingFormat");
+
+    if (recordingMode == Config::RecordingModeType::Invalid)
+        SC_REPORT_FATAL("SimConfig", "Invalid RecordingMode");
+
+    if (recordingSampling == 0)
+        SC_REPORT_FATAL("SimConfig", "Minimum recording sampling is 1");
+
+    if (recordingStart < 0)
+        SC_REPORT_FATAL("SimConfig", "RecordingStart must not be negative");
+
+    if (recordingStop < recordingStart)
+        SC_REPORT_FATAL("SimConfig", "RecordingStop must not be before RecordingStart");
+
+    if (storageBackend == Config::StorageBackendType::Invalid)
+        SC_REPORT_FATAL("SimConfig", "Invalid StorageBackend");
+
+    // POSIX shared memory object names must not contain a slash after the leading one
+    if (storageBackend == Config::StorageBackendType::SharedMemory &&
+        storagePath.find('/') != std::string::npos)
+        SC_REPORT_FATAL("SimConfig",
+                        "StoragePath of the SharedMemory backend must not contain '/'");
+
+    if (storagePageSize == 0 || (storagePageSize & (storagePageSize - 1)) != 0)
+        SC_REPORT_FATAL("SimConfig", "StoragePageSize must be a power of two");
+
+    if (metricsExport == Config::MetricsExportType::Invalid)
+        SC_REPORT_FATAL("SimConfig", "Invalid MetricsExport");
+
     if (windowSize == 0)
         SC_REPORT_FATAL("SimConfig", "Minimum window size is 1");
 }
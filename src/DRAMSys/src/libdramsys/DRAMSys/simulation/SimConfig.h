@@ -40,6 +40,7 @@
 #include <DRAMSys/config/SimConfig.h>
 #include <DRAMUtils/config/toggling_rate.h>
 
+#include <limits>
 #include <string>
 #include <optional>
 
@@ -52,28 +53,51 @@ struct SimConfig
 
     std::string simulationName;
     bool databaseRecording;
+    Config::RecordingFormatType recordingFormat;
+    Config::RecordingModeType recordingMode;
+    unsigned int recordingSampling;
+    double recordingStart;
+    double recordingStop;
+    std::optional<Config::RecordingFilterConfig> recordingFilter;
     bool powerAnalysis;
     bool enableWindowing;
     unsigned int windowSize;
+    Config::MetricsExportType metricsExport;
+    std::string metricsOutput;
     bool debug;
     bool simulationProgressBar;
     bool checkTLM2Protocol;
     bool useMalloc;
     unsigned long long int addressOffset;
     Config::StoreModeType storeMode;
+    Config::StorageBackendType storageBackend;
+    uint64_t storagePageSize;
+    std::string storagePath;
     std::optional<DRAMUtils::Config::ToggleRateDefinition> togglingRate;
 
     static constexpr std::string_view DEFAULT_SIMULATION_NAME = "default";
     static constexpr bool DEFAULT_DATABASE_RECORDING = false;
+    static constexpr Config::RecordingFormatType DEFAULT_RECORDING_FORMAT =
+        Config::RecordingFormatType::SQLite;
+    static constexpr Config::RecordingModeType DEFAULT_RECORDING_MODE =
+        Config::RecordingModeType::Full;
+    static constexpr unsigned int DEFAULT_RECORDING_SAMPLING = 1;
+    static constexpr double DEFAULT_RECORDING_START = 0.0;
+    static constexpr double DEFAULT_RECORDING_STOP = std::numeric_limits<double>::infinity();
     static constexpr bool DEFAULT_POWER_ANALYSIS = false;
     static constexpr bool DEFAULT_ENABLE_WINDOWING = false;
     static constexpr unsigned int DEFAULT_WINDOW_SIZE = 1000;
+    static constexpr Config::MetricsExportType DEFAULT_METRICS_EXPORT =
+        Config::MetricsExportType::None;
     static constexpr bool DEFAULT_DEBUG = false;
     static constexpr bool DEFAULT_SIMULATION_PROGRESS_BAR = false;
     static constexpr bool DEFAULT_CHECK_TLM2_PROTOCOL = false;
     static constexpr bool DEFAULT_USE_MALLOC = false;
     static constexpr unsigned long long int DEFAULT_ADDRESS_OFFSET = 0;
     static constexpr Config::StoreModeType DEFAULT_STORE_MODE = Config::StoreModeType::NoStorage;
+    static constexpr Config::StorageBackendType DEFAULT_STORAGE_BACKEND =
+        Config::StorageBackendType::Flat;
+    static constexpr uint64_t DEFAULT_STORAGE_PAGE_SIZE = 4096;
 };
 
 } // namespace DRAMSys
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "SparseMemory.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <systemc>
+#include <utility>
+
+namespace DRAMSys
+{
+
+SparseMemory::Snapshot::Snapshot(PageTable pageTable, uint64_t pageSize) :
+    pageTable(std::move(pageTable)),
+    pageSize(pageSize)
+{
+}
+
+void SparseMemory::Snapshot::serialize(std::ostream& stream) const
+{
+    serializePageTable(stream, pageTable, pageSize);
+}
+
+SparseMemory::SparseMemory(uint64_t size, uint64_t pageSize) :
+    pageSize(pageSize),
+    pageShift(static_cast<unsigned>(__builtin_ctzll(pageSize))),
+    zeroPage(new unsigned char[pageSize]())
+{
+    uint64_t numberOfPages = (size + pageSize - 1) >> pageShift;
+    pageTable.resize((numberOfPages + PAGES_PER_DIRECTORY - 1) / PAGES_PER_DIRECTORY);
+}
+
+const unsigned char* SparseMemory::readPointer(uint64_t address) const
+{
+    uint64_t pageIndex = address >> pageShift;
+    const std::shared_ptr<Directory>& directory = pageTable[pageIndex / PAGES_PER_DIRECTORY];
+    if (!directory)
+        return zeroPage.get() + (address & (pageSize - 1));
+
+    const Page& page = (*directory)[pageIndex % PAGES_PER_DIRECTORY];
+    if (!page)
+        return zeroPage.get() + (address & (pageSize - 1));
+
+    return page.get() + (address & (pageSize - 1));
+}
+
+unsigned char* SparseMemory::writePointer(uint64_t address)
+{
+    uint64_t pageIndex = address >> pageShift;
+    std::shared_ptr<Directory>& directory = pageTable[pageIndex / PAGES_PER_DIRECTORY];
+
+    // Directories and pages that are still referenced by a snapshot are copied before the
+    // first write
+    if (!directory)
+        directory = std::make_shared<Directory>(PAGES_PER_DIRECTORY);
+    else if (directory.use_count() > 1)
+        directory = std::make_shared<Directory>(*directory);
+
+    Page& page = (*directory)[pageIndex % PAGES_PER_DIRECTORY];
+    if (!page)
+    {
+        page = allocatePage();
+    }
+    else if (page.use_count() > 1)
+    {
+        Page copy = allocatePage();
+        std::memcpy(copy.get(), page.get(), pageSize);
+        page = std::move(copy);
+    }
+
+    return page.get() + (address & (pageSize - 1));
+}
+
+SparseMemory::Page SparseMemory::allocatePage() const
+{
+    // Large allocations of calloc are mapped from the operating system and zeroed lazily
+    auto* page = static_cast<unsigned char*>(std::calloc(pageSize, 1));
+    if (page == nullptr)
+        SC_REPORT_FATAL("SparseMemory", "Memory allocation failed");
+
+    return {page, std::free};
+}
+
+SparseMemory::Snapshot SparseMemory::snapshot() const
+{
+    return {pageTable, pageSize};
+}
+
+void SparseMemory::restore(const Snapshot& snapshot)
+{
+    if (snapshot.pageSize != pageSize || snapshot.pageTable.size() != pageTable.size())
+        SC_REPORT_FATAL("SparseMemory", "Snapshot does not match the memory geometry");
+
+    pageTable = snapshot.pageTable;
+}
+
+uint64_t SparseMemory::allocatedPages() const
+{
+    return countPages(pageTable);
+}
+
+uint64_t SparseMemory::countPages(const PageTable& pageTable)
+{
+    uint64_t numberOfPages = 0;
+    for (const auto& directory : pageTable)
+    {
+        if (!directory)
+            continue;
+
+        for (const auto& page : *directory)
+        {
+            if (page)
+                numberOfPages++;
+        }
+    }
+    return numberOfPages;
+}
+
+void SparseMemory::serializePageTable(std::ostream& stream,
+                                      const PageTable& pageTable,
+                                      uint64_t pageSize)
+{
+    uint64_t numberOfPages = countPages(pageTable);
+    stream.write(reinterpret_cast<const char*>(&pageSize), sizeof(pageSize));
+    stream.write(reinterpret_cast<const char*>(&numberOfPages), sizeof(numberOfPages));
+
+    for (uint64_t directoryIndex = 0; directoryIndex < pageTable.size(); directoryIndex++)
+    {
+        if (!pageTable[directoryIndex])
+            continue;
+
+        const Directory& directory = *pageTable[directoryIndex];
+        for (uint64_t index = 0; index < directory.size(); index++)
+        {
+            if (!directory[index])
+                continue;
+
+            uint64_t pageIndex = directoryIndex * PAGES_PER_DIRECTORY + index;
+            stream.write(reinterpret_cast<const char*>(&pageIndex), sizeof(pageIndex));
+            stream.write(reinterpret_cast<const char*>(directory[index].get()),
+                         static_cast<std::streamsize>(pageSize));
+        }
+    }
+}
+
+void SparseMemory::serialize(std::ostream& stream) const
+{
+    serializePageTable(stream, pageTable, pageSize);
+}
+
+void SparseMemory::deserialize(std::istream& stream)
+{
+    uint64_t serializedPageSize = 0;
+    uint64_t numberOfPages = 0;
+    stream.read(reinterpret_cast<char*>(&serializedPageSize), sizeof(serializedPageSize));
+    stream.read(reinterpret_cast<char*>(&numberOfPages), sizeof(numberOfPages));
+
+    if (serializedPageSize != pageSize)
+        SC_REPORT_FATAL("SparseMemory", "Serialized page size does not match StoragePageSize");
+
+    for (auto& directory : pageTable)
+        directory.reset();
+
+    for (uint64_t page = 0; page < numberOfPages; page++)
+    {
+        uint64_t pageIndex = 0;
+        stream.read(reinterpret_cast<char*>(&pageIndex), sizeof(pageIndex));
+        if (pageIndex / PAGES_PER_DIRECTORY >= pageTable.size())
+            SC_REPORT_FATAL("SparseMemory", "Serialized page is out of range");
+
+        stream.read(reinterpret_cast<char*>(writePointer(pageIndex << pageShift)),
+                    static_cast<std::streamsize>(pageSize));
+    }
+}
+
+} // namespace DRAMSys
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SPARSEMEMORY_H
+#define SPARSEMEMORY_H
+
+#include "DRAMSys/common/Deserialize.h"
+#include "DRAMSys/common/Serialize.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace DRAMSys
+{
+
+/**
+ * Storage of one DRAM channel that only allocates the pages that were written. The pages are
+ * organized in a two-level page table whose directories and pages are shared with snapshots
+ * and only copied when they are written after a snapshot was taken (copy on write). Pages that
+ * were never written read as zeros and are neither allocated nor serialized.
+ */
+class SparseMemory : public Serialize, public Deserialize
+{
+    using Page = std::shared_ptr<unsigned char[]>;
+    using Directory = std::vector<Page>;
+    using PageTable = std::vector<std::shared_ptr<Directory>>;
+
+public:
+    // Immutable view of the memory at the time it was taken, it stays valid while the memory
+    // is written and can be serialized from another thread
+    class Snapshot : public Serialize
+    {
+    public:
+        void serialize(std::ostream& stream) const override;
+
+    private:
+        friend class SparseMemory;
+
+        Snapshot(PageTable pageTable, uint64_t pageSize);
+
+        PageTable pageTable;
+        uint64_t pageSize;
+    };
+
+    SparseMemory(uint64_t size, uint64_t pageSize);
+
+    [[nodiscard]] uint64_t getPageSize() const { return pageSize; }
+    [[nodiscard]] uint64_t bytesToPageEnd(uint64_t address) const
+    {
+        return pageSize - (address & (pageSize - 1));
+    }
+
+    // Pointers are only valid up to the end of the page of the address
+    [[nodiscard]] const unsigned char* readPointer(uint64_t address) const;
+    unsigned char* writePointer(uint64_t address);
+
+    [[nodiscard]] Snapshot snapshot() const;
+    void restore(const Snapshot& snapshot);
+
+    [[nodiscard]] uint64_t allocatedPages() const;
+
+    void serialize(std::ostream& stream) const override;
+    void deserialize(std::istream& stream) override;
+
+private:
+    static constexpr unsigned PAGES_PER_DIRECTORY = 512;
+
+    const uint64_t pageSize;
+    const unsigned pageShift;
+
+    PageTable pageTable;
+    const std::unique_ptr<unsigned char[]> zeroPage;
+
+    [[nodiscard]] Page allocatePage() const;
+    static uint64_t countPages(const PageTable& pageTable);
+    static void
+    serializePageTable(std::ostream& stream, const PageTable& pageTable, uint64_t pageSize);
+};
+
+} // namespace DRAMSys
+
+#endif // SPARSEMEMORY_H
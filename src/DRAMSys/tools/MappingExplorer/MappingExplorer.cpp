@@ -0,0 +1,580 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "MappingExplorer.h"
+
+#include <DRAMSys/simulation/AddressDecoder.h>
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string_view>
+#include <systemc>
+#include <thread>
+#include <utility>
+
+using DRAMSys::AddressDecoder;
+using DRAMSys::DecodedAddressSoA;
+using DRAMSys::Config::AddressMapping;
+
+namespace
+{
+
+enum class Field
+{
+    ColumnLow,
+    ColumnHigh,
+    Row,
+    Bank,
+    BankGroup,
+    Rank,
+    Stack,
+    Channel
+};
+
+unsigned countBits(const std::optional<std::vector<AddressMapping::BitEntry>>& bits)
+{
+    return bits.has_value() ? static_cast<unsigned>(bits->size()) : 0;
+}
+
+std::optional<std::vector<AddressMapping::BitEntry>> toBitEntries(const std::vector<unsigned>& bits)
+{
+    if (bits.empty())
+        return std::nullopt;
+
+    std::vector<AddressMapping::BitEntry> entries;
+    for (unsigned bit : bits)
+        entries.emplace_back(AddressMapping::BitEntry::Type::SINGLE, bit);
+    return entries;
+}
+
+// Parses the address of one STL/RSTL trace line: <time>: [(<length>)] <command> <address> [data]
+bool parseAddress(std::string_view line, uint64_t& address)
+{
+    if (line.empty() || line.front() == '#')
+        return false;
+
+    std::array<std::string_view, 4> tokens;
+    std::size_t numberOfTokens = 0;
+    std::size_t position = 0;
+    while (numberOfTokens < tokens.size())
+    {
+        position = line.find_first_not_of(" \t\r", position);
+        if (position == std::string_view::npos)
+            break;
+
+        std::size_t end = line.find_first_of(" \t\r", position);
+        if (end == std::string_view::npos)
+            end = line.size();
+
+        tokens[numberOfTokens++] = line.substr(position, end - position);
+        position = end;
+    }
+
+    if (numberOfTokens == 0)
+        return false;
+
+    // The optional burst length shifts command and address by one token
+    std::size_t addressToken = (numberOfTokens > 1 && tokens[1].front() == '(') ? 3 : 2;
+    if (addressToken >= numberOfTokens)
+        SC_REPORT_FATAL("MappingExplorer",
+                        ("Malformed trace file line: " + std::string(line)).c_str());
+
+    std::string_view token = tokens[addressToken];
+    if (token.size() > 2 && token[0] == '0' && (token[1] == 'x' || token[1] == 'X'))
+        token.remove_prefix(2);
+
+    const char* end = token.data() + token.size();
+    auto [parsed, error] = std::from_chars(token.data(), end, address, 16);
+    if (error != std::errc() || parsed != end)
+        SC_REPORT_FATAL("MappingExplorer",
+                        ("Malformed trace file line: " + std::string(line)).c_str());
+
+    return true;
+}
+
+class CandidateEvaluator
+{
+public:
+    CandidateEvaluator(const AddressMapping& mapping,
+                       unsigned channels,
+                       unsigned stacks,
+                       unsigned banksPerChannel,
+                       unsigned conflictWindow) :
+        decoder(mapping),
+        stacks(stacks),
+        banksPerChannel(banksPerChannel),
+        conflictWindow(conflictWindow),
+        channelRequests(channels),
+        channelSequence(channels),
+        bankRequests(static_cast<std::size_t>(channels) * stacks * banksPerChannel),
+        lastAccess(bankRequests.size()),
+        lastRow(bankRequests.size())
+    {
+    }
+
+    void process(const std::vector<uint64_t>& addresses)
+    {
+        decoder.decodeBatch(addresses.data(), addresses.size(), decoded);
+
+        for (std::size_t index = 0; index < addresses.size(); index++)
+        {
+            unsigned channel = decoded.channel[index];
+            std::size_t bank =
+                (static_cast<std::size_t>(channel) * stacks + decoded.stack[index]) *
+                    banksPerChannel +
+                decoded.bank[index];
+            unsigned row = decoded.row[index];
+
+            uint64_t sequence = ++channelSequence[channel];
+            channelRequests[channel]++;
+            bankRequests[bank]++;
+
+            // lastAccess holds the channel sequence number of the last request to the bank, zero
+            // if the bank has not been accessed yet
+            if (lastAccess[bank] != 0)
+            {
+                if (lastRow[bank] == row)
+                    rowHits++;
+                else if (sequence - lastAccess[bank] <= conflictWindow)
+                    bankConflicts++;
+            }
+
+            lastAccess[bank] = sequence;
+            lastRow[bank] = row;
+        }
+
+        requests += addresses.size();
+    }
+
+    [[nodiscard]] MappingExplorer::Score score() const
+    {
+        MappingExplorer::Score score;
+        score.requests = requests;
+        if (requests == 0)
+            return score;
+
+        auto balance = [](const std::vector<uint64_t>& counts)
+        {
+            uint64_t maximum = *std::max_element(counts.begin(), counts.end());
+            uint64_t sum = std::accumulate(counts.begin(), counts.end(), uint64_t{0});
+            return static_cast<double>(sum) / static_cast<double>(counts.size()) /
+                   static_cast<double>(maximum);
+        };
+
+        score.rowHitRate = static_cast<double>(rowHits) / static_cast<double>(requests);
+        score.bankConflictRate = static_cast<double>(bankConflicts) / static_cast<double>(requests);
+        score.channelBalance = balance(channelRequests);
+        score.bankBalance = balance(bankRequests);
+        return score;
+    }
+
+private:
+    const AddressDecoder decoder;
+    DecodedAddressSoA decoded;
+
+    const unsigned stacks;
+    const unsigned banksPerChannel;
+    const unsigned conflictWindow;
+
+    std::vector<uint64_t> channelRequests;
+    std::vector<uint64_t> channelSequence;
+    std::vector<uint64_t> bankRequests;
+    std::vector<uint64_t> lastAccess;
+    std::vector<unsigned> lastRow;
+
+    uint64_t requests = 0;
+    uint64_t rowHits = 0;
+    uint64_t bankConflicts = 0;
+};
+
+} // namespace
+
+double MappingExplorer::Score::total() const
+{
+    return (rowHitRate + (1.0 - bankConflictRate) + channelBalance + bankBalance) / 4.0;
+}
+
+MappingExplorer::MappingExplorer(const DRAMSys::Config::Configuration& config,
+                                 const Options& options) :
+    options(options),
+    baseMapping(config.addressmapping)
+{
+    byteBits = countBits(baseMapping.BYTE_BIT);
+    columnBits = countBits(baseMapping.COLUMN_BIT);
+    rowBits = countBits(baseMapping.ROW_BIT);
+    bankBits = countBits(baseMapping.BANK_BIT);
+    bankGroupBits = countBits(baseMapping.BANKGROUP_BIT);
+    rankBits = countBits(baseMapping.RANK_BIT) + countBits(baseMapping.PSEUDOCHANNEL_BIT);
+    stackBits = countBits(baseMapping.STACK_BIT);
+    channelBits = countBits(baseMapping.CHANNEL_BIT);
+    pseudoChannels = baseMapping.PSEUDOCHANNEL_BIT.has_value();
+
+    unsigned addressBits = byteBits + columnBits + rowBits + bankBits + bankGroupBits +
+                           rankBits + stackBits + channelBits;
+    if (addressBits >= 64)
+        SC_REPORT_FATAL("MappingExplorer", "Address mapping exceeds 64 bits!");
+    maxAddress = (uint64_t{1} << addressBits) - 1;
+
+    // The column bits addressed by one burst always stay directly above the byte bits
+    uint64_t maxBurstLength = std::visit(
+        [](const auto& memSpec)
+        {
+            return memSpec.memarchitecturespec.maxBurstLength.value_or(
+                memSpec.memarchitecturespec.burstLength);
+        },
+        config.memspec.getVariant());
+    while ((uint64_t{1} << (burstBits + 1)) <= maxBurstLength && burstBits < columnBits)
+        burstBits++;
+}
+
+void MappingExplorer::addCandidate(std::string name, const AddressMapping& mapping)
+{
+    if (AddressDecoder(mapping).maxAddress() != maxAddress)
+    {
+        SC_REPORT_WARNING("MappingExplorer",
+                          ("Skipping candidate " + name +
+                           ", its address space differs from the base configuration")
+                              .c_str());
+        return;
+    }
+
+    candidateList.push_back({std::move(name), mapping, {}});
+}
+
+void MappingExplorer::generateCandidates()
+{
+    std::vector<Field> fields;
+    unsigned upperColumnBits = columnBits - burstBits;
+    if (upperColumnBits > 1)
+    {
+        fields.push_back(Field::ColumnLow);
+        fields.push_back(Field::ColumnHigh);
+    }
+    else if (upperColumnBits == 1)
+    {
+        fields.push_back(Field::ColumnLow);
+    }
+
+    auto addField = [&fields](Field field, unsigned bits)
+    {
+        if (bits > 0)
+            fields.push_back(field);
+    };
+    addField(Field::Row, rowBits);
+    addField(Field::Bank, bankBits);
+    addField(Field::BankGroup, bankGroupBits);
+    addField(Field::Rank, rankBits);
+    addField(Field::Stack, stackBits);
+    addField(Field::Channel, channelBits);
+
+    unsigned xorVariants = (channelBits > 0) ? 3 : 2;
+
+    // The two column halves are only generated in ascending order, the other order is
+    // equivalent for the scoring
+    std::vector<std::pair<std::vector<unsigned>, unsigned>> variants;
+    std::vector<unsigned> order(fields.size());
+    std::iota(order.begin(), order.end(), 0);
+    do
+    {
+        if (fields.size() > 1 && fields[1] == Field::ColumnHigh)
+        {
+            auto low = std::find(order.begin(), order.end(), 0);
+            auto high = std::find(order.begin(), order.end(), 1);
+            if (high < low)
+                continue;
+        }
+
+        for (unsigned variant = 0; variant < xorVariants; variant++)
+            variants.emplace_back(order, variant);
+    } while (std::next_permutation(order.begin(), order.end()));
+
+    // A fixed seed keeps the selection reproducible between runs
+    if (variants.size() > options.maxCandidates)
+    {
+        std::mt19937_64 generator(0);
+        std::shuffle(variants.begin(), variants.end(), generator);
+        variants.resize(options.maxCandidates);
+    }
+
+    for (const auto& [fieldIndices, variant] : variants)
+    {
+        std::vector<unsigned> fieldOrder;
+        for (unsigned index : fieldIndices)
+            fieldOrder.push_back(static_cast<unsigned>(fields[index]));
+
+        static constexpr std::array<std::string_view, 8> fieldNames = {
+            "CO", "CO", "RO", "BA", "BG", "RA", "SID", "CH"};
+        std::string name;
+        for (auto field = fieldOrder.rbegin(); field != fieldOrder.rend(); ++field)
+        {
+            if (!name.empty())
+                name += '-';
+            name += (*field == static_cast<unsigned>(Field::Rank) && pseudoChannels)
+                        ? "PC"
+                        : fieldNames.at(*field);
+        }
+        if (variant == 1)
+            name += "_xorbank";
+        else if (variant == 2)
+            name += "_xorbankchannel";
+
+        addCandidate(std::move(name), buildMapping(fieldOrder, variant >= 1, variant == 2));
+    }
+}
+
+AddressMapping MappingExplorer::buildMapping(const std::vector<unsigned>& fieldOrder,
+                                             bool bankXor,
+                                             bool channelXor) const
+{
+    std::vector<unsigned> byte;
+    std::vector<unsigned> column;
+    std::vector<unsigned> row;
+    std::vector<unsigned> bank;
+    std::vector<unsigned> bankGroup;
+    std::vector<unsigned> rank;
+    std::vector<unsigned> stack;
+    std::vector<unsigned> channel;
+
+    unsigned upperColumnBits = columnBits - burstBits;
+    unsigned lowColumnBits = (upperColumnBits > 1) ? upperColumnBits / 2 : upperColumnBits;
+
+    unsigned bit = 0;
+    auto assign = [&bit](std::vector<unsigned>& bits, unsigned count)
+    {
+        for (unsigned index = 0; index < count; index++)
+            bits.push_back(bit++);
+    };
+
+    assign(byte, byteBits);
+    assign(column, burstBits);
+    for (unsigned field : fieldOrder)
+    {
+        switch (static_cast<Field>(field))
+        {
+        case Field::ColumnLow:
+            assign(column, lowColumnBits);
+            break;
+        case Field::ColumnHigh:
+            assign(column, upperColumnBits - lowColumnBits);
+            break;
+        case Field::Row:
+            assign(row, rowBits);
+            break;
+        case Field::Bank:
+            assign(bank, bankBits);
+            break;
+        case Field::BankGroup:
+            assign(bankGroup, bankGroupBits);
+            break;
+        case Field::Rank:
+            assign(rank, rankBits);
+            break;
+        case Field::Stack:
+            assign(stack, stackBits);
+            break;
+        case Field::Channel:
+            assign(channel, channelBits);
+            break;
+        }
+    }
+
+    AddressMapping mapping;
+    mapping.BYTE_BIT = toBitEntries(byte);
+    mapping.COLUMN_BIT = toBitEntries(column);
+    mapping.ROW_BIT = toBitEntries(row);
+    mapping.BANK_BIT = toBitEntries(bank);
+    mapping.BANKGROUP_BIT = toBitEntries(bankGroup);
+    mapping.STACK_BIT = toBitEntries(stack);
+    mapping.CHANNEL_BIT = toBitEntries(channel);
+    if (pseudoChannels)
+        mapping.PSEUDOCHANNEL_BIT = toBitEntries(rank);
+    else
+        mapping.RANK_BIT = toBitEntries(rank);
+
+    // XOR hashing: the bank group, bank and optionally channel bits are combined with the row
+    // bits from the lowest one upwards, so that row strides are spread over banks and channels
+    std::size_t nextRowBit = 0;
+    auto hash = [&row, &nextRowBit](std::optional<std::vector<AddressMapping::BitEntry>>& bits)
+    {
+        if (!bits.has_value())
+            return;
+
+        for (auto& entry : *bits)
+        {
+            if (nextRowBit == row.size())
+                return;
+
+            entry = AddressMapping::BitEntry(
+                AddressMapping::BitEntry::Type::ARRAY, entry.at(0), row[nextRowBit++]);
+        }
+    };
+
+    if (bankXor)
+    {
+        hash(mapping.BANKGROUP_BIT);
+        hash(mapping.BANK_BIT);
+    }
+    if (channelXor)
+        hash(mapping.CHANNEL_BIT);
+
+    return mapping;
+}
+
+void MappingExplorer::evaluate(const std::filesystem::path& tracePath)
+{
+    std::ifstream traceFile(tracePath);
+    if (!traceFile.is_open())
+        SC_REPORT_FATAL("MappingExplorer",
+                        ("Could not open trace " + tracePath.string()).c_str());
+
+    unsigned channels = 1U << channelBits;
+    unsigned stacks = 1U << stackBits;
+    unsigned banksPerChannel = 1U << (rankBits + bankGroupBits + bankBits);
+
+    std::vector<std::unique_ptr<CandidateEvaluator>> evaluators;
+    evaluators.reserve(candidateList.size());
+    for (const auto& candidate : candidateList)
+    {
+        evaluators.emplace_back(std::make_unique<CandidateEvaluator>(
+            candidate.mapping, channels, stacks, banksPerChannel, options.conflictWindow));
+    }
+
+    // The next chunk is parsed while the worker threads evaluate the current one
+    constexpr std::size_t chunkSize = 1 << 16;
+    std::array<std::vector<uint64_t>, 2> chunks;
+    uint64_t wrappedAddresses = 0;
+
+    auto readChunk = [&traceFile, &wrappedAddresses, this](std::vector<uint64_t>& chunk)
+    {
+        chunk.clear();
+        std::string line;
+        while (chunk.size() < chunkSize && std::getline(traceFile, line))
+        {
+            uint64_t address = 0;
+            if (!parseAddress(line, address))
+                continue;
+
+            if (address > maxAddress)
+                wrappedAddresses++;
+            chunk.push_back(address & maxAddress);
+        }
+    };
+
+    unsigned numberOfThreads =
+        std::max(1U, std::min<unsigned>(options.threads, evaluators.size()));
+
+    readChunk(chunks[0]);
+    for (unsigned current = 0; !chunks[current].empty(); current ^= 1U)
+    {
+        std::vector<std::thread> workers;
+        for (unsigned thread = 0; thread < numberOfThreads; thread++)
+        {
+            workers.emplace_back(
+                [&, thread]()
+                {
+                    for (std::size_t index = thread; index < evaluators.size();
+                         index += numberOfThreads)
+                        evaluators[index]->process(chunks[current]);
+                });
+        }
+
+        readChunk(chunks[current ^ 1U]);
+
+        for (auto& worker : workers)
+            worker.join();
+    }
+
+    if (wrappedAddresses > 0)
+    {
+        SC_REPORT_WARNING("MappingExplorer",
+                          (std::to_string(wrappedAddresses) +
+                           " trace addresses exceed the address space and were wrapped")
+                              .c_str());
+    }
+
+    for (std::size_t index = 0; index < candidateList.size(); index++)
+        candidateList[index].score = evaluators[index]->score();
+
+    std::stable_sort(candidateList.begin(),
+                     candidateList.end(),
+                     [](const Candidate& a, const Candidate& b)
+                     { return a.score.total() > b.score.total(); });
+}
+
+void MappingExplorer::report(std::ostream& stream, std::size_t top) const
+{
+    if (candidateList.empty())
+        return;
+
+    stream << "Evaluated " << candidateList.size() << " mappings with "
+           << candidateList.front().score.requests << " requests" << std::endl;
+    stream << std::left << std::setw(6) << "Rank" << std::setw(40) << "Mapping" << std::right
+           << std::setw(8) << "Score" << std::setw(10) << "RowHit" << std::setw(10)
+           << "Conflict" << std::setw(10) << "ChBal" << std::setw(10) << "BankBal" << std::endl;
+
+    stream << std::fixed << std::setprecision(4);
+    for (std::size_t index = 0; index < std::min(top, candidateList.size()); index++)
+    {
+        const Candidate& candidate = candidateList[index];
+        stream << std::left << std::setw(6) << index + 1 << std::setw(40) << candidate.name
+               << std::right << std::setw(8) << candidate.score.total() << std::setw(10)
+               << candidate.score.rowHitRate << std::setw(10) << candidate.score.bankConflictRate
+               << std::setw(10) << candidate.score.channelBalance << std::setw(10)
+               << candidate.score.bankBalance << std::endl;
+    }
+    stream << std::defaultfloat;
+}
+
+void MappingExplorer::exportMappings(const std::filesystem::path& directory,
+                                     std::size_t top) const
+{
+    std::filesystem::create_directories(directory);
+
+    for (std::size_t index = 0; index < std::min(top, candidateList.size()); index++)
+    {
+        const Candidate& candidate = candidateList[index];
+        std::filesystem::path path =
+            directory / ("am_explore_" + std::to_string(index + 1) + "_" + candidate.name + ".json");
+
+        nlohmann::json json;
+        json[std::string(AddressMapping::KEY)] = candidate.mapping;
+
+        std::ofstream file(path);
+        file << json.dump(4) << std::endl;
+    }
+}
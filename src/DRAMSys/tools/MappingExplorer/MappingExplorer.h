@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef MAPPINGEXPLORER_H
+#define MAPPINGEXPLORER_H
+
+#include <DRAMSys/config/DRAMSysConfiguration.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ * Scores candidate address mappings against a trace without simulating it. Every candidate is
+ * decoded with the AddressDecoder of DRAMSys and rated by its channel and bank balance, its
+ * row-hit rate and its bank-conflict rate. The rates assume one open row per bank and are
+ * therefore only an approximation of the scheduling in the memory controller.
+ */
+class MappingExplorer
+{
+public:
+    struct Options
+    {
+        unsigned threads = 1;
+        // Number of requests on a channel within which a row miss counts as bank conflict
+        unsigned conflictWindow = 16;
+        std::size_t maxCandidates = 2000;
+    };
+
+    struct Score
+    {
+        uint64_t requests = 0;
+        double rowHitRate = 0.0;
+        double bankConflictRate = 0.0;
+        double channelBalance = 0.0;
+        double bankBalance = 0.0;
+
+        [[nodiscard]] double total() const;
+    };
+
+    struct Candidate
+    {
+        std::string name;
+        DRAMSys::Config::AddressMapping mapping;
+        Score score;
+    };
+
+    MappingExplorer(const DRAMSys::Config::Configuration& config, const Options& options);
+
+    // Permutations of the fields above the burst, each with and without XOR bank hashing
+    void generateCandidates();
+    void addCandidate(std::string name, const DRAMSys::Config::AddressMapping& mapping);
+
+    // Streams the trace once and scores all candidates, best candidate first
+    void evaluate(const std::filesystem::path& tracePath);
+
+    void report(std::ostream& stream, std::size_t top) const;
+    void exportMappings(const std::filesystem::path& directory, std::size_t top) const;
+
+    [[nodiscard]] const std::vector<Candidate>& candidates() const { return candidateList; }
+
+private:
+    const Options options;
+    const DRAMSys::Config::AddressMapping baseMapping;
+
+    unsigned byteBits = 0;
+    unsigned burstBits = 0;
+    unsigned columnBits = 0;
+    unsigned rowBits = 0;
+    unsigned bankBits = 0;
+    unsigned bankGroupBits = 0;
+    unsigned rankBits = 0;
+    unsigned stackBits = 0;
+    unsigned channelBits = 0;
+    bool pseudoChannels = false;
+    uint64_t maxAddress = 0;
+
+    std::vector<Candidate> candidateList;
+
+    [[nodiscard]] DRAMSys::Config::AddressMapping
+    buildMapping(const std::vector<unsigned>& fieldOrder, bool bankXor, bool channelXor) const;
+};
+
+#endif // MAPPINGEXPLORER_H
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "MappingExplorer.h"
+
+#include <DRAMSys/config/DRAMSysConfiguration.h>
+
+#include <charconv>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <systemc>
+#include <thread>
+
+namespace
+{
+
+void usage()
+{
+    std::cout << "Usage: MappingExplorer <base config> <trace> [options]\n"
+                 "  --threads <n>          Number of worker threads (default: all cores)\n"
+                 "  --window <n>           Bank conflict window in requests per channel "
+                 "(default: 16)\n"
+                 "  --max-candidates <n>   Maximum number of generated mappings (default: 2000)\n"
+                 "  --mapping <file>       Additionally evaluate this address mapping, can be "
+                 "repeated\n"
+                 "  --top <n>              Number of reported and exported mappings "
+                 "(default: 10)\n"
+                 "  --output <directory>   Export directory of the best mappings (default: .)\n";
+}
+
+template <typename T> T parseNumber(const std::string& option, const std::string& value)
+{
+    T number = 0;
+    const char* end = value.data() + value.size();
+    auto [parsed, error] = std::from_chars(value.data(), end, number);
+    if (error != std::errc() || parsed != end)
+        SC_REPORT_FATAL("MappingExplorer", ("Invalid value of " + option + ": " + value).c_str());
+
+    return number;
+}
+
+} // namespace
+
+int sc_main(int argc, char** argv)
+{
+    if (argc < 3)
+    {
+        usage();
+        return 1;
+    }
+
+    std::filesystem::path baseConfig = argv[1];
+    std::filesystem::path tracePath = argv[2];
+
+    MappingExplorer::Options options;
+    options.threads = std::max(1U, std::thread::hardware_concurrency());
+    std::vector<std::filesystem::path> mappingPaths;
+    std::size_t top = 10;
+    std::filesystem::path outputDirectory = ".";
+
+    for (int index = 3; index < argc; index++)
+    {
+        std::string argument = argv[index];
+        if (index + 1 >= argc)
+        {
+            usage();
+            return 1;
+        }
+
+        std::string value = argv[++index];
+        if (argument == "--threads")
+            options.threads = std::max(1U, parseNumber<unsigned>(argument, value));
+        else if (argument == "--window")
+            options.conflictWindow = parseNumber<unsigned>(argument, value);
+        else if (argument == "--max-candidates")
+            options.maxCandidates = parseNumber<std::size_t>(argument, value);
+        else if (argument == "--mapping")
+            mappingPaths.emplace_back(value);
+        else if (argument == "--top")
+            top = parseNumber<std::size_t>(argument, value);
+        else if (argument == "--output")
+            outputDirectory = value;
+        else
+        {
+            usage();
+            return 1;
+        }
+    }
+
+    DRAMSys::Config::Configuration configuration = DRAMSys::Config::from_path(baseConfig);
+
+    MappingExplorer explorer(configuration, options);
+    explorer.addCandidate("base", configuration.addressmapping);
+    for (const auto& mappingPath : mappingPaths)
+    {
+        std::ifstream file(mappingPath);
+        nlohmann::json json = nlohmann::json::parse(file);
+        explorer.addCandidate(
+            mappingPath.stem().string(),
+            json.at(std::string(DRAMSys::Config::AddressMapping::KEY))
+                .get<DRAMSys::Config::AddressMapping>());
+    }
+    explorer.generateCandidates();
+
+    explorer.evaluate(tracePath);
+    explorer.report(std::cout, top);
+    explorer.exportMappings(outputDirectory, top);
+
+    return 0;
+}
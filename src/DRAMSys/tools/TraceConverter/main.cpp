@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <DRAMSys/common/ColumnarTraceReader.h>
+#include <DRAMSys/common/SqliteRecorderBackend.h>
+
+#include <filesystem>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <systemc>
+
+int sc_main(int argc, char** argv)
+{
+    if (argc < 2 || argc > 3)
+    {
+        std::cout << "Usage: TraceConverter <columnar trace> [trace database]\n"
+                     "  Converts a .tcb file of the columnar recording format into a .tdb trace "
+                     "database.\n"
+                     "  The database is named after the input file by default.\n";
+        return 1;
+    }
+
+    std::filesystem::path input = argv[1];
+    std::filesystem::path output = input;
+    if (argc == 3)
+        output = argv[2];
+    else
+        output.replace_extension(".tdb");
+
+    try
+    {
+        DRAMSys::ColumnarTraceReader reader(input.string());
+        DRAMSys::SqliteRecorderBackend database(output.string(), reader.getInfo());
+        reader.replay(database);
+        database.close();
+    }
+    catch (const std::runtime_error& error)
+    {
+        std::cerr << input.string() << ": " << error.what() << std::endl;
+        return 1;
+    }
+
+    std::cout << "Converted " << input.string() << " to " << output.string() << std::endl;
+    return 0;
+}
@@ -0,0 +1,96 @@
+#include "DRAMSys/common/utils.h"
+
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace DRAMSys;
+
+namespace {
+
+bool expect(bool condition, const char* what) {
+    if (!condition)
+        std::cerr << what << '\n';
+    return condition;
+}
+
+// Reference copy with the byte enable index taken modulo the byte enable length
+void referenceCopy(unsigned char* destination,
+                   const unsigned char* source,
+                   std::size_t length,
+                   const unsigned char* byteEnable,
+                   std::size_t byteEnableLength,
+                   std::size_t byteEnableOffset) {
+    for (std::size_t i = 0; i < length; ++i) {
+        if (byteEnable[(byteEnableOffset + i) % byteEnableLength] == TLM_BYTE_ENABLED)
+            destination[i] = source[i];
+    }
+}
+
+bool test_against_reference(std::size_t byteEnableLength) {
+    // Guard bytes around the destination catch writes outside of it
+    constexpr std::size_t guard = 64;
+    std::mt19937 rng(static_cast<unsigned>(byteEnableLength));
+    std::vector<unsigned char> byteEnable(byteEnableLength);
+    std::vector<unsigned char> source(1024 + guard);
+    std::vector<unsigned char> expected(1024 + 2 * guard);
+    std::vector<unsigned char> actual(1024 + 2 * guard);
+
+    for (unsigned iteration = 0; iteration < 2000; ++iteration) {
+        // Mostly random patterns, some all enabled and some all disabled
+        unsigned kind = rng() % 8;
+        for (auto& enable : byteEnable) {
+            bool enabled = kind == 0 ? true : kind == 1 ? false : rng() % 2 == 0;
+            enable = enabled ? TLM_BYTE_ENABLED : TLM_BYTE_DISABLED;
+        }
+        for (auto& byte : source)
+            byte = static_cast<unsigned char>(rng());
+        for (std::size_t i = 0; i < expected.size(); ++i)
+            expected[i] = actual[i] = static_cast<unsigned char>(rng());
+
+        std::size_t length = rng() % (iteration % 4 == 0 ? 1024 : 130);
+        std::size_t sourceOffset = rng() % guard;
+        std::size_t destinationOffset = guard + rng() % guard;
+        std::size_t byteEnableOffset = rng() % (3 * byteEnableLength);
+
+        const std::vector<unsigned char> before = actual;
+        referenceCopy(expected.data() + destinationOffset,
+                      source.data() + sourceOffset,
+                      length,
+                      byteEnable.data(),
+                      byteEnableLength,
+                      byteEnableOffset);
+        maskedCopy(actual.data() + destinationOffset,
+                   source.data() + sourceOffset,
+                   length,
+                   byteEnable.data(),
+                   byteEnableLength,
+                   byteEnableOffset);
+
+        if (!expect(actual == expected, "masked copy differs from the reference"))
+            return false;
+
+        for (std::size_t i = 0; i < actual.size(); ++i) {
+            bool inside = i >= destinationOffset && i < destinationOffset + length;
+            bool enabled = inside && byteEnable[(byteEnableOffset + i - destinationOffset) %
+                                                byteEnableLength] == TLM_BYTE_ENABLED;
+            if (!enabled && !expect(actual[i] == before[i], "disabled byte was changed"))
+                return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int main() {
+    for (std::size_t byteEnableLength : {1, 2, 3, 4, 8, 31, 32, 33, 64, 100}) {
+        if (!test_against_reference(byteEnableLength)) {
+            std::cerr << "byte enable length " << byteEnableLength << '\n';
+            return 1;
+        }
+    }
+
+    std::cout << "Masked copy tests passed" << '\n';
+    return 0;
+}
@@ -0,0 +1,180 @@
+#include "DRAMSys/common/StreamMetricsSink.h"
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using namespace DRAMSys;
+
+namespace {
+
+std::vector<MetricsRecord> make_records() {
+    std::vector<MetricsRecord> records;
+
+    MetricsRecord busy;
+    busy.channel = 1;
+    busy.time = 1e-6;
+    busy.bandwidth = 12345678.5;
+    busy.queueDepth = 2.75;
+    busy.rowHitRate = 0.625;
+    for (std::size_t bin = 0; bin < MetricsRecord::latencyBins; ++bin)
+        busy.latencyHistogram[bin] = static_cast<uint32_t>(bin * bin + 1);
+    records.push_back(busy);
+
+    // A window without column commands has no row hit rate
+    MetricsRecord idle;
+    idle.channel = 0;
+    idle.time = 2e-6;
+    records.push_back(idle);
+
+    MetricsRecord power;
+    power.type = MetricsRecord::Type::Power;
+    power.channel = 1;
+    power.time = 2e-6;
+    power.power = 0.123456789;
+    records.push_back(power);
+
+    return records;
+}
+
+void publish(const std::string& output, Config::MetricsExportType format) {
+    StreamMetricsSink sink(output, format);
+    for (const MetricsRecord& record : make_records())
+        sink.publish(record);
+    sink.close();
+}
+
+bool same(double expected, double actual) {
+    return std::isnan(expected) ? std::isnan(actual) : expected == actual;
+}
+
+bool check(bool condition, const std::string& what) {
+    if (!condition)
+        std::cerr << what << '\n';
+    return condition;
+}
+
+bool test_csv(const std::filesystem::path& path) {
+    publish(path.string(), Config::MetricsExportType::CSV);
+
+    std::ifstream file(path);
+    std::string line;
+    if (!check(std::getline(file, line) && line == "time,channel,metric,value", "CSV header"))
+        return false;
+
+    // (time, channel, metric) -> value, an empty value is NaN
+    std::map<std::tuple<double, unsigned, std::string>, double> values;
+    while (std::getline(file, line)) {
+        std::istringstream row(line);
+        std::string time, channel, metric, value;
+        std::getline(row, time, ',');
+        std::getline(row, channel, ',');
+        std::getline(row, metric, ',');
+        std::getline(row, value);
+        double parsed = value.empty() ? std::numeric_limits<double>::quiet_NaN()
+                                      : std::strtod(value.c_str(), nullptr);
+        values[{std::strtod(time.c_str(), nullptr), static_cast<unsigned>(std::stoul(channel)),
+                metric}] = parsed;
+    }
+
+    std::size_t expectedRows = 0;
+    for (const MetricsRecord& record : make_records()) {
+        std::map<std::string, double> expected;
+        if (record.type == MetricsRecord::Type::Power) {
+            expected["power"] = record.power;
+        } else {
+            expected["bandwidth"] = record.bandwidth;
+            expected["row_hit_rate"] = record.rowHitRate;
+            expected["queue_depth"] = record.queueDepth;
+            for (std::size_t bin = 0; bin < MetricsRecord::latencyBins; ++bin) {
+                std::string lower = std::to_string(bin == 0 ? 0 : UINT64_C(1) << bin);
+                expected["latency_" + lower + "ns"] = record.latencyHistogram[bin];
+            }
+        }
+
+        for (const auto& [metric, value] : expected) {
+            auto it = values.find({record.time, record.channel, metric});
+            if (!check(it != values.end() && same(value, it->second),
+                       "CSV value of " + metric + " on channel " +
+                           std::to_string(record.channel)))
+                return false;
+        }
+        expectedRows += expected.size();
+    }
+    return check(values.size() == expectedRows, "number of CSV rows");
+}
+
+bool test_json_lines(const std::filesystem::path& path) {
+    publish(path.string(), Config::MetricsExportType::JSONLines);
+
+    std::ifstream file(path);
+    std::vector<nlohmann::json> lines;
+    std::string line;
+    while (std::getline(file, line))
+        lines.push_back(nlohmann::json::parse(line));
+
+    std::vector<MetricsRecord> records = make_records();
+    if (!check(lines.size() == records.size(), "number of JSON lines"))
+        return false;
+
+    for (std::size_t i = 0; i < records.size(); ++i) {
+        const MetricsRecord& record = records[i];
+        const nlohmann::json& object = lines[i];
+        if (!check(object.at("time").get<double>() == record.time &&
+                       object.at("channel").get<unsigned>() == record.channel,
+                   "JSON time and channel"))
+            return false;
+
+        if (record.type == MetricsRecord::Type::Power) {
+            if (!check(object.size() == 3 && object.at("power").get<double>() == record.power,
+                       "JSON power"))
+                return false;
+            continue;
+        }
+
+        const nlohmann::json& rowHitRate = object.at("rowHitRate");
+        double parsedRowHitRate = rowHitRate.is_null() ? std::numeric_limits<double>::quiet_NaN()
+                                                       : rowHitRate.get<double>();
+        if (!check(object.at("bandwidth").get<double>() == record.bandwidth &&
+                       object.at("queueDepth").get<double>() == record.queueDepth &&
+                       same(record.rowHitRate, parsedRowHitRate),
+                   "JSON controller metrics"))
+            return false;
+
+        auto histogram = object.at("latencyHistogram").get<std::vector<uint32_t>>();
+        if (!check(histogram.size() == MetricsRecord::latencyBins &&
+                       std::equal(histogram.begin(), histogram.end(),
+                                  record.latencyHistogram.begin()),
+                   "JSON latency histogram"))
+            return false;
+    }
+    return true;
+}
+
+} // namespace
+
+int main() {
+    std::filesystem::path directory = std::filesystem::temp_directory_path();
+    std::filesystem::path csv = directory / "dramsys_metrics_sink_test.csv";
+    std::filesystem::path jsonLines = directory / "dramsys_metrics_sink_test.jsonl";
+
+    bool passed = test_csv(csv) && test_json_lines(jsonLines);
+    std::filesystem::remove(csv);
+    std::filesystem::remove(jsonLines);
+    if (!passed)
+        return 1;
+
+    std::cout << "StreamMetricsSink tests passed" << '\n';
+    return 0;
+}
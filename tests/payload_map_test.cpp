@@ -0,0 +1,145 @@
+#include "DRAMSys/common/PayloadMap.h"
+
+#include <iostream>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+using namespace DRAMSys;
+
+namespace {
+
+bool expect(bool condition, const char* what) {
+    if (!condition)
+        std::cerr << what << '\n';
+    return condition;
+}
+
+bool test_insert_and_erase() {
+    std::vector<tlm::tlm_generic_payload> payloads(3);
+    PayloadMap<int> map;
+
+    if (!expect(map.empty() && map.find(&payloads[0]) == nullptr, "new map is empty"))
+        return false;
+
+    auto [first, inserted] = map.emplace(&payloads[0]);
+    first = 10;
+    map.emplace(&payloads[1]).first = 11;
+    if (!expect(inserted && map.size() == 2, "insert") ||
+        !expect(map.at(&payloads[0]) == 10 && *map.find(&payloads[1]) == 11, "lookup") ||
+        !expect(map.find(&payloads[2]) == nullptr, "lookup of a missing payload"))
+        return false;
+
+    // A second emplace returns the existing value
+    auto [again, insertedAgain] = map.emplace(&payloads[0]);
+    if (!expect(!insertedAgain && again == 10 && map.size() == 2, "duplicate insert"))
+        return false;
+
+    map.erase(&payloads[0]);
+    map.erase(&payloads[2]); // not in the map
+    return expect(map.size() == 1 && map.find(&payloads[0]) == nullptr &&
+                      map.at(&payloads[1]) == 11,
+                  "erase");
+}
+
+bool test_value_reuse() {
+    // Erased values stay in the pool and are handed out again with their state
+    std::vector<tlm::tlm_generic_payload> payloads(2);
+    PayloadMap<std::vector<int>> map;
+
+    std::vector<int>& value = map.emplace(&payloads[0]).first;
+    value.reserve(100);
+    value.push_back(1);
+    const std::vector<int>* address = &value;
+    map.erase(&payloads[0]);
+
+    auto [reused, inserted] = map.emplace(&payloads[1]);
+    return expect(inserted && &reused == address && reused.capacity() >= 100 &&
+                      reused.size() == 1,
+                  "reuse of an erased value");
+}
+
+bool test_growth() {
+    // Consecutive payloads like those of a memory manager, far more than the initial table
+    constexpr unsigned count = 5000;
+    std::vector<tlm::tlm_generic_payload> payloads(count);
+    PayloadMap<unsigned> map;
+
+    for (unsigned i = 0; i < count; ++i)
+        map.emplace(&payloads[i]).first = i;
+
+    if (!expect(map.size() == count, "size after growth"))
+        return false;
+    for (unsigned i = 0; i < count; ++i) {
+        if (!expect(map.find(&payloads[i]) != nullptr && map.at(&payloads[i]) == i,
+                    "lookup after growth"))
+            return false;
+    }
+
+    std::vector<unsigned> visits(count, 0);
+    map.forEach([&](tlm::tlm_generic_payload* payload, unsigned& value) {
+        visits[value]++;
+        if (payload != &payloads[value])
+            visits[value] += count;
+    });
+    for (unsigned visit : visits) {
+        if (!expect(visit == 1, "forEach visits every entry once"))
+            return false;
+    }
+    return true;
+}
+
+bool test_churn() {
+    // Random inserts and erases against a reference map, erasing inside probe sequences must
+    // keep the following entries reachable
+    constexpr unsigned count = 256;
+    std::vector<tlm::tlm_generic_payload> payloads(count);
+    PayloadMap<unsigned> map;
+    std::unordered_map<const tlm::tlm_generic_payload*, unsigned> reference;
+    std::mt19937 rng(3);
+
+    for (unsigned step = 0; step < 100000; ++step) {
+        unsigned index = rng() % count;
+        tlm::tlm_generic_payload* payload = &payloads[index];
+        if (rng() % 2 == 0) {
+            auto [value, inserted] = map.emplace(payload);
+            if (!expect(inserted == (reference.count(payload) == 0), "emplace result"))
+                return false;
+            value = step;
+            reference[payload] = step;
+        } else {
+            map.erase(payload);
+            reference.erase(payload);
+        }
+
+        if (step % 61 == 0) {
+            if (!expect(map.size() == reference.size(), "size during churn"))
+                return false;
+            for (unsigned i = 0; i < count; ++i) {
+                auto it = reference.find(&payloads[i]);
+                unsigned* value = map.find(&payloads[i]);
+                if (!expect((it == reference.end()) == (value == nullptr) &&
+                                (value == nullptr || *value == it->second),
+                            "lookup during churn"))
+                    return false;
+            }
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int main() {
+    if (!test_insert_and_erase())
+        return 1;
+    if (!test_value_reuse())
+        return 1;
+    if (!test_growth())
+        return 1;
+    if (!test_churn())
+        return 1;
+
+    std::cout << "PayloadMap tests passed" << '\n';
+    return 0;
+}
@@ -0,0 +1,159 @@
+#include "DRAMSys/common/dramExtensions.h"
+#include "DRAMSys/controller/scheduler/RowIndexedBuffer.h"
+
+#include <algorithm>
+#include <array>
+#include <deque>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace DRAMSys;
+
+namespace {
+
+// Auto extensions require a memory manager, the payloads are owned by the test
+class TestMemoryManager : public tlm::tlm_mm_interface {
+public:
+    void free(tlm::tlm_generic_payload*) override {}
+} memory_manager;
+
+std::unique_ptr<tlm::tlm_generic_payload> make_payload(Bank bank, Row row) {
+    auto payload = std::make_unique<tlm::tlm_generic_payload>(&memory_manager);
+    ControllerExtension::setAutoExtension(*payload, 0, Rank(0), Stack(0), BankGroup(0), bank, row,
+                                          Column(0), 8);
+    return payload;
+}
+
+// Compares the buffer against the payloads in arrival order
+bool check_buffer(const RowIndexedBuffer& buffer,
+                  const std::deque<tlm::tlm_generic_payload*>& expected,
+                  unsigned num_rows, const char* step) {
+    if (buffer.size() != expected.size() || buffer.empty() != expected.empty()) {
+        std::cerr << step << ": size " << buffer.size() << " expected " << expected.size()
+                  << '\n';
+        return false;
+    }
+    if (buffer.front() != (expected.empty() ? nullptr : expected.front())) {
+        std::cerr << step << ": wrong front" << '\n';
+        return false;
+    }
+
+    for (unsigned row_id = 0; row_id < num_rows; ++row_id) {
+        auto row = Row(row_id);
+        std::vector<tlm::tlm_generic_payload*> hits;
+        std::copy_if(expected.begin(), expected.end(), std::back_inserter(hits),
+                     [row](tlm::tlm_generic_payload* payload) {
+                         return ControllerExtension::getRow(*payload) == row;
+                     });
+
+        std::vector<tlm::tlm_generic_payload*> actual(buffer.rowHits(row).begin(),
+                                                      buffer.rowHits(row).end());
+        tlm::tlm_generic_payload* front_hit = hits.empty() ? nullptr : hits.front();
+        if (buffer.numRowHits(row) != hits.size() || buffer.frontRowHit(row) != front_hit ||
+            buffer.rowHits(row).empty() != hits.empty() || actual != hits) {
+            std::cerr << step << ": row " << row_id << " has " << buffer.numRowHits(row)
+                      << " hits, expected " << hits.size() << '\n';
+            return false;
+        }
+    }
+    return true;
+}
+
+bool test_row_grouping() {
+    constexpr unsigned num_rows = 4;
+    std::vector<std::unique_ptr<tlm::tlm_generic_payload>> payloads;
+    std::deque<tlm::tlm_generic_payload*> expected;
+    RowIndexedBuffer buffer;
+
+    for (unsigned row : {2U, 0U, 2U, 3U, 2U, 0U}) {
+        payloads.push_back(make_payload(Bank(0), Row(row)));
+        buffer.push_back(payloads.back().get());
+        expected.push_back(payloads.back().get());
+    }
+    if (!check_buffer(buffer, expected, num_rows, "grouping"))
+        return false;
+
+    // Removing the oldest row hit moves the front of the row and of the buffer
+    buffer.remove(payloads[0].get());
+    expected.erase(expected.begin());
+    if (!check_buffer(buffer, expected, num_rows, "remove front"))
+        return false;
+
+    // Removing from the middle of a row keeps the order of the remaining hits
+    buffer.remove(payloads[2].get());
+    expected.erase(std::find(expected.begin(), expected.end(), payloads[2].get()));
+    if (!check_buffer(buffer, expected, num_rows, "remove middle"))
+        return false;
+
+    // Unknown payloads are ignored
+    auto unknown = make_payload(Bank(0), Row(1));
+    buffer.remove(unknown.get());
+    return check_buffer(buffer, expected, num_rows, "remove unknown");
+}
+
+bool test_bank_and_row_churn() {
+    // Enough rows to grow the row table several times and to force collisions on removal
+    constexpr unsigned num_banks = 4;
+    constexpr unsigned num_rows = 200;
+    constexpr unsigned num_steps = 20000;
+
+    std::mt19937 rng(7);
+    std::vector<std::unique_ptr<tlm::tlm_generic_payload>> payloads;
+    std::array<RowIndexedBuffer, num_banks> buffers;
+    std::array<std::deque<tlm::tlm_generic_payload*>, num_banks> expected;
+
+    for (unsigned step = 0; step < num_steps; ++step) {
+        unsigned bank = rng() % num_banks;
+        auto& queue = expected[bank];
+        // Alternate between phases of filling and draining the buffers
+        bool fill = (step / 2000) % 2 == 0 ? rng() % 4 != 0 : rng() % 4 == 0;
+
+        if (fill || queue.empty()) {
+            // Few hot rows and a long tail of rows that are touched rarely
+            unsigned row = rng() % 2 == 0 ? rng() % 4 : rng() % num_rows;
+            payloads.push_back(make_payload(Bank(bank), Row(row)));
+            buffers[bank].push_back(payloads.back().get());
+            queue.push_back(payloads.back().get());
+        } else {
+            // Mostly the oldest row hit like the schedulers, sometimes an arbitrary payload
+            auto victim = queue.begin() + static_cast<std::ptrdiff_t>(rng() % queue.size());
+            if (rng() % 2 == 0)
+                victim = std::find(queue.begin(), queue.end(),
+                                   buffers[bank].frontRowHit(ControllerExtension::getRow(**victim)));
+            buffers[bank].remove(*victim);
+            queue.erase(victim);
+        }
+
+        if (step % 97 == 0 || step == num_steps - 1) {
+            for (unsigned b = 0; b < num_banks; ++b) {
+                if (!check_buffer(buffers[b], expected[b], num_rows, "churn"))
+                    return false;
+            }
+        }
+    }
+
+    // Drain everything, the buffers must end up empty with no row left behind
+    for (unsigned bank = 0; bank < num_banks; ++bank) {
+        while (!expected[bank].empty()) {
+            buffers[bank].remove(expected[bank].back());
+            expected[bank].pop_back();
+        }
+        if (!check_buffer(buffers[bank], expected[bank], num_rows, "drain"))
+            return false;
+    }
+    return true;
+}
+
+} // namespace
+
+int main() {
+    if (!test_row_grouping())
+        return 1;
+    if (!test_bank_and_row_churn())
+        return 1;
+
+    std::cout << "RowIndexedBuffer tests passed" << '\n';
+    return 0;
+}
@@ -0,0 +1,156 @@
+#include "DRAMSys/simulation/SparseMemory.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <vector>
+
+using namespace DRAMSys;
+
+namespace {
+
+constexpr uint64_t memory_size = 8 * 1024 * 1024;
+constexpr uint64_t page_size = 4096;
+
+void write_bytes(SparseMemory& memory, uint64_t address, const std::vector<unsigned char>& data) {
+    std::size_t offset = 0;
+    while (offset < data.size()) {
+        std::size_t length = std::min<std::size_t>(data.size() - offset,
+                                                   memory.bytesToPageEnd(address + offset));
+        std::memcpy(memory.writePointer(address + offset), data.data() + offset, length);
+        offset += length;
+    }
+}
+
+std::vector<unsigned char> read_bytes(const SparseMemory& memory, uint64_t address,
+                                      std::size_t size) {
+    std::vector<unsigned char> data(size);
+    std::size_t offset = 0;
+    while (offset < size) {
+        std::size_t length =
+            std::min<std::size_t>(size - offset, memory.bytesToPageEnd(address + offset));
+        std::memcpy(data.data() + offset, memory.readPointer(address + offset), length);
+        offset += length;
+    }
+    return data;
+}
+
+std::vector<unsigned char> make_pattern(unsigned char base, std::size_t length) {
+    std::vector<unsigned char> data(length);
+    std::iota(data.begin(), data.end(), base);
+    return data;
+}
+
+bool expect(bool condition, const char* what) {
+    if (!condition)
+        std::cerr << what << '\n';
+    return condition;
+}
+
+bool test_snapshot_restore() {
+    SparseMemory memory(memory_size, page_size);
+
+    // Crosses the boundary of the first two pages, the last write lives in another directory
+    const uint64_t first = page_size - 100;
+    const uint64_t far = 600 * page_size + 8;
+    auto original = make_pattern(0x10, 200);
+    auto original_far = make_pattern(0x80, 64);
+    write_bytes(memory, first, original);
+    write_bytes(memory, far, original_far);
+
+    std::stringstream before;
+    memory.serialize(before);
+
+    SparseMemory::Snapshot snapshot = memory.snapshot();
+
+    // Modify a shared page, a page in a shared directory and an unallocated page
+    auto modified = make_pattern(0xC0, 50);
+    write_bytes(memory, first + 20, modified);
+    write_bytes(memory, far, make_pattern(0x01, 8));
+    write_bytes(memory, 1000 * page_size, make_pattern(0x40, 16));
+
+    auto expected = original;
+    std::copy(modified.begin(), modified.end(), expected.begin() + 20);
+    if (!expect(read_bytes(memory, first, expected.size()) == expected, "write after snapshot") ||
+        !expect(memory.allocatedPages() == 4, "allocated pages after modification"))
+        return false;
+
+    // The snapshot still holds the state at the time it was taken
+    std::stringstream from_snapshot;
+    snapshot.serialize(from_snapshot);
+    if (!expect(from_snapshot.str() == before.str(), "snapshot changed by later writes"))
+        return false;
+
+    memory.restore(snapshot);
+    if (!expect(read_bytes(memory, first, original.size()) == original, "restore shared page") ||
+        !expect(read_bytes(memory, far, original_far.size()) == original_far,
+                "restore page in shared directory") ||
+        !expect(read_bytes(memory, 1000 * page_size, 16) == std::vector<unsigned char>(16),
+                "restore unallocated page") ||
+        !expect(memory.allocatedPages() == 3, "allocated pages after restore"))
+        return false;
+
+    // Writes after a restore must not leak into the snapshot either
+    write_bytes(memory, first, make_pattern(0xF0, 10));
+    memory.restore(snapshot);
+    return expect(read_bytes(memory, first, original.size()) == original, "second restore");
+}
+
+bool test_serialize_deserialize() {
+    SparseMemory memory(memory_size, page_size);
+    std::mt19937 rng(11);
+
+    struct Region {
+        uint64_t address;
+        std::vector<unsigned char> data;
+    };
+    std::vector<Region> regions;
+    for (unsigned i = 0; i < 32; ++i) {
+        uint64_t address = rng() % (memory_size - 512);
+        auto data = make_pattern(static_cast<unsigned char>(rng()), 1 + rng() % 511);
+        write_bytes(memory, address, data);
+        regions.push_back({address, std::move(data)});
+    }
+
+    std::stringstream stream;
+    memory.serialize(stream);
+    if (!expect(stream.str().size() ==
+                    2 * sizeof(uint64_t) + memory.allocatedPages() * (sizeof(uint64_t) + page_size),
+                "only allocated pages are serialized"))
+        return false;
+
+    // Pages of the target that are not in the stream must not survive
+    SparseMemory restored(memory_size, page_size);
+    write_bytes(restored, memory_size - page_size, make_pattern(0x55, 32));
+    restored.deserialize(stream);
+
+    if (!expect(restored.allocatedPages() == memory.allocatedPages(), "deserialized page count") ||
+        !expect(read_bytes(restored, memory_size - page_size, 32) ==
+                    read_bytes(memory, memory_size - page_size, 32),
+                "stale page after deserialize"))
+        return false;
+
+    // Later regions may overwrite earlier ones, compare with the source memory
+    for (const Region& region : regions) {
+        if (!expect(read_bytes(restored, region.address, region.data.size()) ==
+                        read_bytes(memory, region.address, region.data.size()),
+                    "deserialized contents"))
+            return false;
+    }
+    return true;
+}
+
+} // namespace
+
+int main() {
+    if (!test_snapshot_restore())
+        return 1;
+    if (!test_serialize_deserialize())
+        return 1;
+
+    std::cout << "SparseMemory tests passed" << '\n';
+    return 0;
+}
@@ -0,0 +1,93 @@
+#include "DRAMSys/common/SpscRing.h"
+
+#include <cstdint>
+#include <iostream>
+#include <thread>
+
+using namespace DRAMSys;
+
+namespace {
+
+struct Element {
+    uint64_t value = 0;
+    uint64_t check = ~UINT64_C(0); // detects elements that are read while being written
+};
+
+bool test_full_and_empty() {
+    SpscRing<Element> ring(4);
+    Element element;
+
+    if (ring.pop(element)) {
+        std::cerr << "pop from an empty ring succeeded" << '\n';
+        return false;
+    }
+    for (uint64_t value = 0; value < 4; ++value) {
+        if (!ring.push({value, ~value})) {
+            std::cerr << "push into a ring with free space failed" << '\n';
+            return false;
+        }
+    }
+    if (ring.push({4, ~UINT64_C(4)})) {
+        std::cerr << "push into a full ring succeeded" << '\n';
+        return false;
+    }
+
+    // Wrap the indices around a few times
+    uint64_t next = 4;
+    for (uint64_t expected = 0; expected < 20; ++expected) {
+        if (!ring.pop(element) || element.value != expected) {
+            std::cerr << "pop returned " << element.value << " instead of " << expected << '\n';
+            return false;
+        }
+        if (!ring.push({next, ~next})) {
+            std::cerr << "push after pop failed" << '\n';
+            return false;
+        }
+        ++next;
+    }
+    return true;
+}
+
+bool test_two_threads() {
+    // A small ring keeps both threads running into the full and the empty case
+    constexpr uint64_t count = 2000000;
+    SpscRing<Element> ring(16);
+
+    std::thread producer([&ring] {
+        for (uint64_t value = 0; value < count; ++value) {
+            while (!ring.push({value, ~value}))
+                std::this_thread::yield();
+        }
+    });
+
+    // Keeps receiving after a mismatch, so that the producer can finish
+    bool ordered = true;
+    Element element;
+    for (uint64_t expected = 0; expected < count; ++expected) {
+        while (!ring.pop(element))
+            std::this_thread::yield();
+        if (ordered && (element.value != expected || element.check != ~expected)) {
+            std::cerr << "received " << element.value << " instead of " << expected << '\n';
+            ordered = false;
+        }
+    }
+
+    producer.join();
+    if (ordered && ring.pop(element)) {
+        std::cerr << "ring not empty after all elements were received" << '\n';
+        return false;
+    }
+    return ordered;
+}
+
+} // namespace
+
+int main() {
+    if (!test_full_and_empty())
+        return 1;
+    if (!test_two_threads())
+        return 1;
+
+    std::cout << "SpscRing tests passed" << '\n';
+    return 0;
+}